@@ -35,6 +35,9 @@ DEFINE_int32(meta_client_retry_interval_secs, 1, "meta client sleep interval bet
 DEFINE_int32(meta_client_timeout_ms, 60 * 1000, "meta client timeout");
 DEFINE_string(cluster_id_path, "cluster.id", "file path saved clusterId");
 DEFINE_int32(check_plan_killed_frequency, 8, "check plan killed every 1<<n times");
+DEFINE_int32(stats_cache_refresh_interval_secs,
+             60,
+             "interval in seconds to refresh the cached space statistics used by optimizer");
 DEFINE_uint32(failed_login_attempts,
               0,
               "how many consecutive incorrect passwords input to a SINGLE graph service node cause "
@@ -3052,6 +3055,30 @@ MetaClient::getListenersBySpaceHostFromCache(GraphSpaceID spaceId, const HostAdd
   }
 }
 
+StatusOr<std::unordered_map<HostAddr, std::vector<PartitionID>>>
+MetaClient::getListenerHostsBySpaceTypeFromCache(GraphSpaceID spaceId, cpp2::ListenerType type) {
+  memory::MemoryCheckOffGuard g;
+  if (!ready_) {
+    return Status::Error("Not ready!");
+  }
+  folly::rcu_reader guard;
+  const auto& metadata = *metadata_.load();
+  auto spaceIt = metadata.localCache_.find(spaceId);
+  if (spaceIt == metadata.localCache_.end()) {
+    VLOG(3) << "Space " << spaceId << " not found!";
+    return Status::SpaceNotFound();
+  }
+  std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts;
+  for (const auto& listener : spaceIt->second->listeners_) {
+    for (const auto& part : listener.second) {
+      if (part.second == type) {
+        hostParts[listener.first].emplace_back(part.first);
+      }
+    }
+  }
+  return hostParts;
+}
+
 StatusOr<ListenersMap> MetaClient::getListenersByHostFromCache(const HostAddr& host) {
   memory::MemoryCheckOffGuard g;
   if (!ready_) {
@@ -3441,6 +3468,51 @@ folly::Future<StatusOr<cpp2::StatsItem>> MetaClient::getStats(GraphSpaceID space
   return future;
 }
 
+StatusOr<std::shared_ptr<const cpp2::StatsItem>> MetaClient::getStatsFromCache(
+    GraphSpaceID spaceId) {
+  memory::MemoryCheckOffGuard g;
+  if (!ready_) {
+    return Status::Error("Not ready!");
+  }
+  auto now = time::WallClock::fastNowInSec();
+  std::shared_ptr<const cpp2::StatsItem> stats;
+  {
+    folly::SharedMutex::ReadHolder holder(statsCacheLock_);
+    auto iter = statsCache_.find(spaceId);
+    if (iter != statsCache_.end()) {
+      stats = iter->second.stats;
+      if (iter->second.refreshing ||
+          now - iter->second.loadTime < FLAGS_stats_cache_refresh_interval_secs) {
+        return stats;
+      }
+    }
+  }
+  {
+    folly::SharedMutex::WriteHolder holder(statsCacheLock_);
+    auto& item = statsCache_[spaceId];
+    if (item.refreshing) {
+      return stats;
+    }
+    item.refreshing = true;
+  }
+  getStats(spaceId).thenValue([this, spaceId](StatusOr<cpp2::StatsItem>&& resp) {
+    std::shared_ptr<const cpp2::StatsItem> fresh;
+    if (resp.ok() && resp.value().get_status() == cpp2::JobStatus::FINISHED) {
+      fresh = std::make_shared<const cpp2::StatsItem>(std::move(resp).value());
+    } else if (!resp.ok()) {
+      VLOG(2) << "Refresh stats of space " << spaceId << " failed: " << resp.status();
+    }
+    folly::SharedMutex::WriteHolder holder(statsCacheLock_);
+    auto& item = statsCache_[spaceId];
+    if (fresh != nullptr) {
+      item.stats = std::move(fresh);
+    }
+    item.loadTime = time::WallClock::fastNowInSec();
+    item.refreshing = false;
+  });
+  return stats;
+}
+
 folly::Future<StatusOr<nebula::cpp2::ErrorCode>> MetaClient::reportTaskFinish(
     GraphSpaceID spaceId,
     int32_t jobId,
@@ -443,6 +443,10 @@ class MetaClient : public BaseMetaClient {
   StatusOr<std::vector<std::pair<PartitionID, cpp2::ListenerType>>>
   getListenersBySpaceHostFromCache(GraphSpaceID spaceId, const HostAddr& host);
 
+  // Get the parts served by each listener host of the given type, empty if no such listener
+  StatusOr<std::unordered_map<HostAddr, std::vector<PartitionID>>>
+  getListenerHostsBySpaceTypeFromCache(GraphSpaceID spaceId, cpp2::ListenerType type);
+
   // Given host, get the all peers info. This function is used for listener to start up related
   // listener part
   StatusOr<ListenersMap> getListenersByHostFromCache(const HostAddr& host);
@@ -643,6 +647,10 @@ class MetaClient : public BaseMetaClient {
 
   folly::Future<StatusOr<cpp2::StatsItem>> getStats(GraphSpaceID spaceId);
 
+  // Get the statistics of the last finished STATS job from local cache. It never blocks, an
+  // asynchronous refresh is issued when the cached item is absent or expired.
+  StatusOr<std::shared_ptr<const cpp2::StatsItem>> getStatsFromCache(GraphSpaceID spaceId);
+
   folly::Future<StatusOr<nebula::cpp2::ErrorCode>> reportTaskFinish(
       GraphSpaceID spaceId,
       int32_t jobId,
@@ -862,6 +870,15 @@ class MetaClient : public BaseMetaClient {
   SessionMap sessionMap_;
   folly::F14FastSet<std::pair<SessionID, ExecutionPlanID>> killedPlans_;
   std::atomic<MetaData*> metadata_;
+
+  struct StatsCacheItem {
+    std::shared_ptr<const cpp2::StatsItem> stats;
+    int64_t loadTime{0};
+    bool refreshing{false};
+  };
+  // Statistics used by the optimizer to estimate cardinality
+  std::unordered_map<GraphSpaceID, StatsCacheItem> statsCache_;
+  folly::SharedMutex statsCacheLock_;
 };
 
 }  // namespace meta
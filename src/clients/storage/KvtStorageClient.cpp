@@ -393,7 +393,8 @@ KvtStorageRpcRespFuture<cpp2::GetNeighborsResponse> KvtStorageClient::getNeighbo
     const std::vector<cpp2::OrderBy>& /* orderBy */,
     int64_t /* limit */,
     const Expression* /* filter */,
-    const Expression* /* tagFilter */) {
+    const Expression* /* tagFilter */,
+    const cpp2::RuntimeFilter* /* dstFilter */) {
   LOG(WARNING) << "KvtStorageClient::getNeighbors - Not implemented";
   return makeErrorResponse<cpp2::GetNeighborsResponse>("getNeighbors not implemented");
 }
@@ -450,5 +451,25 @@ KvtStorageRpcRespFuture<cpp2::LookupIndexResp> KvtStorageClient::lookupIndex(
   return makeErrorResponse<cpp2::LookupIndexResp>("lookupIndex not implemented");
 }
 
+KvtStorageRpcRespFuture<cpp2::FulltextSearchResponse> KvtStorageClient::fulltextSearch(
+    const CommonRequestParam& /* param */,
+    std::unordered_map<HostAddr, std::vector<PartitionID>> /* hostParts */,
+    const std::string& /* index */,
+    const std::string& /* query */,
+    int64_t /* limit */,
+    cpp2::FulltextStats /* stats */) {
+  LOG(WARNING) << "KvtStorageClient::fulltextSearch - Not implemented";
+  return makeErrorResponse<cpp2::FulltextSearchResponse>("fulltextSearch not implemented");
+}
+
+KvtStorageRpcRespFuture<cpp2::FulltextSearchResponse> KvtStorageClient::fulltextStats(
+    const CommonRequestParam& /* param */,
+    std::unordered_map<HostAddr, std::vector<PartitionID>> /* hostParts */,
+    const std::string& /* index */,
+    const std::string& /* query */) {
+  LOG(WARNING) << "KvtStorageClient::fulltextStats - Not implemented";
+  return makeErrorResponse<cpp2::FulltextSearchResponse>("fulltextStats not implemented");
+}
+
 }  // namespace storage
 }  // namespace nebula
\ No newline at end of file
@@ -205,7 +205,8 @@ MemStorageRpcRespFuture<cpp2::GetNeighborsResponse> MemStorageClient::getNeighbo
     const std::vector<cpp2::OrderBy>& /* orderBy */,
     int64_t limit,
     const Expression* /* filter */,
-    const Expression* /* tagFilter */) {
+    const Expression* /* tagFilter */,
+    const cpp2::RuntimeFilter* /* dstFilter */) {
 
   LOG(INFO) << "MemStorageClient::getNeighbors - Getting neighbors";
 
@@ -422,5 +423,25 @@ MemStorageRpcRespFuture<cpp2::LookupIndexResp> MemStorageClient::lookupIndex(
   return makeSuccessResponse(std::move(response));
 }
 
+MemStorageRpcRespFuture<cpp2::FulltextSearchResponse> MemStorageClient::fulltextSearch(
+    const CommonRequestParam& /* param */,
+    std::unordered_map<HostAddr, std::vector<PartitionID>> /* hostParts */,
+    const std::string& /* index */,
+    const std::string& /* query */,
+    int64_t /* limit */,
+    cpp2::FulltextStats /* stats */) {
+  LOG(WARNING) << "MemStorageClient::fulltextSearch - Not implemented";
+  return makeErrorResponse<cpp2::FulltextSearchResponse>("fulltextSearch not implemented");
+}
+
+MemStorageRpcRespFuture<cpp2::FulltextSearchResponse> MemStorageClient::fulltextStats(
+    const CommonRequestParam& /* param */,
+    std::unordered_map<HostAddr, std::vector<PartitionID>> /* hostParts */,
+    const std::string& /* index */,
+    const std::string& /* query */) {
+  LOG(WARNING) << "MemStorageClient::fulltextStats - Not implemented";
+  return makeErrorResponse<cpp2::FulltextSearchResponse>("fulltextStats not implemented");
+}
+
 }  // namespace storage
 }  // namespace nebula
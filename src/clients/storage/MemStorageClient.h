@@ -110,7 +110,8 @@ class MemStorageClient {
       const std::vector<cpp2::OrderBy>& orderBy = std::vector<cpp2::OrderBy>(),
       int64_t limit = std::numeric_limits<int64_t>::max(),
       const Expression* filter = nullptr,
-      const Expression* tagFilter = nullptr);
+      const Expression* tagFilter = nullptr,
+      const cpp2::RuntimeFilter* dstFilter = nullptr);
 
   MemStorageRpcRespFuture<cpp2::GetDstBySrcResponse> getDstBySrc(
       const CommonRequestParam& param,
@@ -151,6 +152,20 @@ class MemStorageClient {
       const std::vector<storage::cpp2::OrderBy>& orderBy,
       int64_t limit);
 
+  MemStorageRpcRespFuture<cpp2::FulltextSearchResponse> fulltextSearch(
+      const CommonRequestParam& param,
+      std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts,
+      const std::string& index,
+      const std::string& query,
+      int64_t limit,
+      cpp2::FulltextStats stats);
+
+  MemStorageRpcRespFuture<cpp2::FulltextSearchResponse> fulltextStats(
+      const CommonRequestParam& param,
+      std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts,
+      const std::string& index,
+      const std::string& query);
+
   // KV operations
   folly::SemiFuture<StorageRpcResponse<cpp2::KVGetResponse>> get(
       GraphSpaceID space,
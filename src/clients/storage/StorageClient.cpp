@@ -52,7 +52,8 @@ StorageRpcRespFuture<cpp2::GetNeighborsResponse> OrigStorageClient::getNeighbors
     const std::vector<cpp2::OrderBy>& orderBy,
     int64_t limit,
     const Expression* filter,
-    const Expression* tagFilter) {
+    const Expression* tagFilter,
+    const cpp2::RuntimeFilter* dstFilter) {
   auto cbStatus = getIdFromValue(param.space);
   if (!cbStatus.ok()) {
     return folly::makeFuture<StorageRpcResponse<cpp2::GetNeighborsResponse>>(
@@ -101,6 +102,9 @@ StorageRpcRespFuture<cpp2::GetNeighborsResponse> OrigStorageClient::getNeighbors
     if (tagFilter != nullptr) {
       spec.tag_filter_ref() = tagFilter->encode();
     }
+    if (dstFilter != nullptr) {
+      spec.dst_filter_ref() = *dstFilter;
+    }
     req.traverse_spec_ref() = std::move(spec);
   }
 
@@ -587,6 +591,58 @@ StorageRpcRespFuture<cpp2::GetNeighborsResponse> OrigStorageClient::lookupAndTra
                          });
 }
 
+StorageRpcRespFuture<cpp2::FulltextSearchResponse> OrigStorageClient::fulltextSearch(
+    const CommonRequestParam& param,
+    std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts,
+    const std::string& index,
+    const std::string& query,
+    int64_t limit,
+    cpp2::FulltextStats stats) {
+  std::unordered_map<HostAddr, cpp2::FulltextSearchRequest> requests;
+  auto common = param.toReqCommon();
+  for (auto& c : hostParts) {
+    auto& req = requests[c.first];
+    req.space_id_ref() = param.space;
+    req.parts_ref() = std::move(c.second);
+    req.index_ref() = index;
+    req.query_ref() = query;
+    req.limit_ref() = limit;
+    req.common_ref() = common;
+    req.stats_ref() = stats;
+  }
+
+  return collectResponse(param.evb,
+                         std::move(requests),
+                         [](ThriftClientType* client, const cpp2::FulltextSearchRequest& r) {
+                           return client->future_fulltextSearch(r);
+                         });
+}
+
+StorageRpcRespFuture<cpp2::FulltextSearchResponse> OrigStorageClient::fulltextStats(
+    const CommonRequestParam& param,
+    std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts,
+    const std::string& index,
+    const std::string& query) {
+  std::unordered_map<HostAddr, cpp2::FulltextSearchRequest> requests;
+  auto common = param.toReqCommon();
+  for (auto& c : hostParts) {
+    auto& req = requests[c.first];
+    req.space_id_ref() = param.space;
+    req.parts_ref() = std::move(c.second);
+    req.index_ref() = index;
+    req.query_ref() = query;
+    req.limit_ref() = 0;
+    req.common_ref() = common;
+    req.stats_only_ref() = true;
+  }
+
+  return collectResponse(param.evb,
+                         std::move(requests),
+                         [](ThriftClientType* client, const cpp2::FulltextSearchRequest& r) {
+                           return client->future_fulltextSearch(r);
+                         });
+}
+
 StorageRpcRespFuture<cpp2::ScanResponse> OrigStorageClient::scanEdge(
     const CommonRequestParam& param,
     const std::vector<cpp2::EdgeProp>& edgeProp,
@@ -84,7 +84,8 @@ class OrigStorageClient
       const std::vector<cpp2::OrderBy>& orderBy = std::vector<cpp2::OrderBy>(),
       int64_t limit = std::numeric_limits<int64_t>::max(),
       const Expression* filter = nullptr,
-      const Expression* tagFilter = nullptr);
+      const Expression* tagFilter = nullptr,
+      const cpp2::RuntimeFilter* dstFilter = nullptr);
 
   StorageRpcRespFuture<cpp2::GetDstBySrcResponse> getDstBySrc(
       const CommonRequestParam& param,
@@ -157,6 +158,23 @@ class OrigStorageClient
   StorageRpcRespFuture<cpp2::GetNeighborsResponse> lookupAndTraverse(
       const CommonRequestParam& param, cpp2::IndexSpec indexSpec, cpp2::TraverseSpec traverseSpec);
 
+  // The parts are searched in the given hosts, which are the local fulltext listeners, and the
+  // documents are scored by the statistics of all parts collected by fulltextStats()
+  StorageRpcRespFuture<cpp2::FulltextSearchResponse> fulltextSearch(
+      const CommonRequestParam& param,
+      std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts,
+      const std::string& index,
+      const std::string& query,
+      int64_t limit,
+      cpp2::FulltextStats stats);
+
+  // Each host returns the statistics of the fields and terms the query reads in its parts
+  StorageRpcRespFuture<cpp2::FulltextSearchResponse> fulltextStats(
+      const CommonRequestParam& param,
+      std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts,
+      const std::string& index,
+      const std::string& query);
+
   StorageRpcRespFuture<cpp2::ScanResponse> scanEdge(const CommonRequestParam& param,
                                                     const std::vector<cpp2::EdgeProp>& vertexProp,
                                                     int64_t limit,
@@ -110,10 +110,11 @@ class StorageClientWrapper {
                     const std::vector<cpp2::OrderBy>& orderBy = std::vector<cpp2::OrderBy>(),
                     int64_t limit = std::numeric_limits<int64_t>::max(),
                     const Expression* filter = nullptr,
-                    const Expression* tagFilter = nullptr) {
+                    const Expression* tagFilter = nullptr,
+                    const cpp2::RuntimeFilter* dstFilter = nullptr) {
     return client_.getNeighbors(param, std::move(colNames), vids, edgeTypes, edgeDirection,
                                statProps, vertexProps, edgeProps, expressions, dedup, random,
-                               orderBy, limit, filter, tagFilter);
+                               orderBy, limit, filter, tagFilter, dstFilter);
   }
 
   auto getDstBySrc(const CommonRequestParam& param,
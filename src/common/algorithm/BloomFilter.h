@@ -0,0 +1,90 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_ALGORITHM_BLOOMFILTER_H_
+#define COMMON_ALGORITHM_BLOOMFILTER_H_
+
+#include <folly/hash/SpookyHashV2.h>
+
+#include <cmath>
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace algorithm {
+
+// BloomFilter tests whether a key is possibly in the set, without false negative. The bits are
+// the serialized form, and the hash of key is stable across processes, so the filter built in one
+// host could be shipped to and probed in another one.
+class BloomFilter final {
+ public:
+  static constexpr double kDefaultFpp = 0.01;
+  static constexpr uint32_t kMaxNumHashes = 16;
+
+  // Size the filter for the expected number of keys with the given false positive probability
+  explicit BloomFilter(size_t expectedKeys, double fpp = kDefaultFpp) {
+    auto n = static_cast<double>(std::max<size_t>(expectedKeys, 1));
+    auto p = std::min(std::max(fpp, 1e-6), 0.5);
+    auto numBits = static_cast<size_t>(std::ceil(-n * std::log(p) / (M_LN2 * M_LN2)));
+    // At least one 64-bit word
+    bits_.resize(std::max<size_t>((numBits + 63) / 64 * 8, 8), '\0');
+    auto k = std::llround(static_cast<double>(bits_.size() * 8) / n * M_LN2);
+    numHashes_ = static_cast<uint32_t>(std::min<int64_t>(std::max<int64_t>(k, 1), kMaxNumHashes));
+  }
+
+  void add(folly::StringPiece key) {
+    auto h1 = hash(key);
+    auto h2 = (h1 >> 32) | 1;
+    auto numBits = bits_.size() * 8;
+    for (uint32_t i = 0; i < numHashes_; ++i) {
+      auto bit = (h1 + i * h2) % numBits;
+      bits_[bit >> 3] |= static_cast<char>(1 << (bit & 7));
+    }
+  }
+
+  bool mayContain(folly::StringPiece key) const {
+    auto h1 = hash(key);
+    auto h2 = (h1 >> 32) | 1;
+    auto numBits = bits_.size() * 8;
+    for (uint32_t i = 0; i < numHashes_; ++i) {
+      auto bit = (h1 + i * h2) % numBits;
+      if ((bits_[bit >> 3] & static_cast<char>(1 << (bit & 7))) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const std::string& bits() const {
+    return bits_;
+  }
+
+  uint32_t numHashes() const {
+    return numHashes_;
+  }
+
+  static StatusOr<BloomFilter> fromBits(std::string bits, uint32_t numHashes) {
+    if (bits.empty() || numHashes == 0 || numHashes > kMaxNumHashes) {
+      return Status::Error(
+          "Invalid bloom filter of %lu bytes and %u hashes", bits.size(), numHashes);
+    }
+    BloomFilter bf(1);
+    bf.bits_ = std::move(bits);
+    bf.numHashes_ = numHashes;
+    return bf;
+  }
+
+ private:
+  static uint64_t hash(folly::StringPiece key) {
+    return folly::hash::SpookyHashV2::Hash64(key.data(), key.size(), 0);
+  }
+
+  std::string bits_;
+  uint32_t numHashes_{1};
+};
+
+}  // namespace algorithm
+}  // namespace nebula
+#endif  // COMMON_ALGORITHM_BLOOMFILTER_H_
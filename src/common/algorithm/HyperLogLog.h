@@ -0,0 +1,119 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_ALGORITHM_HYPERLOGLOG_H_
+#define COMMON_ALGORITHM_HYPERLOGLOG_H_
+
+#include <folly/hash/Hash.h>
+
+#include <cmath>
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace algorithm {
+
+// HyperLogLog estimates the number of distinct elements with fixed memory. It keeps 2^precision
+// one-byte registers, and the standard error is about 1.04 / sqrt(2^precision). Sketches of the
+// same precision could be merged, so the distinct count of the whole data set is obtained by
+// merging the sketches of all partitions.
+class HyperLogLog final {
+ public:
+  static constexpr uint8_t kMinPrecision = 4;
+  static constexpr uint8_t kMaxPrecision = 16;
+  static constexpr uint8_t kDefaultPrecision = 12;
+
+  explicit HyperLogLog(uint8_t precision = kDefaultPrecision) {
+    precision_ = std::min(std::max(precision, kMinPrecision), kMaxPrecision);
+    registers_.resize(1UL << precision_, 0);
+  }
+
+  // Add an element by its 64-bit hash, the hash should be well distributed.
+  void add(uint64_t hash) {
+    auto index = hash >> (64 - precision_);
+    auto remaining = hash << precision_;
+    uint8_t maxRank = 64 - precision_ + 1;
+    uint8_t rank = maxRank;
+    if (remaining != 0) {
+      rank = std::min<uint8_t>(__builtin_clzll(remaining) + 1, maxRank);
+    }
+    if (rank > static_cast<uint8_t>(registers_[index])) {
+      registers_[index] = rank;
+    }
+  }
+
+  void add(folly::StringPiece data) {
+    add(folly::hash::SpookyHashV2::Hash64(data.data(), data.size(), 0));
+  }
+
+  // Return false if the precisions are different
+  bool merge(const HyperLogLog& other) {
+    if (other.precision_ != precision_) {
+      return false;
+    }
+    for (size_t i = 0; i < registers_.size(); ++i) {
+      registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+    return true;
+  }
+
+  uint64_t estimate() const {
+    double m = static_cast<double>(registers_.size());
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (auto r : registers_) {
+      sum += std::ldexp(1.0, -static_cast<int>(r));
+      if (r == 0) {
+        ++zeros;
+      }
+    }
+    double estimate = alpha(registers_.size()) * m * m / sum;
+    // Use linear counting for small cardinalities
+    if (estimate <= 2.5 * m && zeros != 0) {
+      estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return static_cast<uint64_t>(std::llround(estimate));
+  }
+
+  // The registers are the serialized form, the precision is implied by the size
+  const std::string& registers() const {
+    return registers_;
+  }
+
+  static StatusOr<HyperLogLog> fromRegisters(std::string registers) {
+    auto size = registers.size();
+    if (size == 0 || (size & (size - 1)) != 0) {
+      return Status::Error("Invalid size of HyperLogLog registers: %lu", size);
+    }
+    auto precision = static_cast<uint8_t>(__builtin_ctzll(size));
+    if (precision < kMinPrecision || precision > kMaxPrecision) {
+      return Status::Error("Invalid precision of HyperLogLog: %d", static_cast<int>(precision));
+    }
+    HyperLogLog hll(precision);
+    hll.registers_ = std::move(registers);
+    return hll;
+  }
+
+ private:
+  static double alpha(size_t m) {
+    switch (m) {
+      case 16:
+        return 0.673;
+      case 32:
+        return 0.697;
+      case 64:
+        return 0.709;
+      default:
+        return 0.7213 / (1.0 + 1.079 / static_cast<double>(m));
+    }
+  }
+
+  uint8_t precision_{kDefaultPrecision};
+  std::string registers_;
+};
+
+}  // namespace algorithm
+}  // namespace nebula
+#endif  // COMMON_ALGORITHM_HYPERLOGLOG_H_
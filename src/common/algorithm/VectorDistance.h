@@ -0,0 +1,203 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_ALGORITHM_VECTORDISTANCE_H_
+#define COMMON_ALGORITHM_VECTORDISTANCE_H_
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace nebula {
+namespace algorithm {
+
+// Distance kernels of float vectors. On x86-64 the AVX2/FMA kernels are picked at runtime if the
+// cpu supports them, otherwise the SSE2 ones which are always available. NEON is used on aarch64,
+// and the scalar loop on other platforms.
+class VectorDistance final {
+ public:
+  using Kernel = float (*)(const float*, const float*, size_t);
+
+  // Squared euclidean distance
+  static float l2Sqr(const float* lhs, const float* rhs, size_t dim) {
+    static const Kernel kernel = selectL2Sqr();
+    return kernel(lhs, rhs, dim);
+  }
+
+  static float dot(const float* lhs, const float* rhs, size_t dim) {
+    static const Kernel kernel = selectDot();
+    return kernel(lhs, rhs, dim);
+  }
+
+  // Scale the vector to unit length, return false if it is a zero vector
+  static bool normalize(float* vec, size_t dim) {
+    auto norm = std::sqrt(dot(vec, vec, dim));
+    if (norm == 0.0f || !std::isfinite(norm)) {
+      return false;
+    }
+    for (size_t i = 0; i < dim; ++i) {
+      vec[i] /= norm;
+    }
+    return true;
+  }
+
+  static float l2SqrScalar(const float* lhs, const float* rhs, size_t dim) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < dim; ++i) {
+      float diff = lhs[i] - rhs[i];
+      sum += diff * diff;
+    }
+    return sum;
+  }
+
+  static float dotScalar(const float* lhs, const float* rhs, size_t dim) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < dim; ++i) {
+      sum += lhs[i] * rhs[i];
+    }
+    return sum;
+  }
+
+#if defined(__x86_64__)
+  static float l2SqrSse(const float* lhs, const float* rhs, size_t dim) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= dim; i += 8) {
+      __m128 d0 = _mm_sub_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i));
+      __m128 d1 = _mm_sub_ps(_mm_loadu_ps(lhs + i + 4), _mm_loadu_ps(rhs + i + 4));
+      sum0 = _mm_add_ps(sum0, _mm_mul_ps(d0, d0));
+      sum1 = _mm_add_ps(sum1, _mm_mul_ps(d1, d1));
+    }
+    float sum = hsum128(_mm_add_ps(sum0, sum1));
+    return sum + l2SqrScalar(lhs + i, rhs + i, dim - i);
+  }
+
+  static float dotSse(const float* lhs, const float* rhs, size_t dim) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= dim; i += 8) {
+      sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+      sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(lhs + i + 4), _mm_loadu_ps(rhs + i + 4)));
+    }
+    float sum = hsum128(_mm_add_ps(sum0, sum1));
+    return sum + dotScalar(lhs + i, rhs + i, dim - i);
+  }
+
+  __attribute__((target("avx2,fma"))) static float l2SqrAvx2(const float* lhs,
+                                                            const float* rhs,
+                                                            size_t dim) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= dim; i += 16) {
+      __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i));
+      __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(lhs + i + 8), _mm256_loadu_ps(rhs + i + 8));
+      sum0 = _mm256_fmadd_ps(d0, d0, sum0);
+      sum1 = _mm256_fmadd_ps(d1, d1, sum1);
+    }
+    for (; i + 8 <= dim; i += 8) {
+      __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i));
+      sum0 = _mm256_fmadd_ps(d0, d0, sum0);
+    }
+    float sum = hsum256(_mm256_add_ps(sum0, sum1));
+    return sum + l2SqrScalar(lhs + i, rhs + i, dim - i);
+  }
+
+  __attribute__((target("avx2,fma"))) static float dotAvx2(const float* lhs,
+                                                          const float* rhs,
+                                                          size_t dim) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= dim; i += 16) {
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i), sum0);
+      sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i + 8), _mm256_loadu_ps(rhs + i + 8), sum1);
+    }
+    for (; i + 8 <= dim; i += 8) {
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i), sum0);
+    }
+    float sum = hsum256(_mm256_add_ps(sum0, sum1));
+    return sum + dotScalar(lhs + i, rhs + i, dim - i);
+  }
+#elif defined(__aarch64__)
+  static float l2SqrNeon(const float* lhs, const float* rhs, size_t dim) {
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    for (; i + 8 <= dim; i += 8) {
+      float32x4_t d0 = vsubq_f32(vld1q_f32(lhs + i), vld1q_f32(rhs + i));
+      float32x4_t d1 = vsubq_f32(vld1q_f32(lhs + i + 4), vld1q_f32(rhs + i + 4));
+      sum0 = vfmaq_f32(sum0, d0, d0);
+      sum1 = vfmaq_f32(sum1, d1, d1);
+    }
+    float sum = vaddvq_f32(vaddq_f32(sum0, sum1));
+    return sum + l2SqrScalar(lhs + i, rhs + i, dim - i);
+  }
+
+  static float dotNeon(const float* lhs, const float* rhs, size_t dim) {
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    for (; i + 8 <= dim; i += 8) {
+      sum0 = vfmaq_f32(sum0, vld1q_f32(lhs + i), vld1q_f32(rhs + i));
+      sum1 = vfmaq_f32(sum1, vld1q_f32(lhs + i + 4), vld1q_f32(rhs + i + 4));
+    }
+    float sum = vaddvq_f32(vaddq_f32(sum0, sum1));
+    return sum + dotScalar(lhs + i, rhs + i, dim - i);
+  }
+#endif
+
+ private:
+  VectorDistance() = delete;
+
+#if defined(__x86_64__)
+  static float hsum128(__m128 v) {
+    __m128 sum = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x1));
+    return _mm_cvtss_f32(sum);
+  }
+
+  __attribute__((target("avx2,fma"))) static float hsum256(__m256 v) {
+    return hsum128(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+  }
+
+  static bool hasAvx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  }
+#endif
+
+  static Kernel selectL2Sqr() {
+#if defined(__x86_64__)
+    return hasAvx2() ? &l2SqrAvx2 : &l2SqrSse;
+#elif defined(__aarch64__)
+    return &l2SqrNeon;
+#else
+    return &l2SqrScalar;
+#endif
+  }
+
+  static Kernel selectDot() {
+#if defined(__x86_64__)
+    return hasAvx2() ? &dotAvx2 : &dotSse;
+#elif defined(__aarch64__)
+    return &dotNeon;
+#else
+    return &dotScalar;
+#endif
+  }
+};
+
+}  // namespace algorithm
+}  // namespace nebula
+
+#endif  // COMMON_ALGORITHM_VECTORDISTANCE_H_
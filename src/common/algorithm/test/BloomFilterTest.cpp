@@ -0,0 +1,52 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/algorithm/BloomFilter.h"
+
+namespace nebula {
+namespace algorithm {
+
+TEST(BloomFilterTest, MayContain) {
+  for (size_t count : {1UL, 100UL, 100000UL}) {
+    BloomFilter bf(count);
+    for (size_t i = 0; i < count; ++i) {
+      bf.add(folly::to<std::string>(i));
+    }
+    // No false negative
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_TRUE(bf.mayContain(folly::to<std::string>(i)));
+    }
+    size_t falsePositives = 0;
+    size_t probes = 10000;
+    for (size_t i = 0; i < probes; ++i) {
+      if (bf.mayContain(folly::to<std::string>(count + i))) {
+        ++falsePositives;
+      }
+    }
+    EXPECT_LT(falsePositives, probes * BloomFilter::kDefaultFpp * 3);
+  }
+}
+
+TEST(BloomFilterTest, FromBits) {
+  BloomFilter bf(1000);
+  for (int64_t i = 0; i < 1000; ++i) {
+    bf.add(folly::StringPiece(reinterpret_cast<const char*>(&i), sizeof(int64_t)));
+  }
+  auto ret = BloomFilter::fromBits(bf.bits(), bf.numHashes());
+  ASSERT_TRUE(ret.ok());
+  auto copy = std::move(ret).value();
+  for (int64_t i = 0; i < 2000; ++i) {
+    folly::StringPiece key(reinterpret_cast<const char*>(&i), sizeof(int64_t));
+    EXPECT_EQ(bf.mayContain(key), copy.mayContain(key));
+  }
+
+  EXPECT_FALSE(BloomFilter::fromBits("", 1).ok());
+  EXPECT_FALSE(BloomFilter::fromBits(bf.bits(), 0).ok());
+}
+
+}  // namespace algorithm
+}  // namespace nebula
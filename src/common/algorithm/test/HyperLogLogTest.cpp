@@ -0,0 +1,64 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/algorithm/HyperLogLog.h"
+
+namespace nebula {
+namespace algorithm {
+
+TEST(HyperLogLogTest, Estimate) {
+  {
+    HyperLogLog hll;
+    EXPECT_EQ(0, hll.estimate());
+  }
+  for (uint64_t count : {10UL, 1000UL, 100000UL}) {
+    HyperLogLog hll;
+    for (uint64_t i = 0; i < count; ++i) {
+      auto str = folly::to<std::string>(i);
+      // Duplicated elements are counted once
+      hll.add(str);
+      hll.add(str);
+    }
+    auto estimate = static_cast<double>(hll.estimate());
+    EXPECT_NEAR(count, estimate, count * 0.05);
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  HyperLogLog lhs;
+  HyperLogLog rhs;
+  for (uint64_t i = 0; i < 20000; ++i) {
+    auto str = folly::to<std::string>(i);
+    if (i < 15000) {
+      lhs.add(str);
+    }
+    if (i >= 5000) {
+      rhs.add(str);
+    }
+  }
+  ASSERT_TRUE(lhs.merge(rhs));
+  EXPECT_NEAR(20000, static_cast<double>(lhs.estimate()), 20000 * 0.05);
+
+  HyperLogLog other(10);
+  EXPECT_FALSE(lhs.merge(other));
+}
+
+TEST(HyperLogLogTest, Registers) {
+  HyperLogLog hll;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    hll.add(folly::to<std::string>(i));
+  }
+  auto ret = HyperLogLog::fromRegisters(hll.registers());
+  ASSERT_TRUE(ret.ok());
+  EXPECT_EQ(hll.estimate(), ret.value().estimate());
+
+  EXPECT_FALSE(HyperLogLog::fromRegisters("").ok());
+  EXPECT_FALSE(HyperLogLog::fromRegisters(std::string(100, '\0')).ok());
+}
+
+}  // namespace algorithm
+}  // namespace nebula
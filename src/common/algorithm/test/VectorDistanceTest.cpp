@@ -0,0 +1,51 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "common/algorithm/VectorDistance.h"
+
+namespace nebula {
+namespace algorithm {
+
+TEST(VectorDistanceTest, Kernels) {
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  // Cover the tails which are not a multiple of the simd width
+  for (size_t dim : {0UL, 1UL, 3UL, 4UL, 7UL, 8UL, 15UL, 16UL, 17UL, 128UL, 131UL}) {
+    std::vector<float> lhs(dim), rhs(dim);
+    for (size_t i = 0; i < dim; ++i) {
+      lhs[i] = dist(gen);
+      rhs[i] = dist(gen);
+    }
+    auto l2 = VectorDistance::l2SqrScalar(lhs.data(), rhs.data(), dim);
+    auto dot = VectorDistance::dotScalar(lhs.data(), rhs.data(), dim);
+    EXPECT_NEAR(l2, VectorDistance::l2Sqr(lhs.data(), rhs.data(), dim), 1e-4);
+    EXPECT_NEAR(dot, VectorDistance::dot(lhs.data(), rhs.data(), dim), 1e-4);
+#if defined(__x86_64__)
+    EXPECT_NEAR(l2, VectorDistance::l2SqrSse(lhs.data(), rhs.data(), dim), 1e-4);
+    EXPECT_NEAR(dot, VectorDistance::dotSse(lhs.data(), rhs.data(), dim), 1e-4);
+#endif
+  }
+}
+
+TEST(VectorDistanceTest, Normalize) {
+  {
+    std::vector<float> vec{3.0f, 4.0f};
+    EXPECT_TRUE(VectorDistance::normalize(vec.data(), vec.size()));
+    EXPECT_FLOAT_EQ(0.6f, vec[0]);
+    EXPECT_FLOAT_EQ(0.8f, vec[1]);
+    EXPECT_NEAR(1.0f, VectorDistance::dot(vec.data(), vec.data(), vec.size()), 1e-6);
+  }
+  {
+    std::vector<float> vec{0.0f, 0.0f, 0.0f};
+    EXPECT_FALSE(VectorDistance::normalize(vec.data(), vec.size()));
+  }
+}
+
+}  // namespace algorithm
+}  // namespace nebula
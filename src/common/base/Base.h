@@ -136,6 +136,7 @@ constexpr char kDst[] = "_dst";
 constexpr char kEdgePrefix[] = "_edge";
 constexpr char kStatsPrefix[] = "_stats";
 constexpr char kExprPrefix[] = "_expr";
+constexpr char kDistance[] = "_distance";
 
 // Useful type traits
 
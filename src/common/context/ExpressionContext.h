@@ -15,6 +15,8 @@
 
 namespace nebula {
 
+class PropertyExpression;
+
 /***************************************************************************
  *
  * The base class for all ExpressionContext implementations
@@ -75,6 +77,24 @@ class ExpressionContext {
   // Get Value by Column index
   virtual const Value& getColumn(int32_t index) const = 0;
 
+  // The identity of the input which the property slots are resolved against, 0 if the context
+  // doesn't support property slots. The slots resolved keep valid while the identity is unchanged.
+  virtual uint64_t propSlotsId() const {
+    return 0;
+  }
+
+  // Resolves the property got by the expression to a slot of the input, -1 if not supported
+  virtual int32_t getPropSlot(const PropertyExpression* expr) const {
+    UNUSED(expr);
+    return -1;
+  }
+
+  // Get the property by the slot resolved, without looking up the names of it for each row
+  virtual const Value& getPropBySlot(int32_t slot) const {
+    UNUSED(slot);
+    return Value::kEmpty;
+  }
+
   // Get regex
   const std::regex& getRegex(const std::string& pattern) {
     auto iter = regex_.find(pattern);
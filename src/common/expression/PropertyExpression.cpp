@@ -50,7 +50,25 @@ const Value& PropertyExpression::eval(ExpressionContext& ctx) {
   return Value::kNullBadType;
 }
 
+const Value* PropertyExpression::evalBySlot(ExpressionContext& ctx) {
+  auto id = ctx.propSlotsId();
+  if (id == 0) {
+    return nullptr;
+  }
+  if (id != propSlotsId_) {
+    propSlot_ = ctx.getPropSlot(this);
+    propSlotsId_ = id;
+  }
+  if (propSlot_ < 0) {
+    return nullptr;
+  }
+  return &ctx.getPropBySlot(propSlot_);
+}
+
 const Value& EdgePropertyExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getEdgeProp(sym_, prop_);
   return result_;
 }
@@ -60,6 +78,9 @@ void EdgePropertyExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& TagPropertyExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getTagProp(sym_, prop_);
   return result_;
 }
@@ -99,6 +120,9 @@ void VariablePropertyExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& SourcePropertyExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getSrcProp(sym_, prop_);
   return result_;
 }
@@ -108,6 +132,9 @@ void SourcePropertyExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& DestPropertyExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   return ctx.getDstProp(sym_, prop_);
 }
 
@@ -116,6 +143,9 @@ void DestPropertyExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& EdgeSrcIdExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getEdgeProp(sym_, prop_);
   return result_;
 }
@@ -125,6 +155,9 @@ void EdgeSrcIdExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& EdgeTypeExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getEdgeProp(sym_, prop_);
   return result_;
 }
@@ -134,6 +167,9 @@ void EdgeTypeExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& EdgeRankExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getEdgeProp(sym_, prop_);
   return result_;
 }
@@ -143,6 +179,9 @@ void EdgeRankExpression::accept(ExprVisitor* visitor) {
 }
 
 const Value& EdgeDstIdExpression::eval(ExpressionContext& ctx) {
+  if (auto* val = evalBySlot(ctx)) {
+    return *val;
+  }
   result_ = ctx.getEdgeProp(sym_, prop_);
   return result_;
 }
@@ -63,9 +63,17 @@ class PropertyExpression : public Expression {
   void writeTo(Encoder& encoder) const override;
   void resetFrom(Decoder& decoder) override;
 
+  // Returns the property by the slot resolved by the context, which is resolved once for each
+  // input, nullptr if the context doesn't support it
+  const Value* evalBySlot(ExpressionContext& ctx);
+
   std::string ref_;
   std::string sym_;
   std::string prop_;
+
+ private:
+  uint64_t propSlotsId_{0};
+  int32_t propSlot_{-1};
 };
 
 // edge_name.any_prop_name
@@ -461,6 +461,14 @@ std::unordered_map<std::string, std::vector<TypeSignature>> FunctionManager::typ
      {TypeSignature({Value::Type::STRING}, Value::Type::MAP),
       TypeSignature({Value::Type::STRING}, Value::Type::NULLVALUE)}},
     {"score", {TypeSignature({}, Value::Type::__EMPTY__)}},
+    {"vector_near",
+     {TypeSignature({Value::Type::LIST, Value::Type::LIST, Value::Type::INT}, Value::Type::BOOL),
+      TypeSignature({Value::Type::LIST, Value::Type::LIST, Value::Type::INT, Value::Type::INT},
+                    Value::Type::BOOL)}},
+    {"st_knn",
+     {TypeSignature({Value::Type::GEOGRAPHY, Value::Type::GEOGRAPHY, Value::Type::INT},
+                    Value::Type::BOOL)}},
+    {"distance", {TypeSignature({}, Value::Type::__EMPTY__)}},
     {"md5", {TypeSignature({Value::Type::STRING}, Value::Type::STRING)}},
 };
 
@@ -3083,6 +3091,39 @@ FunctionManager::FunctionManager() {
       return Value::kNullValue;
     };
   }
+  // vector_near(tag.prop, vector, k[, ef]) and st_knn(tag.prop, point, k) are used to identify
+  // the top-k search of a vector index or a geography index in lookup, and distance() is the
+  // distance of each result
+  {
+    auto &attr = functions_["vector_near"];
+    attr.minArity_ = 3;
+    attr.maxArity_ = 4;
+    attr.isAlwaysPure_ = true;
+    attr.body_ = [](const auto &) -> Value {
+      // Only placeholder, will be extracted into index query and need not to be evaluated
+      return Value::kNullValue;
+    };
+  }
+  {
+    auto &attr = functions_["st_knn"];
+    attr.minArity_ = 3;
+    attr.maxArity_ = 3;
+    attr.isAlwaysPure_ = true;
+    attr.body_ = [](const auto &) -> Value {
+      // Only placeholder, will be extracted into index query and need not to be evaluated
+      return Value::kNullValue;
+    };
+  }
+  {
+    auto &attr = functions_["distance"];
+    attr.minArity_ = 0;
+    attr.maxArity_ = 0;
+    attr.isAlwaysPure_ = true;
+    attr.body_ = [](const auto &) -> Value {
+      // Only placeholder, will be replaced by actual expression and need not to be evaluated
+      return Value::kNullValue;
+    };
+  }
   {
     auto &attr = functions_["md5"];
     attr.minArity_ = 1;
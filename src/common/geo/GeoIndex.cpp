@@ -23,10 +23,15 @@
 
 #include <cstdint>
 
+#include "common/base/ConcurrentLRUCache.h"
 #include "common/datatypes/Geography.h"
 #include "common/utils/IndexKeyUtils.h"
 #include "interface/gen-cpp2/storage_types.h"
 
+DEFINE_uint32(geo_covering_cache_capacity,
+              1024,
+              "Capacity of the cache of the scan ranges of geo index query shapes, 0 to disable");
+
 namespace nebula {
 namespace geo {
 
@@ -73,12 +78,14 @@ std::vector<uint64_t> GeoIndex::indexCells(const Geography& g) const {
 }
 
 std::vector<ScanRange> GeoIndex::intersects(const Geography& g) const {
-  auto r = g.asS2();
-  if (UNLIKELY(!r)) {
-    return {};
-  }
+  return cached("intersects", g, 0.0, [this, &g]() -> std::vector<ScanRange> {
+    auto r = g.asS2();
+    if (UNLIKELY(!r)) {
+      return {};
+    }
 
-  return intersects(*r, g.shape() == GeoShape::POINT);
+    return intersects(*r, g.shape() == GeoShape::POINT);
+  });
 }
 
 // covers degenerates to intersects currently
@@ -92,6 +99,12 @@ std::vector<ScanRange> GeoIndex::coveredBy(const Geography& g) const {
 }
 
 std::vector<ScanRange> GeoIndex::dWithin(const Geography& g, double distance) const {
+  return cached("dwithin", g, distance, [this, &g, distance]() -> std::vector<ScanRange> {
+    return dWithinImpl(g, distance);
+  });
+}
+
+std::vector<ScanRange> GeoIndex::dWithinImpl(const Geography& g, double distance) const {
   auto r = g.asS2();
   if (UNLIKELY(!r)) {
     return {};
@@ -124,6 +137,65 @@ std::vector<ScanRange> GeoIndex::dWithin(const Geography& g, double distance) co
   }
 }
 
+std::vector<ScanRange> GeoIndex::ring(const S2Point& center,
+                                      S1Angle radius,
+                                      RingScanState* state) const {
+  std::vector<S2CellId> covering;
+  S2RegionCoverer rc(rcParams_.s2RegionCovererOpts());
+  rc.GetCovering(S2Cap(center, radius), &covering);
+  auto ring = S2CellUnion(std::move(covering)).Difference(state->scanned);
+  state->scanned = state->scanned.Union(ring);
+
+  std::vector<ScanRange> scanRanges;
+  for (const S2CellId& cellId : ring) {
+    if (cellId.is_leaf()) {
+      scanRanges.emplace_back(cellId.id());
+    } else {
+      scanRanges.emplace_back(cellId.range_min().id(), cellId.range_max().id());
+    }
+  }
+  // The geographies indexed in the ancestors of the ring cells may intersect the ring too
+  if (!pointsOnly_) {
+    for (const S2CellId& cellId : ring) {
+      for (auto l = cellId.level() - 1; l >= rcParams_.minCellLevel_; --l) {
+        S2CellId parentCellId = cellId.parent(l);
+        if (!state->ancestors.emplace(parentCellId.id()).second) {
+          break;
+        }
+        scanRanges.emplace_back(parentCellId.id());
+      }
+    }
+  }
+  return scanRanges;
+}
+
+std::vector<ScanRange> GeoIndex::cached(
+    const char* op,
+    const Geography& g,
+    double distance,
+    const std::function<std::vector<ScanRange>()>& compute) const {
+  if (FLAGS_geo_covering_cache_capacity == 0) {
+    return compute();
+  }
+  static ConcurrentLRUCache<std::string, std::vector<ScanRange>> cache(
+      std::max<size_t>(FLAGS_geo_covering_cache_capacity, 32));
+  auto key = folly::stringPrintf("%s:%d:%d:%d:%d:%a:",
+                                 op,
+                                 rcParams_.minCellLevel_,
+                                 rcParams_.maxCellLevel_,
+                                 rcParams_.maxCellNum_,
+                                 pointsOnly_,
+                                 distance);
+  key.append(g.asWKB());
+  auto ret = cache.get(key);
+  if (ret.ok()) {
+    return std::move(ret).value();
+  }
+  auto scanRanges = compute();
+  cache.insert(std::move(key), scanRanges);
+  return scanRanges;
+}
+
 std::vector<ScanRange> GeoIndex::intersects(const S2Region& r, bool isPoint) const {
   auto cells = coveringCells(r, isPoint);
   std::vector<ScanRange> scanRanges;
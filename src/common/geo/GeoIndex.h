@@ -6,9 +6,13 @@
 #ifndef COMMON_GEO_GEOINDEX_H
 #define COMMON_GEO_GEOINDEX_H
 
+#include <s2/s1angle.h>
+#include <s2/s2cell_union.h>
 #include <s2/s2region_coverer.h>
 
 #include <algorithm>
+#include <functional>
+#include <unordered_set>
 #include <vector>
 
 #include "common/datatypes/Geography.h"
@@ -58,6 +62,12 @@ struct ScanRange {
   nebula::storage::cpp2::IndexColumnHint toIndexColumnHint() const;
 };
 
+// The cells which have been scanned while expanding rings around a point in a kNN search
+struct RingScanState {
+  S2CellUnion scanned;
+  std::unordered_set<uint64_t> ancestors;
+};
+
 class GeoIndex {
  public:
   explicit GeoIndex(const RegionCoverParams& params, bool pointsOnly = false)
@@ -75,8 +85,20 @@ class GeoIndex {
   std::vector<ScanRange> coveredBy(const Geography& g) const;
   // ST_Distance(g, x, distance), x is the indexed geography column
   std::vector<ScanRange> dWithin(const Geography& g, double distance) const;
+  // The ring around center whose outer radius is `radius`, which is the part of the cap not
+  // scanned yet. Expanding the radius ring by ring finds the geographies in the order of their
+  // distance to center roughly, which are refined by exact distance by the caller.
+  std::vector<ScanRange> ring(const S2Point& center, S1Angle radius, RingScanState* state) const;
 
  private:
+  // The scan ranges of the query shapes are cached, since computing the covering is heavy
+  std::vector<ScanRange> cached(const char* op,
+                                const Geography& g,
+                                double distance,
+                                const std::function<std::vector<ScanRange>()>& compute) const;
+
+  std::vector<ScanRange> dWithinImpl(const Geography& g, double distance) const;
+
   std::vector<ScanRange> intersects(const S2Region& r, bool isPoint = false) const;
 
   std::vector<S2CellId> coveringCells(const S2Region& r, bool isPoint = false) const;
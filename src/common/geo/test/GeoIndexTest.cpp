@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 #include <s2/s2cell_id.h>
+#include <s2/s2earth.h>
+#include <s2/s2latlng.h>
 
 #include <cstdint>
 #include <unordered_set>
@@ -306,6 +308,48 @@ TEST(indexCells, polygon) {
   }
 }
 
+TEST(ring, point) {
+  geo::RegionCoverParams rc(0, 30, 8);
+  geo::GeoIndex geoIndex(rc, true);
+  S2Point center = S2LatLng::FromDegrees(30.0, 120.0).ToPoint();
+  auto contains = [](const std::vector<ScanRange>& scanRanges, uint64_t cellId) {
+    return std::any_of(scanRanges.begin(), scanRanges.end(), [cellId](const ScanRange& range) {
+      return range.isRangeScan ? range.rangeMin <= cellId && cellId <= range.rangeMax
+                               : range.rangeMin == cellId;
+    });
+  };
+  RingScanState state;
+  auto inner = geoIndex.ring(center, S2Earth::ToAngle(util::units::Meters(100)), &state);
+  auto outer = geoIndex.ring(center, S2Earth::ToAngle(util::units::Meters(1000)), &state);
+  ASSERT_FALSE(inner.empty());
+  ASSERT_FALSE(outer.empty());
+  // The rings are disjoint
+  for (const auto& range : outer) {
+    EXPECT_FALSE(contains(inner, range.rangeMin));
+    EXPECT_FALSE(contains(inner, range.isRangeScan ? range.rangeMax : range.rangeMin));
+  }
+  // The points within the radius are in one of the rings
+  for (double offset : {0.0, 0.0005, 0.002, 0.008}) {
+    auto cellId = S2CellId(S2LatLng::FromDegrees(30.0 + offset, 120.0).ToPoint()).id();
+    EXPECT_TRUE(contains(inner, cellId) || contains(outer, cellId)) << offset;
+  }
+  // Nothing left to scan
+  EXPECT_TRUE(geoIndex.ring(center, S2Earth::ToAngle(util::units::Meters(1000)), &state).empty());
+}
+
+TEST(cache, intersects) {
+  geo::RegionCoverParams rc(0, 30, 8);
+  geo::GeoIndex geoIndex(rc);
+  auto polygon =
+      Geography::fromWKT("POLYGON((-1.0 -1.0, 1.0 -1.0, 1.0 1.0, -1.0 1.0, -1.0 -1.0))").value();
+  auto first = geoIndex.intersects(polygon);
+  auto second = geoIndex.intersects(polygon);
+  EXPECT_EQ(first, second);
+  // The params are part of the key
+  geo::GeoIndex coarse(geo::RegionCoverParams(0, 10, 4));
+  EXPECT_NE(first, coarse.intersects(polygon));
+}
+
 }  // namespace geo
 }  // namespace nebula
 
@@ -0,0 +1,143 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "common/memory/MemoryScope.h"
+
+#include "common/memory/MemoryTracker.h"
+
+namespace nebula {
+namespace memory {
+
+namespace {
+
+// Binds the scope to the threads which the request context is set to
+class MemoryScopeData final : public folly::RequestData {
+ public:
+  explicit MemoryScopeData(std::shared_ptr<MemoryScope> scope) : scope_(std::move(scope)) {}
+
+  bool hasCallback() override {
+    return true;
+  }
+
+  void onSet() override {
+    MemoryStats::bindScope(scope_.get());
+  }
+
+  void onUnset() override {
+    MemoryStats::bindScope(nullptr);
+  }
+
+ private:
+  std::shared_ptr<MemoryScope> scope_;
+};
+
+const folly::RequestToken& scopeToken() {
+  static const folly::RequestToken token("nebula::memory::MemoryScope");
+  return token;
+}
+
+}  // namespace
+
+// static
+const std::shared_ptr<MemoryScope>& MemoryScope::root() {
+  static const std::shared_ptr<MemoryScope> root(
+      new MemoryScope("process", nullptr, kNoLimit, false));
+  return root;
+}
+
+// static
+MemoryScope* MemoryScope::current() {
+  return MemoryStats::currentScope();
+}
+
+std::shared_ptr<MemoryScope> MemoryScope::create(std::string name, int64_t limit, bool killable) {
+  std::shared_ptr<MemoryScope> scope(
+      new MemoryScope(std::move(name), shared_from_this(), limit, killable));
+  // Never fail in the lock, which failLargest() also takes
+  MemoryCheckOffGuard guard;
+  std::lock_guard<std::mutex> lock(lock_);
+  if (children_.size() == children_.capacity()) {
+    children_.erase(std::remove_if(children_.begin(),
+                                   children_.end(),
+                                   [](const auto& child) { return child.expired(); }),
+                    children_.end());
+  }
+  children_.emplace_back(scope);
+  return scope;
+}
+
+std::shared_ptr<MemoryScope> MemoryScope::child(const std::string& name) {
+  {
+    MemoryCheckOffGuard guard;
+    std::lock_guard<std::mutex> lock(lock_);
+    auto found = namedChildren_.find(name);
+    if (found != namedChildren_.end()) {
+      return found->second;
+    }
+  }
+  auto scope = create(name);
+  MemoryCheckOffGuard guard;
+  std::lock_guard<std::mutex> lock(lock_);
+  return namedChildren_.emplace(name, std::move(scope)).first->second;
+}
+
+bool MemoryScope::alloc(int64_t size, bool check) {
+  for (auto* scope = this; scope != nullptr; scope = scope->parent_.get()) {
+    auto willBe = scope->used_.fetch_add(size, std::memory_order_relaxed) + size;
+    if (check && size > 0 && (willBe > scope->limit() || scope->exceeded())) {
+      // All or nothing, revert the ancestors accounted
+      for (auto* s = this; s != scope->parent_.get(); s = s->parent_.get()) {
+        s->used_.fetch_sub(size, std::memory_order_relaxed);
+      }
+      return false;
+    }
+    auto peak = scope->peak_.load(std::memory_order_relaxed);
+    while (willBe > peak &&
+           !scope->peak_.compare_exchange_weak(peak, willBe, std::memory_order_relaxed)) {
+    }
+  }
+  return true;
+}
+
+// static
+bool MemoryScope::failLargest() {
+  MemoryCheckOffGuard guard;
+  auto largest = root()->findLargest();
+  if (largest == nullptr || largest->isAncestorOf(current())) {
+    return false;
+  }
+  largest->exceeded_.store(true, std::memory_order_relaxed);
+  return true;
+}
+
+std::shared_ptr<MemoryScope> MemoryScope::findLargest() {
+  std::shared_ptr<MemoryScope> largest;
+  std::lock_guard<std::mutex> lock(lock_);
+  for (const auto& weak : children_) {
+    auto child = weak.lock();
+    if (child == nullptr) {
+      continue;
+    }
+    auto candidate = child->killable_ ? child : child->findLargest();
+    if (candidate != nullptr && (largest == nullptr || candidate->used() > largest->used())) {
+      largest = std::move(candidate);
+    }
+  }
+  return largest;
+}
+
+bool MemoryScope::isAncestorOf(const MemoryScope* scope) const {
+  for (; scope != nullptr; scope = scope->parent_.get()) {
+    if (scope == this) {
+      return true;
+    }
+  }
+  return false;
+}
+
+MemoryScopeGuard::MemoryScopeGuard(std::shared_ptr<MemoryScope> scope)
+    : guard_(scopeToken(), std::make_unique<MemoryScopeData>(std::move(scope))) {}
+
+}  // namespace memory
+}  // namespace nebula
@@ -0,0 +1,118 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#pragma once
+
+#include <folly/io/async/Request.h>
+
+#include "common/base/Base.h"
+
+namespace nebula {
+namespace memory {
+
+/**
+ *  MemoryScope is a node of the hierarchical memory accounting, e.g.
+ *    process -> user -> query -> executor
+ *  Design:
+ *    The memory allocated by a thread is attributed to the scope bound to the thread, and to all
+ *    the ancestors of it. A scope is bound by MemoryScopeGuard through folly::RequestContext, so
+ *    the binding follows the future callbacks and the thread pool tasks created under it.
+ *
+ *    Like the reservation of MemoryStats, each thread accumulates the bytes of its scope locally,
+ *    and only flushes them into the scope once they exceed a threshold or the scope is unbound.
+ *    A free is attributed to the scope bound when it happens. So the long-lived objects passed
+ *    between scopes are released with the scope owning them bound, e.g. the result of an
+ *    executor is freed in the scope of the executor producing it, though its last consumer or
+ *    the GC thread drops it. The data moved out of such an object belongs to the receiver, whose
+ *    usage could then drop below zero; it's never reported so, and the ancestors stay exact.
+ *
+ *    When the memory of the process exceeds its limit, the killable scope (e.g. a query) using
+ *    the most memory is marked as exceeded, and fails at its next allocation, instead of whichever
+ *    query happens to allocate at that moment.
+ */
+class MemoryScope final : public std::enable_shared_from_this<MemoryScope> {
+ public:
+  static constexpr int64_t kNoLimit = std::numeric_limits<int64_t>::max();
+
+  // The scope of the whole process, the root of all scopes
+  static const std::shared_ptr<MemoryScope>& root();
+
+  // The scope bound to the current thread, nullptr if none
+  static MemoryScope* current();
+
+  // Creates a child scope, whose usage is accounted in this one too. The killable scope could be
+  // chosen to fail when the memory of the process is exhausted.
+  std::shared_ptr<MemoryScope> create(std::string name,
+                                      int64_t limit = kNoLimit,
+                                      bool killable = false);
+
+  // Returns the child of the name, created on first use, e.g. the scope of a user
+  std::shared_ptr<MemoryScope> child(const std::string& name);
+
+  // Accounts the bytes in this scope and its ancestors. Returns false without accounting anything
+  // if `check' and any of them would exceed its limit or has been marked as exceeded.
+  bool alloc(int64_t size, bool check);
+
+  const std::string& name() const {
+    return name_;
+  }
+
+  int64_t used() const {
+    return std::max<int64_t>(used_.load(std::memory_order_relaxed), 0);
+  }
+
+  int64_t peak() const {
+    return peak_.load(std::memory_order_relaxed);
+  }
+
+  int64_t limit() const {
+    return limit_.load(std::memory_order_relaxed);
+  }
+
+  void setLimit(int64_t limit) {
+    limit_.store(limit, std::memory_order_relaxed);
+  }
+
+  bool exceeded() const {
+    return exceeded_.load(std::memory_order_relaxed);
+  }
+
+  // Called when the memory of the process exceeds its limit. Marks the live killable scope using
+  // the most memory as exceeded, and returns true if it's not the one the current thread
+  // allocates in, i.e. the current allocation could go on.
+  static bool failLargest();
+
+ private:
+  MemoryScope(std::string name, std::shared_ptr<MemoryScope> parent, int64_t limit, bool killable)
+      : name_(std::move(name)), parent_(std::move(parent)), limit_(limit), killable_(killable) {}
+
+  std::shared_ptr<MemoryScope> findLargest();
+
+  bool isAncestorOf(const MemoryScope* scope) const;
+
+  const std::string name_;
+  const std::shared_ptr<MemoryScope> parent_;
+  std::atomic<int64_t> limit_;
+  const bool killable_;
+  std::atomic<int64_t> used_{0};
+  std::atomic<int64_t> peak_{0};
+  std::atomic<bool> exceeded_{false};
+
+  std::mutex lock_;
+  std::vector<std::weak_ptr<MemoryScope>> children_;
+  std::unordered_map<std::string, std::shared_ptr<MemoryScope>> namedChildren_;
+};
+
+// Binds the scope to the current thread during its lifetime, along with the future callbacks and
+// the tasks created meanwhile
+class MemoryScopeGuard {
+ public:
+  explicit MemoryScopeGuard(std::shared_ptr<MemoryScope> scope);
+
+ private:
+  folly::ShallowCopyRequestContextScopeGuard guard_;
+};
+
+}  // namespace memory
+}  // namespace nebula
@@ -4,6 +4,17 @@
  */
 #include "common/memory/MemoryTracker.h"
 
+#include "common/memory/MemoryScope.h"
+
+DEFINE_double(memory_tracker_overcommit_ratio,
+              0.05,
+              "When the memory limit is hit, the ratio of the limit allowed to be exceeded while "
+              "the query using the most memory is failed, 0 to fail the allocating query directly");
+DEFINE_double(memory_tracker_pending_free_ratio,
+              0.1,
+              "The ratio of the limit at most allowed to be exceeded for the memory pending to be "
+              "freed, e.g. the garbage released in background");
+
 namespace nebula {
 namespace memory {
 
@@ -18,6 +29,47 @@ ThreadMemoryStats::~ThreadMemoryStats() {
   }
 }
 
+void MemoryStats::bindScope(MemoryScope* scope) {
+  auto& stats = threadMemoryStats_;
+  if (stats.scope != nullptr && stats.scopeUntracked != 0) {
+    instance().flushScope(0, false);
+  }
+  stats.scope = scope;
+  stats.scopeUntracked = 0;
+}
+
+void MemoryStats::flushScope(int64_t size, bool throw_if_memory_exceeded) {
+  auto& stats = threadMemoryStats_;
+  bool check = stats.throwOnMemoryExceeded && throw_if_memory_exceeded;
+  if (stats.scope->alloc(stats.scopeUntracked, check)) {
+    stats.scopeUntracked = 0;
+    return;
+  }
+  // revert the allocation both in the scope and the thread reservation
+  stats.scopeUntracked -= size;
+  stats.reserved += size;
+  stats.throwOnMemoryExceeded = false;
+  throw std::bad_alloc();
+}
+
+int64_t MemoryStats::pendingFreeCredit() {
+  // The pending free is estimated, so it's never trusted beyond a fraction of the limit
+  auto ratio = std::max(FLAGS_memory_tracker_pending_free_ratio, 0.0);
+  auto maxCredit = static_cast<int64_t>(limit_ * ratio);
+  return std::clamp(pendingFree(), static_cast<int64_t>(0), maxCredit);
+}
+
+bool MemoryStats::overcommit(int64_t willBe) {
+  if (willBe - pendingFreeCredit() <= limit_) {
+    return true;
+  }
+  auto ratio = FLAGS_memory_tracker_overcommit_ratio;
+  if (ratio <= 0 || willBe - limit_ > static_cast<int64_t>(limit_ * ratio)) {
+    return false;
+  }
+  return MemoryScope::failLargest();
+}
+
 void MemoryTracker::alloc(int64_t size) {
   bool throw_if_memory_exceeded = true;
   allocImpl(size, throw_if_memory_exceeded);
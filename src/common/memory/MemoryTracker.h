@@ -9,9 +9,13 @@
 
 #include "common/base/Base.h"
 
+DECLARE_double(memory_tracker_pending_free_ratio);
+
 namespace nebula {
 namespace memory {
 
+class MemoryScope;
+
 constexpr int64_t KiB = 1024;
 constexpr int64_t MiB = 1024 * KiB;
 constexpr int64_t GiB = 1024 * MiB;
@@ -43,6 +47,9 @@ struct ThreadMemoryStats {
   // reserved bytes size in current thread
   int64_t reserved;
   bool throwOnMemoryExceeded{false};
+  // the MemoryScope bound to current thread, and the bytes not flushed into it yet
+  MemoryScope* scope{nullptr};
+  int64_t scopeUntracked{0};
 };
 
 /**
@@ -55,6 +62,8 @@ struct ThreadMemoryStats {
  *            occurs, it first tries request size from local reserved.
  *    Global: Counting the global used memory, the actually used memory may less than the counted
  *            usage, since threads have quota reservation.
+ *    Scope:  The usage is also attributed to the MemoryScope bound to the thread, if any, see
+ *            MemoryScope.h.
  */
 class MemoryStats {
  public:
@@ -81,10 +90,23 @@ class MemoryStats {
     // Only update after successful allocations, failed allocations should not be taken into
     // account.
     threadMemoryStats_.reserved = willBe;
+
+    if (threadMemoryStats_.scope != nullptr) {
+      threadMemoryStats_.scopeUntracked += size;
+      if (UNLIKELY(threadMemoryStats_.scopeUntracked > kScopeUntrackedLimit_)) {
+        flushScope(size, throw_if_memory_exceeded);
+      }
+    }
   }
 
   /// Inform size of memory deallocation
   inline ALWAYS_INLINE void free(int64_t size) {
+    if (threadMemoryStats_.scope != nullptr) {
+      threadMemoryStats_.scopeUntracked -= size;
+      if (UNLIKELY(threadMemoryStats_.scopeUntracked < -kScopeUntrackedLimit_)) {
+        flushScope(0, false);
+      }
+    }
     threadMemoryStats_.reserved += size;
     // Return if local reserved exceed limit
     while (threadMemoryStats_.reserved > kLocalReservedLimit_) {
@@ -132,6 +154,21 @@ class MemoryStats {
     return used_ / static_cast<double>(limit_);
   }
 
+  /// Inform size of memory going to be freed soon, e.g. the garbage queued to be released in
+  /// background, and the negative size once it's freed
+  void pendingFree(int64_t size) {
+    pendingFree_.fetch_add(size, std::memory_order_relaxed);
+  }
+
+  /// Get bytes of memory going to be freed soon
+  int64_t pendingFree() {
+    return pendingFree_.load(std::memory_order_relaxed);
+  }
+
+  /// Get bytes of the pending free allowed to exceed the limit, at most
+  /// FLAGS_memory_tracker_pending_free_ratio of the limit
+  int64_t pendingFreeCredit();
+
   std::string toString() {
     return fmt::format("MemoryStats: {}/{}", ReadableSize(limit_), ReadableSize(used_));
   }
@@ -155,10 +192,20 @@ class MemoryStats {
     return threadMemoryStats_.throwOnMemoryExceeded = value;
   }
 
+  // Binds the scope to current thread, nullptr to unbind
+  static void bindScope(MemoryScope* scope);
+
+  static MemoryScope* currentScope() {
+    return threadMemoryStats_.scope;
+  }
+
  private:
   inline ALWAYS_INLINE void allocGlobal(int64_t size, bool throw_if_memory_exceeded) {
     int64_t willBe = size + used_.fetch_add(size, std::memory_order_relaxed);
     if (threadMemoryStats_.throwOnMemoryExceeded && throw_if_memory_exceeded && willBe > limit_) {
+      if (overcommit(willBe)) {
+        return;
+      }
       // revert
       used_.fetch_sub(size, std::memory_order_relaxed);
       threadMemoryStats_.throwOnMemoryExceeded = false;
@@ -166,14 +213,25 @@ class MemoryStats {
     }
   }
 
+  // Flushes the untracked bytes of current thread into its scope, `size' is of the allocation
+  // causing the flush, which is reverted if the scope exceeds its limit.
+  void flushScope(int64_t size, bool throw_if_memory_exceeded);
+
+  // Returns true if the allocation could exceed the limit, since the memory pending to be freed
+  // covers it, or another query has been chosen to fail to release the memory
+  bool overcommit(int64_t willBe);
+
  private:
   // Global
   alignas(CACHE_LINE_SIZE) int64_t limit_{std::numeric_limits<int64_t>::max()};
   std::atomic<int64_t> used_{0};
+  std::atomic<int64_t> pendingFree_{0};
   // Thread Local
   static thread_local ThreadMemoryStats threadMemoryStats_;
   // Each thread reserves this amount of memory
   static constexpr int64_t kLocalReservedLimit_ = 1 * MiB;
+  // Each thread flushes the usage of its scope once it accumulates this amount of memory
+  static constexpr int64_t kScopeUntrackedLimit_ = 256 * KiB;
 };
 
 // A guard to only enable memory check (throw when memory exceed) during its lifetime.
@@ -0,0 +1,68 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/memory/MemoryScope.h"
+#include "common/memory/MemoryTracker.h"
+
+namespace nebula {
+namespace memory {
+
+TEST(MemoryScopeTest, Hierarchy) {
+  auto user = MemoryScope::root()->child("user");
+  EXPECT_EQ(user, MemoryScope::root()->child("user"));
+  auto query = user->create("query", 100, true);
+  auto executor = query->create("executor");
+
+  ASSERT_TRUE(executor->alloc(60, true));
+  EXPECT_EQ(60, executor->used());
+  EXPECT_EQ(60, query->used());
+  EXPECT_EQ(60, user->used());
+
+  // Exceeds the limit of the query, nothing is accounted
+  ASSERT_FALSE(executor->alloc(60, true));
+  EXPECT_EQ(60, executor->used());
+  EXPECT_EQ(60, user->used());
+  // Not checked
+  ASSERT_TRUE(executor->alloc(60, false));
+  EXPECT_EQ(120, query->used());
+
+  ASSERT_TRUE(executor->alloc(-120, true));
+  EXPECT_EQ(0, query->used());
+  EXPECT_EQ(120, query->peak());
+  EXPECT_EQ(120, executor->peak());
+}
+
+TEST(MemoryScopeTest, FailLargest) {
+  auto user = MemoryScope::root()->child("user");
+  auto small = user->create("small", MemoryScope::kNoLimit, true);
+  auto large = user->create("large", MemoryScope::kNoLimit, true);
+  ASSERT_TRUE(small->alloc(10, true));
+  ASSERT_TRUE(large->create("executor")->alloc(1000, true));
+
+  {
+    MemoryScopeGuard guard(small);
+    EXPECT_EQ(small.get(), MemoryScope::current());
+    // The allocation in the small query goes on, and the large one fails
+    EXPECT_TRUE(MemoryScope::failLargest());
+  }
+  EXPECT_EQ(nullptr, MemoryScope::current());
+  EXPECT_FALSE(small->exceeded());
+  EXPECT_TRUE(large->exceeded());
+  EXPECT_FALSE(large->alloc(1, true));
+  EXPECT_TRUE(large->alloc(-1000, true));
+
+  {
+    MemoryScopeGuard guard(small);
+    // The current query is the largest now
+    EXPECT_FALSE(MemoryScope::failLargest());
+  }
+  EXPECT_FALSE(small->exceeded());
+  EXPECT_TRUE(small->alloc(-10, true));
+}
+
+}  // namespace memory
+}  // namespace nebula
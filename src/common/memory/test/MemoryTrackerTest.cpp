@@ -0,0 +1,40 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/memory/MemoryTracker.h"
+
+namespace nebula {
+namespace memory {
+
+TEST(MemoryTrackerTest, PendingFreeCredit) {
+  gflags::FlagSaver saver;
+  FLAGS_memory_tracker_pending_free_ratio = 0.1;
+  auto& stats = MemoryStats::instance();
+  auto limit = stats.getLimit();
+  auto pending = stats.pendingFree();
+  stats.setLimit(1000);
+  stats.pendingFree(-pending);
+
+  stats.pendingFree(50);
+  EXPECT_EQ(50, stats.pendingFreeCredit());
+  // Never trusted beyond the ratio of the limit
+  stats.pendingFree(1000);
+  EXPECT_EQ(100, stats.pendingFreeCredit());
+  // Released more than estimated
+  stats.pendingFree(-1100);
+  EXPECT_EQ(0, stats.pendingFreeCredit());
+
+  FLAGS_memory_tracker_pending_free_ratio = 0;
+  stats.pendingFree(50);
+  EXPECT_EQ(0, stats.pendingFreeCredit());
+
+  stats.pendingFree(pending - stats.pendingFree());
+  stats.setLimit(limit);
+}
+
+}  // namespace memory
+}  // namespace nebula
@@ -114,6 +114,10 @@ class SchemaManager {
   virtual StatusOr<std::unordered_map<std::string, nebula::meta::cpp2::FTIndex>> getFTIndex(
       GraphSpaceID spaceId, int32_t schemaId) = 0;
 
+  // Get all the fulltext indexes of the space
+  virtual StatusOr<std::unordered_map<std::string, nebula::meta::cpp2::FTIndex>> getFTIndexes(
+      GraphSpaceID spaceId) = 0;
+
  protected:
   SchemaManager() = default;
 };
@@ -168,6 +168,11 @@ ServerBasedSchemaManager::getFTIndex(GraphSpaceID spaceId, int32_t schemaId) {
   return std::move(ret).value();
 }
 
+StatusOr<std::unordered_map<std::string, nebula::meta::cpp2::FTIndex>>
+ServerBasedSchemaManager::getFTIndexes(GraphSpaceID spaceId) {
+  return metaClient_->getFTIndexBySpaceFromCache(spaceId);
+}
+
 std::unique_ptr<ServerBasedSchemaManager> ServerBasedSchemaManager::create(MetaClient *client) {
   auto mgr = std::make_unique<ServerBasedSchemaManager>();
   mgr->init(client);
@@ -57,17 +57,7 @@ std::vector<std::string> IndexKeyUtils::encodeValues(std::vector<Value>&& values
     const auto& value = values.back();
     if (!value.isNull()) {
       DCHECK(value.type() == Value::Type::GEOGRAPHY);
-      geo::RegionCoverParams rc;
-      const auto* indexParams = indexItem->get_index_params();
-      if (indexParams) {
-        if (indexParams->s2_max_level_ref().has_value()) {
-          rc.maxCellLevel_ = indexParams->s2_max_level_ref().value();
-        }
-        if (indexParams->s2_max_cells_ref().has_value()) {
-          rc.maxCellNum_ = indexParams->s2_max_cells_ref().value();
-        }
-      }
-      indexes = encodeGeography(value.getGeography(), rc);
+      indexes = encodeGeography(value.getGeography(), regionCoverParams(*indexItem));
     } else {
       nullableBitSet |= 0x8000;
       auto type = IndexKeyUtils::toValueType(cols.back().type.get_type());
@@ -151,6 +141,44 @@ std::string IndexKeyUtils::indexPrefix(PartitionID partId) {
   return key;
 }
 
+// static
+std::string IndexKeyUtils::vectorEntryKey(PartitionID partId, IndexID indexId) {
+  return indexPrefix(partId, indexId).append(1, kVectorEntry);
+}
+
+// static
+std::string IndexKeyUtils::vectorNodeKey(size_t vIdLen,
+                                         PartitionID partId,
+                                         IndexID indexId,
+                                         const VertexID& vId) {
+  std::string key = vectorNodePrefix(partId, indexId);
+  key.append(vId.data(), vId.size()).append(vIdLen - vId.size(), '\0');
+  return key;
+}
+
+// static
+std::string IndexKeyUtils::vectorNodePrefix(PartitionID partId, IndexID indexId) {
+  return indexPrefix(partId, indexId).append(1, kVectorNode);
+}
+
+// static
+geo::RegionCoverParams IndexKeyUtils::regionCoverParams(const meta::cpp2::IndexItem& index) {
+  geo::RegionCoverParams rc;
+  const auto* indexParams = index.get_index_params();
+  if (indexParams) {
+    if (indexParams->s2_min_level_ref().has_value()) {
+      rc.minCellLevel_ = indexParams->s2_min_level_ref().value();
+    }
+    if (indexParams->s2_max_level_ref().has_value()) {
+      rc.maxCellLevel_ = indexParams->s2_max_level_ref().value();
+    }
+    if (indexParams->s2_max_cells_ref().has_value()) {
+      rc.maxCellNum_ = indexParams->s2_max_cells_ref().value();
+    }
+  }
+  return rc;
+}
+
 // static
 std::string IndexKeyUtils::indexVal(const Value& v) {
   std::string val, cVal;
@@ -162,6 +190,13 @@ std::string IndexKeyUtils::indexVal(const Value& v) {
   return val;
 }
 
+// static
+std::string IndexKeyUtils::indexVal(const Value& ttl, List&& included) {
+  auto val = indexVal(ttl);
+  val.append(indexVal(Value(std::move(included))));
+  return val;
+}
+
 // static
 Value IndexKeyUtils::parseIndexTTL(const folly::StringPiece& raw) {
   Value value;
@@ -170,6 +205,24 @@ Value IndexKeyUtils::parseIndexTTL(const folly::StringPiece& raw) {
   return value;
 }
 
+// static
+std::vector<Value> IndexKeyUtils::parseIndexIncluded(const folly::StringPiece& raw) {
+  if (raw.size() < sizeof(size_t)) {
+    return {};
+  }
+  // Skip the ttl value
+  auto offset = sizeof(size_t) + *reinterpret_cast<const size_t*>(raw.data());
+  if (raw.size() < offset + sizeof(size_t)) {
+    return {};
+  }
+  // The included properties are encoded as a list in the same way as ttl value
+  auto value = parseIndexTTL(raw.subpiece(offset));
+  if (!value.isList()) {
+    return {};
+  }
+  return value.moveList().values;
+}
+
 // static
 StatusOr<std::vector<std::string>> IndexKeyUtils::collectIndexValues(
     RowReaderWrapper* reader,
@@ -178,6 +231,9 @@ StatusOr<std::vector<std::string>> IndexKeyUtils::collectIndexValues(
   if (reader == nullptr) {
     return Status::Error("Invalid row reader");
   }
+  if (isVectorIndex(*indexItem)) {
+    return Status::Error("Vector index has no index key");
+  }
   auto& cols = indexItem->get_fields();
   std::vector<Value> values;
   for (const auto& col : cols) {
@@ -548,10 +548,45 @@ class IndexKeyUtils final {
 
   static std::string indexPrefix(PartitionID partId);
 
+  /**
+   * The HNSW graph of a vector index is stored in the key space of the index:
+   * entry point: indexPrefix(partId, indexId) + kVectorEntry => vid
+   * node:        indexPrefix(partId, indexId) + kVectorNode + vid => vector and neighbors
+   **/
+  static std::string vectorEntryKey(PartitionID partId, IndexID indexId);
+
+  static std::string vectorNodeKey(size_t vIdLen,
+                                   PartitionID partId,
+                                   IndexID indexId,
+                                   const VertexID& vId);
+
+  static std::string vectorNodePrefix(PartitionID partId, IndexID indexId);
+
+  static bool isVectorIndex(const meta::cpp2::IndexItem& index) {
+    return index.index_params_ref().has_value() &&
+           index.index_params_ref()->vector_metric_ref().has_value();
+  }
+
+  /**
+   * @brief Region coverer params of a geo index, the default ones are used if not specified
+   */
+  static geo::RegionCoverParams regionCoverParams(const meta::cpp2::IndexItem& index);
+
   static std::string indexVal(const Value& v);
 
+  /**
+   * @brief Index value which stores the included properties of a covering index after the ttl
+   * value, the ttl value is NULL if there is no ttl property
+   */
+  static std::string indexVal(const Value& ttl, List&& included);
+
   static Value parseIndexTTL(const folly::StringPiece& raw);
 
+  /**
+   * @brief The included properties in index value, empty if the index value has none
+   */
+  static std::vector<Value> parseIndexIncluded(const folly::StringPiece& raw);
+
   static StatusOr<std::vector<std::string>> collectIndexValues(
       RowReaderWrapper* reader,
       const meta::cpp2::IndexItem* indexItem,
@@ -565,6 +600,9 @@ class IndexKeyUtils final {
                                                  const meta::NebulaSchemaProvider* latestSchema);
 
   static Status checkValue(const Value& v, bool isNullable);
+
+  static constexpr char kVectorEntry = '\x00';
+  static constexpr char kVectorNode = '\x01';
 };
 
 }  // namespace nebula
@@ -0,0 +1,131 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef COMMON_UTILS_INDEXSTATSUTILS_H_
+#define COMMON_UTILS_INDEXSTATSUTILS_H_
+
+#include <folly/Random.h>
+
+#include "common/algorithm/HyperLogLog.h"
+#include "common/base/Base.h"
+#include "interface/gen-cpp2/meta_types.h"
+
+namespace nebula {
+
+/**
+ * Utils to merge the partial index statistics collected from partitions and build the final
+ * statistics. The partial statistics carry the HyperLogLog sketch and the sampled values, which
+ * are dropped once the ndv and histogram are computed.
+ * */
+class IndexStatsUtils final {
+ public:
+  IndexStatsUtils() = delete;
+
+  // Merge the partial statistics `other` of the same index into `stats`, at most `maxSamples`
+  // values are kept for each column.
+  static void merge(meta::cpp2::IndexStats& stats,
+                    const meta::cpp2::IndexStats& other,
+                    size_t maxSamples) {
+    auto& columns = *stats.columns_ref();
+    const auto& otherColumns = other.get_columns();
+    if (columns.empty()) {
+      stats.index_id_ref() = other.get_index_id();
+      columns = otherColumns;
+    } else if (columns.size() == otherColumns.size()) {
+      for (size_t i = 0; i < columns.size(); ++i) {
+        mergeColumn(columns[i], *stats.rows_ref(), otherColumns[i], other.get_rows(), maxSamples);
+      }
+    } else {
+      LOG(WARNING) << "Columns of index " << other.get_index_id() << " mismatch, ignore it";
+      return;
+    }
+    *stats.rows_ref() += other.get_rows();
+    stats.update_time_ref() = std::max(stats.get_update_time(), other.get_update_time());
+  }
+
+  // Compute the ndv and the equi-depth histogram of `buckets` buckets from the merged sketch and
+  // samples, then drop them.
+  static void finalize(meta::cpp2::IndexStats& stats, size_t buckets) {
+    for (auto& column : *stats.columns_ref()) {
+      auto nonNullRows = std::max<int64_t>(stats.get_rows() - column.get_null_count(), 0);
+      if (column.sketch_ref().has_value()) {
+        auto hll = algorithm::HyperLogLog::fromRegisters(*column.sketch_ref());
+        if (hll.ok()) {
+          column.ndv_ref() = std::min<int64_t>(hll.value().estimate(), nonNullRows);
+        }
+      }
+      column.histogram_ref()->clear();
+      if (column.samples_ref().has_value() && !column.samples_ref()->empty() && buckets > 0) {
+        auto& samples = *column.samples_ref();
+        std::sort(samples.begin(), samples.end());
+        auto num = std::min(buckets, samples.size());
+        for (size_t i = 1; i <= num; ++i) {
+          column.histogram_ref()->emplace_back(samples[i * samples.size() / num - 1]);
+        }
+      }
+      column.sketch_ref().reset();
+      column.samples_ref().reset();
+    }
+  }
+
+ private:
+  static void mergeColumn(meta::cpp2::IndexColumnStats& column,
+                          int64_t rows,
+                          const meta::cpp2::IndexColumnStats& other,
+                          int64_t otherRows,
+                          size_t maxSamples) {
+    auto nonNullRows = std::max<int64_t>(rows - column.get_null_count(), 0);
+    auto otherNonNullRows = std::max<int64_t>(otherRows - other.get_null_count(), 0);
+    *column.null_count_ref() += other.get_null_count();
+
+    if (other.sketch_ref().has_value()) {
+      if (!column.sketch_ref().has_value()) {
+        column.sketch_ref() = *other.sketch_ref();
+      } else {
+        auto lhs = algorithm::HyperLogLog::fromRegisters(*column.sketch_ref());
+        auto rhs = algorithm::HyperLogLog::fromRegisters(*other.sketch_ref());
+        if (lhs.ok() && rhs.ok() && lhs.value().merge(rhs.value())) {
+          column.sketch_ref() = lhs.value().registers();
+        }
+      }
+    }
+
+    // Keep the samples of both sides in proportion to their non-null rows, so the merged samples
+    // still represent the whole data set
+    std::vector<Value> lhs;
+    std::vector<Value> rhs;
+    if (column.samples_ref().has_value()) {
+      lhs = std::move(*column.samples_ref());
+    }
+    if (other.samples_ref().has_value()) {
+      rhs = *other.samples_ref();
+    }
+    auto total = std::min(maxSamples, lhs.size() + rhs.size());
+    size_t numLhs = lhs.size();
+    if (nonNullRows + otherNonNullRows > 0) {
+      double ratio = static_cast<double>(nonNullRows) / (nonNullRows + otherNonNullRows);
+      numLhs = static_cast<size_t>(std::llround(total * ratio));
+    }
+    numLhs = std::max(std::min(numLhs, lhs.size()), total - std::min(total, rhs.size()));
+    auto numRhs = std::min(total - numLhs, rhs.size());
+    std::vector<Value> samples;
+    samples.reserve(numLhs + numRhs);
+    pick(lhs, numLhs, samples);
+    pick(rhs, numRhs, samples);
+    column.samples_ref() = std::move(samples);
+  }
+
+  // Randomly pick `num` values from `values` into `result`
+  static void pick(std::vector<Value>& values, size_t num, std::vector<Value>& result) {
+    for (size_t i = 0; i < num && i < values.size(); ++i) {
+      auto j = i + folly::Random::rand64(values.size() - i);
+      std::swap(values[i], values[j]);
+      result.emplace_back(std::move(values[i]));
+    }
+  }
+};
+
+}  // namespace nebula
+#endif  // COMMON_UTILS_INDEXSTATSUTILS_H_
@@ -51,6 +51,7 @@ static const std::unordered_map<
                  {"leader_terms", {"__leader_terms__", nullptr}},
                  {"listener", {"__listener__", nullptr}},
                  {"stats", {"__stats__", MetaKeyUtils::parseStatsSpace}},
+                 {"index_stats", {"__index_stats__", MetaKeyUtils::parseIndexStatsSpace}},
                  {"balance_task", {"__balance_task__", nullptr}},
                  {"balance_plan", {"__balance_plan__", nullptr}},
                  {"ft_index", {"__ft_index__", nullptr}},
@@ -97,6 +98,8 @@ static const std::string kJobTable              = tableMaps.at("job_manager").fi
 // The number of vertices of each tag in the space
 // The number of edges of each edgetype in the space
 static const std::string kStatsTable          = tableMaps.at("stats").first;            // NOLINT
+// The statistics of indexes in the space, the value is a StatsItem with only index_stats
+static const std::string kIndexStatsTable     = tableMaps.at("index_stats").first;      // NOLINT
 static const std::string kBalanceTaskTable    = tableMaps.at("balance_task").first;     // NOLINT
 static const std::string kBalancePlanTable    = tableMaps.at("balance_plan").first;     // NOLINT
 static const std::string kLocalIdTable        = tableMaps.at("local_id").first;         // NOLINT
@@ -1225,6 +1228,19 @@ const std::string& MetaKeyUtils::statsKeyPrefix() {
   return kStatsTable;
 }
 
+std::string MetaKeyUtils::indexStatsKey(GraphSpaceID spaceId) {
+  std::string key;
+  key.reserve(kIndexStatsTable.size() + sizeof(GraphSpaceID));
+  key.append(kIndexStatsTable.data(), kIndexStatsTable.size())
+      .append(reinterpret_cast<const char*>(&spaceId), sizeof(GraphSpaceID));
+  return key;
+}
+
+GraphSpaceID MetaKeyUtils::parseIndexStatsSpace(folly::StringPiece rawData) {
+  auto offset = kIndexStatsTable.size();
+  return *reinterpret_cast<const GraphSpaceID*>(rawData.data() + offset);
+}
+
 std::string MetaKeyUtils::serviceKey(const meta::cpp2::ExternalServiceType& type) {
   std::string key;
   key.reserve(kServicesTable.size() + sizeof(meta::cpp2::ExternalServiceType));
@@ -360,6 +360,11 @@ class MetaKeyUtils final {
 
   static GraphSpaceID parseStatsSpace(folly::StringPiece rawData);
 
+  // The value of index stats key is encoded by statsVal
+  static std::string indexStatsKey(GraphSpaceID spaceId);
+
+  static GraphSpaceID parseIndexStatsSpace(folly::StringPiece rawData);
+
   static std::string serviceKey(const meta::cpp2::ExternalServiceType& type);
 
   static std::string serviceVal(const std::vector<meta::cpp2::ServiceClient>& client);
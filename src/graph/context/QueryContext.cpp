@@ -5,6 +5,8 @@
 
 #include "graph/context/QueryContext.h"
 
+#include "graph/service/GraphFlags.h"
+
 namespace nebula {
 namespace graph {
 
@@ -40,6 +42,16 @@ void QueryContext::init() {
   idGen_ = std::make_unique<IdGenerator>(0);
   symTable_ = std::make_unique<SymbolTable>(objPool_.get(), ectx_.get());
   vctx_ = std::make_unique<ValidateContext>(std::make_unique<AnonVarGenerator>(symTable_.get()));
+
+  auto parentScope = memory::MemoryScope::root();
+  if (rctx_ && rctx_->session() != nullptr) {
+    parentScope = parentScope->child(rctx_->session()->user());
+  }
+  int64_t memoryLimit = memory::MemoryScope::kNoLimit;
+  if (FLAGS_max_query_memory_bytes > 0) {
+    memoryLimit = FLAGS_max_query_memory_bytes;
+  }
+  memoryScope_ = parentScope->create("query", memoryLimit, true);
 }
 
 }  // namespace graph
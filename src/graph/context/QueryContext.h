@@ -12,6 +12,7 @@
 #include "common/charset/Charset.h"
 #include "common/cpp/helpers.h"
 #include "common/datatypes/Value.h"
+#include "common/memory/MemoryScope.h"
 #include "common/meta/IndexManager.h"
 #include "common/meta/SchemaManager.h"
 #include "graph/context/ExecutionContext.h"
@@ -136,6 +137,21 @@ class QueryContext {
     return killed_.load();
   }
 
+  // Set by the parser if the query may return different results for the same data, e.g. it calls
+  // rand() or now(), or samples edges.
+  void setNonDeterministic() {
+    nonDeterministic_ = true;
+  }
+
+  bool isNonDeterministic() const {
+    return nonDeterministic_;
+  }
+
+  // The memory accounting of the query, under the one of its user
+  const std::shared_ptr<memory::MemoryScope>& memoryScope() const {
+    return memoryScope_;
+  }
+
   // This is only valid in building stage!
   // TODO remove parameter from variables map
   bool existParameter(const std::string& param) const {
@@ -162,6 +178,8 @@ class QueryContext {
   std::unique_ptr<SymbolTable> symTable_;
 
   std::atomic<bool> killed_{false};
+  bool nonDeterministic_{false};
+  std::shared_ptr<memory::MemoryScope> memoryScope_;
 };
 
 }  // namespace graph
@@ -5,6 +5,8 @@
 
 #include "graph/context/QueryExpressionContext.h"
 
+#include "common/expression/PropertyExpression.h"
+
 namespace nebula {
 namespace graph {
 const Value& QueryExpressionContext::getVar(const std::string& var) const {
@@ -94,6 +96,27 @@ const Value& QueryExpressionContext::getColumn(int32_t index) const {
   return iter_->getColumn(index);
 }
 
+int32_t QueryExpressionContext::getPropSlot(const PropertyExpression* expr) const {
+  if (iter_ == nullptr) {
+    return -1;
+  }
+  switch (expr->kind()) {
+    case Expression::Kind::kEdgeProperty:
+    case Expression::Kind::kEdgeSrc:
+    case Expression::Kind::kEdgeType:
+    case Expression::Kind::kEdgeRank:
+    case Expression::Kind::kEdgeDst:
+      return iter_->getEdgePropSlot(expr->sym(), expr->prop());
+    // The same as getTagProp(), getSrcProp() and getDstProp()
+    case Expression::Kind::kTagProperty:
+    case Expression::Kind::kSrcProperty:
+    case Expression::Kind::kDstProperty:
+      return iter_->getTagPropSlot(expr->sym(), expr->prop());
+    default:
+      return -1;
+  }
+}
+
 Value QueryExpressionContext::getVertex(const std::string& name) const {
   if (iter_ == nullptr) {
     return Value::kEmpty;
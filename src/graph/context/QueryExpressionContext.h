@@ -63,6 +63,17 @@ class QueryExpressionContext final : public ExpressionContext {
   // Get the value by column index
   const Value& getColumn(int32_t index) const override;
 
+  uint64_t propSlotsId() const override {
+    return iter_ == nullptr ? 0 : iter_->propSlotsId();
+  }
+
+  // Resolve the tag and edge properties to the slots of the iterator
+  int32_t getPropSlot(const PropertyExpression* expr) const override;
+
+  const Value& getPropBySlot(int32_t slot) const override {
+    return iter_->getPropBySlot(slot);
+  }
+
   // Get Vertex
   Value getVertex(const std::string& name = "") const override;
 
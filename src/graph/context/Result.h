@@ -8,6 +8,7 @@
 
 #include <vector>
 
+#include "common/memory/MemoryScope.h"
 #include "graph/context/Iterator.h"
 
 namespace nebula {
@@ -63,6 +64,12 @@ class Result final {
     }
   }
 
+  // The memory of the result is freed in the scope of the executor producing it, wherever the
+  // result is released, e.g. dropped by its last consumer or by the GC thread
+  void setMemoryScope(std::shared_ptr<memory::MemoryScope> scope) {
+    core_.memoryScope = std::move(scope);
+  }
+
   std::vector<std::string> getColNames() const {
     auto& ds = value();
     if (ds.isDataSet()) {
@@ -83,25 +90,50 @@ class Result final {
   struct Core {
     Core() = default;
     Core(Core&&) = default;
-    Core& operator=(Core&&) = default;
+    Core& operator=(Core&& c) {
+      if (&c != this) {
+        release();
+        checkMemory = c.checkMemory;
+        state = c.state;
+        msg = std::move(c.msg);
+        value = std::move(c.value);
+        iter = std::move(c.iter);
+        memoryScope = std::move(c.memoryScope);
+      }
+      return *this;
+    }
     Core(const Core& c) {
       *this = c;
     }
     Core& operator=(const Core& c) {
       if (&c != this) {
+        release();
         state = c.state;
         msg = c.msg;
         value = c.value;
         iter = c.iter->copy();
+        memoryScope = c.memoryScope;
       }
       return *this;
     }
+    ~Core() {
+      release();
+    }
+
+    void release() {
+      if (memoryScope != nullptr && memoryScope.get() != memory::MemoryScope::current()) {
+        memory::MemoryScopeGuard guard(memoryScope);
+        iter.reset();
+        value.reset();
+      }
+    }
 
     bool checkMemory{false};
     State state;
     std::string msg;
     std::shared_ptr<Value> value;
     std::unique_ptr<Iterator> iter;
+    std::shared_ptr<memory::MemoryScope> memoryScope;
   };
 
   explicit Result(Core&& core) : core_(std::move(core)) {}
@@ -127,6 +127,14 @@ struct LookupContext final : public AstContext {
   bool hasScore{false};
   Expression* fulltextExpr{nullptr};
 
+  // k nearest neighbors search on a vector index or a geography index
+  bool isVectorIndex{false};
+  bool isGeoKnn{false};
+  bool hasDistance{false};
+  IndexID knnIndexId{-1};
+  storage::cpp2::VectorQuery vectorQuery;
+  storage::cpp2::GeoKnnQuery geoKnnQuery;
+
   // order by
 };
 
@@ -148,6 +156,28 @@ struct SubgraphContext final : public AstContext {
   bool getEdgeProp{false};
 };
 
+struct RandomWalkContext final : public AstContext {
+  Starts from;
+  StepClause steps;
+  Over over;
+  // The edge prop to weight the neighbors by, empty if uniform
+  std::string weightProp;
+  double restart{0.0};
+  size_t walks{1};
+  std::vector<std::string> colNames;
+};
+
+struct GraphAlgoContext final : public AstContext {
+  // One of pagerank, wcc and lpa
+  std::string algorithm;
+  Over over;
+  size_t maxIterations{20};
+  // Only for pagerank
+  double damping{0.85};
+  double tolerance{1e-6};
+  std::vector<std::string> colNames;
+};
+
 struct FetchVerticesContext final : public AstContext {
   Starts from;
   bool distinct{false};
@@ -416,6 +416,114 @@ const Value& GetNeighborsIter::getEdgeProp(const std::string& edge, const std::s
   return currentEdge_->values[propIndex->second];
 }
 
+// static
+uint64_t GetNeighborsIter::nextPropSlotsId() {
+  static std::atomic<uint64_t> id{1};
+  return id.fetch_add(1, std::memory_order_relaxed);
+}
+
+int32_t GetNeighborsIter::getTagPropSlot(const std::string& tag, const std::string& prop) {
+  if (tag == "*") {
+    return -1;
+  }
+  return addPropSlot(false, tag, prop);
+}
+
+int32_t GetNeighborsIter::getEdgePropSlot(const std::string& edge, const std::string& prop) {
+  return addPropSlot(true, edge, prop);
+}
+
+int32_t GetNeighborsIter::addPropSlot(bool isEdge,
+                                      const std::string& name,
+                                      const std::string& prop) {
+  for (size_t i = 0; i < propSlots_.size(); ++i) {
+    auto& slot = propSlots_[i];
+    if (slot.isEdge == isEdge && slot.name == name && slot.prop == prop) {
+      return i;
+    }
+  }
+  propSlots_.emplace_back(PropSlot{isEdge, name, prop});
+  for (auto& dsIndex : dsIndices_) {
+    resolvePropSlot(propSlots_.back(), &dsIndex);
+  }
+  return propSlots_.size() - 1;
+}
+
+void GetNeighborsIter::resolvePropSlot(const PropSlot& slot, DataSetIndex* dsIndex) const {
+  // Keep the tables of tags and edges indexed by the same slots
+  dsIndex->tagSlots.emplace_back(-1, -1);
+  if (dsIndex->edgeSlots.empty() && dsIndex->colLowerBound >= 0) {
+    dsIndex->edgeSlots.resize(dsIndex->colUpperBound - dsIndex->colLowerBound - 1);
+  }
+  for (auto& edgeSlots : dsIndex->edgeSlots) {
+    edgeSlots.emplace_back(-1);
+  }
+
+  if (!slot.isEdge) {
+    auto index = dsIndex->tagPropsMap.find(slot.name);
+    if (index == dsIndex->tagPropsMap.end()) {
+      return;
+    }
+    auto propIndex = index->second.propIndices.find(slot.prop);
+    if (propIndex == index->second.propIndices.end()) {
+      return;
+    }
+    dsIndex->tagSlots.back() = {index->second.colIdx, propIndex->second};
+    return;
+  }
+
+  for (size_t i = 0; i < dsIndex->edgeSlots.size(); ++i) {
+    // The edge name has the direction symbol
+    auto name = dsIndex->tagEdgeNameIndices.find(dsIndex->colLowerBound + 1 + i);
+    if (name == dsIndex->tagEdgeNameIndices.end()) {
+      continue;
+    }
+    auto& edgeName = name->second;
+    if (slot.name != "*" && edgeName.compare(1, std::string::npos, slot.name) != 0) {
+      continue;
+    }
+    auto index = dsIndex->edgePropsMap.find(edgeName);
+    if (index == dsIndex->edgePropsMap.end()) {
+      continue;
+    }
+    auto propIndex = index->second.propIndices.find(slot.prop);
+    if (propIndex != index->second.propIndices.end()) {
+      dsIndex->edgeSlots[i].back() = propIndex->second;
+    }
+  }
+}
+
+const Value& GetNeighborsIter::getPropBySlot(int32_t slot) const {
+  if (!valid()) {
+    return Value::kNullValue;
+  }
+  DCHECK_LT(static_cast<size_t>(slot), propSlots_.size());
+
+  if (propSlots_[slot].isEdge) {
+    if (noEdge_) {
+      return Value::kEmpty;
+    }
+    auto propIdx = currentDs_->edgeSlots[colIdx_ - currentDs_->colLowerBound - 1][slot];
+    if (propIdx < 0) {
+      return Value::kEmpty;
+    }
+    return currentEdge_->values[propIdx];
+  }
+
+  auto& pos = currentDs_->tagSlots[slot];
+  if (pos.first < 0) {
+    return Value::kEmpty;
+  }
+  auto& col = (*currentRow_)[pos.first];
+  if (col.empty()) {
+    return Value::kEmpty;
+  }
+  if (!col.isList()) {
+    return Value::kNullBadType;
+  }
+  return col.getList().values[pos.second];
+}
+
 Value GetNeighborsIter::getVertex(const std::string& name) {
   UNUSED(name);
   if (!valid()) {
@@ -21,6 +21,8 @@ class GetNeighborsIter final : public Iterator {
 
   std::unique_ptr<Iterator> copy() const override {
     auto copy = std::make_unique<GetNeighborsIter>(*this);
+    // The copy resolves its own slots
+    copy->propSlotsId_ = nextPropSlotsId();
     copy->reset();
     return copy;
   }
@@ -82,6 +84,21 @@ class GetNeighborsIter final : public Iterator {
 
   const Value& getEdgeProp(const std::string& edge, const std::string& prop) const override;
 
+  uint64_t propSlotsId() const override {
+    return propSlotsId_;
+  }
+
+  // Resolves the tag property to a slot, i.e. the column of the tag and the index of the prop in
+  // it, for each dataset. Not supported for the tag `*'.
+  int32_t getTagPropSlot(const std::string& tag, const std::string& prop) override;
+
+  // Resolves the edge property to a slot, i.e. the index of the prop in each edge column of each
+  // dataset.
+  int32_t getEdgePropSlot(const std::string& edge, const std::string& prop) override;
+
+  // The same as getTagProp()/getEdgeProp(), but without looking up the names
+  const Value& getPropBySlot(int32_t slot) const override;
+
   Value getVertex(const std::string& name = "") override;
 
   Value getEdge() const override;
@@ -149,8 +166,27 @@ class GetNeighborsIter final : public Iterator {
 
     int64_t colLowerBound{-1};
     int64_t colUpperBound{-1};
+
+    // The positions of the property slots, indexed by the slot.
+    // tag  -> {column_idx, prop_idx}, -1 if the tag or the prop doesn't exist
+    std::vector<std::pair<int64_t, int64_t>> tagSlots;
+    // edge -> prop_idx in each edge column, -1 if the column isn't of the edge or has no such
+    //         prop, i.e. edgeSlots[colIdx - colLowerBound - 1][slot]
+    std::vector<std::vector<int64_t>> edgeSlots;
   };
 
+  struct PropSlot {
+    bool isEdge;
+    std::string name;
+    std::string prop;
+  };
+
+  static uint64_t nextPropSlotsId();
+
+  int32_t addPropSlot(bool isEdge, const std::string& name, const std::string& prop);
+
+  void resolvePropSlot(const PropSlot& slot, DataSetIndex* dsIndex) const;
+
   Status processList(std::shared_ptr<Value> value);
 
   void goToFirstEdge();
@@ -185,6 +221,9 @@ class GetNeighborsIter final : public Iterator {
   boost::dynamic_bitset<> bitset_;
   int64_t bitIdx_{-1};
   Value prevVertex_;
+
+  uint64_t propSlotsId_{nextPropSlotsId()};
+  std::vector<PropSlot> propSlots_;
 };
 
 }  // namespace graph
@@ -139,6 +139,27 @@ class Iterator {
     return Value::kEmpty;
   }
 
+  // The identity of the property slots, 0 if the iterator doesn't support them.
+  // See ExpressionContext::getPropSlot()
+  virtual uint64_t propSlotsId() const {
+    return 0;
+  }
+
+  // Resolves the tag property to a slot, -1 if not supported
+  virtual int32_t getTagPropSlot(const std::string&, const std::string&) {
+    return -1;
+  }
+
+  // Resolves the edge property to a slot, -1 if not supported
+  virtual int32_t getEdgePropSlot(const std::string&, const std::string&) {
+    return -1;
+  }
+
+  virtual const Value& getPropBySlot(int32_t) const {
+    DLOG(FATAL) << "Shouldn't call the unimplemented method";
+    return Value::kEmpty;
+  }
+
   virtual Value getVertex(const std::string& name = "") {
     UNUSED(name);
     return Value();
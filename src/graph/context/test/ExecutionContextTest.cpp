@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "common/base/Base.h"
+#include "common/memory/MemoryScope.h"
 #include "graph/context/ExecutionContext.h"
 
 namespace nebula {
@@ -59,5 +60,40 @@ TEST(ExecutionContextTest, TestResult) {
   EXPECT_TRUE(result.valuePtr()->isDataSet());
 }
 
+TEST(ExecutionContextTest, FreeResultInProducerScope) {
+#ifndef ENABLE_MEMORY_TRACKER
+  GTEST_SKIP() << "The memory is not tracked";
+#endif
+  auto query =
+      memory::MemoryScope::root()->create("query", memory::MemoryScope::kNoLimit, true);
+  auto producer = query->create("producer");
+  auto consumer = query->create("consumer");
+  constexpr int64_t kSize = 4 * 1024 * 1024;
+  ExecutionContext ctx;
+  {
+    memory::MemoryScopeGuard guard(producer);
+    auto result = ResultBuilder()
+                      .value(Value(std::string(kSize, 'a')))
+                      .iter(Iterator::Kind::kDefault)
+                      .build();
+    result.setMemoryScope(producer);
+    ctx.setResult("produced", std::move(result));
+  }
+  EXPECT_GE(producer->used(), kSize);
+
+  {
+    memory::MemoryScopeGuard guard(consumer);
+    // The consumer reads the result and drops it as the last user
+    EXPECT_EQ(kSize, static_cast<int64_t>(ctx.getResult("produced").value().getStr().size()));
+    ctx.dropResult("produced");
+    EXPECT_EQ(consumer.get(), memory::MemoryScope::current());
+    ctx.setValue("consumed", Value(std::string(kSize, 'b')));
+  }
+  // The free is credited to the producer, not offset against the allocation of the consumer
+  EXPECT_LT(producer->used(), kSize);
+  EXPECT_GE(consumer->used(), kSize);
+  EXPECT_GE(consumer->peak(), kSize);
+}
+
 }  // namespace graph
 }  // namespace nebula
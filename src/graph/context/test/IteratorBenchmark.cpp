@@ -133,6 +133,26 @@ size_t getEdgeProp(size_t iters) {
   return iters * ops;
 }
 
+size_t getTagPropBySlot(size_t iters) {
+  constexpr size_t ops = 100000UL;
+  auto slot = gGNIter->getTagPropSlot("tag1", "prop1");
+  for (size_t i = 0; i < iters * ops; ++i) {
+    auto& val = gGNIter->getPropBySlot(slot);
+    folly::doNotOptimizeAway(val);
+  }
+  return iters * ops;
+}
+
+size_t getEdgePropBySlot(size_t iters) {
+  constexpr size_t ops = 100000UL;
+  auto slot = gGNIter->getEdgePropSlot("edge1", "prop1");
+  for (size_t i = 0; i < iters * ops; ++i) {
+    auto& val = gGNIter->getPropBySlot(slot);
+    folly::doNotOptimizeAway(val);
+  }
+  return iters * ops;
+}
+
 size_t getVertex(size_t iters) {
   constexpr size_t ops = 100000UL;
   for (size_t i = 0; i < iters * ops; ++i) {
@@ -155,7 +175,9 @@ BENCHMARK_NAMED_PARAM_MULTI(getNeighborsIterCtor, get_neighbors_ctor_40_edges, g
 BENCHMARK_NAMED_PARAM_MULTI(getNeighborsIterCtor, get_neighbors_ctor_4000_edges, gDataSets2)
 BENCHMARK_NAMED_PARAM_MULTI(getColumnForGetNeighborsIter, get_column_1)
 BENCHMARK_NAMED_PARAM_MULTI(getTagProp, get_tag_prop)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(getTagPropBySlot, get_tag_prop_by_slot)
 BENCHMARK_NAMED_PARAM_MULTI(getEdgeProp, get_edge_prop)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(getEdgePropBySlot, get_edge_prop_by_slot)
 BENCHMARK_NAMED_PARAM_MULTI(getVertex, get_vertex)
 BENCHMARK_NAMED_PARAM_MULTI(getEdge, get_edge)
 BENCHMARK_NAMED_PARAM_MULTI(getTagProps, get_tag_4000)
@@ -299,6 +299,44 @@ TEST(IteratorTest, GetNeighbor) {
     EXPECT_EQ(result.size(), 40);
     EXPECT_EQ(expected, result);
   }
+  // props by slots
+  {
+    GetNeighborsIter iter(val);
+    auto copyIter = iter.copy();
+    EXPECT_NE(0, iter.propSlotsId());
+    EXPECT_NE(iter.propSlotsId(), copyIter->propSlotsId());
+    std::vector<std::pair<std::string, std::string>> tagProps = {
+        {"tag1", "prop1"}, {"tag2", "prop2"}, {"tag1", "noexist"}, {"noexist", "prop1"}};
+    std::vector<std::pair<std::string, std::string>> edgeProps = {{"edge1", "prop1"},
+                                                                  {"edge2", "prop2"},
+                                                                  {"*", "prop1"},
+                                                                  {"edge1", kDst},
+                                                                  {"edge2", kRank},
+                                                                  {"edge1", "noexist"}};
+    std::vector<int32_t> tagSlots, edgeSlots;
+    for (auto& tagProp : tagProps) {
+      tagSlots.emplace_back(iter.getTagPropSlot(tagProp.first, tagProp.second));
+    }
+    for (auto& edgeProp : edgeProps) {
+      edgeSlots.emplace_back(iter.getEdgePropSlot(edgeProp.first, edgeProp.second));
+    }
+    EXPECT_EQ(-1, iter.getTagPropSlot("*", "prop1"));
+    EXPECT_EQ(tagSlots[0], iter.getTagPropSlot("tag1", "prop1"));
+    EXPECT_EQ(edgeSlots[0], iter.getEdgePropSlot("edge1", "prop1"));
+    size_t count = 0;
+    for (; iter.valid(); iter.next()) {
+      for (size_t i = 0; i < tagProps.size(); ++i) {
+        EXPECT_EQ(iter.getTagProp(tagProps[i].first, tagProps[i].second),
+                  iter.getPropBySlot(tagSlots[i]));
+      }
+      for (size_t i = 0; i < edgeProps.size(); ++i) {
+        EXPECT_EQ(iter.getEdgeProp(edgeProps[i].first, edgeProps[i].second),
+                  iter.getPropBySlot(edgeSlots[i]));
+      }
+      ++count;
+    }
+    EXPECT_EQ(40, count);
+  }
   // erase
   {
     GetNeighborsIter iter(val);
@@ -48,7 +48,9 @@
 #include "graph/executor/algo/AllPathsExecutor.h"
 #include "graph/executor/algo/BFSShortestPathExecutor.h"
 #include "graph/executor/algo/CartesianProductExecutor.h"
+#include "graph/executor/algo/GraphAlgoExecutor.h"
 #include "graph/executor/algo/MultiShortestPathExecutor.h"
+#include "graph/executor/algo/RandomWalkExecutor.h"
 #include "graph/executor/algo/ShortestPathExecutor.h"
 #include "graph/executor/algo/SubgraphExecutor.h"
 #include "graph/executor/logic/ArgumentExecutor.h"
@@ -82,6 +84,7 @@
 #include "graph/executor/query/LeftJoinExecutor.h"
 #include "graph/executor/query/LimitExecutor.h"
 #include "graph/executor/query/MinusExecutor.h"
+#include "graph/executor/query/MultiwayJoinExecutor.h"
 #include "graph/executor/query/PatternApplyExecutor.h"
 #include "graph/executor/query/ProjectExecutor.h"
 #include "graph/executor/query/RollUpApplyExecutor.h"
@@ -479,6 +482,12 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
     case PlanNode::Kind::kSubgraph: {
       return pool->makeAndAdd<SubgraphExecutor>(node, qctx);
     }
+    case PlanNode::Kind::kRandomWalk: {
+      return pool->makeAndAdd<RandomWalkExecutor>(node, qctx);
+    }
+    case PlanNode::Kind::kGraphAlgo: {
+      return pool->makeAndAdd<GraphAlgoExecutor>(node, qctx);
+    }
     case PlanNode::Kind::kAddHosts: {
       return pool->makeAndAdd<AddHostsExecutor>(node, qctx);
     }
@@ -560,6 +569,9 @@ Executor *Executor::makeExecutor(QueryContext *qctx, const PlanNode *node) {
     case PlanNode::Kind::kCrossJoin: {
       return pool->makeAndAdd<CrossJoinExecutor>(node, qctx);
     }
+    case PlanNode::Kind::kMultiwayJoin: {
+      return pool->makeAndAdd<MultiwayJoinExecutor>(node, qctx);
+    }
     case PlanNode::Kind::kRollUpApply: {
       return pool->makeAndAdd<RollUpApplyExecutor>(node, qctx);
     }
@@ -609,6 +621,10 @@ Status Executor::open() {
   numRows_ = 0;
   execTime_ = 0;
   totalDuration_.reset();
+  // Kept through the iterations of a loop, so the peak covers all of them
+  if (memoryScope_ == nullptr && qctx_->memoryScope() != nullptr) {
+    memoryScope_ = qctx_->memoryScope()->create(name_);
+  }
   return Status::OK();
 }
 
@@ -619,14 +635,25 @@ Status Executor::close() {
   stats.totalDurationInUs = totalDuration_.elapsedInUSec();
   stats.rows = numRows_;
   stats.execDurationInUs = execTime_;
+  if (memoryScope_ != nullptr) {
+    otherStats_.emplace("peak_memory", folly::sformat("{}(bytes)", memoryScope_->peak()));
+  }
   if (!otherStats_.empty()) {
     stats.otherStats =
         std::make_unique<std::unordered_map<std::string, std::string>>(std::move(otherStats_));
   }
   qctx()->plan()->addProfileStats(node_->id(), std::move(stats));
+  arena_.reset();
   return Status::OK();
 }
 
+std::pmr::memory_resource *Executor::arena() {
+  if (arena_ == nullptr) {
+    arena_ = std::make_unique<std::pmr::unsynchronized_pool_resource>();
+  }
+  return arena_.get();
+}
+
 Status Executor::checkMemoryWatermark() {
   if (node_->isQueryNode() && memory::MemoryUtils::kHitMemoryHighWatermark.load()) {
     stats::StatsManager::addValue(kNumQueriesHitMemoryWatermark);
@@ -742,6 +769,7 @@ Status Executor::finish(Result &&result) {
       node()->outputVarPtr()->userCount.load(std::memory_order_relaxed) != 0) {
     numRows_ = result.size();
     result.checkMemory(node()->isQueryNode());
+    result.setMemoryScope(memoryScope_);
     ectx_->setResult(node()->outputVar(), std::move(result));
   } else {
     VLOG(1) << "Drop variable " << node()->outputVar();
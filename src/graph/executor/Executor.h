@@ -6,9 +6,11 @@
 #include <folly/futures/Future.h>
 
 #include <boost/core/noncopyable.hpp>
+#include <memory_resource>
 #include <mutex>
 
 #include "common/cpp/helpers.h"
+#include "common/memory/MemoryScope.h"
 #include "common/memory/MemoryTracker.h"
 #include "common/time/Duration.h"
 #include "common/time/ScopedTimer.h"
@@ -50,6 +52,10 @@ class Executor : private boost::noncopyable, private cpp::NonMovable {
     return name_;
   }
 
+  const std::shared_ptr<memory::MemoryScope> &memoryScope() const {
+    return memoryScope_;
+  }
+
   const PlanNode *node() const {
     return node_;
   }
@@ -97,6 +103,12 @@ class Executor : private boost::noncopyable, private cpp::NonMovable {
 
   folly::Executor *runner() const;
 
+  // The arena for the hash tables of join and aggregate, which never leave the executor. The
+  // blocks freed by a rehash or a growing vector are reused, and all of it is released in close().
+  // The rows and values still use the global heap. MT-unsafe, so allocate from it before
+  // scattering the jobs.
+  std::pmr::memory_resource *arena();
+
   void drop();
   void drop(const PlanNode *node);
   void dropBody(const PlanNode *body);
@@ -162,7 +174,12 @@ class Executor : private boost::noncopyable, private cpp::NonMovable {
   uint64_t execTime_{0};
   time::Duration totalDuration_;
 
+  // Accounts the memory allocated during the execution of this executor
+  std::shared_ptr<memory::MemoryScope> memoryScope_;
+
  private:
+  std::unique_ptr<std::pmr::unsynchronized_pool_resource> arena_;
+
   std::mutex statsLock_;
   std::unordered_map<std::string, std::string> otherStats_;
 };
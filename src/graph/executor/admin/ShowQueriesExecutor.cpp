@@ -31,10 +31,11 @@ folly::Future<Status> ShowQueriesExecutor::showCurrentSessionQueries() {
                    "Host",
                    "StartTime",
                    "DurationInUSec",
+                   "PeakMemoryInBytes",
                    "Status",
                    "Query"});
   auto* session = qctx()->rctx()->session();
-  auto sessionInMeta = session->getSession();
+  auto sessionInMeta = session->getSessionWithQueryStats();
 
   addQueries(sessionInMeta, dataSet);
   return finish(
@@ -56,6 +57,7 @@ folly::Future<Status> ShowQueriesExecutor::showAllSessionQueries() {
                          "Host",
                          "StartTime",
                          "DurationInUSec",
+                         "PeakMemoryInBytes",
                          "Status",
                          "Query"});
         for (auto& session : sessions) {
@@ -81,6 +83,7 @@ void ShowQueriesExecutor::addQueries(const meta::cpp2::Session& session, DataSet
     dateTime.microsec = query.second.get_start_time() % 1000000;
     row.values.emplace_back(std::move(dateTime));
     row.values.emplace_back(query.second.get_duration());
+    row.values.emplace_back(query.second.peak_memory_ref().value_or(0));
     row.values.emplace_back(apache::thrift::util::enumNameSafe(query.second.get_status()));
     row.values.emplace_back(query.second.get_query());
     dataSet.rows.emplace_back(std::move(row));
@@ -493,11 +493,12 @@ std::vector<Row> AllPathsExecutor::buildOneWayPathFromHashTable(bool reverse) {
     auto& paths = findVid->second;
     Value emptyPropVertex(Vertex(vid, {}));
     if (!reverse) {
-      for (auto& path : paths) {
+      for (auto* npath : paths) {
         cnt_.fetch_add(1, std::memory_order_relaxed);
         if (cnt_.load(std::memory_order_relaxed) > limit_) {
           break;
         }
+        auto path = convertNPath2List(npath, true);
         Row row;
         row.values.emplace_back(emptyPropVertex);
         auto& dstVertex = path.back();
@@ -508,11 +509,12 @@ std::vector<Row> AllPathsExecutor::buildOneWayPathFromHashTable(bool reverse) {
         result.emplace_back(std::move(row));
       }
     } else {
-      for (auto& path : paths) {
+      for (auto* npath : paths) {
         cnt_.fetch_add(1, std::memory_order_relaxed);
         if (cnt_.load(std::memory_order_relaxed) > limit_) {
           break;
         }
+        auto path = convertNPath2List(npath, false);
         Row row;
         row.values.emplace_back(path.front());
         std::vector<Value> tmp(path.begin() + 1, path.end());
@@ -538,11 +540,11 @@ folly::Future<Status> AllPathsExecutor::conjunctPath(std::vector<NPath*>& leftPa
   }
   bool reverse = false;
   if (leftPaths.size() < rightPaths.size()) {
-    buildHashTable(leftPaths, reverse);
+    buildHashTable(leftPaths);
     probePaths_ = std::move(rightPaths);
   } else {
     reverse = true;
-    buildHashTable(rightPaths, reverse);
+    buildHashTable(rightPaths);
     probePaths_ = std::move(leftPaths);
   }
   auto oneWayPath = buildOneWayPathFromHashTable(!reverse);
@@ -604,17 +606,11 @@ folly::Future<Status> AllPathsExecutor::conjunctPath(std::vector<NPath*>& leftPa
       });
 }
 
-void AllPathsExecutor::buildHashTable(std::vector<NPath*>& paths, bool reverse) {
+void AllPathsExecutor::buildHashTable(std::vector<NPath*>& paths) {
   for (auto& path : paths) {
     auto& edgeVal = path->edge;
     const auto& edge = edgeVal.getEdge();
-    auto findDst = hashTable_.find(edge.dst);
-    if (findDst == hashTable_.end()) {
-      std::vector<std::vector<Value>> tmp({convertNPath2List(path, reverse)});
-      hashTable_.emplace(edge.dst, std::move(tmp));
-    } else {
-      findDst->second.emplace_back(convertNPath2List(path, reverse));
-    }
+    hashTable_[edge.dst].emplace_back(path);
   }
 }
 
@@ -633,7 +629,7 @@ std::vector<Row> AllPathsExecutor::probe(size_t start, size_t end, bool reverse)
     return row;
   };
 
-  size_t minLength = reverse ? rightSteps_ * 2 : leftSteps_ * 2;
+  size_t minLength = reverse ? rightSteps_ : leftSteps_;
   std::vector<Row> result;
   Row emptyPropVerticesRow;
   for (size_t i = start; i < end; ++i) {
@@ -648,14 +644,14 @@ std::vector<Row> AllPathsExecutor::probe(size_t start, size_t end, bool reverse)
     if (findDst == hashTable_.end()) {
       continue;
     }
-    auto valueList = convertNPath2List(probePath, !reverse);
+    std::vector<Value> valueList;
 
-    for (auto& path : findDst->second) {
-      if (path.size() != minLength) {
+    for (auto* path : findDst->second) {
+      if (pathLength(path) != minLength) {
         continue;
       }
-      auto& leftPath = reverse ? valueList : path;
-      auto& rightPath = reverse ? path : valueList;
+      auto* leftPath = reverse ? probePath : path;
+      auto* rightPath = reverse ? path : probePath;
       if (noLoop_) {
         if (hasSameVertices(leftPath, intersectVid, rightPath)) {
           continue;
@@ -669,7 +665,14 @@ std::vector<Row> AllPathsExecutor::probe(size_t start, size_t end, bool reverse)
       if (cnt_.load(std::memory_order_relaxed) > limit_) {
         break;
       }
-      result.emplace_back(buildPath(leftPath, intersectVertex, rightPath));
+      // The probe path is converted once for all the paths it is conjuncted with
+      if (valueList.empty()) {
+        valueList = convertNPath2List(probePath, !reverse);
+      }
+      auto pathList = convertNPath2List(path, reverse);
+      result.emplace_back(buildPath(reverse ? valueList : pathList,
+                                    intersectVertex,
+                                    reverse ? pathList : valueList));
     }
     emptyPropVerticesRow.values.emplace_back(intersectVertex);
   }
@@ -723,13 +726,11 @@ bool AllPathsExecutor::hasSameVertices(NPath* path, const Edge& edge) {
   return false;
 }
 
-bool AllPathsExecutor::hasSameEdge(std::vector<Value>& leftPaths, std::vector<Value>& rightPaths) {
-  for (auto& leftEdge : leftPaths) {
-    if (!leftEdge.isEdge()) {
-      continue;
-    }
-    for (auto& rightEdge : rightPaths) {
-      if (rightEdge.isEdge() && rightEdge.getEdge().keyEqual(leftEdge.getEdge())) {
+bool AllPathsExecutor::hasSameEdge(NPath* leftPath, NPath* rightPath) {
+  for (NPath* left = leftPath; left != nullptr; left = left->p) {
+    const auto& leftEdge = left->edge.getEdge();
+    for (NPath* right = rightPath; right != nullptr; right = right->p) {
+      if (right->edge.getEdge().keyEqual(leftEdge)) {
         return true;
       }
     }
@@ -737,28 +738,32 @@ bool AllPathsExecutor::hasSameEdge(std::vector<Value>& leftPaths, std::vector<Va
   return false;
 }
 
-bool AllPathsExecutor::hasSameVertices(const std::vector<Value>& leftPaths,
+bool AllPathsExecutor::hasSameVertices(NPath* leftPath,
                                        const Value& intersectVertex,
-                                       const std::vector<Value>& rightPaths) {
-  bool flag = leftPaths.size() > rightPaths.size();
-  const auto& hashPath = flag ? rightPaths : leftPaths;
-  const auto& probePath = flag ? leftPaths : rightPaths;
+                                       NPath* rightPath) {
+  bool flag = pathLength(leftPath) > pathLength(rightPath);
+  NPath* hashPath = flag ? rightPath : leftPath;
+  NPath* probePath = flag ? leftPath : rightPath;
   VidHashSet hashTable;
-  for (const auto& v : hashPath) {
-    if (v.isVertex()) {
-      hashTable.emplace(v);
-    }
+  for (NPath* head = hashPath; head != nullptr; head = head->p) {
+    hashTable.emplace(head->vertex);
   }
   hashTable.emplace(intersectVertex);
-  for (const auto& v : probePath) {
-    if (v.isVertex()) {
-      if (hashTable.find(v) != hashTable.end()) {
-        return true;
-      }
+  for (NPath* head = probePath; head != nullptr; head = head->p) {
+    if (hashTable.find(head->vertex) != hashTable.end()) {
+      return true;
     }
   }
   return false;
 }
 
+size_t AllPathsExecutor::pathLength(NPath* path) {
+  size_t length = 0;
+  for (NPath* head = path; head != nullptr; head = head->p) {
+    ++length;
+  }
+  return length;
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -83,7 +83,7 @@ class AllPathsExecutor final : public StorageAccessExecutor {
 
   folly::Future<Status> buildResult();
 
-  void buildHashTable(std::vector<NPath*>& paths, bool reverse);
+  void buildHashTable(std::vector<NPath*>& paths);
 
   std::vector<Row> probe(size_t start, size_t end, bool reverse);
 
@@ -94,11 +94,11 @@ class AllPathsExecutor final : public StorageAccessExecutor {
 
   bool hasSameVertices(NPath* path, const Edge& edge);
 
-  bool hasSameEdge(std::vector<Value>& leftPaths, std::vector<Value>& rightPaths);
+  bool hasSameEdge(NPath* leftPath, NPath* rightPath);
 
-  bool hasSameVertices(const std::vector<Value>& leftPaths,
-                       const Value& intersectVertex,
-                       const std::vector<Value>& rightPaths);
+  bool hasSameVertices(NPath* leftPath, const Value& intersectVertex, NPath* rightPath);
+
+  size_t pathLength(NPath* path);
 
   void buildOneWayPath(std::vector<NPath*>& paths, bool reverse);
 
@@ -131,7 +131,9 @@ class AllPathsExecutor final : public StorageAccessExecutor {
   class NewTag {};
   folly::ThreadLocalPtr<std::deque<NPath>, NewTag> threadLocalPtr_;
 
-  std::unordered_map<Value, std::vector<std::vector<Value>>> hashTable_;
+  // The paths of the build side keyed by their last vertex, they are only converted to the lists
+  // of values once they are conjuncted into a result row
+  std::unordered_map<Value, std::vector<NPath*>> hashTable_;
   std::vector<NPath*> probePaths_;
 };
 }  // namespace graph
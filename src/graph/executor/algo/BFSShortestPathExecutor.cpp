@@ -5,8 +5,10 @@
 #include "graph/executor/algo/BFSShortestPathExecutor.h"
 
 #include "graph/planner/plan/Algo.h"
+#include "graph/service/GraphFlags.h"
 
 DECLARE_int32(num_operator_threads);
+
 namespace nebula {
 namespace graph {
 folly::Future<Status> BFSShortestPathExecutor::execute() {
@@ -39,18 +41,8 @@ folly::Future<Status> BFSShortestPathExecutor::execute() {
   }
 
   std::vector<folly::Future<Status>> futures;
-  auto leftFuture = folly::via(runner(), [this]() {
-    // MemoryTrackerVerified
-    memory::MemoryCheckGuard guard;
-    return buildPath(false);
-  });
-  auto rightFuture = folly::via(runner(), [this]() {
-    // MemoryTrackerVerified
-    memory::MemoryCheckGuard guard;
-    return buildPath(true);
-  });
-  futures.emplace_back(std::move(leftFuture));
-  futures.emplace_back(std::move(rightFuture));
+  futures.emplace_back(expand(false));
+  futures.emplace_back(expand(true));
 
   return folly::collectAll(futures)
       .via(runner())
@@ -133,16 +125,112 @@ Status BFSShortestPathExecutor::buildPath(bool reverse) {
     }
   }
 
-  // set nextVid
+  setNextStepVids(reverse, std::move(uniqueDst), std::move(nextStepVids));
+  return Status::OK();
+}
+
+folly::Future<Status> BFSShortestPathExecutor::expand(bool reverse) {
+  auto rows = reverse ? ectx_->getResult(pathNode_->rightInputVar()).size()
+                      : ectx_->getResult(pathNode_->leftInputVar()).size();
+  size_t jobs = 1;
+  if (rows >= FLAGS_loop_parallel_threshold_rows && FLAGS_max_job_size > 1) {
+    auto batchSize = getBatchSize(rows);
+    jobs = (rows + batchSize - 1) / batchSize;
+  }
+  folly::dynamic strategy = folly::dynamic::object();
+  strategy.insert("rows", rows);
+  strategy.insert("jobs", jobs);
+  addState(reverse ? "rightExpand" : "leftExpand", strategy);
+
+  if (jobs <= 1) {
+    return folly::via(runner(), [this, reverse]() {
+      // MemoryTrackerVerified
+      memory::MemoryCheckGuard guard;
+      return buildPath(reverse);
+    });
+  }
+  return buildPathMultiJobs(reverse);
+}
+
+folly::Future<Status> BFSShortestPathExecutor::buildPathMultiJobs(bool reverse) {
+  auto iter = reverse ? ectx_->getResult(pathNode_->rightInputVar()).iter()
+                      : ectx_->getResult(pathNode_->leftInputVar()).iter();
+  DCHECK(!!iter);
+  auto scatter = [this, reverse](size_t begin, size_t end, Iterator* tmpIter) {
+    return expandJob(begin, end, tmpIter, reverse);
+  };
+  auto gather = [this, reverse](std::vector<folly::Try<ExpandResult>>&& resps) {
+    memory::MemoryCheckGuard guard;
+    auto& visitedVids = reverse ? rightVisitedVids_ : leftVisitedVids_;
+    auto& allEdges = reverse ? allRightEdges_ : allLeftEdges_;
+    allEdges.emplace_back();
+    auto& currentEdges = allEdges.back();
+
+    HashSet uniqueDst;
+    DataSet nextStepVids;
+    nextStepVids.colNames = {nebula::kVid};
+    for (auto& respVal : resps) {
+      if (respVal.hasException()) {
+        auto ex = respVal.exception().get_exception<std::bad_alloc>();
+        if (ex) {
+          throw std::bad_alloc();
+        } else {
+          throw std::runtime_error(respVal.exception().what().c_str());
+        }
+      }
+      auto result = std::move(respVal).value();
+      for (auto& src : result.srcs) {
+        visitedVids.emplace(std::move(src));
+      }
+      for (auto& edge : result.edges) {
+        if (uniqueDst.emplace(edge.first).second) {
+          nextStepVids.rows.emplace_back(Row({edge.first}));
+        }
+        currentEdges.emplace(std::move(edge.first), std::move(edge.second));
+      }
+    }
+    setNextStepVids(reverse, std::move(uniqueDst), std::move(nextStepVids));
+    return Status::OK();
+  };
+  return runMultiJobs(std::move(scatter), std::move(gather), iter.get());
+}
+
+BFSShortestPathExecutor::ExpandResult BFSShortestPathExecutor::expandJob(size_t begin,
+                                                                         size_t end,
+                                                                         Iterator* iter,
+                                                                         bool reverse) const {
+  // Only read here, the visited vids are updated after all jobs are done
+  const auto& visitedVids = reverse ? rightVisitedVids_ : leftVisitedVids_;
+  ExpandResult result;
+  for (; iter->valid() && begin++ < end; iter->next()) {
+    auto edgeVal = iter->getEdge();
+    if (UNLIKELY(!edgeVal.isEdge())) {
+      continue;
+    }
+    auto& edge = edgeVal.getEdge();
+    if (step_ == 1) {
+      result.srcs.emplace_back(edge.src);
+    } else if (visitedVids.find(edge.dst) != visitedVids.end()) {
+      continue;
+    }
+    auto dst = edge.dst;
+    result.edges.emplace_back(std::move(dst), std::move(edge));
+  }
+  return result;
+}
+
+void BFSShortestPathExecutor::setNextStepVids(bool reverse,
+                                              HashSet&& uniqueDst,
+                                              DataSet&& nextStepVids) {
+  auto& visitedVids = reverse ? rightVisitedVids_ : leftVisitedVids_;
   const auto& nextVidVar = reverse ? pathNode_->rightVidVar() : pathNode_->leftVidVar();
   ectx_->setResult(nextVidVar, ResultBuilder().value(std::move(nextStepVids)).build());
   if (uniqueDst.size() == 0) {
     ectx_->setValue(terminateEarlyVar_, true);
-    return Status::OK();
+    return;
   }
   visitedVids.insert(std::make_move_iterator(uniqueDst.begin()),
                      std::make_move_iterator(uniqueDst.end()));
-  return Status::OK();
 }
 
 folly::Future<Status> BFSShortestPathExecutor::conjunctPath() {
@@ -19,6 +19,11 @@
 // `buildPath`: extract edges from GetNeighbors put it into allLeftEdges or allRightEdges
 //   and set the vid that needs to be expanded in the next step
 //
+// `expand`: choose the strategy of `buildPath` by the rows of the current step, the edges are
+//   extracted by the multiple jobs of `runMultiJobs` once the frontier reaches
+//   FLAGS_loop_parallel_threshold_rows, so a step with a huge frontier doesn't stall the loop.
+//   The chosen strategy of each step is recorded in the profile.
+//
 // `conjunctPath`: concatenate the path(From) and the path(To) into a complete path
 //   allLeftEdges needs to match the previous step of the allRightEdges
 //   then current step of the allRightEdges each time
@@ -51,8 +56,23 @@ class BFSShortestPathExecutor final : public Executor {
   folly::Future<Status> execute() override;
 
  private:
+  struct ExpandResult {
+    std::vector<Value> srcs;
+    std::vector<std::pair<Value, Edge>> edges;
+  };
+
+  folly::Future<Status> expand(bool reverse);
+
   Status buildPath(bool reverse);
 
+  folly::Future<Status> buildPathMultiJobs(bool reverse);
+
+  // Extracts the edges of rows [begin, end) which lead to unvisited vertices
+  ExpandResult expandJob(size_t begin, size_t end, Iterator* iter, bool reverse) const;
+
+  // Sets the vids to expand in the next step
+  void setNextStepVids(bool reverse, HashSet&& uniqueDst, DataSet&& nextStepVids);
+
   folly::Future<Status> conjunctPath();
 
   DataSet doConjunct(const std::vector<Value>& meetVids, bool oddStep);
@@ -61,6 +61,8 @@ size_t BatchShortestPath::init(const HashSet& startVids, const HashSet& endVids)
   currentLeftPathMaps_.reserve(rowSize);
   currentRightPathMaps_.reserve(rowSize);
   preRightPathMaps_.reserve(rowSize);
+  leftPathTrees_.resize(rowSize);
+  rightPathTrees_.resize(rowSize);
 
   terminationMaps_.reserve(rowSize);
   resultDs_.resize(rowSize);
@@ -200,6 +202,7 @@ Status BatchShortestPath::buildPath(size_t rowNum, RpcResponse&& resps, bool rev
 Status BatchShortestPath::doBuildPath(size_t rowNum, GetNeighborsIter* iter, bool reverse) {
   auto& historyPathMap = reverse ? allRightPathMaps_[rowNum] : allLeftPathMaps_[rowNum];
   auto& currentPathMap = reverse ? currentRightPathMaps_[rowNum] : currentLeftPathMaps_[rowNum];
+  auto& pathTree = reverse ? rightPathTrees_[rowNum] : leftPathTrees_[rowNum];
 
   for (; iter->valid(); iter->next()) {
     auto edgeVal = iter->getEdge();
@@ -213,25 +216,27 @@ Status BatchShortestPath::doBuildPath(size_t rowNum, GetNeighborsIter* iter, boo
       continue;
     }
     auto vertex = iter->getVertex();
-    CustomPath customPath;
-    customPath.emplace_back(std::move(vertex));
-    customPath.emplace_back(std::move(edge));
+    CustomStep customStep;
+    customStep.emplace_back(std::move(vertex));
+    customStep.emplace_back(std::move(edge));
+    auto step = pathTree.addStep(std::move(customStep));
 
     auto findSrcFromHistory = historyPathMap.find(src);
     if (findSrcFromHistory == historyPathMap.end()) {
       // first step
+      auto customPath = pathTree.append(PathTree::kNoParent, step);
       auto findDstFromCurrent = currentPathMap.find(dst);
       if (findDstFromCurrent == currentPathMap.end()) {
-        std::vector<CustomPath> tmp({std::move(customPath)});
+        std::vector<CustomPath> tmp{customPath};
         currentPathMap[dst].emplace(src, std::move(tmp));
       } else {
         auto findSrc = findDstFromCurrent->second.find(src);
         if (findSrc == findDstFromCurrent->second.end()) {
-          std::vector<CustomPath> tmp({std::move(customPath)});
+          std::vector<CustomPath> tmp{customPath};
           findDstFromCurrent->second.emplace(src, std::move(tmp));
         } else {
           // same <src, dst>, different edge type or rank
-          findSrc->second.emplace_back(std::move(customPath));
+          findSrc->second.emplace_back(customPath);
         }
       }
     } else {
@@ -244,12 +249,12 @@ Status BatchShortestPath::doBuildPath(size_t rowNum, GetNeighborsIter* iter, boo
         if (findDstFromCurrent == currentPathMap.end()) {
           // dst not in current, new edge
           for (const auto& srcPath : srcPathMap) {
-            currentPathMap[dst].emplace(srcPath.first, createPaths(srcPath.second, customPath));
+            currentPathMap[dst].emplace(srcPath.first, createPaths(pathTree, srcPath.second, step));
           }
         } else {
           // dst in current
           for (const auto& srcPath : srcPathMap) {
-            auto newPaths = createPaths(srcPath.second, customPath);
+            auto newPaths = createPaths(pathTree, srcPath.second, step);
             auto findSrc = findDstFromCurrent->second.find(srcPath.first);
             if (findSrc == findDstFromCurrent->second.end()) {
               findDstFromCurrent->second.emplace(srcPath.first, std::move(newPaths));
@@ -271,9 +276,9 @@ Status BatchShortestPath::doBuildPath(size_t rowNum, GetNeighborsIter* iter, boo
           }
           auto findDstFromCurrent = currentPathMap.find(dst);
           if (findDstFromCurrent == currentPathMap.end()) {
-            currentPathMap[dst].emplace(srcPath.first, createPaths(srcPath.second, customPath));
+            currentPathMap[dst].emplace(srcPath.first, createPaths(pathTree, srcPath.second, step));
           } else {
-            auto newPaths = createPaths(srcPath.second, customPath);
+            auto newPaths = createPaths(pathTree, srcPath.second, step);
             auto findSrc = findDstFromCurrent->second.find(srcPath.first);
             if (findSrc == findDstFromCurrent->second.end()) {
               findDstFromCurrent->second.emplace(srcPath.first, std::move(newPaths));
@@ -356,7 +361,7 @@ folly::Future<std::vector<Value>> BatchShortestPath::getMeetVids(size_t rowNum,
       bool flag = false;
       for (auto& srcPaths : dstPaths.second) {
         for (auto& path : srcPaths.second) {
-          auto& vertex = path.values[path.size() - 2];
+          auto& vertex = rightPathTrees_[rowNum].lastStep(path).values.front();
           auto& vid = vertex.getVertex().vid;
           if (vid == meetVid) {
             vertices.emplace_back(vertex);
@@ -458,12 +463,14 @@ void BatchShortestPath::doConjunctPath(const std::vector<CustomPath>& leftPaths,
                                        const Value& commonVertex,
                                        size_t rowNum) {
   auto& resultDs = resultDs_[rowNum];
+  const auto& leftPathTree = leftPathTrees_[rowNum];
+  const auto& rightPathTree = rightPathTrees_[rowNum];
   if (rightPaths.empty()) {
     for (const auto& leftPath : leftPaths) {
-      if (hasSameEdge(leftPath.values)) {
+      auto forwardPath = leftPathTree.values(leftPath);
+      if (hasSameEdge(forwardPath)) {
         continue;
       }
-      auto forwardPath = leftPath.values;
       auto src = forwardPath.front();
       forwardPath.erase(forwardPath.begin());
       Row row;
@@ -479,8 +486,8 @@ void BatchShortestPath::doConjunctPath(const std::vector<CustomPath>& leftPaths,
   }
   for (const auto& leftPath : leftPaths) {
     for (const auto& rightPath : rightPaths) {
-      auto forwardPath = leftPath.values;
-      auto backwardPath = rightPath.values;
+      auto forwardPath = leftPathTree.values(leftPath);
+      auto backwardPath = rightPathTree.values(rightPath);
       auto src = forwardPath.front();
       forwardPath.erase(forwardPath.begin());
       forwardPath.emplace_back(commonVertex);
@@ -505,15 +512,14 @@ void BatchShortestPath::doConjunctPath(const std::vector<CustomPath>& leftPaths,
   }
 }
 
-// [a, a->b, b, b->c ] insert [c, c->d]  result is [a, a->b, b, b->c, c, c->d]
-std::vector<Row> BatchShortestPath::createPaths(const std::vector<CustomPath>& paths,
-                                                const CustomPath& path) {
+// [a, a->b, b, b->c ] append [c, c->d]  result is [a, a->b, b, b->c, c, c->d], which only
+// adds a node referring to the prefix to the tree
+std::vector<BatchShortestPath::CustomPath> BatchShortestPath::createPaths(
+    PathTree& tree, const std::vector<CustomPath>& paths, PathTree::StepId step) {
   std::vector<CustomPath> newPaths;
   newPaths.reserve(paths.size());
   for (const auto& p : paths) {
-    auto customPath = p;
-    customPath.values.insert(customPath.values.end(), path.values.begin(), path.values.end());
-    newPaths.emplace_back(std::move(customPath));
+    newPaths.emplace_back(tree.append(p, step));
   }
   return newPaths;
 }
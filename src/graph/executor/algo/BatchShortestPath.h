@@ -21,7 +21,8 @@ class BatchShortestPath final : public ShortestPathBase {
                                 const HashSet& endVids,
                                 DataSet* result) override;
 
-  using CustomPath = Row;
+  // The path in the PathTree of its direction
+  using CustomPath = PathTree::PathId;
   using PathMap = robin_hood::unordered_flat_map<
       DstVid,
       robin_hood::unordered_flat_map<StartVid, std::vector<CustomPath>, std::hash<StartVid>>,
@@ -53,7 +54,9 @@ class BatchShortestPath final : public ShortestPathBase {
                       const Value& commonVertex,
                       size_t rowNum);
 
-  std::vector<Row> createPaths(const std::vector<CustomPath>& paths, const CustomPath& path);
+  std::vector<CustomPath> createPaths(PathTree& tree,
+                                      const std::vector<CustomPath>& paths,
+                                      PathTree::StepId step);
 
   void setNextStepVid(const PathMap& paths, size_t rowNum, bool reverse);
 
@@ -67,6 +70,9 @@ class BatchShortestPath final : public ShortestPathBase {
   std::vector<PathMap> currentLeftPathMaps_;
   std::vector<PathMap> currentRightPathMaps_;
   std::vector<PathMap> preRightPathMaps_;
+
+  std::vector<PathTree> leftPathTrees_;
+  std::vector<PathTree> rightPathTrees_;
 };
 
 }  // namespace graph
@@ -0,0 +1,361 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include "graph/executor/algo/GraphAlgoExecutor.h"
+
+#include <robin_hood.h>
+
+#include <numeric>
+
+#include "common/memory/MemoryTracker.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/Utils.h"
+
+using nebula::storage::StorageClient;
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> GraphAlgoExecutor::execute() {
+  return scanEdges();
+}
+
+folly::Future<Status> GraphAlgoExecutor::scanEdges() {
+  SCOPED_TIMER(&execTime_);
+  StorageClient* storageClient = qctx_->getStorageClient();
+  StorageClient::CommonRequestParam param(algo_->space(),
+                                          qctx_->rctx()->session()->id(),
+                                          qctx_->plan()->id(),
+                                          qctx_->plan()->isProfileEnabled());
+  time::Duration scanTime;
+  // One more than allowed, to tell whether there are too many edges
+  int64_t limit =
+      std::min<uint64_t>(FLAGS_max_graph_algorithm_edges, std::numeric_limits<int64_t>::max() - 1) +
+      1;
+  return DCHECK_NOTNULL(storageClient)
+      ->scanEdge(param, algo_->edgeProps(), limit, nullptr)
+      .via(runner())
+      .thenValue([this, scanTime](RpcResponse&& resp) -> folly::Future<Status> {
+        // MemoryTrackerVerified
+        memory::MemoryCheckGuard guard;
+        SCOPED_TIMER(&execTime_);
+        addState("total_rpc", scanTime);
+        auto& hostLatency = resp.hostLatency();
+        for (size_t i = 0; i < hostLatency.size(); ++i) {
+          size_t size = 0u;
+          auto& result = resp.responses()[i];
+          if (result.props_ref().has_value()) {
+            size = (*result.props_ref()).size();
+          }
+          auto info = util::collectRespProfileData(result.result, hostLatency[i], size);
+          addState(folly::sformat("resp[{}]", i), info);
+        }
+        NG_RETURN_IF_ERROR(handleResponse(std::move(resp)));
+        return runAlgorithm();
+      });
+}
+
+Status GraphAlgoExecutor::handleResponse(RpcResponse&& resps) {
+  auto result = handleCompleteness(resps, FLAGS_accept_partial_success);
+  NG_RETURN_IF_ERROR(result);
+
+  std::vector<DataSet> scanned;
+  for (auto& resp : resps.responses()) {
+    if (resp.props_ref().has_value()) {
+      scanned.emplace_back(std::move(*resp.props_ref()));
+    }
+  }
+  time::Duration buildTime;
+  NG_RETURN_IF_ERROR(buildGraph(std::move(scanned)));
+  addState("build_graph", buildTime);
+  addState("vertices", folly::dynamic(static_cast<int64_t>(vids_.size())));
+  addState("edges", folly::dynamic(static_cast<int64_t>(edges_.size())));
+  return Status::OK();
+}
+
+folly::Future<Status> GraphAlgoExecutor::runAlgorithm() {
+  const auto& algorithm = algo_->algorithm();
+  if (algorithm == "pagerank") {
+    return pageRank();
+  }
+  if (algorithm == "wcc") {
+    return wcc();
+  }
+  DCHECK_EQ(algorithm, "lpa");
+  return labelPropagation();
+}
+
+Status GraphAlgoExecutor::buildGraph(std::vector<DataSet> scanned) {
+  size_t numEdges = 0;
+  for (const auto& ds : scanned) {
+    numEdges += ds.rowSize();
+  }
+  if (numEdges > FLAGS_max_graph_algorithm_edges) {
+    return Status::Error(
+        "Too many edges to load into graphd for algorithm `%s', more than %lu, see "
+        "max_graph_algorithm_edges",
+        algo_->algorithm().c_str(),
+        FLAGS_max_graph_algorithm_edges);
+  }
+
+  robin_hood::unordered_flat_map<Value, VertexId, std::hash<Value>> ids;
+  auto toId = [this, &ids](const Value& vid) {
+    auto res = ids.emplace(vid, static_cast<VertexId>(vids_.size()));
+    if (res.second) {
+      vids_.emplace_back(vid);
+    }
+    return res.first->second;
+  };
+
+  auto numEdgeTypes = algo_->edgeProps().size();
+  edges_.reserve(numEdges);
+  for (auto& ds : scanned) {
+    auto& rows = ds.rows;
+    for (auto& row : rows) {
+      // Each row has the src and dst of all the edge types, only the ones of the scanned type
+      // are not empty.
+      for (size_t i = 0; i < numEdgeTypes && 2 * i + 1 < row.size(); ++i) {
+        const auto& src = row[2 * i];
+        if (src.empty()) {
+          continue;
+        }
+        if (vids_.size() + 2 >= std::numeric_limits<VertexId>::max()) {
+          return Status::Error("Too many vertices to run algorithm `%s'",
+                               algo_->algorithm().c_str());
+        }
+        auto srcId = toId(src);
+        auto dstId = toId(row[2 * i + 1]);
+        edges_.emplace_back(srcId, dstId);
+        break;
+      }
+    }
+    // Release the scanned rows as early as possible
+    rows.clear();
+    rows.shrink_to_fit();
+  }
+  return Status::OK();
+}
+
+GraphAlgoExecutor::Csr GraphAlgoExecutor::buildCsr(bool forward, bool backward) const {
+  auto n = vids_.size();
+  Csr csr;
+  csr.offsets.assign(n + 1, 0);
+  for (const auto& edge : edges_) {
+    if (forward) {
+      ++csr.offsets[edge.second + 1];
+    }
+    if (backward) {
+      ++csr.offsets[edge.first + 1];
+    }
+  }
+  for (size_t v = 0; v < n; ++v) {
+    csr.offsets[v + 1] += csr.offsets[v];
+  }
+  csr.targets.resize(csr.offsets[n]);
+  std::vector<size_t> cursors(csr.offsets.begin(), csr.offsets.end() - 1);
+  for (const auto& edge : edges_) {
+    if (forward) {
+      csr.targets[cursors[edge.second]++] = edge.first;
+    }
+    if (backward) {
+      csr.targets[cursors[edge.first]++] = edge.second;
+    }
+  }
+  return csr;
+}
+
+template <typename Func>
+folly::Future<double> GraphAlgoExecutor::parallelSum(Func func) {
+  auto total = vids_.size();
+  auto jobs = static_cast<size_t>(std::max(FLAGS_num_operator_threads, 1));
+  auto batchSize = std::max((total + jobs - 1) / jobs, static_cast<size_t>(FLAGS_min_batch_size));
+  std::vector<folly::Future<double>> futures;
+  for (size_t begin = 0; begin < total; begin += batchSize) {
+    auto end = std::min(total, begin + batchSize);
+    futures.emplace_back(folly::via(runner(), [begin, end, func]() {
+      // MemoryTrackerVerified
+      memory::MemoryCheckGuard guard;
+      return func(begin, end);
+    }));
+  }
+  return folly::collect(futures).via(runner()).thenValue([](std::vector<double>&& sums) {
+    return std::accumulate(sums.begin(), sums.end(), 0.0);
+  });
+}
+
+folly::Future<Status> GraphAlgoExecutor::pageRank() {
+  auto n = vids_.size();
+  outDegrees_.assign(n, 0);
+  bool forward = algo_->direction() != storage::cpp2::EdgeDirection::IN_EDGE;
+  bool backward = algo_->direction() != storage::cpp2::EdgeDirection::OUT_EDGE;
+  for (const auto& edge : edges_) {
+    if (forward) {
+      ++outDegrees_[edge.first];
+    }
+    if (backward) {
+      ++outDegrees_[edge.second];
+    }
+  }
+  // Pull the ranks from the in-neighbors
+  csr_ = buildCsr(forward, backward);
+  decltype(edges_)().swap(edges_);
+
+  scores_.assign(n, n == 0 ? 0.0 : 1.0 / n);
+  nextScores_.resize(n);
+  contribs_.resize(n);
+  return pageRankIteration(0);
+}
+
+folly::Future<Status> GraphAlgoExecutor::pageRankIteration(size_t iteration) {
+  if (iteration >= algo_->maxIterations() || vids_.empty()) {
+    addState("iterations", folly::dynamic(static_cast<int64_t>(iteration)));
+    return finishWithScores();
+  }
+  return parallelSum([this](size_t begin, size_t end) {
+           double dangling = 0.0;
+           for (size_t v = begin; v < end; ++v) {
+             if (outDegrees_[v] == 0) {
+               dangling += scores_[v];
+               contribs_[v] = 0.0;
+             } else {
+               contribs_[v] = scores_[v] / outDegrees_[v];
+             }
+           }
+           return dangling;
+         })
+      .thenValue([this](double dangling) {
+        auto n = static_cast<double>(vids_.size());
+        auto damping = algo_->damping();
+        auto base = (1.0 - damping) / n + damping * dangling / n;
+        return parallelSum([this, base, damping](size_t begin, size_t end) {
+          double delta = 0.0;
+          for (size_t v = begin; v < end; ++v) {
+            double sum = 0.0;
+            for (auto i = csr_.offsets[v]; i < csr_.offsets[v + 1]; ++i) {
+              sum += contribs_[csr_.targets[i]];
+            }
+            auto score = base + damping * sum;
+            delta += std::abs(score - scores_[v]);
+            nextScores_[v] = score;
+          }
+          return delta;
+        });
+      })
+      .thenValue([this, iteration](double delta) {
+        scores_.swap(nextScores_);
+        if (delta <= algo_->tolerance()) {
+          addState("iterations", folly::dynamic(static_cast<int64_t>(iteration + 1)));
+          return folly::makeFuture<Status>(finishWithScores());
+        }
+        return pageRankIteration(iteration + 1);
+      });
+}
+
+folly::Future<Status> GraphAlgoExecutor::wcc() {
+  // Union-find takes one pass over the edges, while propagating the min label takes as many
+  // iterations as the diameter of the graph.
+  auto n = vids_.size();
+  labels_.resize(n);
+  std::iota(labels_.begin(), labels_.end(), 0);
+  auto find = [this](VertexId v) {
+    while (labels_[v] != v) {
+      labels_[v] = labels_[labels_[v]];
+      v = labels_[v];
+    }
+    return v;
+  };
+  for (const auto& edge : edges_) {
+    auto a = find(edge.first);
+    auto b = find(edge.second);
+    // The root is always the smallest id of the set
+    if (a < b) {
+      labels_[b] = a;
+    } else if (b < a) {
+      labels_[a] = b;
+    }
+  }
+  decltype(edges_)().swap(edges_);
+  // The parent of a vertex is smaller than itself, so it has been resolved already
+  for (size_t v = 0; v < n; ++v) {
+    labels_[v] = labels_[labels_[v]];
+  }
+  return finishWithLabels();
+}
+
+folly::Future<Status> GraphAlgoExecutor::labelPropagation() {
+  auto n = vids_.size();
+  csr_ = buildCsr(true, true);
+  decltype(edges_)().swap(edges_);
+  labels_.resize(n);
+  std::iota(labels_.begin(), labels_.end(), 0);
+  nextLabels_.resize(n);
+  return labelPropagationIteration(0);
+}
+
+folly::Future<Status> GraphAlgoExecutor::labelPropagationIteration(size_t iteration) {
+  if (iteration >= algo_->maxIterations() || vids_.empty()) {
+    addState("iterations", folly::dynamic(static_cast<int64_t>(iteration)));
+    return finishWithLabels();
+  }
+  return parallelSum([this](size_t begin, size_t end) {
+           double changed = 0.0;
+           std::vector<VertexId> neighborLabels;
+           for (size_t v = begin; v < end; ++v) {
+             auto current = labels_[v];
+             neighborLabels.clear();
+             for (auto i = csr_.offsets[v]; i < csr_.offsets[v + 1]; ++i) {
+               neighborLabels.emplace_back(labels_[csr_.targets[i]]);
+             }
+             std::sort(neighborLabels.begin(), neighborLabels.end());
+             auto best = current;
+             size_t bestCount = 0;
+             for (size_t i = 0; i < neighborLabels.size();) {
+               auto j = i;
+               while (j < neighborLabels.size() && neighborLabels[j] == neighborLabels[i]) {
+                 ++j;
+               }
+               auto count = j - i;
+               if (count > bestCount || (count == bestCount && neighborLabels[i] == current)) {
+                 best = neighborLabels[i];
+                 bestCount = count;
+               }
+               i = j;
+             }
+             nextLabels_[v] = best;
+             if (best != current) {
+               changed += 1.0;
+             }
+           }
+           return changed;
+         })
+      .thenValue([this, iteration](double changed) {
+        labels_.swap(nextLabels_);
+        if (changed == 0.0) {
+          addState("iterations", folly::dynamic(static_cast<int64_t>(iteration + 1)));
+          return folly::makeFuture<Status>(finishWithLabels());
+        }
+        return labelPropagationIteration(iteration + 1);
+      });
+}
+
+Status GraphAlgoExecutor::finishWithScores() {
+  DataSet ds(algo_->colNames());
+  ds.rows.reserve(vids_.size());
+  for (size_t v = 0; v < vids_.size(); ++v) {
+    ds.rows.emplace_back(Row({std::move(vids_[v]), scores_[v]}));
+  }
+  return finish(ResultBuilder().value(Value(std::move(ds))).build());
+}
+
+Status GraphAlgoExecutor::finishWithLabels() {
+  DataSet ds(algo_->colNames());
+  ds.rows.reserve(vids_.size());
+  for (size_t v = 0; v < vids_.size(); ++v) {
+    ds.rows.emplace_back(Row({vids_[v], vids_[labels_[v]]}));
+  }
+  return finish(ResultBuilder().value(Value(std::move(ds))).build());
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,106 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#ifndef GRAPH_EXECUTOR_ALGO_GRAPHALGOEXECUTOR_H_
+#define GRAPH_EXECUTOR_ALGO_GRAPHALGOEXECUTOR_H_
+
+#include "graph/executor/StorageAccessExecutor.h"
+#include "graph/planner/plan/Algo.h"
+
+// GraphAlgo runs a whole-graph algorithm over the edges of the given types in the memory of the
+// graphd handling the query, i.e. RUN LOCAL ALGORITHM.
+//
+// The edges are scanned from all the partitions at once, each storaged scans its partitions
+// concurrently, but nothing else runs in storaged. All the edges are pulled into this graphd, so
+// it's only meant for the graphs which fit in one graphd, bounded by
+// FLAGS_max_graph_algorithm_edges. The scan doesn't read a consistent snapshot either. The vids
+// are then mapped to dense ids, and the edges are kept as compressed sparse rows, so that each
+// iteration only touches flat arrays.
+//
+// pagerank: the bulk synchronous pull-based PageRank, each iteration is split into batches of
+//   vertices run by FLAGS_num_operator_threads jobs, the rank of the dangling vertices is spread
+//   to all the vertices. It stops after `maxIterations', or once the L1 norm of the change of
+//   the ranks is within `tolerance'.
+// wcc: the weakly connected components, computed by union-find in one pass over the edges, the
+//   component is represented by one of its vids.
+// lpa: the synchronous label propagation on the undirected graph, each vertex takes the most
+//   frequent label of its neighbors, preferring its current label and then the smaller one on
+//   ties. It stops after `maxIterations' or once no label changes.
+//
+// Only the vertices with at least one of the edges are returned.
+
+namespace nebula {
+namespace graph {
+
+class GraphAlgoExecutor final : public StorageAccessExecutor {
+  friend class GraphAlgoTest;
+
+ public:
+  GraphAlgoExecutor(const PlanNode* node, QueryContext* qctx)
+      : StorageAccessExecutor("GraphAlgoExecutor", node, qctx) {
+    algo_ = asNode<GraphAlgo>(node);
+  }
+
+  folly::Future<Status> execute() override;
+
+ private:
+  using VertexId = uint32_t;
+  using RpcResponse = storage::StorageRpcResponse<storage::cpp2::ScanResponse>;
+
+  // The neighbors of vertex v are targets[offsets[v], offsets[v + 1])
+  struct Csr {
+    std::vector<size_t> offsets;
+    std::vector<VertexId> targets;
+  };
+
+  folly::Future<Status> scanEdges();
+
+  Status handleResponse(RpcResponse&& resps);
+
+  // Maps the vids of the scanned edges, which are rows of [src, dst] of each edge type, to dense
+  // ids. Fails if there are more than FLAGS_max_graph_algorithm_edges edges.
+  Status buildGraph(std::vector<DataSet> scanned);
+
+  folly::Future<Status> runAlgorithm();
+
+  // Builds the rows of the dst of each edge if `forward', and of the src if `backward'
+  Csr buildCsr(bool forward, bool backward) const;
+
+  // Runs func(begin, end) on all the vertices in batches concurrently, and returns the sum of
+  // the results of the batches.
+  template <typename Func>
+  folly::Future<double> parallelSum(Func func);
+
+  folly::Future<Status> pageRank();
+
+  folly::Future<Status> pageRankIteration(size_t iteration);
+
+  folly::Future<Status> wcc();
+
+  folly::Future<Status> labelPropagation();
+
+  folly::Future<Status> labelPropagationIteration(size_t iteration);
+
+  Status finishWithScores();
+
+  Status finishWithLabels();
+
+  const GraphAlgo* algo_{nullptr};
+  // Dense id to vid
+  std::vector<Value> vids_;
+  std::vector<std::pair<VertexId, VertexId>> edges_;
+  Csr csr_;
+  // For pagerank
+  std::vector<uint32_t> outDegrees_;
+  std::vector<double> scores_;
+  std::vector<double> nextScores_;
+  std::vector<double> contribs_;
+  // For wcc and lpa
+  std::vector<VertexId> labels_;
+  std::vector<VertexId> nextLabels_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // GRAPH_EXECUTOR_ALGO_GRAPHALGOEXECUTOR_H_
@@ -0,0 +1,218 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include "graph/executor/algo/RandomWalkExecutor.h"
+
+#include <folly/Random.h>
+
+#include "common/memory/MemoryTracker.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/Utils.h"
+
+using nebula::storage::StorageClient;
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> RandomWalkExecutor::execute() {
+  SCOPED_TIMER(&execTime_);
+  auto iter = ectx_->getResult(walk_->inputVar()).iter();
+  auto res = buildRequestListByVidType(iter.get(), walk_->src(), true);
+  NG_RETURN_IF_ERROR(res);
+  seeds_ = std::move(res).value();
+  initWalkers();
+  return walk();
+}
+
+void RandomWalkExecutor::initWalkers() {
+  auto walks = walk_->walks();
+  walkers_.reserve(seeds_.size() * walks);
+  active_.reserve(seeds_.size() * walks);
+  for (size_t i = 0; i < seeds_.size(); ++i) {
+    for (size_t j = 0; j < walks; ++j) {
+      Walker walker{i, {}};
+      walker.path.reserve(walk_->steps() + 1);
+      walker.path.emplace_back(seeds_[i]);
+      active_.emplace_back(walkers_.size());
+      walkers_.emplace_back(std::move(walker));
+    }
+  }
+}
+
+folly::Future<Status> RandomWalkExecutor::walk() {
+  if (!nextStep()) {
+    return buildResult();
+  }
+  std::vector<Value> vids;
+  vids.reserve(movers_.size());
+  for (const auto& group : movers_) {
+    vids.emplace_back(group.first);
+  }
+  // No more neighbors than the walkers are needed by the uniform walk
+  auto limit = walk_->weightProp().empty() ? static_cast<int64_t>(maxGroupSize_) : -1;
+  return getNeighbors(std::move(vids), limit);
+}
+
+bool RandomWalkExecutor::nextStep() {
+  auto restart = walk_->restart();
+  while (currentStep_ < walk_->steps() && !active_.empty()) {
+    ++currentStep_;
+    movers_.clear();
+    maxGroupSize_ = 0;
+    for (auto idx : active_) {
+      auto& walker = walkers_[idx];
+      if (restart > 0.0 && folly::Random::randDouble01() < restart) {
+        walker.path.emplace_back(seeds_[walker.seed]);
+        continue;
+      }
+      auto& group = movers_[walker.path.back()];
+      group.emplace_back(idx);
+      maxGroupSize_ = std::max(maxGroupSize_, group.size());
+    }
+    // Otherwise all the walkers went back to their seeds
+    if (!movers_.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+folly::Future<Status> RandomWalkExecutor::getNeighbors(std::vector<Value> vids, int64_t limit) {
+  time::Duration getNbrTime;
+  StorageClient* storageClient = qctx_->getStorageClient();
+  StorageClient::CommonRequestParam param(walk_->space(),
+                                          qctx_->rctx()->session()->id(),
+                                          qctx_->plan()->id(),
+                                          qctx_->plan()->isProfileEnabled());
+
+  storage::cpp2::EdgeDirection edgeDirection{Direction::OUT_EDGE};
+  return storageClient
+      ->getNeighbors(param,
+                     {nebula::kVid},
+                     std::move(vids),
+                     {},
+                     edgeDirection,
+                     nullptr,
+                     nullptr,
+                     walk_->edgeProps(),
+                     nullptr,
+                     false,
+                     limit >= 0,
+                     {},
+                     limit,
+                     nullptr,
+                     nullptr)
+      .via(runner())
+      .thenValue([this, getNbrTime](RpcResponse&& resp) mutable {
+        // MemoryTrackerVerified
+        memory::MemoryCheckGuard guard;
+        addState(folly::sformat("step[{}].total_rpc_time", currentStep_), getNbrTime);
+        auto& hostLatency = resp.hostLatency();
+        for (size_t i = 0; i < hostLatency.size(); ++i) {
+          size_t size = 0u;
+          auto& result = resp.responses()[i];
+          if (result.vertices_ref().has_value()) {
+            size = (*result.vertices_ref()).size();
+          }
+          auto info = util::collectRespProfileData(result.result, hostLatency[i], size);
+          addState(folly::sformat("step[{}].resp[{}]", currentStep_, i), info);
+        }
+        return handleResponse(std::move(resp));
+      });
+}
+
+folly::Future<Status> RandomWalkExecutor::handleResponse(RpcResponse&& resps) {
+  auto result = handleCompleteness(resps, FLAGS_accept_partial_success);
+  NG_RETURN_IF_ERROR(result);
+
+  List list;
+  for (auto& resp : resps.responses()) {
+    auto dataset = resp.get_vertices();
+    if (dataset == nullptr) {
+      continue;
+    }
+    list.values.emplace_back(std::move(*dataset));
+  }
+  moveWalkers(std::move(list));
+  return walk();
+}
+
+void RandomWalkExecutor::moveWalkers(List neighbors) {
+  auto allCandidates = collectCandidates(std::move(neighbors));
+  std::unordered_set<size_t> stopped;
+  for (auto& group : movers_) {
+    auto found = allCandidates.find(group.first);
+    for (auto idx : group.second) {
+      const Value* next = found == allCandidates.end() ? nullptr : pick(found->second);
+      if (next == nullptr) {
+        stopped.emplace(idx);
+        continue;
+      }
+      walkers_[idx].path.emplace_back(*next);
+    }
+  }
+  if (!stopped.empty()) {
+    active_.erase(std::remove_if(active_.begin(),
+                                 active_.end(),
+                                 [&stopped](size_t idx) { return stopped.count(idx) != 0; }),
+                  active_.end());
+  }
+}
+
+RandomWalkExecutor::CandidatesMap RandomWalkExecutor::collectCandidates(List neighbors) {
+  GetNeighborsIter iter(std::make_shared<Value>(std::move(neighbors)));
+
+  const auto& weightProp = walk_->weightProp();
+  CandidatesMap candidatesMap;
+  candidatesMap.reserve(movers_.size());
+  for (; iter.valid(); iter.next()) {
+    const auto& dst = iter.getEdgeProp("*", nebula::kDst);
+    if (dst.empty()) {
+      // no edge, dst is empty
+      continue;
+    }
+    double weight = 1.0;
+    if (!weightProp.empty()) {
+      const auto& w = iter.getEdgeProp("*", weightProp);
+      weight = w.isInt() ? static_cast<double>(w.getInt()) : (w.isFloat() ? w.getFloat() : 0.0);
+      if (!(weight > 0.0)) {
+        continue;
+      }
+    }
+    auto& candidates = candidatesMap[iter.getColumn(nebula::kVid)];
+    auto sum = candidates.weights.empty() ? 0.0 : candidates.weights.back();
+    candidates.dsts.emplace_back(dst);
+    candidates.weights.emplace_back(sum + weight);
+  }
+  return candidatesMap;
+}
+
+const Value* RandomWalkExecutor::pick(const Candidates& candidates) const {
+  if (candidates.dsts.empty()) {
+    return nullptr;
+  }
+  auto total = candidates.weights.back();
+  auto point = folly::Random::randDouble(0.0, total);
+  auto found = std::upper_bound(candidates.weights.begin(), candidates.weights.end(), point);
+  if (found == candidates.weights.end()) {
+    --found;
+  }
+  return &candidates.dsts[std::distance(candidates.weights.begin(), found)];
+}
+
+folly::Future<Status> RandomWalkExecutor::buildResult() {
+  DataSet ds(walk_->colNames());
+  ds.rows.reserve(walkers_.size());
+  for (auto& walker : walkers_) {
+    Row row;
+    row.values.emplace_back(seeds_[walker.seed]);
+    row.values.emplace_back(List(std::move(walker.path)));
+    ds.rows.emplace_back(std::move(row));
+  }
+  walkers_.clear();
+  return finish(ResultBuilder().value(Value(std::move(ds))).build());
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,93 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#ifndef GRAPH_EXECUTOR_ALGO_RANDOMWALKEXECUTOR_H_
+#define GRAPH_EXECUTOR_ALGO_RANDOMWALKEXECUTOR_H_
+
+#include <robin_hood.h>
+
+#include "graph/executor/StorageAccessExecutor.h"
+#include "graph/planner/plan/Algo.h"
+
+// RandomWalk starts `walks' walkers from each of the src vertices, all the walkers move one step
+// forward together, i.e. the walkers standing on the same vertex are grouped, and one
+// GetNeighbors request is sent for the distinct vertices of each step.
+//
+// For the uniform walk, the neighbors are sampled by storage, at most the number of walkers on the
+// vertex, and each walker picks one of the samples. For the weighted walk, all the neighbors with
+// the weight prop are fetched, and each walker picks one with the probability proportional to
+// the weight, the ones with non-positive weights are never picked.
+//
+// Before each step, a walker jumps back to its seed with the probability of `restart', which
+// doesn't touch storage. A walker stops when its vertex has no neighbor to go, so the walks may be
+// shorter than the steps.
+//
+// Output: one row for each walker, [seed, [seed, v1, v2, ...]]
+
+namespace nebula {
+namespace graph {
+
+class RandomWalkExecutor : public StorageAccessExecutor {
+  friend class RandomWalkTest;
+
+ public:
+  using RpcResponse = storage::StorageRpcResponse<storage::cpp2::GetNeighborsResponse>;
+
+  RandomWalkExecutor(const PlanNode* node, QueryContext* qctx)
+      : StorageAccessExecutor("RandomWalkExecutor", node, qctx) {
+    walk_ = asNode<RandomWalk>(node);
+  }
+
+  folly::Future<Status> execute() override;
+
+ private:
+  struct Walker {
+    size_t seed;
+    std::vector<Value> path;
+  };
+
+  // The neighbors of a vertex, with the prefix sums of their weights
+  struct Candidates {
+    std::vector<Value> dsts;
+    std::vector<double> weights;
+  };
+
+  using WalkerMap = robin_hood::unordered_flat_map<Value, std::vector<size_t>, std::hash<Value>>;
+  using CandidatesMap = robin_hood::unordered_flat_map<Value, Candidates, std::hash<Value>>;
+
+  void initWalkers();
+
+  folly::Future<Status> walk();
+
+  // Goes to the next step in which some walkers move along the edges, false if no more steps
+  bool nextStep();
+
+  folly::Future<Status> getNeighbors(std::vector<Value> vids, int64_t limit);
+
+  folly::Future<Status> handleResponse(RpcResponse&& resps);
+
+  // Moves the walkers of the current step by the neighbors of their vertices, which are in the
+  // form of the GetNeighbors results
+  void moveWalkers(List neighbors);
+
+  CandidatesMap collectCandidates(List neighbors);
+
+  const Value* pick(const Candidates& candidates) const;
+
+  folly::Future<Status> buildResult();
+
+  const RandomWalk* walk_{nullptr};
+  size_t currentStep_{0};
+  std::vector<Value> seeds_;
+  std::vector<Walker> walkers_;
+  // The indices of the walkers not stopped yet
+  std::vector<size_t> active_;
+  // The walkers to move in the current step, grouped by the vertices they stand on
+  WalkerMap movers_;
+  size_t maxGroupSize_{0};
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // GRAPH_EXECUTOR_ALGO_RANDOMWALKEXECUTOR_H_
@@ -48,6 +48,16 @@ folly::Future<std::vector<Value>> ShortestPathBase::getMeetVidsProps(
       });
 }
 
+std::vector<Value> ShortestPathBase::PathTree::values(PathId path) const {
+  std::vector<Value> result;
+  for (auto id = path; id != kNoParent; id = nodes_[id].parent) {
+    const auto& step = steps_[nodes_[id].step];
+    result.insert(result.end(), step.values.rbegin(), step.values.rend());
+  }
+  std::reverse(result.begin(), result.end());
+  return result;
+}
+
 bool ShortestPathBase::hasSameEdge(const std::vector<Value>& values) {
   for (size_t i = 0; i < values.size(); ++i) {
     if (values[i].isEdge()) {
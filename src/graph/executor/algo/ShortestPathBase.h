@@ -42,6 +42,52 @@ class ShortestPathBase {
   // save the starting vertex and the corresponding edge. eg [vertex(a), edge(a->b)]
   using CustomStep = Row;
 
+  // PathTree keeps the paths of one direction as a prefix tree. A path is the id of its last
+  // node, and each node refers to its parent and to the step it appends, so the paths extended
+  // from the same prefix share the nodes of it instead of copying it. The vertices and the edges
+  // of a path are only materialized by values() when the path is emitted.
+  class PathTree {
+   public:
+    using PathId = uint32_t;
+    using StepId = uint32_t;
+    // The parent of the paths of one step
+    static constexpr PathId kNoParent = std::numeric_limits<PathId>::max();
+
+    StepId addStep(CustomStep step) {
+      checkSize(steps_.size());
+      steps_.emplace_back(std::move(step));
+      return steps_.size() - 1;
+    }
+
+    PathId append(PathId parent, StepId step) {
+      checkSize(nodes_.size());
+      nodes_.emplace_back(Node{parent, step});
+      return nodes_.size() - 1;
+    }
+
+    const CustomStep& lastStep(PathId path) const {
+      return steps_[nodes_[path].step];
+    }
+
+    // [vertex(a), edge(a->b), vertex(b), edge(b->c), ...] from the first step of the path
+    std::vector<Value> values(PathId path) const;
+
+   private:
+    struct Node {
+      PathId parent;
+      StepId step;
+    };
+
+    static void checkSize(size_t size) {
+      if (UNLIKELY(size >= kNoParent)) {
+        throw std::bad_alloc();
+      }
+    }
+
+    std::vector<Node> nodes_;
+    std::vector<CustomStep> steps_;
+  };
+
  protected:
   folly::Future<std::vector<Value>> getMeetVidsProps(const std::vector<Value>& meetVids);
 
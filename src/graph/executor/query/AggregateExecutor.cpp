@@ -30,7 +30,7 @@ folly::Future<Status> AggregateExecutor::execute() {
     }
   }
 
-  std::unordered_map<List, std::vector<std::unique_ptr<AggData>>, std::hash<nebula::List>> result;
+  std::pmr::unordered_map<List, std::vector<std::unique_ptr<AggData>>> result(arena());
 
   // generate default result when input dataset is empty
   if (UNLIKELY(!iter->valid())) {
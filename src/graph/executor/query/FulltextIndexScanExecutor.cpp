@@ -12,23 +12,34 @@
 
 using nebula::storage::StorageClient;
 using nebula::storage::StorageRpcResponse;
-using nebula::storage::cpp2::GetPropResponse;
+using nebula::storage::cpp2::FulltextSearchResponse;
 
 namespace nebula::graph {
 
 folly::Future<Status> FulltextIndexScanExecutor::execute() {
+  auto* ftIndexScan = asNode<FulltextIndexScan>(node());
+  const auto& space = qctx()->rctx()->session()->space();
+  auto localHosts = FTIndexUtils::localFTIndexHosts(qctx_->getMetaClient(), space.id);
+  NG_RETURN_IF_ERROR(localHosts);
+  if (!localHosts.value().empty()) {
+    return accessLocalFulltextIndex(ftIndexScan->searchExpression(),
+                                    std::move(localHosts).value());
+  }
   auto esAdapterResult = FTIndexUtils::getESAdapter(qctx_->getMetaClient());
   if (!esAdapterResult.ok()) {
     return esAdapterResult.status();
   }
   esAdapter_ = std::move(esAdapterResult).value();
-  auto* ftIndexScan = asNode<FulltextIndexScan>(node());
   auto esQueryResult = accessFulltextIndex(ftIndexScan->searchExpression());
   if (!esQueryResult.ok()) {
     LOG(ERROR) << esQueryResult.status().message();
     return esQueryResult.status();
   }
-  auto esResultValue = std::move(esQueryResult).value();
+  return handleResult(std::move(esQueryResult).value());
+}
+
+Status FulltextIndexScanExecutor::handleResult(plugin::ESQueryResult&& esResultValue) {
+  auto* ftIndexScan = asNode<FulltextIndexScan>(node());
   const auto& space = qctx()->rctx()->session()->space();
   if (!isIntVidType(space)) {
     if (ftIndexScan->isEdge()) {
@@ -74,6 +85,105 @@ folly::Future<Status> FulltextIndexScanExecutor::execute() {
   return Status::OK();
 }
 
+folly::Future<Status> FulltextIndexScanExecutor::accessLocalFulltextIndex(
+    TextSearchExpression* tsExpr, std::unordered_map<HostAddr, std::vector<PartitionID>> hosts) {
+  if (tsExpr->kind() != Expression::Kind::kESQUERY) {
+    return Status::SemanticError("text search expression error");
+  }
+  auto* ftIndexScan = asNode<FulltextIndexScan>(node());
+  auto arg = tsExpr->arg();
+  int64_t offset = ftIndexScan->getValidOffset();
+  auto limit = ftIndexScan->limit();
+  if (limit > std::numeric_limits<int32_t>::max()) {
+    limit = std::numeric_limits<int32_t>::max();
+  }
+  if (limit - offset == 0) {
+    return handleResult(plugin::ESQueryResult());
+  }
+
+  StorageClient::CommonRequestParam param(ftIndexScan->space(),
+                                          qctx()->rctx()->session()->id(),
+                                          qctx()->plan()->id(),
+                                          qctx()->plan()->isProfileEnabled());
+  // The BM25 scores of different parts are comparable only if they're computed by the same
+  // statistics, so the statistics of all parts are collected and summed up first
+  auto* storageClient = qctx_->getStorageClient();
+  return storageClient->fulltextStats(param, hosts, arg->index(), arg->query())
+      .via(runner())
+      .thenValue([this, storageClient, param, hosts = std::move(hosts), arg, offset, limit](
+                     StorageRpcResponse<FulltextSearchResponse>&& statsResp) mutable {
+        memory::MemoryCheckGuard guard;
+        addStats(statsResp);
+        auto statsCompleteness = handleCompleteness(statsResp, FLAGS_accept_partial_success);
+        if (!statsCompleteness.ok()) {
+          return folly::makeFuture<Status>(statsCompleteness.status());
+        }
+        // Each part returns its top (offset + count), the global page is cut after merged
+        return storageClient
+            ->fulltextSearch(param,
+                             std::move(hosts),
+                             arg->index(),
+                             arg->query(),
+                             limit,
+                             mergeStats(statsResp.responses()))
+            .via(runner())
+            .thenValue([this, offset, limit](StorageRpcResponse<FulltextSearchResponse>&& rpcResp) {
+              memory::MemoryCheckGuard guard;
+              addStats(rpcResp);
+              auto completeness = handleCompleteness(rpcResp, FLAGS_accept_partial_success);
+              NG_RETURN_IF_ERROR(completeness);
+              plugin::ESQueryResult result;
+              for (auto& resp : rpcResp.responses()) {
+                if (!resp.data_ref().has_value()) {
+                  continue;
+                }
+                for (auto& row : resp.data_ref()->rows) {
+                  plugin::ESQueryResult::Item item;
+                  item.vid = row[0].getStr();
+                  item.src = row[1].getStr();
+                  item.dst = row[2].getStr();
+                  item.rank = row[3].getInt();
+                  item.score = row[4].getFloat();
+                  result.items.emplace_back(std::move(item));
+                }
+              }
+              auto& items = result.items;
+              std::stable_sort(items.begin(), items.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.score > rhs.score;
+              });
+              if (items.size() > static_cast<size_t>(limit)) {
+                items.resize(limit);
+              }
+              if (items.size() > static_cast<size_t>(offset)) {
+                items.erase(items.begin(), items.begin() + offset);
+              } else {
+                items.clear();
+              }
+              return handleResult(std::move(result));
+            });
+      });
+}
+
+storage::cpp2::FulltextStats FulltextIndexScanExecutor::mergeStats(
+    const std::vector<FulltextSearchResponse>& responses) {
+  storage::cpp2::FulltextStats stats;
+  for (const auto& resp : responses) {
+    if (!resp.stats_ref().has_value()) {
+      continue;
+    }
+    for (const auto& kv : resp.stats_ref()->get_doc_count()) {
+      (*stats.doc_count_ref())[kv.first] += kv.second;
+    }
+    for (const auto& kv : resp.stats_ref()->get_total_length()) {
+      (*stats.total_length_ref())[kv.first] += kv.second;
+    }
+    for (const auto& kv : resp.stats_ref()->get_doc_freq()) {
+      (*stats.doc_freq_ref())[kv.first] += kv.second;
+    }
+  }
+  return stats;
+}
+
 StatusOr<plugin::ESQueryResult> FulltextIndexScanExecutor::accessFulltextIndex(
     TextSearchExpression* tsExpr) {
   std::function<StatusOr<nebula::plugin::ESQueryResult>()> execFunc;
@@ -11,16 +11,27 @@
 
 namespace nebula::graph {
 class FulltextIndexScan;
-class FulltextIndexScanExecutor final : public Executor {
+class FulltextIndexScanExecutor final : public StorageAccessExecutor {
  public:
   FulltextIndexScanExecutor(const PlanNode* node, QueryContext* qctx)
-      : Executor("FulltextIndexScanExecutor", node, qctx) {}
+      : StorageAccessExecutor("FulltextIndexScanExecutor", node, qctx) {}
 
   folly::Future<Status> execute() override;
 
  private:
   StatusOr<plugin::ESQueryResult> accessFulltextIndex(TextSearchExpression* expr);
 
+  // Search the index maintained by local fulltext listeners, each part is searched in its
+  // listener host by the statistics of all parts, and the results are merged by score
+  folly::Future<Status> accessLocalFulltextIndex(
+      TextSearchExpression* expr, std::unordered_map<HostAddr, std::vector<PartitionID>> hosts);
+
+  // Sum up the statistics returned by the listener hosts
+  static storage::cpp2::FulltextStats mergeStats(
+      const std::vector<storage::cpp2::FulltextSearchResponse>& responses);
+
+  Status handleResult(plugin::ESQueryResult&& esResultValue);
+
   bool isIntVidType(const SpaceInfo& space) const {
     return (*space.spaceDesc.vid_type_ref()).type == nebula::cpp2::PropertyType::INT64;
   }
@@ -22,7 +22,7 @@ folly::Future<Status> InnerJoinExecutor::execute() {
 
 Status InnerJoinExecutor::close() {
   exchange_ = false;
-  return Executor::close();
+  return JoinExecutor::close();
 }
 
 folly::Future<Status> InnerJoinExecutor::join(const std::vector<Expression*>& hashKeys,
@@ -39,7 +39,7 @@ folly::Future<Status> InnerJoinExecutor::join(const std::vector<Expression*>& ha
   }
 
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
-    std::unordered_map<Value, std::vector<const Row*>> hashTable;
+    JoinHashTable<Value> hashTable(arena());
     hashTable.reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
       buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), hashTable);
@@ -52,7 +52,7 @@ folly::Future<Status> InnerJoinExecutor::join(const std::vector<Expression*>& ha
       result = singleKeyProbe(hashKeys.front(), lhsIter_.get(), hashTable);
     }
   } else {
-    std::unordered_map<List, std::vector<const Row*>> hashTable;
+    JoinHashTable<List> hashTable(arena());
     hashTable.reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
       buildHashTable(hashKeys, lhsIter_.get(), hashTable);
@@ -69,10 +69,9 @@ folly::Future<Status> InnerJoinExecutor::join(const std::vector<Expression*>& ha
   return finish(ResultBuilder().value(Value(std::move(result))).build());
 }
 
-DataSet InnerJoinExecutor::probe(
-    const std::vector<Expression*>& probeKeys,
-    Iterator* probeIter,
-    const std::unordered_map<List, std::vector<const Row*>>& hashTable) const {
+DataSet InnerJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
+                                 Iterator* probeIter,
+                                 const JoinHashTable<List>& hashTable) const {
   DataSet ds;
   QueryExpressionContext ctx(ectx_);
   ds.rows.reserve(probeIter->size());
@@ -94,10 +93,9 @@ DataSet InnerJoinExecutor::probe(
   return ds;
 }
 
-DataSet InnerJoinExecutor::singleKeyProbe(
-    Expression* probeKey,
-    Iterator* probeIter,
-    const std::unordered_map<Value, std::vector<const Row*>>& hashTable) const {
+DataSet InnerJoinExecutor::singleKeyProbe(Expression* probeKey,
+                                          Iterator* probeIter,
+                                          const JoinHashTable<Value>& hashTable) const {
   DataSet ds;
   QueryExpressionContext ctx(ectx_);
   for (; probeIter->valid(); probeIter->next()) {
@@ -127,23 +125,23 @@ folly::Future<Status> InnerJoinExecutor::joinMultiJobs(const std::vector<Express
   }
 
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
-    hashTable_.reserve(bucketSize);
+    hashTable_->reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
-      buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), hashTable_);
+      buildSingleKeyHashTable(hashKeys.front(), lhsIter_.get(), *hashTable_);
       return singleKeyProbe(probeKeys.front(), rhsIter_.get());
     } else {
       exchange_ = true;
-      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable_);
+      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), *hashTable_);
       return singleKeyProbe(hashKeys.front(), lhsIter_.get());
     }
   } else {
-    listHashTable_.reserve(bucketSize);
+    listHashTable_->reserve(bucketSize);
     if (lhsIter_->size() < rhsIter_->size()) {
-      buildHashTable(hashKeys, lhsIter_.get(), listHashTable_);
+      buildHashTable(hashKeys, lhsIter_.get(), *listHashTable_);
       return probe(probeKeys, rhsIter_.get());
     } else {
       exchange_ = true;
-      buildHashTable(probeKeys, rhsIter_.get(), listHashTable_);
+      buildHashTable(probeKeys, rhsIter_.get(), *listHashTable_);
       return probe(hashKeys, lhsIter_.get());
     }
   }
@@ -167,7 +165,7 @@ folly::Future<Status> InnerJoinExecutor::probe(const std::vector<Expression*>& p
         Value val = col->eval(ctx(tmpIter));
         list.values.emplace_back(std::move(val));
       }
-      buildNewRow<List>(listHashTable_, list, *tmpIter->row(), ds);
+      buildNewRow<List>(*listHashTable_, list, *tmpIter->row(), ds);
     }
     return ds;
   };
@@ -209,7 +207,7 @@ folly::Future<Status> InnerJoinExecutor::singleKeyProbe(Expression* probeKey, It
     ds.rows.reserve(end - begin);
     for (; tmpIter->valid() && begin++ < end; tmpIter->next()) {
       auto& val = tmpProbeKey->eval(ctx(tmpIter));
-      buildNewRow<Value>(hashTable_, val, *tmpIter->row(), ds);
+      buildNewRow<Value>(*hashTable_, val, *tmpIter->row(), ds);
     }
     return ds;
   };
@@ -243,7 +241,7 @@ folly::Future<Status> InnerJoinExecutor::singleKeyProbe(Expression* probeKey, It
 }
 
 template <class T>
-void InnerJoinExecutor::buildNewRow(const std::unordered_map<T, std::vector<const Row*>>& hashTable,
+void InnerJoinExecutor::buildNewRow(const JoinHashTable<T>& hashTable,
                                     const T& val,
                                     Row rRow,
                                     DataSet& ds) const {
@@ -9,10 +9,16 @@
 namespace nebula {
 namespace graph {
 
+Status JoinExecutor::close() {
+  hashTable_.reset();
+  listHashTable_.reset();
+  return Executor::close();
+}
+
 Status JoinExecutor::checkInputDataSets() {
-  // Since the executors might reuse in loops, so manually clear the table here.
-  hashTable_.clear();
-  listHashTable_.clear();
+  // Since the executors might reuse in loops, so manually recreate the tables here.
+  hashTable_.emplace(arena());
+  listHashTable_.emplace(arena());
   auto* join = asNode<Join>(node());
   lhsIter_ = ectx_->getVersionedResult(join->leftVar().first, join->leftVar().second).iter();
   DCHECK(!!lhsIter_);
@@ -75,7 +81,7 @@ Status JoinExecutor::checkBiInputDataSets() {
 
 void JoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
                                   Iterator* iter,
-                                  std::unordered_map<List, std::vector<const Row*>>& hashTable) {
+                                  JoinHashTable<List>& hashTable) {
   QueryExpressionContext ctx(ectx_);
   for (; iter->valid(); iter->next()) {
     List list;
@@ -90,10 +96,9 @@ void JoinExecutor::buildHashTable(const std::vector<Expression*>& hashKeys,
   }
 }
 
-void JoinExecutor::buildSingleKeyHashTable(
-    Expression* hashKey,
-    Iterator* iter,
-    std::unordered_map<Value, std::vector<const Row*>>& hashTable) {
+void JoinExecutor::buildSingleKeyHashTable(Expression* hashKey,
+                                           Iterator* iter,
+                                           JoinHashTable<Value>& hashTable) {
   QueryExpressionContext ctx(ectx_);
   for (; iter->valid(); iter->next()) {
     auto& val = hashKey->eval(ctx(iter));
@@ -10,23 +10,29 @@
 namespace nebula {
 namespace graph {
 
+// The hash table of join, allocated from the arena of the executor
+template <class K>
+using JoinHashTable = std::pmr::unordered_map<K, std::pmr::vector<const Row*>>;
+
 class JoinExecutor : public Executor {
  public:
   JoinExecutor(const std::string& name, const PlanNode* node, QueryContext* qctx)
       : Executor(name, node, qctx) {}
 
  protected:
+  Status close() override;
+
   Status checkInputDataSets();
 
   Status checkBiInputDataSets();
 
   void buildHashTable(const std::vector<Expression*>& hashKeys,
                       Iterator* iter,
-                      std::unordered_map<List, std::vector<const Row*>>& hashTable);
+                      JoinHashTable<List>& hashTable);
 
   void buildSingleKeyHashTable(Expression* hashKey,
                                Iterator* iter,
-                               std::unordered_map<Value, std::vector<const Row*>>& hashTable);
+                               JoinHashTable<Value>& hashTable);
 
   // concat rows
   Row newRow(Row left, Row right) const;
@@ -40,8 +46,10 @@ class JoinExecutor : public Executor {
   // If the join is natural join, rhsOutputColIdxs_ will be used to record the output column index
   // of the right. If not, rhsOutputColIdxs_ will be empty.
   std::optional<std::vector<size_t>> rhsOutputColIdxs_;
-  std::unordered_map<Value, std::vector<const Row*>> hashTable_;
-  std::unordered_map<List, std::vector<const Row*>> listHashTable_;
+  // The hash tables shared by the jobs probing them, which are created in the arena in
+  // checkInputDataSets() and destroyed in close() before the arena is released
+  std::optional<JoinHashTable<Value>> hashTable_;
+  std::optional<JoinHashTable<List>> listHashTable_;
 };
 }  // namespace graph
 }  // namespace nebula
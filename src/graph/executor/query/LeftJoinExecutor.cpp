@@ -26,7 +26,7 @@ folly::Future<Status> LeftJoinExecutor::execute() {
 }
 
 Status LeftJoinExecutor::close() {
-  return Executor::close();
+  return JoinExecutor::close();
 }
 
 folly::Future<Status> LeftJoinExecutor::join(const std::vector<Expression*>& hashKeys,
@@ -35,7 +35,7 @@ folly::Future<Status> LeftJoinExecutor::join(const std::vector<Expression*>& has
   DCHECK_EQ(hashKeys.size(), probeKeys.size());
   DataSet result;
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
-    std::unordered_map<Value, std::vector<const Row*>> hashTable;
+    JoinHashTable<Value> hashTable(arena());
     hashTable.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
       buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable);
@@ -43,7 +43,7 @@ folly::Future<Status> LeftJoinExecutor::join(const std::vector<Expression*>& has
       result = singleKeyProbe(hashKeys.front(), lhsIter_.get(), hashTable);
     }
   } else {
-    std::unordered_map<List, std::vector<const Row*>> hashTable;
+    JoinHashTable<List> hashTable(arena());
     hashTable.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
       buildHashTable(probeKeys, rhsIter_.get(), hashTable);
@@ -56,10 +56,9 @@ folly::Future<Status> LeftJoinExecutor::join(const std::vector<Expression*>& has
   return finish(ResultBuilder().value(Value(std::move(result))).build());
 }
 
-DataSet LeftJoinExecutor::probe(
-    const std::vector<Expression*>& probeKeys,
-    Iterator* probeIter,
-    const std::unordered_map<List, std::vector<const Row*>>& hashTable) const {
+DataSet LeftJoinExecutor::probe(const std::vector<Expression*>& probeKeys,
+                                Iterator* probeIter,
+                                const JoinHashTable<List>& hashTable) const {
   DataSet ds;
   ds.rows.reserve(probeIter->size());
   QueryExpressionContext ctx(ectx_);
@@ -82,10 +81,9 @@ DataSet LeftJoinExecutor::probe(
   return ds;
 }
 
-DataSet LeftJoinExecutor::singleKeyProbe(
-    Expression* probeKey,
-    Iterator* probeIter,
-    const std::unordered_map<Value, std::vector<const Row*>>& hashTable) const {
+DataSet LeftJoinExecutor::singleKeyProbe(Expression* probeKey,
+                                         Iterator* probeIter,
+                                         const JoinHashTable<Value>& hashTable) const {
   DataSet ds;
   ds.rows.reserve(probeIter->size());
   QueryExpressionContext ctx(ectx_);
@@ -108,15 +106,15 @@ folly::Future<Status> LeftJoinExecutor::joinMultiJobs(const std::vector<Expressi
   DCHECK_EQ(hashKeys.size(), probeKeys.size());
   DataSet result;
   if (hashKeys.size() == 1 && probeKeys.size() == 1) {
-    hashTable_.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
+    hashTable_->reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
-      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), hashTable_);
+      buildSingleKeyHashTable(probeKeys.front(), rhsIter_.get(), *hashTable_);
       return singleKeyProbe(hashKeys.front(), lhsIter_.get());
     }
   } else {
-    listHashTable_.reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
+    listHashTable_->reserve(rhsIter_->empty() ? 1 : rhsIter_->size());
     if (!lhsIter_->empty()) {
-      buildHashTable(probeKeys, rhsIter_.get(), listHashTable_);
+      buildHashTable(probeKeys, rhsIter_.get(), *listHashTable_);
       return probe(hashKeys, lhsIter_.get());
     }
   }
@@ -144,7 +142,7 @@ folly::Future<Status> LeftJoinExecutor::probe(const std::vector<Expression*>& pr
         list.values.emplace_back(std::move(val));
       }
 
-      buildNewRow<List>(listHashTable_, list, *tmpIter->row(), ds);
+      buildNewRow<List>(*listHashTable_, list, *tmpIter->row(), ds);
     }
     return ds;
   };
@@ -185,7 +183,7 @@ folly::Future<Status> LeftJoinExecutor::singleKeyProbe(Expression* probeKey, Ite
     ds.rows.reserve(end - begin);
     for (; tmpIter->valid() && begin++ < end; tmpIter->next()) {
       auto& val = tmpProbeKey->eval(ctx(tmpIter));
-      buildNewRow<Value>(hashTable_, val, *tmpIter->row(), ds);
+      buildNewRow<Value>(*hashTable_, val, *tmpIter->row(), ds);
     }
     return ds;
   };
@@ -219,7 +217,7 @@ folly::Future<Status> LeftJoinExecutor::singleKeyProbe(Expression* probeKey, Ite
 }
 
 template <class T>
-void LeftJoinExecutor::buildNewRow(const std::unordered_map<T, std::vector<const Row*>>& hashTable,
+void LeftJoinExecutor::buildNewRow(const JoinHashTable<T>& hashTable,
                                    const T& val,
                                    Row lRow,
                                    DataSet& ds) const {
@@ -0,0 +1,186 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include "graph/executor/query/MultiwayJoinExecutor.h"
+
+#include "graph/planner/plan/Query.h"
+
+namespace nebula {
+namespace graph {
+
+folly::Future<Status> MultiwayJoinExecutor::execute() {
+  SCOPED_TIMER(&execTime_);
+  NG_RETURN_IF_ERROR(buildRelations());
+  DataSet ds;
+  ds.colNames = node()->colNames();
+
+  std::vector<Range> ranges;
+  ranges.reserve(relations_.size());
+  for (const auto& relation : relations_) {
+    ranges.emplace_back(0, relation.entries.size());
+  }
+  join(0, ranges, ds);
+  relations_.clear();
+  participants_.clear();
+  return finish(ResultBuilder().value(Value(std::move(ds))).build());
+}
+
+Status MultiwayJoinExecutor::buildRelations() {
+  // Since the executors might reuse in loops, so manually clear here.
+  relations_.clear();
+  auto* join = asNode<MultiwayJoin>(node());
+  const auto& joinCols = join->joinCols();
+  const auto& colNames = join->colNames();
+  participants_.assign(joinCols.size(), {});
+  std::vector<bool> filled(colNames.size(), false);
+
+  for (auto* var : join->inputVars()) {
+    Relation relation;
+    relation.iter = ectx_->getResult(var->name).iter();
+    DCHECK(!!relation.iter);
+    if (relation.iter->isGetNeighborsIter() || relation.iter->isDefaultIter()) {
+      std::stringstream ss;
+      ss << "Multiway join executor does not support " << relation.iter->kind();
+      return Status::Error(ss.str());
+    }
+
+    const auto& inputCols = var->colNames;
+    std::vector<size_t> keyCols;
+    for (size_t i = 0; i < joinCols.size(); ++i) {
+      auto found = std::find(inputCols.begin(), inputCols.end(), joinCols[i]);
+      if (found == inputCols.end()) {
+        relation.keyIdx.emplace_back(-1);
+        continue;
+      }
+      relation.keyIdx.emplace_back(keyCols.size());
+      keyCols.emplace_back(std::distance(inputCols.begin(), found));
+      participants_[i].emplace_back(relations_.size());
+    }
+    for (size_t i = 0; i < colNames.size(); ++i) {
+      if (filled[i]) {
+        continue;
+      }
+      auto found = std::find(inputCols.begin(), inputCols.end(), colNames[i]);
+      if (found != inputCols.end()) {
+        relation.outputCols.emplace_back(i, std::distance(inputCols.begin(), found));
+        filled[i] = true;
+      }
+    }
+
+    auto& entries = relation.entries;
+    entries.reserve(relation.iter->size());
+    for (; relation.iter->valid(); relation.iter->next()) {
+      const auto* row = relation.iter->row();
+      std::vector<Value> keys;
+      keys.reserve(keyCols.size());
+      for (auto col : keyCols) {
+        // Join on the vid of vertex, the same as `_joinkey`
+        const auto& val = row->values[col];
+        keys.emplace_back(val.isVertex() ? val.getVertex().vid : val);
+      }
+      // The null never equals to anything
+      if (std::any_of(keys.begin(), keys.end(), [](const auto& key) {
+            return key.isNull() || key.empty();
+          })) {
+        continue;
+      }
+      entries.emplace_back(std::move(keys), row);
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+      return lhs.first < rhs.first;
+    });
+    relations_.emplace_back(std::move(relation));
+  }
+  return Status::OK();
+}
+
+void MultiwayJoinExecutor::join(size_t depth, std::vector<Range>& ranges, DataSet& ds) const {
+  if (depth == participants_.size()) {
+    Row row;
+    row.values.resize(ds.colNames.size());
+    emit(0, ranges, row, ds);
+    return;
+  }
+
+  const auto& participants = participants_[depth];
+  if (participants.empty()) {
+    join(depth + 1, ranges, ds);
+    return;
+  }
+  // The entries in the range share the keys of the previous depths, so they are sorted by the key
+  // of the current depth.
+  auto keyOf = [this, depth](size_t rel, size_t pos) -> const Value& {
+    const auto& relation = relations_[rel];
+    return relation.entries[pos].first[relation.keyIdx[depth]];
+  };
+  auto seek = [this, depth](size_t rel, const Range& range, const Value& key, bool upper) {
+    const auto& relation = relations_[rel];
+    auto idx = relation.keyIdx[depth];
+    auto begin = relation.entries.begin() + range.first;
+    auto end = relation.entries.begin() + range.second;
+    if (upper) {
+      begin = std::upper_bound(
+          begin, end, key, [idx](const Value& k, const Entry& e) { return k < e.first[idx]; });
+    } else {
+      begin = std::lower_bound(
+          begin, end, key, [idx](const Entry& e, const Value& k) { return e.first[idx] < k; });
+    }
+    return static_cast<size_t>(std::distance(relation.entries.begin(), begin));
+  };
+
+  while (true) {
+    Value maxKey;
+    for (auto rel : participants) {
+      if (ranges[rel].first >= ranges[rel].second) {
+        return;
+      }
+      const auto& key = keyOf(rel, ranges[rel].first);
+      if (maxKey.empty() || maxKey < key) {
+        maxKey = key;
+      }
+    }
+
+    bool matched = true;
+    for (auto rel : participants) {
+      ranges[rel].first = seek(rel, ranges[rel], maxKey, false);
+      if (ranges[rel].first >= ranges[rel].second || keyOf(rel, ranges[rel].first) != maxKey) {
+        matched = false;
+      }
+    }
+    if (!matched) {
+      continue;
+    }
+
+    // Narrow down to the entries equal to the key, and then skip them after the next depth.
+    auto narrowed = ranges;
+    for (auto rel : participants) {
+      narrowed[rel].second = seek(rel, ranges[rel], maxKey, true);
+    }
+    join(depth + 1, narrowed, ds);
+    for (auto rel : participants) {
+      ranges[rel].first = narrowed[rel].second;
+    }
+  }
+}
+
+void MultiwayJoinExecutor::emit(size_t rel,
+                                const std::vector<Range>& ranges,
+                                Row& row,
+                                DataSet& ds) const {
+  if (rel == relations_.size()) {
+    ds.rows.emplace_back(row);
+    return;
+  }
+  const auto& relation = relations_[rel];
+  for (auto i = ranges[rel].first; i < ranges[rel].second; ++i) {
+    const auto* input = relation.entries[i].second;
+    for (const auto& [out, in] : relation.outputCols) {
+      row.values[out] = input->values[in];
+    }
+    emit(rel + 1, ranges, row, ds);
+  }
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,52 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#ifndef GRAPH_EXECUTOR_QUERY_MULTIWAYJOINEXECUTOR_H_
+#define GRAPH_EXECUTOR_QUERY_MULTIWAYJOINEXECUTOR_H_
+
+#include "graph/executor/Executor.h"
+
+// Natural join all inputs in a leapfrog manner. Each input is sorted by the join columns it
+// contains, in the order of `joinCols`. Then the join columns are bound one by one: the inputs
+// containing the current column seek to the maximum of their current values until all of them
+// agree, and the matched ranges are narrowed down for the next column. So the rows are only
+// produced when they match in all inputs, without materializing the pairwise join results.
+namespace nebula {
+namespace graph {
+class MultiwayJoinExecutor final : public Executor {
+ public:
+  MultiwayJoinExecutor(const PlanNode* node, QueryContext* qctx)
+      : Executor("MultiwayJoinExecutor", node, qctx) {}
+
+  folly::Future<Status> execute() override;
+
+ private:
+  using Entry = std::pair<std::vector<Value>, const Row*>;
+  // [begin, end) of the entries of an input
+  using Range = std::pair<size_t, size_t>;
+
+  struct Relation {
+    // The iterator owns the rows referenced by the entries
+    std::unique_ptr<Iterator> iter;
+    // Entries sorted by the keys
+    std::vector<Entry> entries;
+    // Position of each join column in the keys, -1 if the input doesn't contain it
+    std::vector<int64_t> keyIdx;
+    // (output column index, input column index) of the columns filled by this input
+    std::vector<std::pair<size_t, size_t>> outputCols;
+  };
+
+  Status buildRelations();
+
+  void join(size_t depth, std::vector<Range>& ranges, DataSet& ds) const;
+
+  void emit(size_t rel, const std::vector<Range>& ranges, Row& row, DataSet& ds) const;
+
+  std::vector<Relation> relations_;
+  // The inputs containing the join column of each depth
+  std::vector<std::vector<size_t>> participants_;
+};
+}  // namespace graph
+}  // namespace nebula
+#endif  // GRAPH_EXECUTOR_QUERY_MULTIWAYJOINEXECUTOR_H_
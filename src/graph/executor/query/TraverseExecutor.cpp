@@ -5,6 +5,7 @@
 #include "graph/executor/query/TraverseExecutor.h"
 
 #include "clients/storage/StorageClient.h"
+#include "common/algorithm/BloomFilter.h"
 #include "common/memory/MemoryTracker.h"
 #include "graph/context/iterator/GetNbrsRespDataSetIter.h"
 #include "graph/service/GraphFlags.h"
@@ -30,9 +31,51 @@ folly::Future<Status> TraverseExecutor::execute() {
     DataSet emptyDs;
     return finish(ResultBuilder().value(Value(std::move(emptyDs))).build());
   }
+  NG_RETURN_IF_ERROR(buildRuntimeFilter());
   return getNeighbors();
 }
 
+Status TraverseExecutor::buildRuntimeFilter() {
+  if (!traverse_->hasRuntimeFilter()) {
+    return Status::OK();
+  }
+  SCOPED_TIMER(&execTime_);
+  auto iter = ectx_->getResult(traverse_->runtimeFilterVar()).iter();
+  if (iter->size() > FLAGS_runtime_filter_max_keys) {
+    return Status::OK();
+  }
+  auto* key = traverse_->runtimeFilterKey();
+  QueryExpressionContext ctx(ectx_);
+  std::unordered_set<Value> keys;
+  for (; iter->valid(); iter->next()) {
+    const auto& val = key->eval(ctx(iter.get()));
+    if (val.isVertex()) {
+      keys.emplace(val.getVertex().vid);
+    } else if (val.isInt() || val.isStr()) {
+      // The other keys, e.g. null, never match any vid
+      keys.emplace(val);
+    }
+  }
+
+  dstFilter_ = std::make_unique<storage::cpp2::RuntimeFilter>();
+  if (keys.size() <= FLAGS_runtime_filter_max_exact_keys) {
+    dstFilter_->keys_ref() = std::vector<Value>(keys.begin(), keys.end());
+  } else {
+    algorithm::BloomFilter bloom(keys.size());
+    for (const auto& k : keys) {
+      if (k.isInt()) {
+        bloom.add(folly::StringPiece(reinterpret_cast<const char*>(&k.getInt()), sizeof(int64_t)));
+      } else {
+        bloom.add(k.getStr());
+      }
+    }
+    dstFilter_->bloom_ref() = bloom.bits();
+    dstFilter_->num_hashes_ref() = static_cast<int32_t>(bloom.numHashes());
+  }
+  addState("runtimeFilterKeys", folly::dynamic(static_cast<int64_t>(keys.size())));
+  return Status::OK();
+}
+
 Status TraverseExecutor::buildRequestVids() {
   SCOPED_TIMER(&execTime_);
   const auto& inputVar = traverse_->inputVar();
@@ -102,7 +145,8 @@ folly::Future<Status> TraverseExecutor::getNeighbors() {
                      finalStep ? traverse_->orderBy() : std::vector<storage::cpp2::OrderBy>(),
                      finalStep ? traverse_->limit(qctx()) : -1,
                      selectFilter(),
-                     currentStep_ == 1 ? traverse_->tagFilter() : nullptr)
+                     currentStep_ == 1 ? traverse_->tagFilter() : nullptr,
+                     finalStep ? dstFilter_.get() : nullptr)
       .via(runner())
       .thenValue([this, getNbrTime](StorageRpcResponse<GetNeighborsResponse>&& resp) mutable {
         // MemoryTrackerVerified
@@ -90,6 +90,9 @@ class TraverseExecutor final : public StorageAccessExecutor {
 
   Expression* selectFilter();
 
+  // Collect the join keys of build side to filter the dst of edges in storage
+  Status buildRuntimeFilter();
+
  private:
   ObjectPool objPool_;
 
@@ -103,6 +106,7 @@ class TraverseExecutor final : public StorageAccessExecutor {
   const Traverse* traverse_{nullptr};
   MatchStepRange range_;
   size_t currentStep_{0};
+  std::unique_ptr<storage::cpp2::RuntimeFilter> dstFilter_;
 };
 
 }  // namespace graph
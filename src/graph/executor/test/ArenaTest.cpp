@@ -0,0 +1,136 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+
+#include "common/expression/AggregateExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "graph/context/QueryContext.h"
+#include "graph/executor/query/AggregateExecutor.h"
+#include "graph/executor/query/InnerJoinExecutor.h"
+#include "graph/planner/plan/Query.h"
+
+namespace nebula {
+namespace graph {
+
+// Counts the memory the arenas take from their upstream, which is the default resource
+class CountingResource final : public std::pmr::memory_resource {
+ public:
+  size_t allocated() const {
+    return allocated_;
+  }
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    allocated_ += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    allocated_ -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  std::atomic<size_t> allocated_{0};
+};
+
+class ArenaTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    upstream_ = std::pmr::set_default_resource(&resource_);
+    qctx_ = std::make_unique<QueryContext>();
+    // Large enough to take more than one block of the arena
+    DataSet left(std::vector<std::string>{"k", "a"});
+    for (int64_t i = 0; i < 10000; ++i) {
+      left.rows.emplace_back(Row({i % 1000, i}));
+    }
+    qctx_->symTable()->newVariable("left");
+    qctx_->ectx()->setResult("left", ResultBuilder().value(Value(std::move(left))).build());
+    DataSet right(std::vector<std::string>{"k", "b"});
+    for (int64_t i = 0; i < 2000; ++i) {
+      right.rows.emplace_back(Row({i % 500, i}));
+    }
+    qctx_->symTable()->newVariable("right");
+    qctx_->ectx()->setResult("right", ResultBuilder().value(Value(std::move(right))).build());
+  }
+
+  void TearDown() override {
+    qctx_.reset();
+    std::pmr::set_default_resource(upstream_);
+  }
+
+  DataSet sortedResult(const PlanNode* node) {
+    auto ds = qctx_->ectx()->getResult(node->outputVar()).value().getDataSet();
+    std::sort(ds.rows.begin(), ds.rows.end());
+    return ds;
+  }
+
+  CountingResource resource_;
+  std::pmr::memory_resource* upstream_{nullptr};
+  std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(ArenaTest, InnerJoin) {
+  auto* pool = qctx_->objPool();
+  std::vector<Expression*> hashKeys = {VariablePropertyExpression::make(pool, "left", "k")};
+  std::vector<Expression*> probeKeys = {VariablePropertyExpression::make(pool, "right", "k")};
+  auto* join = InnerJoin::make(
+      qctx_.get(), nullptr, {"left", 0}, {"right", 0}, std::move(hashKeys), std::move(probeKeys));
+  join->setColNames({"k", "a", "k1", "b"});
+
+  auto executor = std::make_unique<InnerJoinExecutor>(join, qctx_.get());
+  ASSERT_TRUE(executor->execute().get().ok());
+  EXPECT_GT(resource_.allocated(), 0u);
+
+  DataSet expected(std::vector<std::string>{"k", "a", "k1", "b"});
+  for (int64_t a = 0; a < 10000; ++a) {
+    for (int64_t b = 0; b < 2000; ++b) {
+      if (a % 1000 == b % 500) {
+        expected.rows.emplace_back(Row({a % 1000, a, b % 500, b}));
+      }
+    }
+  }
+  std::sort(expected.rows.begin(), expected.rows.end());
+  EXPECT_EQ(expected, sortedResult(join));
+
+  // All the memory of the arena is released at once
+  ASSERT_TRUE(executor->close().ok());
+  EXPECT_EQ(0u, resource_.allocated());
+}
+
+TEST_F(ArenaTest, Aggregate) {
+  auto* pool = qctx_->objPool();
+  std::vector<Expression*> groupKeys = {InputPropertyExpression::make(pool, "k")};
+  std::vector<Expression*> groupItems = {
+      InputPropertyExpression::make(pool, "k"),
+      AggregateExpression::make(pool, "COUNT", InputPropertyExpression::make(pool, "a"), false),
+      AggregateExpression::make(pool, "SUM", InputPropertyExpression::make(pool, "a"), false),
+  };
+  auto* agg = Aggregate::make(qctx_.get(), nullptr, std::move(groupKeys), std::move(groupItems));
+  agg->setInputVar("left");
+  agg->setColNames({"k", "count", "sum"});
+
+  auto executor = std::make_unique<AggregateExecutor>(agg, qctx_.get());
+  ASSERT_TRUE(executor->execute().get().ok());
+  EXPECT_GT(resource_.allocated(), 0u);
+
+  DataSet expected(std::vector<std::string>{"k", "count", "sum"});
+  for (int64_t k = 0; k < 1000; ++k) {
+    // k + 1000 * i for i in [0, 10)
+    expected.rows.emplace_back(Row({k, 10, 10 * k + 45000}));
+  }
+  EXPECT_EQ(expected, sortedResult(agg));
+
+  ASSERT_TRUE(executor->close().ok());
+  EXPECT_EQ(0u, resource_.allocated());
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -2,13 +2,17 @@
 //
 // This source code is licensed under Apache 2.0 License.
 
+#include <folly/json.h>
 #include <gtest/gtest.h>
 
+#include "common/graph/Response.h"
 #include "graph/context/QueryContext.h"
 #include "graph/executor/algo/BFSShortestPathExecutor.h"
 #include "graph/executor/algo/MultiShortestPathExecutor.h"
+#include "graph/executor/algo/ShortestPathBase.h"
 #include "graph/planner/plan/Algo.h"
 #include "graph/planner/plan/Logic.h"
+#include "graph/service/GraphFlags.h"
 
 namespace nebula {
 namespace graph {
@@ -225,6 +229,69 @@ class FindPathTest : public testing::Test {
     mulitSourceInit();
   }
 
+  // Runs the two steps of the single source shortest path from `a' to `x' by a new executor,
+  // returns the paths and the vids to expand of each step, and the number of jobs the left
+  // side of each step is split into.
+  std::vector<DataSet> bfsShortestPath(std::vector<int64_t>* leftJobs) {
+    auto qctx = std::make_unique<QueryContext>();
+    auto setResult = [&qctx](const std::string& var, DataSet ds, Iterator::Kind kind) {
+      qctx->symTable()->newVariable(var);
+      ResultBuilder builder;
+      if (kind == Iterator::Kind::kGetNeighbors) {
+        List datasets;
+        datasets.values.emplace_back(std::move(ds));
+        builder.value(std::move(datasets));
+      } else {
+        builder.value(std::move(ds));
+      }
+      qctx->ectx()->setResult(var, builder.iter(kind).build());
+    };
+    auto vids = [](const std::string& vid) {
+      DataSet ds(std::vector<std::string>{nebula::kVid});
+      ds.rows.emplace_back(Row({vid}));
+      return ds;
+    };
+    setResult("leftVid", vids("a"), Iterator::Kind::kSequential);
+    setResult("rightVid", vids("x"), Iterator::Kind::kSequential);
+
+    auto* path = BFSShortestPath::make(
+        qctx.get(), StartNode::make(qctx.get()), StartNode::make(qctx.get()), 5);
+    path->setLeftVar("fromGNInput");
+    path->setRightVar("toGNInput");
+    path->setLeftVidVar("leftVid");
+    path->setRightVidVar("rightVid");
+    path->setColNames(pathColNames_);
+    // Collect the profiling stats
+    qctx->plan()->setRoot(path);
+    PlanDescription planDesc;
+    qctx->plan()->describe(&planDesc);
+
+    auto sorted = [&qctx](const std::string& var) {
+      auto ds = qctx->ectx()->getResult(var).value().getDataSet();
+      std::sort(ds.rows.begin(), ds.rows.end());
+      return ds;
+    };
+    std::vector<DataSet> results;
+    auto pathExe = std::make_unique<BFSShortestPathExecutor>(path, qctx.get());
+    std::vector<std::pair<DataSet, DataSet>> steps = {{single1StepFrom_, single1StepTo_},
+                                                      {single2StepFrom_, single2StepTo_}};
+    for (auto& step : steps) {
+      setResult("fromGNInput", std::move(step.first), Iterator::Kind::kGetNeighbors);
+      setResult("toGNInput", std::move(step.second), Iterator::Kind::kGetNeighbors);
+      EXPECT_TRUE(pathExe->execute().get().ok());
+      EXPECT_TRUE(pathExe->close().ok());
+      results.emplace_back(sorted(path->outputVar()));
+      results.emplace_back(sorted("leftVid"));
+      results.emplace_back(sorted("rightVid"));
+    }
+    auto& profiles = *planDesc.planNodeDescs[planDesc.nodeIndexMap.at(path->id())].profiles;
+    for (auto& profile : profiles) {
+      auto strategy = folly::parseJson(profile.otherStats->at("leftExpand"));
+      leftJobs->emplace_back(strategy["jobs"].asInt());
+    }
+    return results;
+  }
+
  protected:
   std::unique_ptr<QueryContext> qctx_;
   const int EDGE_TYPE = 1;
@@ -408,6 +475,25 @@ TEST_F(FindPathTest, singleSourceShortestPath) {
   }
 }
 
+TEST_F(FindPathTest, shortestPathExpandStrategies) {
+  gflags::FlagSaver saver;
+  FLAGS_max_job_size = 2;
+  FLAGS_min_batch_size = 1;
+  FLAGS_loop_parallel_threshold_rows = std::numeric_limits<uint64_t>::max();
+  std::vector<int64_t> singleJob;
+  auto expected = bfsShortestPath(&singleJob);
+  EXPECT_EQ(std::vector<int64_t>({1, 1}), singleJob);
+  ASSERT_EQ(6, expected.size());
+  // The paths are found in the 2nd step
+  EXPECT_EQ(3, expected[3].size());
+
+  // Every step is split into multiple jobs
+  FLAGS_loop_parallel_threshold_rows = 1;
+  std::vector<int64_t> multiJobs;
+  EXPECT_EQ(expected, bfsShortestPath(&multiJobs));
+  EXPECT_EQ(std::vector<int64_t>({2, 2}), multiJobs);
+}
+
 TEST_F(FindPathTest, multiSourceShortestPath) {
   int steps = 5;
   std::string leftVidVar = "leftVid";
@@ -661,5 +747,27 @@ TEST_F(FindPathTest, empthInput) {
   }
 }
 
+TEST_F(FindPathTest, pathTree) {
+  using PathTree = ShortestPathBase::PathTree;
+  auto step = [this](const std::string& src, const std::string& dst) {
+    return Row({Vertex(src, {}), Edge(src, dst, EDGE_TYPE, "like", EDGE_RANK, {})});
+  };
+  PathTree tree;
+  // a->b->c and a->b->d share the prefix a->b
+  auto ab = tree.append(PathTree::kNoParent, tree.addStep(step("a", "b")));
+  auto abc = tree.append(ab, tree.addStep(step("b", "c")));
+  auto abd = tree.append(ab, tree.addStep(step("b", "d")));
+
+  std::vector<Value> expected = {Vertex("a", {}),
+                                 Edge("a", "b", EDGE_TYPE, "like", EDGE_RANK, {}),
+                                 Vertex("b", {}),
+                                 Edge("b", "c", EDGE_TYPE, "like", EDGE_RANK, {})};
+  EXPECT_EQ(expected, tree.values(abc));
+  expected.back() = Edge("b", "d", EDGE_TYPE, "like", EDGE_RANK, {});
+  EXPECT_EQ(expected, tree.values(abd));
+  EXPECT_EQ(Value(Vertex("b", {})), tree.lastStep(abd).values.front());
+  EXPECT_EQ(2, tree.values(ab).size());
+}
+
 }  // namespace graph
 }  // namespace nebula
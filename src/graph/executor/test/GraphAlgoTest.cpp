@@ -0,0 +1,108 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "graph/context/QueryContext.h"
+#include "graph/executor/algo/GraphAlgoExecutor.h"
+#include "graph/planner/plan/Algo.h"
+#include "graph/service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+class GraphAlgoTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    qctx_ = std::make_unique<QueryContext>();
+    // Two triangles, and 7 only points to the first one
+    edges_ = {{"1", "2"}, {"2", "3"}, {"3", "1"}, {"4", "5"}, {"5", "6"}, {"6", "4"}, {"7", "1"}};
+  }
+
+  GraphAlgo* graphAlgo(const std::string& algorithm) {
+    auto* algo = GraphAlgo::make(qctx_.get(), nullptr, 1, algorithm);
+    storage::cpp2::EdgeProp edgeProp;
+    edgeProp.type_ref() = 1;
+    edgeProp.props_ref() = {kSrc, kDst};
+    algo->setEdgeProps({std::move(edgeProp)});
+    algo->setMaxIterations(100);
+    algo->setColNames({"vid", "value"});
+    return algo;
+  }
+
+  // Runs on the scanned edges instead of the ones from storage, returns the value of each vid
+  StatusOr<std::unordered_map<std::string, Value>> run(const GraphAlgo* algo) {
+    DataSet ds(std::vector<std::string>{"like._src", "like._dst"});
+    for (const auto& edge : edges_) {
+      ds.rows.emplace_back(Row({edge.first, edge.second}));
+    }
+    std::vector<DataSet> scanned;
+    scanned.emplace_back(std::move(ds));
+
+    GraphAlgoExecutor executor(algo, qctx_.get());
+    NG_RETURN_IF_ERROR(executor.buildGraph(std::move(scanned)));
+    NG_RETURN_IF_ERROR(executor.runAlgorithm().get());
+    std::unordered_map<std::string, Value> result;
+    for (const auto& row : qctx_->ectx()->getResult(algo->outputVar()).value().getDataSet().rows) {
+      result.emplace(row.values[0].getStr(), row.values[1]);
+    }
+    return result;
+  }
+
+  std::unique_ptr<QueryContext> qctx_;
+  std::vector<std::pair<std::string, std::string>> edges_;
+};
+
+TEST_F(GraphAlgoTest, PageRank) {
+  auto result = run(graphAlgo("pagerank"));
+  ASSERT_TRUE(result.ok()) << result.status();
+  auto& scores = result.value();
+  ASSERT_EQ(7, scores.size());
+  std::unordered_map<std::string, double> expected = {
+      {"1", 0.19006},
+      {"2", 0.18298},
+      {"3", 0.17696},
+      {"4", 1.0 / 7},
+      {"5", 1.0 / 7},
+      {"6", 1.0 / 7},
+      // Nobody points to it
+      {"7", 0.15 / 7},
+  };
+  for (const auto& score : expected) {
+    EXPECT_NEAR(score.second, scores[score.first].getFloat(), 1e-4) << score.first;
+  }
+}
+
+TEST_F(GraphAlgoTest, Wcc) {
+  auto result = run(graphAlgo("wcc"));
+  ASSERT_TRUE(result.ok()) << result.status();
+  std::unordered_map<std::string, Value> expected = {
+      {"1", "1"}, {"2", "1"}, {"3", "1"}, {"4", "4"}, {"5", "4"}, {"6", "4"}, {"7", "1"}};
+  EXPECT_EQ(expected, result.value());
+}
+
+TEST_F(GraphAlgoTest, LabelPropagation) {
+  auto result = run(graphAlgo("lpa"));
+  ASSERT_TRUE(result.ok()) << result.status();
+  // Converged within the iterations
+  std::unordered_map<std::string, Value> expected = {
+      {"1", "1"}, {"2", "1"}, {"3", "1"}, {"4", "4"}, {"5", "4"}, {"6", "4"}, {"7", "1"}};
+  EXPECT_EQ(expected, result.value());
+}
+
+TEST_F(GraphAlgoTest, TooManyEdges) {
+  gflags::FlagSaver saver;
+  FLAGS_max_graph_algorithm_edges = 6;
+  auto result = run(graphAlgo("wcc"));
+  ASSERT_FALSE(result.ok());
+  EXPECT_EQ("Too many edges to load into graphd for algorithm `wcc', more than 6, see "
+            "max_graph_algorithm_edges",
+            result.status().message());
+
+  FLAGS_max_graph_algorithm_edges = 7;
+  EXPECT_TRUE(run(graphAlgo("wcc")).ok());
+}
+
+}  // namespace graph
+}  // namespace nebula
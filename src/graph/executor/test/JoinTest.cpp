@@ -8,6 +8,7 @@
 #include "graph/context/QueryContext.h"
 #include "graph/executor/query/InnerJoinExecutor.h"
 #include "graph/executor/query/LeftJoinExecutor.h"
+#include "graph/executor/query/MultiwayJoinExecutor.h"
 #include "graph/executor/test/QueryTestBase.h"
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/Query.h"
@@ -397,5 +398,54 @@ TEST_F(JoinTest, HashLeftJoin) {
   EXPECT_EQ(result.state(), Result::State::kSuccess);
 }
 
+TEST_F(JoinTest, MultiwayJoin) {
+  // Edges: 1->2, 2->3, 3->1, 1->3, 2->4
+  std::vector<std::pair<int, int>> edges = {{1, 2}, {2, 3}, {3, 1}, {1, 3}, {2, 4}};
+  auto makeInput = [this, &edges](const std::string& var, const std::vector<std::string>& cols) {
+    DataSet ds;
+    ds.colNames = cols;
+    for (const auto& edge : edges) {
+      ds.rows.emplace_back(Row({edge.first, edge.second}));
+    }
+    qctx_->symTable()->newVariable(var);
+    qctx_->ectx()->setResult(var, ResultBuilder().value(Value(std::move(ds))).build());
+    auto* input = Project::make(qctx_.get(), nullptr, nullptr);
+    input->setOutputVar(var);
+    input->setColNames(cols);
+    return input;
+  };
+
+  // (a)->(b)->(c)->(a)
+  std::vector<PlanNode*> inputs = {makeInput("ab", {"a", "b"}),
+                                   makeInput("bc", {"b", "c"}),
+                                   makeInput("ca", {"c", "a"})};
+  auto* join = MultiwayJoin::make(qctx_.get(), inputs, {"a", "b", "c"});
+  EXPECT_EQ(join->colNames(), std::vector<std::string>({"a", "b", "c"}));
+
+  auto joinExe = std::make_unique<MultiwayJoinExecutor>(join, qctx_.get());
+  auto status = joinExe->execute().get();
+  EXPECT_TRUE(status.ok());
+  auto& result = qctx_->ectx()->getResult(join->outputVar());
+
+  DataSet expected;
+  expected.colNames = {"a", "b", "c"};
+  expected.rows.emplace_back(Row({1, 2, 3}));
+  expected.rows.emplace_back(Row({2, 3, 1}));
+  expected.rows.emplace_back(Row({3, 1, 2}));
+  EXPECT_EQ(result.value().getDataSet(), expected);
+  EXPECT_EQ(result.state(), Result::State::kSuccess);
+
+  // No triangle left without 3->1
+  edges = {{1, 2}, {2, 3}, {1, 3}};
+  inputs = {makeInput("ab2", {"a", "b"}),
+            makeInput("bc2", {"b", "c"}),
+            makeInput("ca2", {"c", "a"})};
+  join = MultiwayJoin::make(qctx_.get(), inputs, {"a", "b", "c"});
+  joinExe = std::make_unique<MultiwayJoinExecutor>(join, qctx_.get());
+  status = joinExe->execute().get();
+  EXPECT_TRUE(status.ok());
+  EXPECT_TRUE(qctx_->ectx()->getResult(join->outputVar()).value().getDataSet().rows.empty());
+}
+
 }  // namespace graph
 }  // namespace nebula
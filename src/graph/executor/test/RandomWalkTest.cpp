@@ -0,0 +1,101 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "graph/context/QueryContext.h"
+#include "graph/executor/algo/RandomWalkExecutor.h"
+#include "graph/planner/plan/Algo.h"
+
+namespace nebula {
+namespace graph {
+
+class RandomWalkTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    qctx_ = std::make_unique<QueryContext>();
+    // The edges with their weights, 4 has no out edges
+    edges_ = {
+        {"1", {{"2", 1}, {"3", 0}}},
+        {"2", {{"3", 2}}},
+        {"3", {{"1", -1}, {"2", 1}}},
+        {"4", {}},
+    };
+  }
+
+  RandomWalk* randomWalk(size_t steps, size_t walks) {
+    auto* src = InputPropertyExpression::make(qctx_->objPool(), nebula::kVid);
+    auto* walk = RandomWalk::make(qctx_.get(), nullptr, 1, src, steps);
+    walk->setWalks(walks);
+    walk->setColNames({"seed", "walk"});
+    return walk;
+  }
+
+  // Walks without storage, the neighbors of each step are taken from the edges above
+  DataSet run(const RandomWalk* walk, std::vector<Value> seeds) {
+    RandomWalkExecutor executor(walk, qctx_.get());
+    executor.seeds_ = std::move(seeds);
+    executor.initWalkers();
+    while (executor.nextStep()) {
+      DataSet ds(
+          std::vector<std::string>{nebula::kVid, "_stats", "_edge:+like:_dst:weight", "_expr"});
+      for (const auto& group : executor.movers_) {
+        List edges;
+        for (const auto& edge : edges_.at(group.first.getStr())) {
+          edges.values.emplace_back(List({edge.first, edge.second}));
+        }
+        ds.rows.emplace_back(Row({group.first, Value(), std::move(edges), Value()}));
+      }
+      List neighbors;
+      neighbors.values.emplace_back(std::move(ds));
+      executor.moveWalkers(std::move(neighbors));
+    }
+    EXPECT_TRUE(executor.buildResult().get().ok());
+    return qctx_->ectx()->getResult(walk->outputVar()).value().getDataSet();
+  }
+
+  bool hasEdge(const Value& src, const Value& dst) const {
+    for (const auto& edge : edges_.at(src.getStr())) {
+      if (edge.first == dst.getStr()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::unique_ptr<QueryContext> qctx_;
+  std::unordered_map<std::string, std::vector<std::pair<std::string, int64_t>>> edges_;
+};
+
+TEST_F(RandomWalkTest, UniformWalk) {
+  auto result = run(randomWalk(4, 5), {"1", "4"});
+  ASSERT_EQ(10, result.rowSize());
+  for (const auto& row : result.rows) {
+    const auto& seed = row.values[0];
+    const auto& path = row.values[1].getList().values;
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(seed, path.front());
+    // Stopped at once without any out edge
+    EXPECT_EQ(seed.getStr() == "4" ? 1u : 5u, path.size()) << row.values[1];
+    for (size_t i = 1; i < path.size(); ++i) {
+      EXPECT_TRUE(hasEdge(path[i - 1], path[i])) << row.values[1];
+    }
+  }
+}
+
+TEST_F(RandomWalkTest, WeightedWalk) {
+  auto* walk = randomWalk(4, 3);
+  walk->setWeightProp("weight");
+  auto result = run(walk, {"1"});
+  ASSERT_EQ(3, result.rowSize());
+  // The edges with non-positive weights are never taken
+  List expected({"1", "2", "3", "2", "3"});
+  for (const auto& row : result.rows) {
+    EXPECT_EQ(Value("1"), row.values[0]);
+    EXPECT_EQ(Value(expected), row.values[1]);
+  }
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,63 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <folly/executors/InlineExecutor.h>
+#include <gtest/gtest.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "graph/context/QueryContext.h"
+#include "graph/planner/plan/ExecutionPlan.h"
+#include "graph/planner/plan/Logic.h"
+#include "graph/planner/plan/Query.h"
+#include "graph/scheduler/AsyncMsgNotifyBasedScheduler.h"
+
+namespace nebula {
+namespace graph {
+
+class SchedulerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    qctx_ = std::make_unique<QueryContext>();
+    auto rctx = std::make_unique<RequestContext<ExecutionResponse>>();
+    rctx->setRunner(&folly::InlineExecutor::instance());
+    qctx_->setRCtx(std::move(rctx));
+  }
+
+  // An empty input
+  PlanNode* input() {
+    auto* passThrough = PassThroughNode::make(qctx_.get(), StartNode::make(qctx_.get()));
+    passThrough->setColNames({"a"});
+    return passThrough;
+  }
+
+  Status schedule(PlanNode* root) {
+    qctx_->plan()->setRoot(root);
+    AsyncMsgNotifyBasedScheduler scheduler(qctx_.get());
+    return scheduler.schedule().get();
+  }
+
+  std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(SchedulerTest, RuntimeFilter) {
+  auto* pool = qctx_->objPool();
+  auto* build = input();
+  auto* traverse = Traverse::make(qctx_.get(), input(), 1);
+  traverse->setColNames({"v", "e"});
+  traverse->setRuntimeFilter(build->outputVar(), ConstantExpression::make(pool, 1));
+  auto* join = HashInnerJoin::make(qctx_.get(), build, traverse);
+  auto status = schedule(join);
+  EXPECT_TRUE(status.ok()) << status;
+
+  // The traverse can't wait for the build side which is not in the plan
+  traverse = Traverse::make(qctx_.get(), input(), 1);
+  traverse->setColNames({"v", "e"});
+  traverse->setRuntimeFilter(input()->outputVar(), ConstantExpression::make(pool, 1));
+  join = HashInnerJoin::make(qctx_.get(), input(), traverse);
+  status = schedule(join);
+  EXPECT_FALSE(status.ok());
+}
+
+}  // namespace graph
+}  // namespace nebula
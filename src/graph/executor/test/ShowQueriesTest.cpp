@@ -28,6 +28,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
     desc.start_time_ref() = 123;
     desc.status_ref() = meta::cpp2::QueryStatus::RUNNING;
     desc.duration_ref() = 100;
+    desc.peak_memory_ref() = 4096;
     desc.query_ref() = "";
     desc.graph_addr_ref() = HostAddr("127.0.0.1", 9669);
 
@@ -50,6 +51,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
                    "Host",
                    "StartTime",
                    "DurationInUSec",
+                   "PeakMemoryInBytes",
                    "Status",
                    "Query"});
   DataSet expected = dataSet;
@@ -63,6 +65,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
     dateTime.microsec = 123;
     row.emplace_back(std::move(dateTime));
     row.emplace_back(100);
+    row.emplace_back(4096);
     row.emplace_back("RUNNING");
     row.emplace_back("");
     expected.rows.emplace_back(std::move(row));
@@ -77,6 +80,7 @@ TEST_F(ShowQueriesTest, TestAddQueryAndTopN) {
     dateTime.microsec = 123;
     row.emplace_back(std::move(dateTime));
     row.emplace_back(200);
+    row.emplace_back(0);
     row.emplace_back("RUNNING");
     row.emplace_back("");
     expected.rows.emplace_back(std::move(row));
@@ -26,14 +26,118 @@ GC::GC() {
 
 void GC::clear(std::vector<Result>&& garbage) {
   memory::MemoryCheckOffGuard guard;
+  auto bytes = estimateSize(garbage);
+  auto& stats = memory::MemoryStats::instance();
+  stats.pendingFree(bytes);
   // do not bother folly
-  queue_.enqueue(std::move(garbage));
+  queue_.enqueue(Garbage{std::move(garbage), bytes});
+  // One urgent task drains all the garbage queued before it runs
+  if (stats.usedRatio() >= FLAGS_gc_urgent_memory_ratio && !urgentScheduled_.exchange(true)) {
+    workers_.addTask(&GC::urgentTask, this);
+  }
 }
 
 void GC::periodicTask() {
-  while (!queue_.empty()) {
-    queue_.try_dequeue();
+  while (auto garbage = queue_.try_dequeue()) {
+    release(std::move(*garbage));
+  }
+}
+
+void GC::urgentTask() {
+  // Reset before draining, so the garbage queued meanwhile schedules another one
+  urgentScheduled_.store(false);
+  periodicTask();
+}
+
+void GC::release(Garbage&& garbage) {
+  memory::MemoryCheckOffGuard guard;
+  std::vector<std::shared_ptr<Value>> values;
+  values.reserve(garbage.results.size());
+  for (const auto& result : garbage.results) {
+    values.emplace_back(result.valuePtr());
   }
+  garbage.results.clear();
+
+  int64_t dispatched = 0;
+  for (auto& value : values) {
+    // Still used by others
+    if (value == nullptr || value.use_count() > 1) {
+      continue;
+    }
+    if (value->isDataSet()) {
+      dispatched += releaseInChunks(&value->mutableDataSet());
+    } else if (value->isList()) {
+      // The datasets of GetNeighbors
+      for (auto& item : value->mutableList().values) {
+        if (item.isDataSet()) {
+          dispatched += releaseInChunks(&item.mutableDataSet());
+        }
+      }
+    }
+  }
+  values.clear();
+  memory::MemoryStats::instance().pendingFree(dispatched - garbage.bytes);
+}
+
+int64_t GC::releaseInChunks(DataSet* ds) {
+  auto& rows = ds->rows;
+  size_t chunkRows = FLAGS_gc_chunk_rows;
+  if (chunkRows == 0 || rows.size() <= chunkRows) {
+    return 0;
+  }
+  int64_t rowBytes = estimateSize(*ds) / rows.size();
+  int64_t dispatched = 0;
+  // The first chunk is released by the current worker along with the dataset
+  for (size_t begin = chunkRows; begin < rows.size(); begin += chunkRows) {
+    auto end = std::min(begin + chunkRows, rows.size());
+    std::vector<Row> chunk(std::make_move_iterator(rows.begin() + begin),
+                           std::make_move_iterator(rows.begin() + end));
+    int64_t bytes = rowBytes * (end - begin);
+    dispatched += bytes;
+    workers_.addTask([chunk = std::move(chunk), bytes]() mutable {
+      memory::MemoryCheckOffGuard guard;
+      chunk.clear();
+      memory::MemoryStats::instance().pendingFree(-bytes);
+    });
+  }
+  return dispatched;
+}
+
+// static
+int64_t GC::estimateSize(const std::vector<Result>& garbage) {
+  // The references to each value held by the garbage, i.e. by the results and their iterators
+  std::unordered_map<std::shared_ptr<Value>, int64_t> refs;
+  for (const auto& result : garbage) {
+    auto value = result.valuePtr();
+    if (value == nullptr) {
+      continue;
+    }
+    auto* iter = result.iterRef();
+    refs[value] += (iter != nullptr && iter->valuePtr() == value) ? 2 : 1;
+  }
+  int64_t bytes = 0;
+  for (const auto& ref : refs) {
+    // Also referred by the key of the map, the ones shared by others are not freed with the garbage
+    if (ref.first.use_count() > ref.second + 1) {
+      continue;
+    }
+    const auto& value = *ref.first;
+    if (value.isDataSet()) {
+      bytes += estimateSize(value.getDataSet());
+    } else if (value.isList()) {
+      for (const auto& item : value.getList().values) {
+        if (item.isDataSet()) {
+          bytes += estimateSize(item.getDataSet());
+        }
+      }
+    }
+  }
+  return bytes;
+}
+
+// static
+int64_t GC::estimateSize(const DataSet& ds) {
+  return ds.rows.size() * (sizeof(Row) + ds.colNames.size() * sizeof(Value));
 }
 
 }  // namespace graph
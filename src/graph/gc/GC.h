@@ -15,6 +15,12 @@ namespace graph {
 // Clean the unused memory on background threads, this is helpful
 // for big queries since the memory release of interim results may
 // cost too much time.
+//
+// The garbage is released on the next round, or immediately if the memory
+// tracked is short. The rows of big datasets are released in chunks by all
+// the workers in parallel. The estimated size of the garbage not released yet
+// is reported to MemoryStats as pending free, so the memory check doesn't
+// fail a query for the memory going to be released.
 class GC {
  public:
   static GC& instance();
@@ -26,9 +32,30 @@ class GC {
   void clear(std::vector<Result>&& garbage);
 
  private:
+  struct Garbage {
+    std::vector<Result> results;
+    int64_t bytes;
+  };
+
+  friend class GCTest;
+
   GC();
   void periodicTask();
-  folly::UMPMCQueue<std::vector<Result>, false> queue_;
+  // Runs once the memory is short, at most one of them is scheduled at a time
+  void urgentTask();
+  void release(Garbage&& garbage);
+  // Hands the rows of the dataset except the first chunk over to the workers, returns the
+  // estimated bytes of them
+  int64_t releaseInChunks(DataSet* ds);
+
+  // The estimated bytes released with the garbage, i.e. of the rows of its datasets not shared by
+  // others. A dataset held by several results is counted once. The strings and the nested values
+  // are not counted.
+  static int64_t estimateSize(const std::vector<Result>& garbage);
+  static int64_t estimateSize(const DataSet& ds);
+
+  folly::UMPMCQueue<Garbage, false> queue_;
+  std::atomic<bool> urgentScheduled_{false};
   thread::GenericThreadPool workers_;
 };
 }  // namespace graph
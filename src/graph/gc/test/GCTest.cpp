@@ -0,0 +1,97 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "common/memory/MemoryTracker.h"
+#include "graph/gc/GC.h"
+#include "graph/service/GraphFlags.h"
+
+namespace nebula {
+namespace graph {
+
+class GCTest : public ::testing::Test {
+ protected:
+  static DataSet dataSet(int64_t rows) {
+    DataSet ds({"a", "b"});
+    for (int64_t i = 0; i < rows; ++i) {
+      ds.emplace_back(Row({i, "b"}));
+    }
+    return ds;
+  }
+
+  static Result result(std::shared_ptr<Value> value) {
+    return ResultBuilder().value(std::move(value)).iter(Iterator::Kind::kSequential).build();
+  }
+
+  static int64_t estimateSize(const std::vector<Result>& garbage) {
+    return GC::estimateSize(garbage);
+  }
+
+  static int64_t estimateSize(const DataSet& ds) {
+    return GC::estimateSize(ds);
+  }
+
+  // Waits for the garbage to be released by the workers
+  static bool drained(int64_t pendingFree) {
+    auto& gc = GC::instance();
+    for (int32_t i = 0; i < 100; ++i) {
+      if (gc.queue_.empty() && !gc.urgentScheduled_.load() &&
+          memory::MemoryStats::instance().pendingFree() == pendingFree) {
+        return true;
+      }
+      usleep(100 * 1000);
+    }
+    return false;
+  }
+};
+
+TEST_F(GCTest, EstimateSize) {
+  auto rows = estimateSize(dataSet(10));
+  ASSERT_GT(rows, 0);
+  {
+    std::vector<Result> garbage;
+    auto value = std::make_shared<Value>(dataSet(10));
+    // Counted once even if held by several results
+    garbage.emplace_back(result(value));
+    garbage.emplace_back(result(value));
+    garbage.emplace_back(ResultBuilder().value(Value(dataSet(10))).build());
+    value.reset();
+    EXPECT_EQ(2 * rows, estimateSize(garbage));
+
+    // Not freed with the garbage
+    auto shared = garbage.front().valuePtr();
+    EXPECT_EQ(rows, estimateSize(garbage));
+  }
+  {
+    // The datasets of GetNeighbors
+    std::vector<Result> garbage;
+    List list(std::vector<Value>{dataSet(10), dataSet(10)});
+    garbage.emplace_back(ResultBuilder().value(Value(std::move(list))).build());
+    garbage.emplace_back(ResultBuilder().value(Value(1)).build());
+    EXPECT_EQ(2 * rows, estimateSize(garbage));
+  }
+}
+
+TEST_F(GCTest, Urgent) {
+  gflags::FlagSaver saver;
+  FLAGS_gc_urgent_memory_ratio = 0;
+  FLAGS_gc_chunk_rows = 4;
+  auto& stats = memory::MemoryStats::instance();
+  auto pendingFree = stats.pendingFree();
+  auto shared = std::make_shared<Value>(dataSet(100));
+  for (int32_t i = 0; i < 1000; ++i) {
+    std::vector<Result> garbage;
+    garbage.emplace_back(result(std::make_shared<Value>(dataSet(100))));
+    garbage.emplace_back(result(shared));
+    GC::instance().clear(std::move(garbage));
+  }
+  // All the estimated bytes are released, in chunks or not
+  EXPECT_TRUE(drained(pendingFree));
+  // Never released while used by others
+  EXPECT_EQ(dataSet(100), shared->getDataSet());
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,288 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/optimizer/CostModel.h"
+
+#include <cmath>
+
+#include "graph/context/QueryContext.h"
+#include "graph/context/QueryExpressionContext.h"
+#include "graph/planner/plan/PlanNode.h"
+#include "graph/planner/plan/Query.h"
+#include "graph/util/CardinalityEstimator.h"
+#include "graph/util/ExpressionUtils.h"
+
+using nebula::graph::CardinalityEstimator;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+
+namespace nebula {
+namespace opt {
+
+namespace {
+
+// The variable length patterns are estimated by at most such steps
+constexpr size_t kMaxEstimatedSteps = 5;
+
+// Get the constant value of limit/count expression, or -1 if it's not known before execution
+int64_t constCount(const Expression *expr, QueryContext *qctx) {
+  if (expr == nullptr || !graph::ExpressionUtils::isEvaluableExpr(expr, qctx)) {
+    return -1;
+  }
+  graph::QueryExpressionContext ctx(qctx->ectx());
+  auto val = const_cast<Expression *>(expr)->eval(ctx());
+  return val.isInt() ? val.getInt() : -1;
+}
+
+double applyLimit(double rows, int64_t limit) {
+  return limit < 0 ? rows : std::min(rows, static_cast<double>(limit));
+}
+
+}  // namespace
+
+CostModel::CostModel(QueryContext *qctx) : qctx_(qctx) {}
+
+CostModel::~CostModel() = default;
+
+CardinalityEstimator *CostModel::estimator(GraphSpaceID space) {
+  auto iter = estimators_.find(space);
+  if (iter == estimators_.end()) {
+    iter = estimators_.emplace(space, std::make_unique<CardinalityEstimator>(qctx_, space)).first;
+  }
+  return iter->second.get();
+}
+
+// static
+double CostModel::expandRows(double rows, double degree, size_t minSteps, size_t maxSteps) {
+  maxSteps = std::min(maxSteps, minSteps + kMaxEstimatedSteps);
+  double total = 0.0;
+  double stepRows = rows;
+  for (size_t step = 1; step <= maxSteps; ++step) {
+    stepRows *= degree;
+    if (step >= minSteps) {
+      total += stepRows;
+    }
+  }
+  // Zero step returns the start vertices themselves
+  return minSteps == 0 ? total + rows : total;
+}
+
+PlanEstimate CostModel::estimate(const PlanNode *node,
+                                 const std::vector<PlanEstimate> &deps,
+                                 const std::vector<PlanEstimate> &bodies) {
+  double inputRows = 0.0;
+  double inputCost = 0.0;
+  for (const auto &dep : deps) {
+    inputRows = std::max(inputRows, dep.rows);
+    inputCost += dep.cost;
+  }
+  if (deps.empty()) {
+    inputRows = 1.0;
+  }
+
+  PlanEstimate est;
+  // Rows read from storage and processed in memory by this node
+  double storageRows = 0.0;
+  double cpuRows = inputRows;
+  switch (node->kind()) {
+    case PlanNode::Kind::kStart:
+    case PlanNode::Kind::kArgument: {
+      est.rows = 1.0;
+      cpuRows = 0.0;
+      break;
+    }
+    case PlanNode::Kind::kScanVertices: {
+      auto *scan = static_cast<const graph::ScanVertices *>(node);
+      auto *ce = estimator(scan->space());
+      std::vector<int32_t> tags;
+      if (scan->props() != nullptr) {
+        for (const auto &prop : *scan->props()) {
+          tags.emplace_back(prop.get_tag());
+        }
+      }
+      // All vertices are read since the tag is not the prefix of key
+      storageRows = ce->numVertices();
+      est.rows = applyLimit(ce->scanRows(tags, false, scan->filter()),
+                            constCount(scan->limitExpr(), qctx_));
+      break;
+    }
+    case PlanNode::Kind::kScanEdges: {
+      auto *scan = static_cast<const graph::ScanEdges *>(node);
+      auto *ce = estimator(scan->space());
+      std::vector<int32_t> edgeTypes;
+      if (scan->props() != nullptr) {
+        for (const auto &prop : *scan->props()) {
+          edgeTypes.emplace_back(prop.get_type());
+        }
+      }
+      storageRows = ce->numEdges();
+      est.rows = applyLimit(ce->scanRows(edgeTypes, true, scan->filter()),
+                            constCount(scan->limitExpr(), qctx_));
+      break;
+    }
+    case PlanNode::Kind::kIndexScan:
+    case PlanNode::Kind::kTagIndexFullScan:
+    case PlanNode::Kind::kTagIndexPrefixScan:
+    case PlanNode::Kind::kTagIndexRangeScan:
+    case PlanNode::Kind::kEdgeIndexFullScan:
+    case PlanNode::Kind::kEdgeIndexPrefixScan:
+    case PlanNode::Kind::kEdgeIndexRangeScan: {
+      auto *scan = static_cast<const graph::IndexScan *>(node);
+      auto *ce = estimator(scan->space());
+      storageRows = ce->indexScanRows(scan->schemaId(), scan->isEdge(), scan->queryContext());
+      est.rows = applyLimit(storageRows * CardinalityEstimator::filterSelectivity(scan->filter()),
+                            constCount(scan->limitExpr(), qctx_));
+      break;
+    }
+    case PlanNode::Kind::kGetNeighbors:
+    case PlanNode::Kind::kTraverse: {
+      auto *gn = static_cast<const graph::GetNeighbors *>(node);
+      auto *ce = estimator(gn->space());
+      double degree = ce->avgDegree(gn->edgeTypes(), gn->edgeDirection());
+      if (node->kind() == PlanNode::Kind::kTraverse) {
+        auto range = static_cast<const graph::Traverse *>(node)->stepRange();
+        storageRows = expandRows(inputRows, degree, 1, std::max<size_t>(range.max(), 1));
+        est.rows = expandRows(inputRows, degree, range.min(), range.max());
+      } else {
+        storageRows = inputRows * degree;
+        est.rows = storageRows;
+      }
+      est.rows = applyLimit(est.rows * CardinalityEstimator::filterSelectivity(gn->filter()),
+                            constCount(gn->limitExpr(), qctx_));
+      break;
+    }
+    case PlanNode::Kind::kExpand:
+    case PlanNode::Kind::kExpandAll: {
+      auto *expand = static_cast<const graph::Expand *>(node);
+      auto *ce = estimator(expand->space());
+      double degree = ce->avgDegree(expand->edgeTypes(), storage::cpp2::EdgeDirection::OUT_EDGE);
+      size_t minSteps = expand->maxSteps();
+      if (node->kind() == PlanNode::Kind::kExpandAll) {
+        minSteps = static_cast<const graph::ExpandAll *>(node)->minSteps();
+      }
+      storageRows = expandRows(inputRows, degree, 1, std::max<size_t>(expand->maxSteps(), 1));
+      est.rows = expandRows(inputRows, degree, minSteps, expand->maxSteps());
+      est.rows = est.rows * CardinalityEstimator::filterSelectivity(expand->filter());
+      break;
+    }
+    case PlanNode::Kind::kGetVertices:
+    case PlanNode::Kind::kAppendVertices:
+    case PlanNode::Kind::kGetEdges: {
+      auto *explore = static_cast<const graph::Explore *>(node);
+      storageRows = inputRows;
+      est.rows = applyLimit(inputRows * CardinalityEstimator::filterSelectivity(explore->filter()),
+                            constCount(explore->limitExpr(), qctx_));
+      break;
+    }
+    case PlanNode::Kind::kFilter: {
+      auto *filter = static_cast<const graph::Filter *>(node);
+      est.rows = inputRows * CardinalityEstimator::filterSelectivity(filter->condition());
+      break;
+    }
+    case PlanNode::Kind::kLimit: {
+      auto *limit = static_cast<const graph::Limit *>(node);
+      auto count = constCount(limit->countExpr(), qctx_);
+      auto offset = std::max<int64_t>(limit->offset(), 0);
+      est.rows = applyLimit(inputRows, count < 0 ? -1 : offset + count);
+      break;
+    }
+    case PlanNode::Kind::kTopN: {
+      auto *topN = static_cast<const graph::TopN *>(node);
+      est.rows = applyLimit(inputRows, topN->offset() + topN->count());
+      cpuRows = inputRows * std::log2(std::max(2.0, est.rows));
+      break;
+    }
+    case PlanNode::Kind::kSample: {
+      auto *sample = static_cast<const graph::Sample *>(node);
+      est.rows = applyLimit(inputRows, constCount(sample->countExpr(), qctx_));
+      break;
+    }
+    case PlanNode::Kind::kSort: {
+      est.rows = inputRows;
+      cpuRows = inputRows * std::log2(std::max(2.0, inputRows));
+      break;
+    }
+    case PlanNode::Kind::kAggregate: {
+      auto *agg = static_cast<const graph::Aggregate *>(node);
+      // Assume each group key reduces the rows by a half
+      est.rows = agg->groupKeys().empty()
+                     ? 1.0
+                     : std::max(1.0, inputRows * std::pow(0.5, agg->groupKeys().size()));
+      break;
+    }
+    case PlanNode::Kind::kHashInnerJoin:
+    case PlanNode::Kind::kHashLeftJoin: {
+      DCHECK_EQ(deps.size(), 2U);
+      double leftRows = deps[0].rows;
+      double rightRows = deps[1].rows;
+      est.rows = node->kind() == PlanNode::Kind::kHashLeftJoin ? leftRows
+                                                                : std::max(leftRows, rightRows);
+      cpuRows = std::min(leftRows, rightRows) * kHashBuildRowCost / kCpuRowCost +
+                std::max(leftRows, rightRows) * kHashProbeRowCost / kCpuRowCost;
+      break;
+    }
+    case PlanNode::Kind::kCrossJoin: {
+      DCHECK_EQ(deps.size(), 2U);
+      est.rows = deps[0].rows * deps[1].rows;
+      cpuRows = est.rows;
+      break;
+    }
+    case PlanNode::Kind::kMultiwayJoin: {
+      // Assume the result is no larger than the smallest input since all inputs share the join
+      // columns, each input is sorted and then scanned once
+      est.rows = deps.empty() ? 0.0 : deps[0].rows;
+      cpuRows = 0.0;
+      for (const auto &dep : deps) {
+        est.rows = std::min(est.rows, dep.rows);
+        cpuRows += dep.rows * std::log2(std::max(2.0, dep.rows));
+      }
+      break;
+    }
+    case PlanNode::Kind::kUnion: {
+      est.rows = 0.0;
+      for (const auto &dep : deps) {
+        est.rows += dep.rows;
+      }
+      break;
+    }
+    case PlanNode::Kind::kIntersect: {
+      DCHECK_EQ(deps.size(), 2U);
+      est.rows = std::min(deps[0].rows, deps[1].rows);
+      break;
+    }
+    case PlanNode::Kind::kMinus: {
+      DCHECK_EQ(deps.size(), 2U);
+      est.rows = deps[0].rows;
+      break;
+    }
+    case PlanNode::Kind::kLoop: {
+      est.rows = inputRows;
+      for (const auto &body : bodies) {
+        inputCost += body.cost * kDefaultLoopRounds;
+      }
+      break;
+    }
+    case PlanNode::Kind::kSelect: {
+      est.rows = inputRows;
+      double bodyCost = 0.0;
+      for (const auto &body : bodies) {
+        bodyCost = std::max(bodyCost, body.cost);
+      }
+      inputCost += bodyCost;
+      break;
+    }
+    default: {
+      est.rows = inputRows;
+      break;
+    }
+  }
+
+  est.rows = std::max(est.rows, 0.0);
+  est.cost = inputCost + storageRows * kStorageRowCost + cpuRows * kCpuRowCost;
+  return est;
+}
+
+}  // namespace opt
+}  // namespace nebula
@@ -0,0 +1,65 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_OPTIMIZER_COSTMODEL_H_
+#define GRAPH_OPTIMIZER_COSTMODEL_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/thrift/ThriftTypes.h"
+
+namespace nebula {
+namespace graph {
+class CardinalityEstimator;
+class PlanNode;
+class QueryContext;
+}  // namespace graph
+
+namespace opt {
+
+// Estimated output rows of a plan node and the accumulated cost of the sub-plan rooted at it
+struct PlanEstimate {
+  double rows{1.0};
+  double cost{0.0};
+};
+
+// The cost model used to select the cheapest alternative in the memo. The cost is measured by
+// the number of rows handled and weighted by where they are handled: rows read from storage are
+// much more expensive than the rows processed in the graph service.
+class CostModel final {
+ public:
+  // Cost of one row read from storage service
+  static constexpr double kStorageRowCost = 1.0;
+  // Cost of one row processed in memory
+  static constexpr double kCpuRowCost = 0.1;
+  static constexpr double kHashBuildRowCost = 0.2;
+  static constexpr double kHashProbeRowCost = 0.1;
+  // Assumed rounds of a loop when it's unknown before execution
+  static constexpr double kDefaultLoopRounds = 3.0;
+
+  explicit CostModel(graph::QueryContext *qctx);
+  ~CostModel();
+
+  // Estimate the node from the estimations of its dependencies and bodies
+  PlanEstimate estimate(const graph::PlanNode *node,
+                        const std::vector<PlanEstimate> &deps,
+                        const std::vector<PlanEstimate> &bodies);
+
+ private:
+  graph::CardinalityEstimator *estimator(GraphSpaceID space);
+
+  // Rows visited by walking `steps` hops from `rows` vertices
+  static double expandRows(double rows, double degree, size_t minSteps, size_t maxSteps);
+
+  graph::QueryContext *qctx_{nullptr};
+  std::unordered_map<GraphSpaceID, std::unique_ptr<graph::CardinalityEstimator>> estimators_;
+};
+
+}  // namespace opt
+}  // namespace nebula
+
+#endif  // GRAPH_OPTIMIZER_COSTMODEL_H_
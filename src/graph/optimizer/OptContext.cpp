@@ -29,5 +29,12 @@ const OptGroupNode *OptContext::findOptGroupNodeByPlanNodeId(int64_t planNodeId)
   return found == planNodeToOptGroupNodeMap_.end() ? nullptr : found->second;
 }
 
+CostModel *OptContext::costModel() {
+  if (costModel_ == nullptr) {
+    costModel_ = std::make_unique<CostModel>(qctx_);
+  }
+  return costModel_.get();
+}
+
 }  // namespace opt
 }  // namespace nebula
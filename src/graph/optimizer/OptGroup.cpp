@@ -12,6 +12,7 @@
 #include "graph/optimizer/OptRule.h"
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/PlanNode.h"
+#include "graph/service/GraphFlags.h"
 
 using nebula::graph::BinaryInputNode;
 using nebula::graph::Loop;
@@ -249,6 +250,10 @@ double OptGroup::getCost() const {
   return findMinCostGroupNode().first;
 }
 
+PlanEstimate OptGroup::estimate() const {
+  return DCHECK_NOTNULL(findMinCostGroupNode().second)->estimate();
+}
+
 const PlanNode *OptGroup::getPlan() const {
   auto &group2PlanNodeMap = ctx_->group2PlanNodeMap_;
   auto iter = group2PlanNodeMap.find(this);
@@ -256,6 +261,12 @@ const PlanNode *OptGroup::getPlan() const {
     return iter->second;
   }
   const OptGroupNode *minGroupNode = findMinCostGroupNode().second;
+  // The alternatives not chosen are dropped, so that they don't write the output variable
+  for (auto *gn : groupNodes_) {
+    if (gn != minGroupNode) {
+      gn->release();
+    }
+  }
   const auto plan = DCHECK_NOTNULL(minGroupNode)->getPlan();
   group2PlanNodeMap.emplace(this, plan);
   return plan;
@@ -317,7 +328,31 @@ Status OptGroupNode::explore(const OptRule *rule) {
 }
 
 double OptGroupNode::getCost() const {
-  return node_->cost();
+  if (!FLAGS_enable_optimizer_cost_model) {
+    return node_->cost();
+  }
+  return estimate().cost;
+}
+
+PlanEstimate OptGroupNode::estimate() const {
+  auto *ctx = group_->ctx();
+  auto iter = ctx->estimates_.find(this);
+  if (iter != ctx->estimates_.end()) {
+    return iter->second;
+  }
+  std::vector<PlanEstimate> deps;
+  deps.reserve(dependencies_.size());
+  for (auto *dep : dependencies_) {
+    deps.emplace_back(dep->estimate());
+  }
+  std::vector<PlanEstimate> bodies;
+  bodies.reserve(bodies_.size());
+  for (auto *body : bodies_) {
+    bodies.emplace_back(body->estimate());
+  }
+  auto est = ctx->costModel()->estimate(node_, deps, bodies);
+  ctx->estimates_.emplace(this, est);
+  return est;
 }
 
 const PlanNode *OptGroupNode::getPlan() const {
@@ -5,6 +5,12 @@
 
 #include "graph/optimizer/Optimizer.h"
 
+#include <folly/String.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/FunctionCallExpression.h"
+#include "common/expression/PropertyExpression.h"
 #include "graph/context/QueryContext.h"
 #include "graph/optimizer/OptContext.h"
 #include "graph/optimizer/OptGroup.h"
@@ -12,14 +18,33 @@
 #include "graph/planner/plan/ExecutionPlan.h"
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/PlanNode.h"
+#include "graph/planner/plan/Query.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/AnonVarGenerator.h"
+#include "graph/util/ExpressionUtils.h"
 #include "graph/visitor/PrunePropertiesVisitor.h"
 
+using nebula::graph::AnonVarGenerator;
+using nebula::graph::AppendVertices;
 using nebula::graph::BinaryInputNode;
+using nebula::graph::Explore;
+using nebula::graph::ExpressionUtils;
+using nebula::graph::Filter;
+using nebula::graph::GetEdges;
+using nebula::graph::GetNeighbors;
+using nebula::graph::GetVertices;
+using nebula::graph::HashJoin;
+using nebula::graph::IndexScan;
 using nebula::graph::Loop;
 using nebula::graph::PlanNode;
+using nebula::graph::Project;
 using nebula::graph::QueryContext;
+using nebula::graph::ScanEdges;
+using nebula::graph::ScanVertices;
 using nebula::graph::Select;
 using nebula::graph::SingleDependencyNode;
+using nebula::graph::Traverse;
+using nebula::graph::Variable;
 
 DEFINE_bool(enable_optimizer_property_pruner_rule, true, "");
 DEFINE_uint64(max_plan_depth, 512, "The max depth of plan tree");
@@ -65,6 +90,12 @@ Status Optimizer::postprocess(PlanNode *root, graph::QueryContext *qctx, GraphSp
                 << visitor.status();
     }
   }
+  if (FLAGS_enable_optimizer_cse) {
+    eliminateCommonSubPlans(root);
+  }
+  if (FLAGS_enable_runtime_filter) {
+    addRuntimeFilters(root);
+  }
   return Status::OK();
 }
 
@@ -201,16 +232,28 @@ Status Optimizer::rewriteArgumentInputVarInternal(
       break;
     }
     case 2: {
-      auto *bpn = static_cast<BinaryInputNode *>(root);
-      auto *left = const_cast<PlanNode *>(bpn->left());
-      NG_RETURN_IF_ERROR(rewriteArgumentInputVarInternal(left, path, visitedPlanNode));
-      auto *right = const_cast<PlanNode *>(bpn->right());
-      NG_RETURN_IF_ERROR(rewriteArgumentInputVarInternal(right, path, visitedPlanNode));
-      break;
+      if (root->isBiInput()) {
+        auto *bpn = static_cast<BinaryInputNode *>(root);
+        auto *left = const_cast<PlanNode *>(bpn->left());
+        NG_RETURN_IF_ERROR(rewriteArgumentInputVarInternal(left, path, visitedPlanNode));
+        auto *right = const_cast<PlanNode *>(bpn->right());
+        NG_RETURN_IF_ERROR(rewriteArgumentInputVarInternal(right, path, visitedPlanNode));
+        break;
+      }
+      [[fallthrough]];
     }
     default: {
-      return Status::Error(
-          "Invalid dependencies of plan node `%s': %lu", root->toString().c_str(), root->numDeps());
+      if (!root->isMultiInput()) {
+        return Status::Error("Invalid dependencies of plan node `%s': %lu",
+                             root->toString().c_str(),
+                             root->numDeps());
+      }
+      // The inputs are independent of each other
+      for (size_t i = 0; i < root->numDeps(); ++i) {
+        auto *dep = const_cast<PlanNode *>(root->dep(i));
+        NG_RETURN_IF_ERROR(rewriteArgumentInputVarInternal(dep, path, visitedPlanNode));
+      }
+      break;
     }
   }
   path.pop_back();
@@ -239,6 +282,663 @@ Status Optimizer::rewriteArgumentInputVar(PlanNode *root,
   return rewriteArgumentInputVarInternal(root, path, visitedPlanNode);
 }
 
+namespace {
+
+// Returns the alias of edge `e' if the expression is `none_direct_dst($-.e, ...)'
+const std::string *dstEdgeAlias(const Expression *expr) {
+  if (expr == nullptr || expr->kind() != Expression::Kind::kFunctionCall) {
+    return nullptr;
+  }
+  auto *func = static_cast<const FunctionCallExpression *>(expr);
+  if (func->name() != "none_direct_dst") {
+    return nullptr;
+  }
+  const auto &args = func->args()->args();
+  if (args.empty() || args[0]->kind() != Expression::Kind::kInputProperty) {
+    return nullptr;
+  }
+  return &static_cast<const InputPropertyExpression *>(args[0])->prop();
+}
+
+// Returns the input column referred by the join key, e.g. `_joinkey($-.v)', `id($-.v)' or `$-.v'
+const std::string *joinKeyColumn(const Expression *expr) {
+  if (expr->kind() == Expression::Kind::kFunctionCall) {
+    auto *func = static_cast<const FunctionCallExpression *>(expr);
+    const auto &args = func->args()->args();
+    if ((func->name() != "_joinkey" && func->name() != "id") || args.size() != 1) {
+      return nullptr;
+    }
+    expr = args[0];
+  }
+  if (expr->kind() != Expression::Kind::kInputProperty) {
+    return nullptr;
+  }
+  return &static_cast<const InputPropertyExpression *>(expr)->prop();
+}
+
+// Trace the column back to the one step traverse whose edges' dst produce it. Every node on the
+// way must be the only reader of its input, otherwise the filtered rows are visible to others.
+Traverse *findDstTraverse(const PlanNode *node,
+                          std::string col,
+                          const std::unordered_map<std::string, size_t> &readers) {
+  auto onlyReader = [&readers](const PlanNode *n) {
+    auto found = readers.find(n->outputVar());
+    return found != readers.end() && found->second == 1;
+  };
+  const std::string *edge = nullptr;
+  while (edge == nullptr) {
+    if (!onlyReader(node)) {
+      return nullptr;
+    }
+    switch (node->kind()) {
+      case PlanNode::Kind::kFilter: {
+        break;
+      }
+      case PlanNode::Kind::kProject: {
+        auto *project = static_cast<const Project *>(node);
+        const YieldColumn *column = nullptr;
+        for (auto *c : project->columns()->columns()) {
+          if (c->alias() == col) {
+            column = c;
+          }
+        }
+        if (column == nullptr) {
+          return nullptr;
+        }
+        auto *expr = column->expr();
+        if (expr->kind() == Expression::Kind::kInputProperty) {
+          col = static_cast<const InputPropertyExpression *>(expr)->prop();
+        } else if ((edge = dstEdgeAlias(expr)) == nullptr) {
+          return nullptr;
+        }
+        break;
+      }
+      case PlanNode::Kind::kAppendVertices: {
+        auto *av = static_cast<const AppendVertices *>(node);
+        if (av->nodeAlias() != col || (edge = dstEdgeAlias(av->src())) == nullptr) {
+          return nullptr;
+        }
+        break;
+      }
+      default:
+        return nullptr;
+    }
+    node = node->dep();
+  }
+  if (node->kind() != PlanNode::Kind::kTraverse || !onlyReader(node)) {
+    return nullptr;
+  }
+  auto *traverse = static_cast<const Traverse *>(node);
+  if (!traverse->isOneStep() || traverse->edgeAlias() != *edge) {
+    return nullptr;
+  }
+  return const_cast<Traverse *>(traverse);
+}
+
+// The limit pushed down keeps the first edges of the traverse, which are different ones once the
+// edges are filtered in storage
+bool hasLimit(const Traverse *traverse) {
+  auto *limit = traverse->limitExpr();
+  if (limit == nullptr) {
+    return false;
+  }
+  if (limit->kind() != Expression::Kind::kConstant) {
+    return true;
+  }
+  const auto &val = static_cast<const ConstantExpression *>(limit)->value();
+  return !val.isInt() || val.getInt() >= 0;
+}
+
+bool dependsOn(const PlanNode *root, const PlanNode *target) {
+  std::vector<const PlanNode *> stack{root};
+  std::unordered_set<const PlanNode *> visited;
+  while (!stack.empty()) {
+    auto *node = stack.back();
+    stack.pop_back();
+    if (node == target) {
+      return true;
+    }
+    if (!visited.emplace(node).second) {
+      continue;
+    }
+    for (size_t i = 0; i < node->numDeps(); ++i) {
+      stack.emplace_back(node->dep(i));
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+// static
+void Optimizer::addRuntimeFilters(PlanNode *root) {
+  std::vector<PlanNode *> nodes;
+  std::unordered_set<const PlanNode *> visited;
+  std::vector<PlanNode *> stack{root};
+  while (!stack.empty()) {
+    auto *node = stack.back();
+    stack.pop_back();
+    if (node == nullptr || !visited.emplace(node).second) {
+      continue;
+    }
+    nodes.emplace_back(node);
+    for (size_t i = 0; i < node->numDeps(); ++i) {
+      stack.emplace_back(const_cast<PlanNode *>(node->dep(i)));
+    }
+    if (node->kind() == PlanNode::Kind::kLoop) {
+      stack.emplace_back(const_cast<PlanNode *>(static_cast<Loop *>(node)->body()));
+    } else if (node->kind() == PlanNode::Kind::kSelect) {
+      auto *sel = static_cast<Select *>(node);
+      stack.emplace_back(const_cast<PlanNode *>(sel->then()));
+      stack.emplace_back(const_cast<PlanNode *>(sel->otherwise()));
+    }
+  }
+
+  // Count the readers in the final plan, the symbol table still keeps the replaced nodes
+  std::unordered_map<std::string, size_t> readers;
+  for (auto *node : nodes) {
+    for (auto *var : node->inputVars()) {
+      if (var != nullptr) {
+        readers[var->name]++;
+      }
+    }
+  }
+
+  for (auto *node : nodes) {
+    if (node->kind() != PlanNode::Kind::kHashInnerJoin &&
+        node->kind() != PlanNode::Kind::kHashLeftJoin) {
+      continue;
+    }
+    // Both the inner and left join drop the right rows which could not match any left row
+    auto *join = static_cast<HashJoin *>(node);
+    const auto &hashKeys = join->hashKeys();
+    const auto &probeKeys = join->probeKeys();
+    for (size_t i = 0; i < probeKeys.size(); ++i) {
+      auto *col = joinKeyColumn(probeKeys[i]);
+      if (col == nullptr) {
+        continue;
+      }
+      auto *traverse = findDstTraverse(join->right(), *col, readers);
+      // The traverse waits for the build side, so it must not be a dependency of it
+      if (traverse == nullptr || traverse->hasRuntimeFilter() || hasLimit(traverse) ||
+          dependsOn(join->left(), traverse)) {
+        continue;
+      }
+      traverse->setRuntimeFilter(join->leftInputVar(), hashKeys[i]->clone());
+      break;
+    }
+  }
+}
+
+namespace {
+
+// The nodes whose results only depend on their inputs, so the ones with the same inputs could be
+// computed once
+bool isSharable(const PlanNode *node) {
+  switch (node->kind()) {
+    case PlanNode::Kind::kStart:
+    case PlanNode::Kind::kGetVertices:
+    case PlanNode::Kind::kGetEdges:
+    case PlanNode::Kind::kAppendVertices:
+    case PlanNode::Kind::kIndexScan:
+    case PlanNode::Kind::kTagIndexFullScan:
+    case PlanNode::Kind::kTagIndexPrefixScan:
+    case PlanNode::Kind::kTagIndexRangeScan:
+    case PlanNode::Kind::kEdgeIndexFullScan:
+    case PlanNode::Kind::kEdgeIndexPrefixScan:
+    case PlanNode::Kind::kEdgeIndexRangeScan:
+    case PlanNode::Kind::kScanVertices:
+    case PlanNode::Kind::kScanEdges:
+    case PlanNode::Kind::kDedup: {
+      return true;
+    }
+    case PlanNode::Kind::kGetNeighbors:
+    case PlanNode::Kind::kTraverse: {
+      // The sampled edges differ from one run to another
+      return !static_cast<const GetNeighbors *>(node)->random();
+    }
+    case PlanNode::Kind::kProject: {
+      for (auto *col : static_cast<const Project *>(node)->columns()->columns()) {
+        if (ExpressionUtils::findInnerRandFunction(col->expr())) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case PlanNode::Kind::kFilter: {
+      auto *condition = static_cast<const Filter *>(node)->condition();
+      return condition == nullptr || !ExpressionUtils::findInnerRandFunction(condition);
+    }
+    default:
+      return false;
+  }
+}
+
+// Merges the props of the same tag or edge type, and drops the repeated prop names, where an empty
+// list asks for all the props. Returns nullptr if there is nothing to merge.
+template <typename Prop, typename SchemaOf>
+std::unique_ptr<std::vector<Prop>> dedupProps(const std::vector<Prop> *props, SchemaOf schemaOf) {
+  if (props == nullptr) {
+    return nullptr;
+  }
+  bool changed = false;
+  std::vector<Prop> merged;
+  std::unordered_map<int32_t, size_t> index;
+  for (const auto &prop : *props) {
+    auto found = index.find(schemaOf(prop));
+    if (found == index.end()) {
+      index.emplace(schemaOf(prop), merged.size());
+      merged.emplace_back(prop);
+      continue;
+    }
+    changed = true;
+    auto &names = *merged[found->second].props_ref();
+    const auto &more = *prop.props_ref();
+    if (names.empty() || more.empty()) {
+      names.clear();
+    } else {
+      names.insert(names.end(), more.begin(), more.end());
+    }
+  }
+  for (auto &prop : merged) {
+    auto &names = *prop.props_ref();
+    std::unordered_set<std::string> seen;
+    auto end = std::remove_if(names.begin(), names.end(), [&seen](const std::string &name) {
+      return !seen.emplace(name).second;
+    });
+    if (end != names.end()) {
+      changed = true;
+      names.erase(end, names.end());
+    }
+  }
+  return changed ? std::make_unique<std::vector<Prop>>(std::move(merged)) : nullptr;
+}
+
+// Don't fetch the same property twice in one storage request
+void dedupStorageProps(PlanNode *node) {
+  auto tagOf = [](const storage::cpp2::VertexProp &prop) { return prop.tag_ref().value(); };
+  auto typeOf = [](const storage::cpp2::EdgeProp &prop) { return prop.type_ref().value(); };
+  switch (node->kind()) {
+    case PlanNode::Kind::kGetNeighbors:
+    case PlanNode::Kind::kTraverse: {
+      auto *gn = static_cast<GetNeighbors *>(node);
+      if (auto vertexProps = dedupProps(gn->vertexProps(), tagOf)) {
+        gn->setVertexProps(std::move(vertexProps));
+      }
+      if (auto edgeProps = dedupProps(gn->edgeProps(), typeOf)) {
+        gn->setEdgeProps(std::move(edgeProps));
+      }
+      break;
+    }
+    case PlanNode::Kind::kGetVertices:
+    case PlanNode::Kind::kAppendVertices: {
+      auto *gv = static_cast<GetVertices *>(node);
+      if (auto props = dedupProps(gv->props(), tagOf)) {
+        gv->setVertexProps(std::move(props));
+      }
+      break;
+    }
+    case PlanNode::Kind::kGetEdges: {
+      auto *ge = static_cast<GetEdges *>(node);
+      if (auto props = dedupProps(ge->props(), typeOf)) {
+        ge->setEdgeProps(std::move(props));
+      }
+      break;
+    }
+    case PlanNode::Kind::kScanVertices: {
+      auto *sv = static_cast<ScanVertices *>(node);
+      if (auto props = dedupProps(sv->props(), tagOf)) {
+        sv->setVertexProps(std::move(props));
+      }
+      break;
+    }
+    case PlanNode::Kind::kScanEdges: {
+      auto *se = static_cast<ScanEdges *>(node);
+      if (auto props = dedupProps(se->props(), typeOf)) {
+        se->setEdgeProps(std::move(props));
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+// Appends the nodes reachable from the root through dependencies, each after all its dependencies
+void collectInPostOrder(PlanNode *root,
+                        std::unordered_set<const PlanNode *> &visited,
+                        std::vector<PlanNode *> &nodes) {
+  if (root == nullptr || !visited.emplace(root).second) {
+    return;
+  }
+  std::vector<std::pair<PlanNode *, size_t>> stack{{root, 0}};
+  while (!stack.empty()) {
+    auto *node = stack.back().first;
+    auto next = stack.back().second++;
+    if (next < node->numDeps()) {
+      auto *dep = const_cast<PlanNode *>(node->dep(next));
+      if (dep != nullptr && visited.emplace(dep).second) {
+        stack.emplace_back(dep, 0);
+      }
+      continue;
+    }
+    nodes.emplace_back(node);
+    stack.pop_back();
+  }
+}
+
+void appendField(const std::string &field, std::string &signature) {
+  // Prefixed by the length so that the fields never run into each other
+  signature += folly::to<std::string>(field.size());
+  signature += ':';
+  signature += field;
+}
+
+template <typename T>
+void appendInt(T value, std::string &signature) {
+  appendField(folly::to<std::string>(value), signature);
+}
+
+void appendExpr(const Expression *expr, std::string &signature) {
+  // The encoded expression keeps all of it, e.g. the quotes of string literals, unlike the printed
+  // one, and is never empty
+  appendField(expr == nullptr ? "" : Expression::encode(*expr), signature);
+}
+
+template <typename T>
+void appendThrifts(const std::vector<T> *objs, std::string &signature) {
+  // Tells null from empty
+  appendField(objs == nullptr ? "null" : folly::to<std::string>(objs->size()), signature);
+  if (objs == nullptr) {
+    return;
+  }
+  for (const auto &obj : *objs) {
+    appendField(apache::thrift::CompactSerializer::serialize<std::string>(obj), signature);
+  }
+}
+
+void appendColumns(const YieldColumns *columns, std::string &signature) {
+  appendField(columns == nullptr ? "null" : folly::to<std::string>(columns->size()), signature);
+  if (columns == nullptr) {
+    return;
+  }
+  for (const auto *col : columns->columns()) {
+    appendField(col->alias(), signature);
+    appendExpr(col->expr(), signature);
+  }
+}
+
+void appendExplore(const Explore *explore, std::string &signature) {
+  appendInt(explore->space(), signature);
+  appendInt(explore->dedup(), signature);
+  appendExpr(explore->limitExpr(), signature);
+  appendExpr(explore->filter(), signature);
+  appendThrifts(&explore->orderBy(), signature);
+}
+
+// Appends the fields of a sharable node which decide its result besides the inputs
+void appendFields(const PlanNode *node, std::string &signature) {
+  switch (node->kind()) {
+    case PlanNode::Kind::kStart:
+    case PlanNode::Kind::kDedup: {
+      break;
+    }
+    case PlanNode::Kind::kFilter: {
+      auto *filter = static_cast<const Filter *>(node);
+      appendExpr(filter->condition(), signature);
+      appendInt(filter->needStableFilter(), signature);
+      break;
+    }
+    case PlanNode::Kind::kProject: {
+      appendColumns(static_cast<const Project *>(node)->columns(), signature);
+      break;
+    }
+    case PlanNode::Kind::kGetNeighbors:
+    case PlanNode::Kind::kTraverse: {
+      auto *gn = static_cast<const GetNeighbors *>(node);
+      appendExplore(gn, signature);
+      appendExpr(gn->src(), signature);
+      appendField(folly::join(",", gn->edgeTypes()), signature);
+      appendInt(static_cast<int32_t>(gn->edgeDirection()), signature);
+      appendThrifts(gn->vertexProps(), signature);
+      appendThrifts(gn->edgeProps(), signature);
+      appendThrifts(gn->statProps(), signature);
+      appendThrifts(gn->exprs(), signature);
+      appendInt(gn->random(), signature);
+      if (node->kind() == PlanNode::Kind::kTraverse) {
+        auto *traverse = static_cast<const Traverse *>(node);
+        auto range = traverse->stepRange();
+        appendInt(range.min(), signature);
+        appendInt(range.max(), signature);
+        appendExpr(traverse->vFilter(), signature);
+        appendExpr(traverse->eFilter(), signature);
+        appendExpr(traverse->firstStepFilter(), signature);
+        appendExpr(traverse->tagFilter(), signature);
+        appendInt(traverse->trackPrevPath(), signature);
+        appendInt(traverse->genPath(), signature);
+        appendField(traverse->runtimeFilterVar(), signature);
+        appendExpr(traverse->runtimeFilterKey(), signature);
+      }
+      break;
+    }
+    case PlanNode::Kind::kGetVertices:
+    case PlanNode::Kind::kAppendVertices: {
+      auto *gv = static_cast<const GetVertices *>(node);
+      appendExplore(gv, signature);
+      appendExpr(gv->src(), signature);
+      appendThrifts(gv->props(), signature);
+      appendThrifts(gv->exprs(), signature);
+      if (node->kind() == PlanNode::Kind::kAppendVertices) {
+        auto *av = static_cast<const AppendVertices *>(node);
+        appendExpr(av->vFilter(), signature);
+        appendInt(av->trackPrevPath(), signature);
+      }
+      break;
+    }
+    case PlanNode::Kind::kGetEdges: {
+      auto *ge = static_cast<const GetEdges *>(node);
+      appendExplore(ge, signature);
+      appendExpr(ge->src(), signature);
+      appendExpr(ge->type(), signature);
+      appendExpr(ge->ranking(), signature);
+      appendExpr(ge->dst(), signature);
+      appendThrifts(ge->props(), signature);
+      appendThrifts(ge->exprs(), signature);
+      break;
+    }
+    case PlanNode::Kind::kIndexScan:
+    case PlanNode::Kind::kTagIndexFullScan:
+    case PlanNode::Kind::kTagIndexPrefixScan:
+    case PlanNode::Kind::kTagIndexRangeScan:
+    case PlanNode::Kind::kEdgeIndexFullScan:
+    case PlanNode::Kind::kEdgeIndexPrefixScan:
+    case PlanNode::Kind::kEdgeIndexRangeScan: {
+      auto *scan = static_cast<const IndexScan *>(node);
+      appendExplore(scan, signature);
+      appendThrifts(&scan->queryContext(), signature);
+      appendField(folly::join(",", scan->returnColumns()), signature);
+      appendInt(scan->isEdge(), signature);
+      appendInt(scan->schemaId(), signature);
+      appendColumns(scan->yieldColumns(), signature);
+      appendInt(scan->lazyIndexHint(), signature);
+      break;
+    }
+    case PlanNode::Kind::kScanVertices: {
+      auto *sv = static_cast<const ScanVertices *>(node);
+      appendExplore(sv, signature);
+      appendThrifts(sv->props(), signature);
+      appendThrifts(sv->exprs(), signature);
+      break;
+    }
+    case PlanNode::Kind::kScanEdges: {
+      auto *se = static_cast<const ScanEdges *>(node);
+      appendExplore(se, signature);
+      appendThrifts(se->props(), signature);
+      appendThrifts(se->exprs(), signature);
+      break;
+    }
+    default: {
+      LOG(DFATAL) << "Not a sharable plan node: " << PlanNode::toString(node->kind());
+      // Never the same as others
+      appendInt(node->id(), signature);
+      break;
+    }
+  }
+}
+
+// Collects the identifiers in the text, e.g. the variable names within printed expressions
+void collectNames(const std::string &text, std::unordered_set<std::string> &names) {
+  size_t begin = 0;
+  for (size_t i = 0; i <= text.size(); ++i) {
+    if (i < text.size() && (std::isalnum(static_cast<unsigned char>(text[i])) || text[i] == '_')) {
+      continue;
+    }
+    if (i > begin) {
+      names.emplace(text, begin, i - begin);
+    }
+    begin = i + 1;
+  }
+}
+
+}  // namespace
+
+// static
+void Optimizer::eliminateCommonSubPlans(PlanNode *root) {
+  // The nodes in loop bodies and select branches come after the others, they may be run many
+  // times or not at all, so they are never shared.
+  std::vector<PlanNode *> nodes;
+  std::unordered_set<const PlanNode *> visited;
+  collectInPostOrder(root, visited, nodes);
+  auto numOutside = nodes.size();
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    auto *node = nodes[i];
+    if (node->kind() == PlanNode::Kind::kLoop) {
+      collectInPostOrder(const_cast<PlanNode *>(static_cast<Loop *>(node)->body()), visited, nodes);
+    } else if (node->kind() == PlanNode::Kind::kSelect) {
+      auto *sel = static_cast<Select *>(node);
+      collectInPostOrder(const_cast<PlanNode *>(sel->then()), visited, nodes);
+      collectInPostOrder(const_cast<PlanNode *>(sel->otherwise()), visited, nodes);
+    }
+  }
+
+  std::unordered_map<std::string, PlanNode *> writerOf;
+  std::unordered_map<std::string, size_t> numWriters;
+  std::unordered_map<std::string, size_t> numReaders;
+  std::unordered_map<const PlanNode *, std::vector<PlanNode *>> parents;
+  std::unordered_set<const PlanNode *> inside(nodes.begin() + numOutside, nodes.end());
+  for (auto *node : nodes) {
+    dedupStorageProps(node);
+    writerOf[node->outputVar()] = node;
+    numWriters[node->outputVar()]++;
+    for (auto *var : node->inputVars()) {
+      if (var != nullptr) {
+        numReaders[var->name]++;
+      }
+    }
+    for (size_t i = 0; i < node->numDeps(); ++i) {
+      if (node->dep(i) != nullptr) {
+        parents[node->dep(i)].emplace_back(node);
+      }
+    }
+  }
+
+  // The variables may also be referred by the expressions, e.g. the conditions of loops or the keys
+  // of joins, which are not input vars. The names in the descriptions of all nodes are taken as
+  // referred conservatively, and matched exactly.
+  std::unordered_set<std::string> referred;
+  for (auto *node : nodes) {
+    auto desc = node->explain();
+    if (desc->description == nullptr) {
+      continue;
+    }
+    for (const auto &pair : *desc->description) {
+      if (pair.key != "inputVar") {
+        collectNames(pair.value, referred);
+      }
+    }
+  }
+
+  std::unordered_map<const PlanNode *, const PlanNode *> replacedBy;
+  auto sharedOf = [&replacedBy](const PlanNode *node) {
+    auto found = replacedBy.find(node);
+    return found == replacedBy.end() ? node : found->second;
+  };
+  auto varOf = [&](const Variable *var) -> std::string {
+    if (var == nullptr) {
+      return "";
+    }
+    if (numWriters[var->name] == 1) {
+      return folly::to<std::string>("#", sharedOf(writerOf[var->name])->id());
+    }
+    return var->name;
+  };
+  // A duplicated node is dropped only if all its readers are the parents outside of branches,
+  // which read it from the input vars.
+  auto isReplaceable = [&](const PlanNode *node) {
+    const auto &var = node->outputVar();
+    if (node == root || !AnonVarGenerator::isAnnoVar(var) || referred.count(var) != 0) {
+      return false;
+    }
+    size_t numRead = 0;
+    for (auto *parent : parents[node]) {
+      if (inside.count(parent) != 0) {
+        return false;
+      }
+      for (auto *input : parent->inputVars()) {
+        numRead += input != nullptr && input->name == var;
+      }
+    }
+    return numRead == numReaders[var];
+  };
+
+  size_t numReplaced = 0;
+  std::unordered_map<std::string, PlanNode *> shared;
+  for (size_t i = 0; i < numOutside; ++i) {
+    auto *node = nodes[i];
+    if (!isSharable(node) || numWriters[node->outputVar()] != 1) {
+      continue;
+    }
+    std::string signature;
+    appendField(PlanNode::toString(node->kind()), signature);
+    appendField(folly::join(",", node->colNames()), signature);
+    for (auto *var : node->inputVars()) {
+      appendField(varOf(var), signature);
+    }
+    for (size_t j = 0; j < node->numDeps(); ++j) {
+      appendInt(sharedOf(node->dep(j))->id(), signature);
+    }
+    appendFields(node, signature);
+
+    auto found = shared.find(signature);
+    if (found == shared.end()) {
+      shared.emplace(std::move(signature), node);
+      continue;
+    }
+    if (!isReplaceable(node)) {
+      continue;
+    }
+    // Let the parents read the result of the first one instead
+    auto *same = found->second;
+    for (auto *parent : parents[node]) {
+      for (size_t j = 0; j < parent->numDeps(); ++j) {
+        if (parent->dep(j) == node) {
+          parent->setDep(j, same);
+        }
+      }
+      for (size_t j = 0; j < parent->inputVars().size(); ++j) {
+        if (parent->inputVar(j) == node->outputVar()) {
+          parent->setInputVar(same->outputVar(), j);
+        }
+      }
+    }
+    replacedBy.emplace(node, same);
+    ++numReplaced;
+  }
+  if (numReplaced > 0) {
+    VLOG(1) << "Replaced " << numReplaced << " plan nodes by the identical ones";
+  }
+}
+
 Status Optimizer::checkPlanDepth(const PlanNode *root) const {
   std::queue<const PlanNode *> queue;
   std::unordered_set<const PlanNode *> visited;
@@ -6,6 +6,8 @@
 #ifndef GRAPH_OPTIMIZER_OPTIMIZER_H_
 #define GRAPH_OPTIMIZER_OPTIMIZER_H_
 
+#include <gtest/gtest_prod.h>
+
 #include "common/base/Base.h"
 #include "common/base/StatusOr.h"
 #include "common/thrift/ThriftTypes.h"
@@ -26,6 +28,12 @@ class OptGroupNode;
 class RuleSet;
 
 class Optimizer final {
+  FRIEND_TEST(OptimizerTest, ShareCommonSubPlans);
+  FRIEND_TEST(OptimizerTest, KeepDifferentSubPlans);
+  FRIEND_TEST(OptimizerTest, RewriteArgumentsOfMultiwayJoin);
+  FRIEND_TEST(OptimizerTest, RewriteArgumentsOfConcurrentStatements);
+  FRIEND_TEST(OptimizerTest, AddRuntimeFilters);
+
  public:
   explicit Optimizer(std::vector<const RuleSet *> ruleSets);
   ~Optimizer() = default;
@@ -54,6 +62,14 @@ class Optimizer final {
       std::vector<const graph::PlanNode *> &path,
       std::unordered_set<const graph::PlanNode *> &visitedPlanNode);
 
+  // Let the probe side traverse of hash join filter the dst of edges in storage by the join keys
+  // of build side, so the rows which could not be joined are not fetched at all
+  static void addRuntimeFilters(graph::PlanNode *root);
+
+  // Compute the structurally identical sub-plans only once and let all their consumers read the
+  // same result variable, besides, the repeated props of storage requests are merged
+  static void eliminateCommonSubPlans(graph::PlanNode *root);
+
   Status checkPlanDepth(const graph::PlanNode *root) const;
 
   static constexpr int8_t kMaxIterationRound = 5;
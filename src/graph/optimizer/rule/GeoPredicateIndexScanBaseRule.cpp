@@ -6,6 +6,7 @@
 #include "graph/optimizer/rule/GeoPredicateIndexScanBaseRule.h"
 
 #include "common/geo/GeoIndex.h"
+#include "common/utils/IndexKeyUtils.h"
 #include "graph/optimizer/OptContext.h"
 #include "graph/optimizer/OptGroup.h"
 #include "graph/optimizer/OptRule.h"
@@ -121,17 +122,7 @@ StatusOr<TransformResult> GeoPredicateIndexScanBaseRule::transform(
   bool isPointColumn = geoColumnTypeDef.geo_shape_ref().has_value() &&
                        geoColumnTypeDef.geo_shape_ref().value() == meta::cpp2::GeoShape::POINT;
 
-  geo::RegionCoverParams rc;
-  const auto* indexParams = geoIndexItem->get_index_params();
-  if (indexParams) {
-    if (indexParams->s2_max_level_ref().has_value()) {
-      rc.maxCellLevel_ = indexParams->s2_max_level_ref().value();
-    }
-    if (indexParams->s2_max_cells_ref().has_value()) {
-      rc.maxCellNum_ = indexParams->s2_max_cells_ref().value();
-    }
-  }
-  geo::GeoIndex geoIndex(rc, isPointColumn);
+  geo::GeoIndex geoIndex(IndexKeyUtils::regionCoverParams(*geoIndexItem), isPointColumn);
   std::vector<geo::ScanRange> scanRanges;
   if (geoPredicateName == "st_intersects") {
     scanRanges = geoIndex.intersects(geog);
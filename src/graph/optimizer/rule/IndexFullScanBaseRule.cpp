@@ -54,12 +54,19 @@ StatusOr<TransformResult> IndexFullScanBaseRule::transform(OptContext* ctx,
 
   std::vector<IndexQueryContext> idxCtxs;
   IndexQueryContext ictx;
+  // Prefer the covering index which need not read base data, and then the lightest one
+  const auto& returnColumns = scan->returnColumns();
   auto idxId = indexItems[0]->get_index_id();
   auto numFields = indexItems[0]->get_fields().size();
+  auto covering = OptimizerUtils::isCoveringIndex(*indexItems[0], returnColumns);
   for (size_t i = 1; i < indexItems.size(); ++i) {
     const auto& index = indexItems[i];
-    if (numFields > index->get_fields().size()) {
+    auto isCovering = OptimizerUtils::isCoveringIndex(*index, returnColumns);
+    if ((isCovering && !covering) ||
+        (isCovering == covering && numFields > index->get_fields().size())) {
       idxId = index->get_index_id();
+      numFields = index->get_fields().size();
+      covering = isCovering;
     }
   }
   ictx.index_id_ref() = idxId;
@@ -160,24 +160,25 @@ StatusOr<TransformResult> OptimizeTagIndexScanByFilterRule::transform(
     }
   }
 
-  IndexQueryContext ictx;
-  bool isPrefixScan = false;
-  if (!OptimizerUtils::findOptimalIndex(transformedExpr, indexItems, &isPrefixScan, &ictx)) {
+  auto candidates = OptimizerUtils::findIndexCandidates(
+      ctx->qctx(), scan->space(), transformedExpr, indexItems, &scan->returnColumns());
+  if (candidates.empty()) {
     return TransformResult::noTransform();
   }
 
-  std::vector<IndexQueryContext> idxCtxs = {ictx};
-  auto scanNode = makeTagIndexScan(ctx->qctx(), scan, isPrefixScan);
-  scanNode->setIndexQueryContext(std::move(idxCtxs));
-  scanNode->setOutputVar(filter->outputVar());
-  scanNode->setColNames(filter->colNames());
+  TransformResult result;
   auto filterGroup = matched.node->group();
-  auto optScanNode = OptGroupNode::create(ctx, scanNode, filterGroup);
-  for (auto group : matched.dependencies[0].node->dependencies()) {
-    optScanNode->dependsOn(group);
+  for (auto& candidate : candidates) {
+    auto scanNode = makeTagIndexScan(ctx->qctx(), scan, candidate.isPrefixScan);
+    scanNode->setIndexQueryContext({std::move(candidate.ictx)});
+    scanNode->setOutputVar(filter->outputVar());
+    scanNode->setColNames(filter->colNames());
+    auto optScanNode = OptGroupNode::create(ctx, scanNode, filterGroup);
+    for (auto group : matched.dependencies[0].node->dependencies()) {
+      optScanNode->dependsOn(group);
+    }
+    result.newGroupNodes.emplace_back(optScanNode);
   }
-  TransformResult result;
-  result.newGroupNodes.emplace_back(optScanNode);
   result.eraseCurr = true;
   return result;
 }
@@ -55,6 +55,8 @@ const std::unordered_set<graph::PlanNode::Kind> RemoveNoopProjectRule::kQueries{
     PlanNode::Kind::kAllPaths,
     PlanNode::Kind::kCartesianProduct,
     PlanNode::Kind::kSubgraph,
+    PlanNode::Kind::kRandomWalk,
+    PlanNode::Kind::kGraphAlgo,
     PlanNode::Kind::kDataCollect,
     PlanNode::Kind::kInnerJoin,
     PlanNode::Kind::kHashLeftJoin,
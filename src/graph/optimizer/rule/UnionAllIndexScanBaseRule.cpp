@@ -177,11 +177,16 @@ StatusOr<TransformResult> UnionAllIndexScanBaseRule::transform(OptContext* ctx,
   for (auto operand : logicalExpr->operands()) {
     IndexQueryContext ictx;
     bool isPrefixScan = false;
-    if (!OptimizerUtils::findOptimalIndex(operand, indexItems, &isPrefixScan, &ictx)) {
+    if (!OptimizerUtils::findOptimalIndex(
+            operand, indexItems, &isPrefixScan, &ictx, &scan->returnColumns()) &&
+        !OptimizerUtils::findSkipScanIndex(
+            qctx, scan->space(), operand, indexItems, &ictx, &scan->returnColumns())) {
       return TransformResult::noTransform();
     }
     idxCtxs.emplace_back(std::move(ictx));
   }
+  // The operands on the same index, e.g. the expanded IN list, are scanned by one iterator
+  OptimizerUtils::mergeRangeContexts(idxCtxs);
 
   auto scanNode = IndexScan::make(qctx, nullptr);
   OptimizerUtils::copyIndexScanData(scan, scanNode, qctx);
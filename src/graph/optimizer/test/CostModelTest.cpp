@@ -0,0 +1,145 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "graph/context/QueryContext.h"
+#include "graph/optimizer/CostModel.h"
+#include "graph/optimizer/OptContext.h"
+#include "graph/optimizer/OptGroup.h"
+#include "graph/planner/plan/Logic.h"
+#include "graph/planner/plan/Query.h"
+#include "graph/planner/plan/Scan.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/CardinalityEstimator.h"
+
+using nebula::graph::CardinalityEstimator;
+using nebula::graph::GetNeighbors;
+using nebula::graph::HashInnerJoin;
+using nebula::graph::Limit;
+using nebula::graph::PlanNode;
+using nebula::graph::QueryContext;
+using nebula::graph::StartNode;
+using nebula::graph::TagIndexPrefixScan;
+using nebula::graph::TagIndexRangeScan;
+using nebula::storage::cpp2::IndexColumnHint;
+using nebula::storage::cpp2::IndexQueryContext;
+using nebula::storage::cpp2::ScanType;
+
+namespace nebula {
+namespace opt {
+
+class CostModelTest : public ::testing::Test {
+ protected:
+  static std::vector<IndexQueryContext> indexContext(ScanType scanType) {
+    IndexColumnHint hint;
+    hint.column_name_ref() = "age";
+    hint.scan_type_ref() = scanType;
+    hint.begin_value_ref() = 10;
+    IndexQueryContext ictx;
+    ictx.index_id_ref() = 1;
+    ictx.column_hints_ref() = {hint};
+    return {ictx};
+  }
+
+  GetNeighbors *getNeighbors(PlanNode *input) {
+    auto *gn = GetNeighbors::make(&qctx_, input, 1);
+    gn->setSrc(ConstantExpression::make(qctx_.objPool(), 1));
+    gn->setEdgeTypes({1});
+    return gn;
+  }
+
+  // The space has no statistics, so the default values are used
+  QueryContext qctx_;
+  CostModel costModel_{&qctx_};
+};
+
+TEST_F(CostModelTest, Estimate) {
+  auto *start = StartNode::make(&qctx_);
+  auto startEst = costModel_.estimate(start, {}, {});
+  EXPECT_EQ(1.0, startEst.rows);
+  EXPECT_EQ(0.0, startEst.cost);
+
+  // One vertex walks to the average degree of edges, which are read from storage
+  auto *gn = getNeighbors(start);
+  auto gnEst = costModel_.estimate(gn, {startEst}, {});
+  double degree = CardinalityEstimator::kDefaultEdges *
+                  CardinalityEstimator::kDefaultSchemaFraction /
+                  CardinalityEstimator::kDefaultVertices;
+  EXPECT_DOUBLE_EQ(degree, gnEst.rows);
+  EXPECT_DOUBLE_EQ(degree * CostModel::kStorageRowCost + CostModel::kCpuRowCost, gnEst.cost);
+
+  // Reduced by the filter and the limit
+  auto *filter = graph::Filter::make(
+      &qctx_,
+      gn,
+      RelationalExpression::makeEQ(qctx_.objPool(),
+                                   ConstantExpression::make(qctx_.objPool(), 1),
+                                   ConstantExpression::make(qctx_.objPool(), 1)));
+  gnEst.rows = 1000.0;
+  auto filterEst = costModel_.estimate(filter, {gnEst}, {});
+  EXPECT_LT(filterEst.rows, gnEst.rows);
+  EXPECT_GT(filterEst.cost, gnEst.cost);
+  auto *limit = Limit::make(&qctx_, filter, 0, 10);
+  EXPECT_DOUBLE_EQ(10.0, costModel_.estimate(limit, {filterEst}, {}).rows);
+
+  // The cost accumulates the costs of both inputs
+  auto *join = HashInnerJoin::make(&qctx_, gn, filter, {}, {});
+  auto joinEst = costModel_.estimate(join, {gnEst, filterEst}, {});
+  EXPECT_GT(joinEst.cost, gnEst.cost + filterEst.cost);
+  EXPECT_DOUBLE_EQ(gnEst.rows, joinEst.rows);
+}
+
+TEST_F(CostModelTest, IndexScan) {
+  auto *start = StartNode::make(&qctx_);
+  auto startEst = costModel_.estimate(start, {}, {});
+  auto *prefix = TagIndexPrefixScan::make(
+      &qctx_, start, "person", 1, indexContext(ScanType::PREFIX), {}, 2);
+  auto *range =
+      TagIndexRangeScan::make(&qctx_, start, "person", 1, indexContext(ScanType::RANGE), {}, 2);
+  double tagRows = CardinalityEstimator::kDefaultVertices *
+                   CardinalityEstimator::kDefaultSchemaFraction;
+  auto prefixEst = costModel_.estimate(prefix, {startEst}, {});
+  auto rangeEst = costModel_.estimate(range, {startEst}, {});
+  EXPECT_DOUBLE_EQ(tagRows * CardinalityEstimator::kEqualSelectivity, prefixEst.rows);
+  EXPECT_DOUBLE_EQ(tagRows * CardinalityEstimator::kRangeSelectivity, rangeEst.rows);
+  EXPECT_LT(prefixEst.cost, rangeEst.cost);
+}
+
+TEST_F(CostModelTest, ChooseCheapestAlternative) {
+  gflags::FlagSaver saver;
+  auto *start = StartNode::make(&qctx_);
+  auto *range =
+      TagIndexRangeScan::make(&qctx_, start, "person", 1, indexContext(ScanType::RANGE), {}, 2);
+  auto *prefix = TagIndexPrefixScan::make(
+      &qctx_, start, "person", 1, indexContext(ScanType::PREFIX), {}, 2);
+  prefix->setOutputVar(range->outputVar());
+
+  auto choose = [&]() {
+    OptContext octx(&qctx_);
+    auto *startGroup = OptGroup::create(&octx);
+    startGroup->makeGroupNode(start);
+    auto *group = OptGroup::create(&octx);
+    for (auto *node : std::vector<PlanNode *>{range, prefix}) {
+      group->makeGroupNode(node)->dependsOn(startGroup);
+    }
+    return group->getPlan();
+  };
+
+  FLAGS_enable_optimizer_cost_model = true;
+  EXPECT_EQ(prefix, choose());
+  // The alternative not chosen doesn't write the result any more
+  const auto &writtenBy = qctx_.symTable()->getVar(range->outputVar())->writtenBy;
+  EXPECT_EQ(1u, writtenBy.size());
+  EXPECT_EQ(1u, writtenBy.count(prefix));
+
+  // The first one is chosen without the cost model
+  FLAGS_enable_optimizer_cost_model = false;
+  EXPECT_EQ(range, choose());
+}
+
+}  // namespace opt
+}  // namespace nebula
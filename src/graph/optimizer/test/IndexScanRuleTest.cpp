@@ -461,6 +461,82 @@ TEST(IndexScanRuleTest, BoundValueRangeTest) {
   }
 }
 
+TEST(IndexScanRuleTest, CoveringIndexTest) {
+  meta::cpp2::IndexItem index;
+  std::vector<meta::cpp2::ColumnDef> cols;
+  {
+    meta::cpp2::ColumnDef col;
+    col.name_ref() = "col0";
+    col.type.type_ref() = PropertyType::INT64;
+    cols.emplace_back(std::move(col));
+  }
+  {
+    meta::cpp2::ColumnDef col;
+    col.name_ref() = "col1";
+    col.type.type_ref() = PropertyType::FIXED_STRING;
+    col.type.type_length_ref() = 8;
+    cols.emplace_back(std::move(col));
+  }
+  index.fields_ref() = std::move(cols);
+  ASSERT_TRUE(OptimizerUtils::isCoveringIndex(index, {kVid, "col0"}));
+  // The string in index key could be truncated
+  ASSERT_FALSE(OptimizerUtils::isCoveringIndex(index, {kVid, "col1"}));
+  ASSERT_FALSE(OptimizerUtils::isCoveringIndex(index, {kVid, "col2"}));
+
+  meta::cpp2::IndexParams params;
+  params.included_fields_ref() = {"col1", "col2"};
+  index.index_params_ref() = std::move(params);
+  ASSERT_TRUE(OptimizerUtils::isCoveringIndex(index, {kVid, "col0", "col1", "col2"}));
+  ASSERT_FALSE(OptimizerUtils::isCoveringIndex(index, {kVid, "col3"}));
+}
+
+TEST(IndexScanRuleTest, MergeRangeContextsTest) {
+  auto hint = [](const std::string& col, int64_t value) {
+    storage::cpp2::IndexColumnHint h;
+    h.column_name_ref() = col;
+    h.scan_type_ref() = storage::cpp2::ScanType::PREFIX;
+    h.begin_value_ref() = Value(value);
+    return h;
+  };
+  auto context = [](IndexID indexId, std::vector<storage::cpp2::IndexColumnHint> hints) {
+    IndexQueryContext ctx;
+    ctx.index_id_ref() = indexId;
+    ctx.column_hints_ref() = std::move(hints);
+    return ctx;
+  };
+  // col0 IN [1, 2, 3] OR col1 == 4
+  std::vector<IndexQueryContext> contexts;
+  contexts.emplace_back(context(1, {hint("col0", 1)}));
+  contexts.emplace_back(context(2, {hint("col1", 4)}));
+  contexts.emplace_back(context(1, {hint("col0", 2)}));
+  contexts.emplace_back(context(1, {hint("col0", 3)}));
+  OptimizerUtils::mergeRangeContexts(contexts);
+  ASSERT_EQ(2, contexts.size());
+  ASSERT_EQ(1, contexts[0].get_index_id());
+  ASSERT_TRUE(contexts[0].get_column_hints().empty());
+  ASSERT_TRUE(contexts[0].range_hints_ref().has_value());
+  const auto& ranges = *contexts[0].range_hints_ref();
+  ASSERT_EQ(3, ranges.size());
+  for (size_t i = 0; i < ranges.size(); i++) {
+    ASSERT_EQ(1, ranges[i].size());
+    ASSERT_EQ(Value(static_cast<int64_t>(i + 1)), ranges[i][0].get_begin_value());
+  }
+  // The single range is scanned by column hints
+  ASSERT_EQ(2, contexts[1].get_index_id());
+  ASSERT_EQ(1, contexts[1].get_column_hints().size());
+  ASSERT_FALSE(contexts[1].range_hints_ref().has_value());
+
+  // The contexts with different filters could not be merged
+  contexts.clear();
+  contexts.emplace_back(context(1, {hint("col0", 1)}));
+  contexts.emplace_back(context(1, {hint("col0", 2)}));
+  contexts.back().filter_ref() = "filter";
+  OptimizerUtils::mergeRangeContexts(contexts);
+  ASSERT_EQ(2, contexts.size());
+  ASSERT_FALSE(contexts[0].range_hints_ref().has_value());
+  ASSERT_FALSE(contexts[1].range_hints_ref().has_value());
+}
+
 }  // namespace opt
 }  // namespace nebula
 
@@ -0,0 +1,219 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "common/expression/FunctionCallExpression.h"
+#include "common/expression/PropertyExpression.h"
+#include "graph/context/QueryContext.h"
+#include "graph/optimizer/Optimizer.h"
+#include "graph/planner/plan/ExecutionPlan.h"
+#include "graph/planner/plan/Logic.h"
+#include "graph/planner/plan/Query.h"
+
+using nebula::graph::AppendVertices;
+using nebula::graph::Argument;
+using nebula::graph::GetNeighbors;
+using nebula::graph::HashInnerJoin;
+using nebula::graph::MultiwayJoin;
+using nebula::graph::PassThroughNode;
+using nebula::graph::PlanNode;
+using nebula::graph::Project;
+using nebula::graph::QueryContext;
+using nebula::graph::StartNode;
+using nebula::graph::Traverse;
+using nebula::graph::Union;
+
+namespace nebula {
+namespace opt {
+
+class OptimizerTest : public ::testing::Test {
+ protected:
+  GetNeighbors *getNeighbors(PlanNode *input, EdgeType edgeType) {
+    auto *gn = GetNeighbors::make(&qctx_, input, 1);
+    gn->setSrc(ConstantExpression::make(qctx_.objPool(), 1));
+    gn->setEdgeTypes({edgeType});
+    return gn;
+  }
+
+  Project *project(PlanNode *input, Expression *expr) {
+    auto *cols = qctx_.objPool()->makeAndAdd<YieldColumns>();
+    cols->addColumn(new YieldColumn(expr, "a"));
+    return Project::make(&qctx_, input, cols);
+  }
+
+  QueryContext qctx_;
+};
+
+TEST_F(OptimizerTest, ShareCommonSubPlans) {
+  auto *pool = qctx_.objPool();
+  auto *start = StartNode::make(&qctx_);
+  auto *left = project(getNeighbors(start, 1), ConstantExpression::make(pool, 1));
+  auto *right = project(getNeighbors(start, 1), ConstantExpression::make(pool, 1));
+  auto *root = Union::make(&qctx_, left, right);
+  // Only the name of the right one as a whole is taken as referred
+  auto *filter = graph::Filter::make(
+      &qctx_, root, VariablePropertyExpression::make(pool, right->outputVar() + "_0", "a"));
+
+  Optimizer::eliminateCommonSubPlans(filter);
+  EXPECT_EQ(left, root->dep(1));
+  EXPECT_EQ(left->outputVar(), root->inputVar(1));
+}
+
+TEST_F(OptimizerTest, KeepDifferentSubPlans) {
+  auto *pool = qctx_.objPool();
+  auto *start = StartNode::make(&qctx_);
+  {
+    // Over other edges
+    auto *left = getNeighbors(start, 1);
+    auto *right = getNeighbors(start, 2);
+    auto *root = Union::make(&qctx_, left, right);
+    Optimizer::eliminateCommonSubPlans(root);
+    EXPECT_EQ(right, root->dep(1));
+    EXPECT_EQ(right->outputVar(), root->inputVar(1));
+  }
+  {
+    // Printed the same, but not equal
+    auto *left = project(start, ConstantExpression::make(pool, "1"));
+    auto *right = project(start, ConstantExpression::make(pool, 1));
+    auto *root = Union::make(&qctx_, left, right);
+    Optimizer::eliminateCommonSubPlans(root);
+    EXPECT_EQ(right, root->dep(1));
+  }
+  {
+    // Differs from one run to another
+    auto *left = project(start, FunctionCallExpression::make(pool, "rand"));
+    auto *right = project(start, FunctionCallExpression::make(pool, "rand"));
+    auto *root = Union::make(&qctx_, left, right);
+    Optimizer::eliminateCommonSubPlans(root);
+    EXPECT_EQ(right, root->dep(1));
+  }
+  {
+    // The result of the right one is also referred by name
+    auto *left = project(start, ConstantExpression::make(pool, 1));
+    auto *right = project(start, ConstantExpression::make(pool, 1));
+    auto *root = Union::make(&qctx_, left, right);
+    auto *filter = graph::Filter::make(
+        &qctx_, root, VariablePropertyExpression::make(pool, right->outputVar(), "a"));
+    Optimizer::eliminateCommonSubPlans(filter);
+    EXPECT_EQ(right, root->dep(1));
+  }
+}
+
+TEST_F(OptimizerTest, RewriteArgumentsOfMultiwayJoin) {
+  auto *pool = qctx_.objPool();
+  auto *start = StartNode::make(&qctx_);
+  for (size_t n : {2, 3}) {
+    std::vector<PlanNode *> inputs;
+    for (size_t i = 0; i < n; ++i) {
+      inputs.emplace_back(getNeighbors(start, i + 1));
+    }
+    auto *join = MultiwayJoin::make(&qctx_, inputs, {});
+    std::unordered_set<const PlanNode *> visited;
+    EXPECT_TRUE(Optimizer::rewriteArgumentInputVar(join, visited).ok());
+  }
+
+  // The argument is fed by the left input of binary input node
+  auto *left = project(start, ConstantExpression::make(pool, 1));
+  auto *argument = Argument::make(&qctx_, "a");
+  argument->setColNames({"a"});
+  auto *right = project(argument, ConstantExpression::make(pool, 1));
+  auto *hashJoin = HashInnerJoin::make(&qctx_, left, right, {}, {});
+  std::unordered_set<const PlanNode *> visited;
+  EXPECT_TRUE(Optimizer::rewriteArgumentInputVar(hashJoin, visited).ok());
+  EXPECT_EQ(left->outputVar(), argument->inputVar());
+
+  // But not by another input of multiway join even if there are only two
+  argument = Argument::make(&qctx_, "a");
+  argument->setColNames({"a"});
+  right = project(argument, ConstantExpression::make(pool, 1));
+  auto *join = MultiwayJoin::make(&qctx_, {left, right}, {"a"});
+  visited.clear();
+  EXPECT_FALSE(Optimizer::rewriteArgumentInputVar(join, visited).ok());
+}
+
+TEST_F(OptimizerTest, RewriteArgumentsOfConcurrentStatements) {
+  auto *pool = qctx_.objPool();
+  auto *start = StartNode::make(&qctx_);
+  // `YIELD 1; YIELD 2; ...' are joined by one pass through node which outputs the last result
+  auto concurrent = [&](size_t n) {
+    auto *last = project(start, ConstantExpression::make(pool, static_cast<int64_t>(n)));
+    auto *passThrough = PassThroughNode::make(&qctx_, last);
+    passThrough->setOutputVar(last->outputVar());
+    passThrough->setColNames(last->colNames());
+    for (size_t i = 1; i < n; ++i) {
+      passThrough->addDep(project(start, ConstantExpression::make(pool, static_cast<int64_t>(i))));
+    }
+    return passThrough;
+  };
+  for (size_t n : {2, 3}) {
+    auto *root = concurrent(n);
+    EXPECT_TRUE(root->isMultiInput());
+    EXPECT_FALSE(root->isBiInput());
+    std::unordered_set<const PlanNode *> visited;
+    EXPECT_TRUE(Optimizer::rewriteArgumentInputVar(root, visited).ok());
+  }
+
+  // The whole optimization of the plan
+  qctx_.plan()->setRoot(concurrent(3));
+  Optimizer optimizer({});
+  auto result = optimizer.findBestPlan(&qctx_);
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_EQ(3U, result.value()->numDeps());
+
+  // The argument isn't fed by another statement
+  auto *argument = Argument::make(&qctx_, "a");
+  argument->setColNames({"a"});
+  auto *root = concurrent(2);
+  root->addDep(project(argument, ConstantExpression::make(pool, 3)));
+  std::unordered_set<const PlanNode *> visited;
+  EXPECT_FALSE(Optimizer::rewriteArgumentInputVar(root, visited).ok());
+}
+
+TEST_F(OptimizerTest, AddRuntimeFilters) {
+  auto *pool = qctx_.objPool();
+  auto *start = StartNode::make(&qctx_);
+  auto joinKey = [pool]() {
+    auto *args = ArgumentList::make(pool);
+    args->addArgument(InputPropertyExpression::make(pool, "a"));
+    return FunctionCallExpression::make(pool, "_joinkey", args);
+  };
+  // The build side yields `a', which is the dst of edges traversed by the probe side
+  auto makeJoin = [&](Traverse *traverse) {
+    traverse->setStepRange(MatchStepRange(1, 1));
+    traverse->setColNames({"v", "e"});
+    auto *args = ArgumentList::make(pool);
+    args->addArgument(InputPropertyExpression::make(pool, "e"));
+    auto *appendVertices = AppendVertices::make(&qctx_, traverse, 1);
+    appendVertices->setSrc(FunctionCallExpression::make(pool, "none_direct_dst", args));
+    appendVertices->setColNames({"v", "e", "a"});
+    auto *build = project(start, ConstantExpression::make(pool, 1));
+    return HashInnerJoin::make(&qctx_, build, appendVertices, {joinKey()}, {joinKey()});
+  };
+
+  auto *traverse = Traverse::make(&qctx_, start, 1);
+  auto *join = makeJoin(traverse);
+  Optimizer::addRuntimeFilters(join);
+  ASSERT_TRUE(traverse->hasRuntimeFilter());
+  EXPECT_EQ(join->leftInputVar(), traverse->runtimeFilterVar());
+  EXPECT_EQ("_joinkey($-.a)", traverse->runtimeFilterKey()->toString());
+
+  // The limit pushed down would keep other edges
+  traverse = Traverse::make(&qctx_, start, 1);
+  traverse->setLimit(10);
+  join = makeJoin(traverse);
+  Optimizer::addRuntimeFilters(join);
+  EXPECT_FALSE(traverse->hasRuntimeFilter());
+
+  // The result of traverse is read by others as well
+  traverse = Traverse::make(&qctx_, start, 1);
+  join = makeJoin(traverse);
+  auto *root = Union::make(&qctx_, join, project(traverse, ConstantExpression::make(pool, 1)));
+  Optimizer::addRuntimeFilters(root);
+  EXPECT_FALSE(traverse->hasRuntimeFilter());
+}
+
+}  // namespace opt
+}  // namespace nebula
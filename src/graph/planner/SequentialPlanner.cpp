@@ -7,6 +7,8 @@
 
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/ParserUtil.h"
 #include "graph/validator/SequentialValidator.h"
 #include "parser/Sentence.h"
 
@@ -20,23 +22,63 @@ StatusOr<SubPlan> SequentialPlanner::transform(AstContext* astCtx) {
   SubPlan subPlan;
   auto* seqCtx = static_cast<SequentialAstContext*>(astCtx);
   const auto& validators = seqCtx->validators;
-  subPlan.root = validators.back()->root();
-  for (auto iter = validators.begin(); iter < validators.end() - 1; ++iter) {
-    // Remove left tail kStart plannode before append plan.
-    // It allows that kUse sentence to append kMatch Sentence.
-    // For example: Use ...; Match ...
-    rmLeftTailStartNode((iter + 1)->get());
-    NG_RETURN_IF_ERROR((iter + 1)->get()->appendPlan(iter->get()->root()));
-  }
-  if (validators.front()->tail()->isSingleInput()) {
-    subPlan.tail = seqCtx->startNode;
-    NG_RETURN_IF_ERROR(validators.front()->appendPlan(subPlan.tail));
-  } else {
-    subPlan.tail = validators.front()->tail();
+  PlanNode* prev = nullptr;
+  for (size_t begin = 0; begin < validators.size();) {
+    // Adjacent read-only sentences only depend on the sentences before them, so they are
+    // run concurrently, e.g. GO ...; FETCH ...; MATCH ...
+    size_t end = begin + 1;
+    if (FLAGS_enable_concurrent_statements &&
+        ParserUtil::isReadOnly(validators[begin]->sentence())) {
+      while (end < validators.size() && ParserUtil::isReadOnly(validators[end]->sentence())) {
+        ++end;
+      }
+    }
+    for (size_t i = begin; i < end; ++i) {
+      auto* validator = validators[i].get();
+      if (prev == nullptr) {
+        if (validator->tail()->isSingleInput()) {
+          NG_RETURN_IF_ERROR(validator->appendPlan(seqCtx->startNode));
+          if (i == 0) {
+            subPlan.tail = seqCtx->startNode;
+          }
+        } else if (i == 0) {
+          subPlan.tail = validator->tail();
+        }
+      } else {
+        // Remove left tail kStart plannode before append plan.
+        // It allows that kUse sentence to append kMatch Sentence.
+        // For example: Use ...; Match ...
+        rmLeftTailStartNode(validator);
+        NG_RETURN_IF_ERROR(validator->appendPlan(prev));
+      }
+    }
+    prev = validators[end - 1]->root();
+    if (end - begin > 1) {
+      prev = joinConcurrent(seqCtx->qctx, validators, begin, end);
+    }
+    begin = end;
   }
+  subPlan.root = prev;
   return subPlan;
 }
 
+// Waits for all the sub-plans of [begin, end) and outputs the result of the last one, which
+// is the result of the query if it's the last group.
+PlanNode* SequentialPlanner::joinConcurrent(
+    QueryContext* qctx,
+    const std::vector<std::unique_ptr<Validator>>& validators,
+    size_t begin,
+    size_t end) {
+  auto* last = validators[end - 1]->root();
+  auto* passThrough = PassThroughNode::make(qctx, last);
+  passThrough->setOutputVar(last->outputVar());
+  passThrough->setColNames(last->colNames());
+  for (size_t i = begin; i < end - 1; ++i) {
+    passThrough->addDep(validators[i]->root());
+  }
+  return passThrough;
+}
+
 // When appending plans, it need to remove left tail plannode.
 // Because the left tail plannode is StartNode which needs to be removed,
 // and remain one size for add dependency
@@ -22,7 +22,10 @@ class SequentialPlanner final : public Planner {
 
   /**
    * Each sentence would be converted to a sub-plan, and they would
-   * be cascaded together into a complete execution plan.
+   * be cascaded together into a complete execution plan. The adjacent
+   * read-only sentences are not cascaded but joined by a PassThrough
+   * node, so that they are scheduled concurrently. Mutations, USE and
+   * assignments keep their order with respect to all the others.
    */
   StatusOr<SubPlan> transform(AstContext* astCtx) override;
 
@@ -30,6 +33,11 @@ class SequentialPlanner final : public Planner {
 
  private:
   SequentialPlanner() = default;
+
+  static PlanNode* joinConcurrent(QueryContext* qctx,
+                                  const std::vector<std::unique_ptr<Validator>>& validators,
+                                  size_t begin,
+                                  size_t end);
 };
 }  // namespace graph
 }  // namespace nebula
@@ -5,6 +5,7 @@
 
 #include "graph/planner/match/LabelIndexSeek.h"
 
+#include "common/utils/IndexKeyUtils.h"
 #include "graph/planner/match/MatchSolver.h"
 #include "graph/planner/plan/Query.h"
 #include "graph/util/ExpressionUtils.h"
@@ -213,7 +214,7 @@ StatusOr<SubPlan> LabelIndexSeek::transformEdge(EdgeContext* edgeCtx) {
     auto tagId = nodeCtx->scanInfo.schemaIds[i];
     std::shared_ptr<meta::cpp2::IndexItem> candidateIndex{nullptr};
     for (const auto& index : tagIndexes) {
-      if (index->get_schema_id().get_tag_id() == tagId) {
+      if (index->get_schema_id().get_tag_id() == tagId && !IndexKeyUtils::isVectorIndex(*index)) {
         if (candidateIndex == nullptr) {
           candidateIndex = index;
         } else {
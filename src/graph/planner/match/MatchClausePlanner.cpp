@@ -5,28 +5,109 @@
 
 #include "graph/planner/match/MatchClausePlanner.h"
 
+#include <cmath>
+#include <numeric>
+
 #include "graph/context/ast/CypherAstContext.h"
 #include "graph/planner/match/MatchPathPlanner.h"
 #include "graph/planner/match/SegmentsConnector.h"
 #include "graph/planner/match/ShortestPathPlanner.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/CardinalityEstimator.h"
 #include "graph/util/ExpressionUtils.h"
 
 namespace nebula {
 namespace graph {
 
+using AliasesMap = std::unordered_map<std::string, AliasType>;
+
+static double edgeDegree(const EdgeInfo& edge, const CardinalityEstimator& estimator) {
+  auto degree = estimator.avgDegree(edge.edgeTypes, storage::cpp2::EdgeDirection::OUT_EDGE);
+  return edge.direction == MatchEdge::Direction::BOTH ? 2 * degree : degree;
+}
+
+static double nodeRows(const NodeInfo& node,
+                       const CardinalityEstimator& estimator,
+                       const AliasesMap& aliasesAvailable) {
+  // The node is bound by the input row
+  if (aliasesAvailable.find(node.alias) != aliasesAvailable.end()) {
+    return 1.0;
+  }
+  return std::max(1.0, estimator.scanRows(node.tids, false, node.filter));
+}
+
+// Rows of matching the path from its most selective node
+static double pathRows(const Path& path,
+                       const CardinalityEstimator& estimator,
+                       const AliasesMap& aliasesAvailable) {
+  double rows = std::numeric_limits<double>::max();
+  for (const auto& node : path.nodeInfos) {
+    rows = std::min(rows, nodeRows(node, estimator, aliasesAvailable));
+  }
+  for (const auto& edge : path.edgeInfos) {
+    size_t hops = edge.range == nullptr ? 1 : std::max<size_t>(edge.range->min(), 1);
+    rows *= std::pow(edgeDegree(edge, estimator), hops);
+  }
+  return std::max(rows, 1.0);
+}
+
+// Sum of the rows of the intermediate results when joining the paths pairwise in the order
+static double pairwiseJoinRows(const std::vector<Path>& paths,
+                               const std::vector<size_t>& order,
+                               const CardinalityEstimator& estimator,
+                               const AliasesMap& aliasesAvailable) {
+  double total = 0.0;
+  double rows = 0.0;
+  std::unordered_set<std::string> joined;
+  for (size_t i = 0; i < order.size(); ++i) {
+    const auto& path = paths[order[i]];
+    double rhs = pathRows(path, estimator, aliasesAvailable);
+    if (i == 0) {
+      rows = rhs;
+    } else {
+      std::unordered_set<std::string> shared;
+      for (const auto& node : path.nodeInfos) {
+        if (!node.anonymous && joined.find(node.alias) != joined.end()) {
+          shared.emplace(node.alias);
+        }
+      }
+      rows = rows * rhs / std::pow(estimator.numVertices(), shared.size());
+    }
+    total += rows;
+    for (const auto& node : path.nodeInfos) {
+      if (!node.anonymous) {
+        joined.emplace(node.alias);
+      }
+    }
+  }
+  return total;
+}
+
 StatusOr<SubPlan> MatchClausePlanner::transform(CypherClauseContextBase* clauseCtx) {
   if (clauseCtx->kind != CypherClauseKind::kMatch) {
     return Status::Error("Not a valid context for MatchClausePlanner.");
   }
 
   auto* matchClauseCtx = static_cast<MatchClauseContext*>(clauseCtx);
+  CardinalityEstimator estimator(matchClauseCtx->qctx, matchClauseCtx->space.id);
+  auto order = joinOrder(matchClauseCtx, estimator);
+  if (useMultiwayJoin(matchClauseCtx, estimator, order)) {
+    auto multiwayPlan = multiwayJoin(matchClauseCtx, estimator);
+    if (multiwayPlan.ok()) {
+      return multiwayPlan;
+    }
+    VLOG(1) << "Join the paths pairwise since " << multiwayPlan.status();
+  }
+
   SubPlan matchClausePlan;
   // All nodes ever seen in current match clause
   std::unordered_set<std::string> nodeAliasesSeen;
   // TODO: Maybe it is better to rebuild the graph and find all connected components.
   auto& pathInfos = matchClauseCtx->paths;
-  for (auto iter = pathInfos.begin(); iter < pathInfos.end(); ++iter) {
+  std::vector<std::vector<std::string>> pathColNames(pathInfos.size());
+  for (auto idx : order) {
+    auto iter = pathInfos.begin() + idx;
     auto& nodeInfos = iter->nodeInfos;
     SubPlan pathPlan;
     if (iter->pathType == Path::PathType::kDefault) {
@@ -40,12 +121,291 @@ StatusOr<SubPlan> MatchClausePlanner::transform(CypherClauseContextBase* clauseC
       NG_RETURN_IF_ERROR(result);
       pathPlan = std::move(result).value();
     }
+    pathColNames[idx] = pathPlan.root->colNames();
     NG_RETURN_IF_ERROR(
         connectPathPlan(nodeInfos, matchClauseCtx, pathPlan, nodeAliasesSeen, matchClausePlan));
   }
+
+  // Keep the columns in the textual order of the paths if they are joined in another order
+  std::vector<std::string> colNames;
+  for (const auto& cols : pathColNames) {
+    for (const auto& col : cols) {
+      if (std::find(colNames.begin(), colNames.end(), col) == colNames.end()) {
+        colNames.emplace_back(col);
+      }
+    }
+  }
+  if (matchClausePlan.root != nullptr && matchClausePlan.root->colNames() != colNames) {
+    auto* pool = matchClauseCtx->qctx->objPool();
+    auto* columns = pool->makeAndAdd<YieldColumns>();
+    for (const auto& col : colNames) {
+      columns->addColumn(new YieldColumn(InputPropertyExpression::make(pool, col), col));
+    }
+    auto* project = Project::make(matchClauseCtx->qctx, matchClausePlan.root, columns);
+    project->setColNames(std::move(colNames));
+    matchClausePlan.root = project;
+  }
   return matchClausePlan;
 }
 
+std::vector<size_t> MatchClausePlanner::joinOrder(MatchClauseContext* matchClauseCtx,
+                                                  const CardinalityEstimator& estimator) const {
+  const auto& paths = matchClauseCtx->paths;
+  std::vector<size_t> order(paths.size());
+  std::iota(order.begin(), order.end(), 0);
+  bool costBased = FLAGS_enable_optimizer_cost_model && estimator.hasStats();
+  if (!costBased || paths.size() < 2 ||
+      std::any_of(paths.begin(), paths.end(), [](const auto& path) {
+        return path.pathType != Path::PathType::kDefault;
+      })) {
+    return order;
+  }
+
+  std::vector<double> rows;
+  for (const auto& path : paths) {
+    rows.emplace_back(pathRows(path, estimator, matchClauseCtx->aliasesAvailable));
+  }
+  auto connected = [&paths](size_t idx, const std::unordered_set<std::string>& joined) {
+    const auto& nodeInfos = paths[idx].nodeInfos;
+    return std::any_of(nodeInfos.begin(), nodeInfos.end(), [&joined](const auto& node) {
+      return !node.anonymous && joined.find(node.alias) != joined.end();
+    });
+  };
+
+  order.clear();
+  std::vector<bool> chosen(paths.size(), false);
+  std::unordered_set<std::string> joined;
+  while (order.size() < paths.size()) {
+    // The former path wins when the estimations are equal
+    size_t best = paths.size();
+    bool bestConnected = false;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      if (chosen[i]) {
+        continue;
+      }
+      bool isConnected = connected(i, joined);
+      if (best == paths.size() || (isConnected && !bestConnected) ||
+          (isConnected == bestConnected && rows[i] < rows[best])) {
+        best = i;
+        bestConnected = isConnected;
+      }
+    }
+    chosen[best] = true;
+    order.emplace_back(best);
+    for (const auto& node : paths[best].nodeInfos) {
+      if (!node.anonymous) {
+        joined.emplace(node.alias);
+      }
+    }
+  }
+  VLOG(1) << "Join order of paths: " << folly::join(",", order);
+  return order;
+}
+
+bool MatchClausePlanner::useMultiwayJoin(MatchClauseContext* matchClauseCtx,
+                                         const CardinalityEstimator& estimator,
+                                         const std::vector<size_t>& order) const {
+  // The plan is chosen by the estimated rows, which make no sense without statistics
+  if (!FLAGS_enable_multiway_join || !estimator.hasStats()) {
+    return false;
+  }
+  const auto& paths = matchClauseCtx->paths;
+  const auto& aliasesAvailable = matchClauseCtx->aliasesAvailable;
+  auto isAvailable = [&aliasesAvailable](const std::string& alias) {
+    return aliasesAvailable.find(alias) != aliasesAvailable.end();
+  };
+
+  // Find the cycle by union-find over the nodes
+  std::unordered_map<std::string, std::string> parents;
+  auto root = [&parents](std::string alias) {
+    for (auto iter = parents.find(alias); iter != parents.end(); iter = parents.find(alias)) {
+      alias = iter->second;
+    }
+    return alias;
+  };
+  bool cyclic = false;
+  double multiwayRows = 0.0;
+  for (const auto& path : paths) {
+    // Only the single hop edges without path built could be matched separately
+    if (path.pathType != Path::PathType::kDefault || path.genPath || path.isPred ||
+        path.rollUpApply) {
+      return false;
+    }
+    const auto& nodeInfos = path.nodeInfos;
+    for (const auto& node : nodeInfos) {
+      if (isAvailable(node.alias)) {
+        return false;
+      }
+    }
+    for (size_t i = 0; i < path.edgeInfos.size(); ++i) {
+      const auto& edge = path.edgeInfos[i];
+      if (edge.range != nullptr || isAvailable(edge.alias)) {
+        return false;
+      }
+      multiwayRows += std::min(nodeRows(nodeInfos[i], estimator, aliasesAvailable),
+                               nodeRows(nodeInfos[i + 1], estimator, aliasesAvailable)) *
+                      edgeDegree(edge, estimator);
+      auto src = root(nodeInfos[i].alias);
+      auto dst = root(nodeInfos[i + 1].alias);
+      if (src == dst) {
+        cyclic = cyclic || nodeInfos[i].alias != nodeInfos[i + 1].alias;
+        continue;
+      }
+      parents[src] = dst;
+    }
+  }
+  if (!cyclic) {
+    return false;
+  }
+
+  auto pairwiseRows = pairwiseJoinRows(paths, order, estimator, aliasesAvailable);
+  VLOG(1) << "Estimated rows of multiway join: " << multiwayRows
+          << ", pairwise join: " << pairwiseRows;
+  return multiwayRows < pairwiseRows;
+}
+
+StatusOr<SubPlan> MatchClausePlanner::multiwayJoin(MatchClauseContext* matchClauseCtx,
+                                                   const CardinalityEstimator& estimator) const {
+  auto* qctx = matchClauseCtx->qctx;
+  auto* pool = qctx->objPool();
+  const auto& paths = matchClauseCtx->paths;
+
+  // Each edge is matched with its two nodes as a relation, all the nodes and edges are kept in
+  // the result for joining.
+  std::vector<Path> relations;
+  for (const auto& path : paths) {
+    for (size_t i = 0; i < path.edgeInfos.size(); ++i) {
+      Path relation;
+      relation.genPath = false;
+      for (auto j : {i, i + 1}) {
+        auto node = path.nodeInfos[j];
+        node.anonymous = false;
+        relation.nodeInfos.emplace_back(std::move(node));
+      }
+      const auto& edge = path.edgeInfos[i];
+      EdgeInfo edgeInfo;
+      edgeInfo.edgeTypes = edge.edgeTypes;
+      edgeInfo.direction = edge.direction;
+      edgeInfo.types = edge.types;
+      edgeInfo.alias = edge.alias;
+      edgeInfo.innerAlias = edge.innerAlias;
+      edgeInfo.props = edge.props;
+      edgeInfo.filter = edge.filter;
+      relation.edgeInfos.emplace_back(std::move(edgeInfo));
+      relations.emplace_back(std::move(relation));
+    }
+  }
+
+  SubPlan plan;
+  std::vector<PlanNode*> inputs;
+  for (const auto& relation : relations) {
+    MatchPathPlanner matchPathPlanner(matchClauseCtx, relation);
+    auto result = matchPathPlanner.transform(matchClauseCtx->where.get());
+    NG_RETURN_IF_ERROR(result);
+    auto relationPlan = std::move(result).value();
+    if (plan.tail == nullptr) {
+      plan.tail = relationPlan.tail;
+    }
+    inputs.emplace_back(relationPlan.root);
+  }
+
+  // Join on the nodes shared by relations, begin with the most selective one and then always the
+  // one adjacent to the joined.
+  std::vector<std::string> candidates;
+  std::unordered_map<std::string, size_t> counts;
+  std::unordered_map<std::string, double> rows;
+  for (const auto& relation : relations) {
+    const auto& src = relation.nodeInfos.front();
+    const auto& dst = relation.nodeInfos.back();
+    for (const auto* node : {&src, &dst}) {
+      if (node == &dst && dst.alias == src.alias) {
+        continue;
+      }
+      if (++counts[node->alias] == 2) {
+        candidates.emplace_back(node->alias);
+      }
+      auto nRows = nodeRows(*node, estimator, matchClauseCtx->aliasesAvailable);
+      auto iter = rows.find(node->alias);
+      rows[node->alias] = iter == rows.end() ? nRows : std::min(iter->second, nRows);
+    }
+  }
+  std::vector<std::string> joinCols;
+  std::unordered_set<std::string> adjacent;
+  while (joinCols.size() < candidates.size()) {
+    const std::string* best = nullptr;
+    bool bestAdjacent = false;
+    for (const auto& alias : candidates) {
+      if (std::find(joinCols.begin(), joinCols.end(), alias) != joinCols.end()) {
+        continue;
+      }
+      bool isAdjacent = adjacent.find(alias) != adjacent.end();
+      if (best == nullptr || (isAdjacent && !bestAdjacent) ||
+          (isAdjacent == bestAdjacent && rows[alias] < rows[*best])) {
+        best = &alias;
+        bestAdjacent = isAdjacent;
+      }
+    }
+    joinCols.emplace_back(*best);
+    for (const auto& relation : relations) {
+      const auto& src = relation.nodeInfos.front().alias;
+      const auto& dst = relation.nodeInfos.back().alias;
+      if (src == *best || dst == *best) {
+        adjacent.emplace(src);
+        adjacent.emplace(dst);
+      }
+    }
+  }
+  VLOG(1) << "Multiway join on: " << folly::join(",", joinCols);
+  PlanNode* root = MultiwayJoin::make(qctx, inputs, std::move(joinCols));
+
+  // The edges in the same path should be different
+  std::vector<Expression*> conds;
+  std::vector<std::string> colNames;
+  auto addCol = [&colNames](const std::string& col) {
+    if (std::find(colNames.begin(), colNames.end(), col) == colNames.end()) {
+      colNames.emplace_back(col);
+    }
+  };
+  for (const auto& path : paths) {
+    const auto& edgeInfos = path.edgeInfos;
+    for (size_t i = 0; i < edgeInfos.size(); ++i) {
+      for (size_t j = i + 1; j < edgeInfos.size(); ++j) {
+        conds.emplace_back(
+            RelationalExpression::makeNE(pool,
+                                         InputPropertyExpression::make(pool, edgeInfos[i].alias),
+                                         InputPropertyExpression::make(pool, edgeInfos[j].alias)));
+      }
+    }
+    for (size_t i = 0; i < edgeInfos.size(); ++i) {
+      if (!path.nodeInfos[i].anonymous) {
+        addCol(path.nodeInfos[i].alias);
+      }
+      if (!edgeInfos[i].anonymous) {
+        addCol(edgeInfos[i].alias);
+      }
+    }
+    if (!path.nodeInfos.back().anonymous) {
+      addCol(path.nodeInfos.back().alias);
+    }
+  }
+  if (!conds.empty()) {
+    auto* cond = conds.size() == 1 ? conds.front() : ExpressionUtils::pushAnds(pool, conds);
+    auto* filter = Filter::make(qctx, root, cond);
+    filter->setColNames(root->colNames());
+    root = filter;
+  }
+
+  // Only the columns of named nodes and edges are returned as the pairwise join
+  auto* columns = pool->makeAndAdd<YieldColumns>();
+  for (const auto& col : colNames) {
+    columns->addColumn(new YieldColumn(InputPropertyExpression::make(pool, col), col));
+  }
+  auto* project = Project::make(qctx, root, columns);
+  project->setColNames(std::move(colNames));
+  plan.root = project;
+  return plan;
+}
+
 Status MatchClausePlanner::connectPathPlan(const std::vector<NodeInfo>& nodeInfos,
                                            MatchClauseContext* matchClauseCtx,
                                            const SubPlan& subplan,
@@ -10,6 +10,8 @@
 
 namespace nebula {
 namespace graph {
+class CardinalityEstimator;
+
 // The MatchClausePlanner generates plan for match clause;
 class MatchClausePlanner final : public CypherClausePlanner {
  public:
@@ -18,6 +20,21 @@ class MatchClausePlanner final : public CypherClausePlanner {
   StatusOr<SubPlan> transform(CypherClauseContextBase* clauseCtx) override;
 
  private:
+  // Order of the paths to join. Start from the path with the least estimated rows, then always
+  // join the cheapest path connected with the joined ones. The textual order is kept if there
+  // are no statistics.
+  std::vector<size_t> joinOrder(MatchClauseContext* matchClauseCtx,
+                                const CardinalityEstimator& estimator) const;
+
+  // Whether the pattern is cyclic and cheaper to match by MultiwayJoin
+  bool useMultiwayJoin(MatchClauseContext* matchClauseCtx,
+                       const CardinalityEstimator& estimator,
+                       const std::vector<size_t>& order) const;
+
+  // Match every edge of the pattern separately and then join all of them with MultiwayJoin
+  StatusOr<SubPlan> multiwayJoin(MatchClauseContext* matchClauseCtx,
+                                 const CardinalityEstimator& estimator) const;
+
   Status connectPathPlan(const std::vector<NodeInfo>& nodeInfos,
                          MatchClauseContext* matchClauseCtx,
                          const SubPlan& subplan,
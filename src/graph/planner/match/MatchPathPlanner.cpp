@@ -13,6 +13,8 @@
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/PlanNode.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/CardinalityEstimator.h"
 #include "graph/util/ExpressionUtils.h"
 #include "graph/util/SchemaUtil.h"
 #include "graph/visitor/RewriteVisitor.h"
@@ -110,8 +112,24 @@ Status MatchPathPlanner::findStarts(WhereClauseContext* bindWhereClause,
   auto* qctx = ctx_->qctx;
   const auto& nodeInfos = path_.nodeInfos;
   const auto& edgeInfos = path_.edgeInfos;
+  CardinalityEstimator estimator(qctx, spaceId);
+  bool costBased = FLAGS_enable_optimizer_cost_model && estimator.hasStats();
   // Find the start plan node
   for (auto& finder : startVidFinders) {
+    if (costBased && finder()->costBased()) {
+      NG_RETURN_IF_ERROR(findCheapestStart(finder,
+                                           estimator,
+                                           bindWhereClause,
+                                           &nodeAliasesSeen,
+                                           foundStart,
+                                           startFromEdge,
+                                           startIndex,
+                                           matchClausePlan));
+      if (foundStart) {
+        break;
+      }
+      continue;
+    }
     for (size_t i = 0; i < nodeInfos.size() && !foundStart; ++i) {
       NodeContext nodeCtx(qctx, bindWhereClause, spaceId, &nodeInfos[i]);
       nodeCtx.aliasesAvailable = &nodeAliasesSeen;
@@ -158,6 +176,66 @@ Status MatchPathPlanner::findStarts(WhereClauseContext* bindWhereClause,
   return Status::OK();
 }
 
+Status MatchPathPlanner::findCheapestStart(const StartVidFinderInstantiateFunc& finder,
+                                           const CardinalityEstimator& estimator,
+                                           WhereClauseContext* bindWhereClause,
+                                           std::unordered_set<std::string>* nodeAliasesSeen,
+                                           bool& foundStart,
+                                           bool& startFromEdge,
+                                           size_t& startIndex,
+                                           SubPlan& matchClausePlan) {
+  auto spaceId = ctx_->space.id;
+  auto* qctx = ctx_->qctx;
+  const auto& nodeInfos = path_.nodeInfos;
+  const auto& edgeInfos = path_.edgeInfos;
+
+  std::unique_ptr<StartVidFinder> bestFinder;
+  std::unique_ptr<PatternContext> bestCtx;
+  size_t bestIndex = 0;
+  double bestRows = std::numeric_limits<double>::max();
+  auto tryStart = [&](std::unique_ptr<PatternContext> patternCtx, size_t index) {
+    auto startFinder = finder();
+    if (!startFinder->match(patternCtx.get())) {
+      return;
+    }
+    const auto& scanInfo = patternCtx->scanInfo;
+    bool isEdge = patternCtx->kind == PatternKind::kEdge;
+    double rows = estimator.scanRows(scanInfo.schemaIds, isEdge, scanInfo.filter);
+    VLOG(1) << "Start candidate of " << startFinder->name() << ": " << (isEdge ? "edge " : "node ")
+            << index << ", estimated rows: " << rows;
+    if (rows < bestRows) {
+      bestRows = rows;
+      bestIndex = index;
+      bestFinder = std::move(startFinder);
+      bestCtx = std::move(patternCtx);
+    }
+  };
+
+  for (size_t i = 0; i < nodeInfos.size(); ++i) {
+    auto nodeCtx = std::make_unique<NodeContext>(qctx, bindWhereClause, spaceId, &nodeInfos[i]);
+    nodeCtx->aliasesAvailable = nodeAliasesSeen;
+    tryStart(std::move(nodeCtx), i);
+    if (i != nodeInfos.size() - 1) {
+      tryStart(std::make_unique<EdgeContext>(qctx, bindWhereClause, spaceId, &edgeInfos[i]), i);
+    }
+  }
+  if (bestCtx == nullptr) {
+    return Status::OK();
+  }
+
+  auto plan = bestFinder->transform(bestCtx.get());
+  NG_RETURN_IF_ERROR(plan);
+  matchClausePlan = std::move(plan).value();
+  startFromEdge = bestCtx->kind == PatternKind::kEdge;
+  startIndex = bestIndex;
+  foundStart = true;
+  initialExpr_ = bestCtx->initialExpr->clone();
+  VLOG(1) << "Find starts: " << startIndex << ", Pattern has " << edgeInfos.size()
+          << " edges, root: " << matchClausePlan.root->outputVar()
+          << ", colNames: " << folly::join(",", matchClausePlan.root->colNames());
+  return Status::OK();
+}
+
 Status MatchPathPlanner::expand(bool startFromEdge, size_t startIndex, SubPlan& subplan) {
   if (startFromEdge) {
     return expandFromEdge(startIndex, subplan);
@@ -5,10 +5,13 @@
 #pragma once
 
 #include "graph/planner/match/CypherClausePlanner.h"
+#include "graph/planner/match/StartVidFinder.h"
 
 namespace nebula {
 namespace graph {
 
+class CardinalityEstimator;
+
 // The MatchPathPlanner generates plan for match clause;
 class MatchPathPlanner final {
  public:
@@ -24,6 +27,17 @@ class MatchPathPlanner final {
                     size_t& startIndex,
                     SubPlan& matchClausePlan);
 
+  // Try all the nodes and edges of the path with the finder, and start from the one with the
+  // least estimated vids. The former one in the pattern wins when the estimations are equal.
+  Status findCheapestStart(const StartVidFinderInstantiateFunc& finder,
+                           const CardinalityEstimator& estimator,
+                           WhereClauseContext* bindWhereClause,
+                           std::unordered_set<std::string>* nodeAliasesSeen,
+                           bool& foundStart,
+                           bool& startFromEdge,
+                           size_t& startIndex,
+                           SubPlan& matchClausePlan);
+
   Status expand(bool startFromEdge, size_t startIndex, SubPlan& subplan);
   Status expandFromNode(size_t startIndex, SubPlan& subplan);
   Status leftExpandFromNode(size_t startIndex, SubPlan& subplan);
@@ -30,6 +30,10 @@ class PropIndexSeek final : public StartVidFinder {
     return "PropIndexSeekFinder";
   }
 
+  bool costBased() const override {
+    return true;
+  }
+
  private:
   PropIndexSeek() = default;
 };
@@ -78,6 +78,13 @@ class StartVidFinder {
 
   virtual const char* name() const = 0;
 
+  // Whether the count of vids found by this finder depends on the data distribution. For such
+  // finders the planner compares all the matched patterns by the estimated cardinality when the
+  // statistics of space are available, instead of taking the first one.
+  virtual bool costBased() const {
+    return false;
+  }
+
  protected:
   StartVidFinder() = default;
 };
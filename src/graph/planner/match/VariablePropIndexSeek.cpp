@@ -5,6 +5,7 @@
 
 #include "graph/planner/match/VariablePropIndexSeek.h"
 
+#include "common/utils/IndexKeyUtils.h"
 #include "graph/planner/match/MatchSolver.h"
 #include "graph/planner/plan/Logic.h"
 #include "graph/planner/plan/Query.h"
@@ -122,7 +123,8 @@ bool VariablePropIndexSeek::getIndexItem(const NodeContext* nodeCtx,
   std::vector<std::shared_ptr<IndexItem>> idxItemList;
   for (auto itemPtr : status.value()) {
     auto schemaId = itemPtr->get_schema_id();
-    if (schemaId.get_tag_id() == nodeCtx->info->tids.back()) {
+    if (schemaId.get_tag_id() == nodeCtx->info->tids.back() &&
+        !IndexKeyUtils::isVectorIndex(*itemPtr)) {
       const auto& fields = itemPtr->get_fields();
       if (!fields.empty() && fields.front().get_name() == propName) {
         idxItemList.push_back(itemPtr);
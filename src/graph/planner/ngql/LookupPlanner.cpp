@@ -95,6 +95,44 @@ StatusOr<SubPlan> LookupPlanner::transform(AstContext* astCtx) {
       plan.root = HashInnerJoin::make(
           qctx, fulltextIndexScan, plan.root, std::move(hashKeys), std::move(probeKeys));
     }
+  } else if (lookupCtx->isVectorIndex || lookupCtx->isGeoKnn) {
+    // The knn index scan returns the top k of each part, which are merged by TopN on distance
+    storage::cpp2::IndexQueryContext ictx;
+    ictx.index_id_ref() = lookupCtx->knnIndexId;
+    int64_t k = 0;
+    if (lookupCtx->isVectorIndex) {
+      ictx.vector_query_ref() = lookupCtx->vectorQuery;
+      k = lookupCtx->vectorQuery.get_k();
+    } else {
+      ictx.geo_knn_query_ref() = lookupCtx->geoKnnQuery;
+      k = lookupCtx->geoKnnQuery.get_k();
+    }
+    if (lookupCtx->filter) {
+      ictx.filter_ref() = Expression::encode(*lookupCtx->filter);
+    }
+    std::vector<storage::cpp2::IndexQueryContext> ictxs;
+    ictxs.emplace_back(std::move(ictx));
+    auto returnCols = lookupCtx->idxReturnCols;
+    returnCols.emplace_back(kDistance);
+    auto* tagIndexScan = TagIndexFullScan::make(qctx,
+                                                nullptr,
+                                                from,
+                                                lookupCtx->space.id,
+                                                std::move(ictxs),
+                                                std::move(returnCols),
+                                                lookupCtx->schemaId);
+    tagIndexScan->setYieldColumns(lookupCtx->yieldExpr);
+    auto colNames = lookupCtx->idxColNames;
+    colNames.emplace_back(kDistance);
+    tagIndexScan->setColNames(colNames);
+    auto* topN = TopN::make(qctx,
+                            tagIndexScan,
+                            {{colNames.size() - 1, OrderFactor::OrderType::ASCEND}},
+                            0,
+                            k);
+    topN->setColNames(std::move(colNames));
+    plan.tail = tagIndexScan;
+    plan.root = topN;
   } else {
     if (lookupCtx->isEdge) {
       auto* edgeIndexFullScan = EdgeIndexFullScan::make(qctx,
@@ -0,0 +1,68 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "graph/planner/ngql/RandomWalkPlanner.h"
+
+#include "graph/planner/plan/Algo.h"
+#include "graph/util/PlannerUtil.h"
+
+namespace nebula {
+namespace graph {
+
+std::unique_ptr<std::vector<RandomWalkPlanner::EdgeProp>> RandomWalkPlanner::buildEdgeProps() {
+  auto edgeProps = std::make_unique<std::vector<EdgeProp>>();
+  switch (walkCtx_->over.direction) {
+    case storage::cpp2::EdgeDirection::IN_EDGE: {
+      doBuildEdgeProps(edgeProps.get(), true);
+      break;
+    }
+    case storage::cpp2::EdgeDirection::OUT_EDGE: {
+      doBuildEdgeProps(edgeProps.get(), false);
+      break;
+    }
+    case storage::cpp2::EdgeDirection::BOTH: {
+      doBuildEdgeProps(edgeProps.get(), true);
+      doBuildEdgeProps(edgeProps.get(), false);
+      break;
+    }
+  }
+  return edgeProps;
+}
+
+void RandomWalkPlanner::doBuildEdgeProps(std::vector<EdgeProp>* edgeProps, bool isInEdge) {
+  for (auto edgeType : walkCtx_->over.edgeTypes) {
+    EdgeProp ep;
+    ep.type_ref() = isInEdge ? -edgeType : edgeType;
+    if (walkCtx_->weightProp.empty()) {
+      ep.props_ref() = {kDst};
+    } else {
+      ep.props_ref() = {kDst, walkCtx_->weightProp};
+    }
+    edgeProps->emplace_back(std::move(ep));
+  }
+}
+
+StatusOr<SubPlan> RandomWalkPlanner::transform(AstContext* astCtx) {
+  walkCtx_ = static_cast<RandomWalkContext*>(astCtx);
+  auto* qctx = walkCtx_->qctx;
+  std::string vidsVar;
+
+  SubPlan startPlan = PlannerUtil::buildStart(qctx, walkCtx_->from, vidsVar);
+  auto* walk = RandomWalk::make(
+      qctx, startPlan.root, walkCtx_->space.id, walkCtx_->from.src, walkCtx_->steps.steps());
+  walk->setEdgeProps(buildEdgeProps());
+  walk->setWeightProp(walkCtx_->weightProp);
+  walk->setRestart(walkCtx_->restart);
+  walk->setWalks(walkCtx_->walks);
+  walk->setInputVar(vidsVar);
+  walk->setColNames(walkCtx_->colNames);
+
+  SubPlan subPlan;
+  subPlan.root = walk;
+  subPlan.tail = startPlan.tail == nullptr ? walk : startPlan.tail;
+  return subPlan;
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,43 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef NGQL_PLANNERS_RANDOMWALKPLANNER_H
+#define NGQL_PLANNERS_RANDOMWALKPLANNER_H
+
+#include "graph/context/QueryContext.h"
+#include "graph/context/ast/QueryAstContext.h"
+#include "graph/planner/Planner.h"
+#include "graph/planner/plan/Query.h"
+
+namespace nebula {
+namespace graph {
+
+class RandomWalkPlanner final : public Planner {
+ public:
+  using EdgeProp = nebula::storage::cpp2::EdgeProp;
+
+  static std::unique_ptr<RandomWalkPlanner> make() {
+    return std::unique_ptr<RandomWalkPlanner>(new RandomWalkPlanner());
+  }
+
+  static bool match(AstContext* astCtx) {
+    return astCtx->sentence->kind() == Sentence::Kind::kRandomWalk;
+  }
+
+  StatusOr<SubPlan> transform(AstContext* astCtx) override;
+
+ private:
+  RandomWalkPlanner() = default;
+
+  std::unique_ptr<std::vector<EdgeProp>> buildEdgeProps();
+
+  void doBuildEdgeProps(std::vector<EdgeProp>* edgeProps, bool isInEdge);
+
+  RandomWalkContext* walkCtx_{nullptr};
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // NGQL_PLANNERS_RANDOMWALKPLANNER_H
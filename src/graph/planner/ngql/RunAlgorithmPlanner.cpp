@@ -0,0 +1,41 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "graph/planner/ngql/RunAlgorithmPlanner.h"
+
+#include "graph/planner/plan/Algo.h"
+
+namespace nebula {
+namespace graph {
+
+StatusOr<SubPlan> RunAlgorithmPlanner::transform(AstContext* astCtx) {
+  auto* algoCtx = static_cast<GraphAlgoContext*>(astCtx);
+  auto* qctx = algoCtx->qctx;
+
+  // The edges are always scanned from the src side, the direction is applied by the executor
+  std::vector<EdgeProp> edgeProps;
+  edgeProps.reserve(algoCtx->over.edgeTypes.size());
+  for (auto edgeType : algoCtx->over.edgeTypes) {
+    EdgeProp ep;
+    ep.type_ref() = edgeType;
+    ep.props_ref() = {kSrc, kDst};
+    edgeProps.emplace_back(std::move(ep));
+  }
+
+  auto* algo = GraphAlgo::make(qctx, nullptr, algoCtx->space.id, algoCtx->algorithm);
+  algo->setEdgeProps(std::move(edgeProps));
+  algo->setDirection(algoCtx->over.direction);
+  algo->setMaxIterations(algoCtx->maxIterations);
+  algo->setDamping(algoCtx->damping);
+  algo->setTolerance(algoCtx->tolerance);
+  algo->setColNames(algoCtx->colNames);
+
+  SubPlan subPlan;
+  subPlan.root = algo;
+  subPlan.tail = algo;
+  return subPlan;
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,35 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef NGQL_PLANNERS_RUNALGORITHMPLANNER_H
+#define NGQL_PLANNERS_RUNALGORITHMPLANNER_H
+
+#include "graph/context/QueryContext.h"
+#include "graph/context/ast/QueryAstContext.h"
+#include "graph/planner/Planner.h"
+#include "graph/planner/plan/Query.h"
+
+namespace nebula {
+namespace graph {
+
+class RunAlgorithmPlanner final : public Planner {
+ public:
+  static std::unique_ptr<RunAlgorithmPlanner> make() {
+    return std::unique_ptr<RunAlgorithmPlanner>(new RunAlgorithmPlanner());
+  }
+
+  static bool match(AstContext* astCtx) {
+    return astCtx->sentence->kind() == Sentence::Kind::kRunAlgorithm;
+  }
+
+  StatusOr<SubPlan> transform(AstContext* astCtx) override;
+
+ private:
+  RunAlgorithmPlanner() = default;
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // NGQL_PLANNERS_RUNALGORITHMPLANNER_H
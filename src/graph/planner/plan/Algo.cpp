@@ -189,5 +189,63 @@ std::unique_ptr<PlanNodeDescription> Subgraph::explain() const {
   return desc;
 }
 
+PlanNode* RandomWalk::clone() const {
+  auto* walk = RandomWalk::make(qctx_, nullptr, space_, src_->clone(), steps_);
+  walk->cloneMembers(*this);
+  return walk;
+}
+
+void RandomWalk::cloneMembers(const RandomWalk& walk) {
+  SingleInputNode::cloneMembers(walk);
+  if (walk.edgeProps_) {
+    auto edgeProps = *walk.edgeProps_;
+    setEdgeProps(std::make_unique<decltype(edgeProps)>(std::move(edgeProps)));
+  }
+  weightProp_ = walk.weightProp_;
+  restart_ = walk.restart_;
+  walks_ = walk.walks_;
+}
+
+std::unique_ptr<PlanNodeDescription> RandomWalk::explain() const {
+  auto desc = SingleInputNode::explain();
+  addDescription("src", src_ ? src_->toString() : "", desc.get());
+  addDescription("steps", folly::to<std::string>(steps_), desc.get());
+  addDescription(
+      "edgeProps", edgeProps_ ? folly::toJson(util::toJson(*edgeProps_)) : "", desc.get());
+  addDescription("weight", weightProp_, desc.get());
+  addDescription("restart", folly::to<std::string>(restart_), desc.get());
+  addDescription("walks", folly::to<std::string>(walks_), desc.get());
+  return desc;
+}
+
+PlanNode* GraphAlgo::clone() const {
+  auto* algo = GraphAlgo::make(qctx_, nullptr, space_, algorithm_);
+  algo->cloneMembers(*this);
+  return algo;
+}
+
+void GraphAlgo::cloneMembers(const GraphAlgo& algo) {
+  SingleInputNode::cloneMembers(algo);
+  edgeProps_ = algo.edgeProps_;
+  direction_ = algo.direction_;
+  maxIterations_ = algo.maxIterations_;
+  damping_ = algo.damping_;
+  tolerance_ = algo.tolerance_;
+}
+
+std::unique_ptr<PlanNodeDescription> GraphAlgo::explain() const {
+  auto desc = SingleInputNode::explain();
+  addDescription("space", folly::to<std::string>(space_), desc.get());
+  addDescription("algorithm", algorithm_, desc.get());
+  addDescription("edgeProps", folly::toJson(util::toJson(edgeProps_)), desc.get());
+  addDescription("edgeDirection", apache::thrift::util::enumNameSafe(direction_), desc.get());
+  addDescription("maxIterations", folly::to<std::string>(maxIterations_), desc.get());
+  if (algorithm_ == "pagerank") {
+    addDescription("damping", folly::to<std::string>(damping_), desc.get());
+    addDescription("tolerance", folly::to<std::string>(tolerance_), desc.get());
+  }
+  return desc;
+}
+
 }  // namespace graph
 }  // namespace nebula
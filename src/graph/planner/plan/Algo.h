@@ -490,6 +490,167 @@ class Subgraph final : public SingleInputNode {
   std::unique_ptr<std::vector<EdgeProp>> edgeProps_;
 };
 
+// Walks randomly from each of the src vertices, the walks of all the srcs move forward together,
+// one GetNeighbors request for each step.
+class RandomWalk final : public SingleInputNode {
+ public:
+  static RandomWalk* make(QueryContext* qctx,
+                          PlanNode* input,
+                          GraphSpaceID space,
+                          Expression* src,
+                          size_t steps) {
+    return qctx->objPool()->makeAndAdd<RandomWalk>(qctx, input, space, DCHECK_NOTNULL(src), steps);
+  }
+
+  GraphSpaceID space() const {
+    return space_;
+  }
+
+  Expression* src() const {
+    return src_;
+  }
+
+  size_t steps() const {
+    return steps_;
+  }
+
+  const std::vector<EdgeProp>* edgeProps() const {
+    return edgeProps_.get();
+  }
+
+  // Empty if the next vertex is chosen uniformly
+  const std::string& weightProp() const {
+    return weightProp_;
+  }
+
+  double restart() const {
+    return restart_;
+  }
+
+  size_t walks() const {
+    return walks_;
+  }
+
+  void setEdgeProps(std::unique_ptr<std::vector<EdgeProp>> edgeProps) {
+    edgeProps_ = std::move(edgeProps);
+  }
+
+  void setWeightProp(std::string prop) {
+    weightProp_ = std::move(prop);
+  }
+
+  void setRestart(double restart) {
+    restart_ = restart;
+  }
+
+  void setWalks(size_t walks) {
+    walks_ = walks;
+  }
+
+  PlanNode* clone() const override;
+
+  std::unique_ptr<PlanNodeDescription> explain() const override;
+
+ private:
+  friend ObjectPool;
+  RandomWalk(QueryContext* qctx, PlanNode* input, GraphSpaceID space, Expression* src, size_t steps)
+      : SingleInputNode(qctx, Kind::kRandomWalk, input), space_(space), src_(src), steps_(steps) {}
+
+  void cloneMembers(const RandomWalk&);
+
+  GraphSpaceID space_;
+  Expression* src_{nullptr};
+  size_t steps_{1};
+  std::unique_ptr<std::vector<EdgeProp>> edgeProps_;
+  std::string weightProp_;
+  double restart_{0.0};
+  size_t walks_{1};
+};
+
+// Runs an iterative graph algorithm over all the edges of the given types in the space, the
+// edges are scanned from all the partitions and kept in graphd as compact adjacency arrays.
+class GraphAlgo final : public SingleInputNode {
+ public:
+  static GraphAlgo* make(QueryContext* qctx,
+                         PlanNode* input,
+                         GraphSpaceID space,
+                         std::string algorithm) {
+    return qctx->objPool()->makeAndAdd<GraphAlgo>(qctx, input, space, std::move(algorithm));
+  }
+
+  GraphSpaceID space() const {
+    return space_;
+  }
+
+  // One of pagerank, wcc and lpa
+  const std::string& algorithm() const {
+    return algorithm_;
+  }
+
+  // The src and dst of each edge type to scan
+  const std::vector<EdgeProp>& edgeProps() const {
+    return edgeProps_;
+  }
+
+  // The direction to follow, only matters for pagerank, the others take the graph as undirected
+  storage::cpp2::EdgeDirection direction() const {
+    return direction_;
+  }
+
+  size_t maxIterations() const {
+    return maxIterations_;
+  }
+
+  double damping() const {
+    return damping_;
+  }
+
+  double tolerance() const {
+    return tolerance_;
+  }
+
+  void setEdgeProps(std::vector<EdgeProp> edgeProps) {
+    edgeProps_ = std::move(edgeProps);
+  }
+
+  void setDirection(storage::cpp2::EdgeDirection direction) {
+    direction_ = direction;
+  }
+
+  void setMaxIterations(size_t maxIterations) {
+    maxIterations_ = maxIterations;
+  }
+
+  void setDamping(double damping) {
+    damping_ = damping;
+  }
+
+  void setTolerance(double tolerance) {
+    tolerance_ = tolerance;
+  }
+
+  PlanNode* clone() const override;
+
+  std::unique_ptr<PlanNodeDescription> explain() const override;
+
+ private:
+  friend ObjectPool;
+  GraphAlgo(QueryContext* qctx, PlanNode* input, GraphSpaceID space, std::string algorithm)
+      : SingleInputNode(qctx, Kind::kGraphAlgo, input),
+        space_(space),
+        algorithm_(std::move(algorithm)) {}
+
+  void cloneMembers(const GraphAlgo&);
+
+  GraphSpaceID space_;
+  std::string algorithm_;
+  std::vector<EdgeProp> edgeProps_;
+  storage::cpp2::EdgeDirection direction_{storage::cpp2::EdgeDirection::OUT_EDGE};
+  size_t maxIterations_{20};
+  double damping_{0.85};
+  double tolerance_{1e-6};
+};
+
 }  // namespace graph
 }  // namespace nebula
 #endif  // GRAPH_PLANNER_PLAN_ALGO_H_
@@ -245,6 +245,10 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
       return "CartesianProduct";
     case Kind::kSubgraph:
       return "Subgraph";
+    case Kind::kRandomWalk:
+      return "RandomWalk";
+    case Kind::kGraphAlgo:
+      return "GraphAlgo";
     case Kind::kAddHosts:
       return "AddHosts";
     case Kind::kDropHosts:
@@ -301,6 +305,8 @@ const char* PlanNode::toString(PlanNode::Kind kind) {
       return "HashInnerJoin";
     case Kind::kCrossJoin:
       return "CrossJoin";
+    case Kind::kMultiwayJoin:
+      return "MultiwayJoin";
     case Kind::kShortestPath:
       return "ShortestPath";
     case Kind::kArgument:
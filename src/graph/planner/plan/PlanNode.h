@@ -68,11 +68,14 @@ class PlanNode {
     kAllPaths,
     kCartesianProduct,
     kSubgraph,
+    kRandomWalk,
+    kGraphAlgo,
     kDataCollect,
     kInnerJoin,
     kHashLeftJoin,
     kHashInnerJoin,
     kCrossJoin,
+    kMultiwayJoin,
     kRollUpApply,
     kPatternApply,
     kArgument,
@@ -222,8 +225,14 @@ class PlanNode {
     return numDeps() == 1U;
   }
 
+  // MultiwayJoin and the PassThrough joining the concurrent statements have any number of
+  // independent inputs, so they're not binary input nodes even if they have two.
+  bool isMultiInput() const {
+    return kind_ == Kind::kMultiwayJoin || (kind_ == Kind::kPassThrough && numDeps() > 1U);
+  }
+
   bool isBiInput() const {
-    return numDeps() == 2U;
+    return numDeps() == 2U && !isMultiInput();
   }
 
   void setOutputVar(const std::string& var);
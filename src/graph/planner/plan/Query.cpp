@@ -842,6 +842,9 @@ void Traverse::cloneMembers(const Traverse& g) {
     setTagFilter(g.tagFilter_->clone());
   }
   genPath_ = g.genPath();
+  if (g.runtimeFilterKey_ != nullptr) {
+    setRuntimeFilter(g.runtimeFilterVar_, g.runtimeFilterKey_->clone());
+  }
 }
 
 std::unique_ptr<PlanNodeDescription> Traverse::explain() const {
@@ -854,6 +857,11 @@ std::unique_ptr<PlanNodeDescription> Traverse::explain() const {
                  firstStepFilter_ != nullptr ? firstStepFilter_->toString() : "",
                  desc.get());
   addDescription("tag filter", tagFilter_ != nullptr ? tagFilter_->toString() : "", desc.get());
+  if (hasRuntimeFilter()) {
+    addDescription("runtime filter",
+                   folly::sformat("{} IN ${}", runtimeFilterKey_->toString(), runtimeFilterVar_),
+                   desc.get());
+  }
   return desc;
 }
 
@@ -996,6 +1004,45 @@ void CrossJoin::accept(PlanNodeVisitor* visitor) {
 
 CrossJoin::CrossJoin(QueryContext* qctx) : BinaryInputNode(qctx, Kind::kCrossJoin) {}
 
+MultiwayJoin::MultiwayJoin(QueryContext* qctx,
+                           const std::vector<PlanNode*>& inputs,
+                           std::vector<std::string> joinCols)
+    : VariableDependencyNode(qctx, Kind::kMultiwayJoin), joinCols_(std::move(joinCols)) {
+  std::vector<std::string> colNames;
+  for (auto* input : inputs) {
+    addDep(input);
+    readVariable(input->outputVarPtr());
+    for (const auto& col : input->colNames()) {
+      if (std::find(colNames.begin(), colNames.end(), col) == colNames.end()) {
+        colNames.emplace_back(col);
+      }
+    }
+  }
+  setColNames(std::move(colNames));
+}
+
+std::unique_ptr<PlanNodeDescription> MultiwayJoin::explain() const {
+  auto desc = VariableDependencyNode::explain();
+  addDescription("inputVar", folly::toJson(util::toJson(inputVars_)), desc.get());
+  addDescription("joinCols", folly::toJson(util::toJson(joinCols_)), desc.get());
+  return desc;
+}
+
+PlanNode* MultiwayJoin::clone() const {
+  auto* newJoin = MultiwayJoin::make(qctx_, {}, {});
+  newJoin->cloneMembers(*this);
+  // when cloning, the number of dependencies will be lost, needs to be added manually
+  for (size_t i = 0; i < numDeps(); ++i) {
+    newJoin->addDep(nullptr);
+  }
+  return newJoin;
+}
+
+void MultiwayJoin::cloneMembers(const MultiwayJoin& l) {
+  VariableDependencyNode::cloneMembers(l);
+  joinCols_ = l.joinCols_;
+}
+
 std::unique_ptr<PlanNodeDescription> RollUpApply::explain() const {
   auto desc = BinaryInputNode::explain();
   addDescription("compareCols", folly::toJson(util::toJson(compareCols_)), desc.get());
@@ -1766,6 +1766,25 @@ class Traverse final : public GetNeighbors {
     tagFilter_ = tagFilter;
   }
 
+  // The variable of the hash join build side, the dst of edges are filtered in storage
+  // by the keys evaluated on it.
+  const std::string& runtimeFilterVar() const {
+    return runtimeFilterVar_;
+  }
+
+  Expression* runtimeFilterKey() const {
+    return runtimeFilterKey_;
+  }
+
+  bool hasRuntimeFilter() const {
+    return !runtimeFilterVar_.empty() && runtimeFilterKey_ != nullptr;
+  }
+
+  void setRuntimeFilter(const std::string& var, Expression* key) {
+    runtimeFilterVar_ = var;
+    runtimeFilterKey_ = key;
+  }
+
  private:
   friend ObjectPool;
   Traverse(QueryContext* qctx, PlanNode* input, GraphSpaceID space)
@@ -1784,6 +1803,8 @@ class Traverse final : public GetNeighbors {
   Expression* firstStepFilter_{nullptr};
   Expression* tagFilter_{nullptr};
   bool genPath_{false};
+  std::string runtimeFilterVar_;
+  Expression* runtimeFilterKey_{nullptr};
 };
 
 // Append vertices to a path.
@@ -1963,6 +1984,45 @@ class CrossJoin final : public BinaryInputNode {
   explicit CrossJoin(QueryContext* qctx);
 };
 
+// Natural join the results of all inputs at once. Rows are matched by intersecting the inputs
+// sorted by the join columns one column after another, so the cyclic patterns won't produce the
+// huge intermediate results of joining the inputs pairwise.
+class MultiwayJoin final : public VariableDependencyNode {
+ public:
+  static MultiwayJoin* make(QueryContext* qctx,
+                            const std::vector<PlanNode*>& inputs,
+                            std::vector<std::string> joinCols) {
+    return qctx->objPool()->makeAndAdd<MultiwayJoin>(qctx, inputs, std::move(joinCols));
+  }
+
+  std::vector<std::string> vars() const {
+    std::vector<std::string> vars(inputVars_.size());
+    std::transform(
+        inputVars_.begin(), inputVars_.end(), vars.begin(), [](auto& var) { return var->name; });
+    return vars;
+  }
+
+  // The columns to join on, in the order of intersection
+  const std::vector<std::string>& joinCols() const {
+    return joinCols_;
+  }
+
+  PlanNode* clone() const override;
+
+  std::unique_ptr<PlanNodeDescription> explain() const override;
+
+ private:
+  friend ObjectPool;
+  MultiwayJoin(QueryContext* qctx,
+               const std::vector<PlanNode*>& inputs,
+               std::vector<std::string> joinCols);
+
+  void cloneMembers(const MultiwayJoin&);
+
+ private:
+  std::vector<std::string> joinCols_;
+};
+
 // Roll Up Apply two results from two inputs.
 class RollUpApply : public BinaryInputNode {
  public:
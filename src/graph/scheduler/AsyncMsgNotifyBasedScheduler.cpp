@@ -5,6 +5,8 @@
 
 #include "graph/scheduler/AsyncMsgNotifyBasedScheduler.h"
 
+#include "graph/planner/plan/Query.h"
+
 DECLARE_bool(enable_lifetime_optimize);
 
 namespace nebula {
@@ -83,6 +85,34 @@ folly::Future<Status> AsyncMsgNotifyBasedScheduler::doSchedule(Executor* root) c
     }
   }
 
+  // The traverse with runtime filter waits for the build side of the join as well, it would
+  // filter by the keys not produced yet if the build side isn't scheduled together with it.
+  for (auto* exe : visited) {
+    if (exe->node()->kind() != PlanNode::Kind::kTraverse) {
+      continue;
+    }
+    auto* traverse = static_cast<const Traverse*>(exe->node());
+    if (!traverse->hasRuntimeFilter()) {
+      continue;
+    }
+    bool ordered = false;
+    const auto& writtenBy = qctx_->symTable()->getVar(traverse->runtimeFilterVar())->writtenBy;
+    for (auto& node : writtenBy) {
+      if (futureMap.find(node->id()) == futureMap.end()) {
+        continue;
+      }
+      folly::Promise<Status> p;
+      futureMap[exe->id()].emplace_back(p.getFuture());
+      promiseMap[node->id()].emplace_back(std::move(p));
+      ordered = true;
+    }
+    if (!ordered) {
+      return folly::makeFuture<Status>(
+          Status::Error("The build side of the runtime filter of `%s' is not scheduled",
+                        traverse->toString().c_str()));
+    }
+  }
+
   while (!queue2.empty()) {
     auto* exe = queue2.front();
     queue2.pop();
@@ -267,6 +297,7 @@ folly::Future<Status> AsyncMsgNotifyBasedScheduler::runExecute(Executor* executo
     folly::Future<Status> status = Status::OK();
     {
       memory::MemoryCheckGuard guard;
+      memory::MemoryScopeGuard scopeGuard(executor->memoryScope());
       status = executor->execute();
     }
     return std::move(status).thenError(folly::tag_t<std::bad_alloc>{}, [](const std::bad_alloc&) {
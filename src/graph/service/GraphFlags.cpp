@@ -62,6 +62,38 @@ DEFINE_int64(max_allowed_connections,
              "Max connections of the whole cluster");
 
 DEFINE_bool(enable_optimizer, false, "Whether to enable optimizer");
+DEFINE_bool(enable_optimizer_cost_model,
+            true,
+            "Whether to choose among the candidate plans by the cost estimated from space stats");
+DEFINE_bool(enable_multiway_join,
+            false,
+            "Whether to join the cyclic match patterns by intersecting all edges at once");
+DEFINE_bool(enable_optimizer_cse,
+            true,
+            "Whether to compute the identical sub-plans of a query only once");
+DEFINE_bool(enable_runtime_filter,
+            false,
+            "Whether to filter the probe side of hash join in storage by the keys of build side");
+DEFINE_uint32(runtime_filter_max_exact_keys,
+              1024,
+              "The max number of join keys shipped as a list, otherwise a bloom filter is shipped");
+DEFINE_uint32(runtime_filter_max_keys,
+              1000000,
+              "The max number of join keys to build a runtime filter from");
+DEFINE_uint32(max_random_walks_per_start,
+              1000,
+              "The max number of walks from each start vertex of a random walk");
+DEFINE_uint32(max_graph_algorithm_iterations,
+              1000,
+              "The max number of iterations allowed for RUN LOCAL ALGORITHM");
+DEFINE_uint64(max_graph_algorithm_edges,
+              10000000,
+              "The max number of edges loaded into the graphd by RUN LOCAL ALGORITHM, it fails "
+              "with more edges");
+DEFINE_uint32(index_skip_scan_max_ndv,
+              64,
+              "The max distinct values of the leading index field to skip scan an index, 0 to "
+              "disable skip scan");
 
 #ifndef BUILD_STANDALONE
 DEFINE_uint32(ft_request_retry_times, 3, "Retry times if fulltext request failed");
@@ -83,10 +115,32 @@ DEFINE_bool(enable_experimental_feature, false, "Whether to enable experimental
 DEFINE_bool(enable_data_balance, true, "Whether to enable data balance feature");
 
 DEFINE_int32(num_rows_to_check_memory, 1024, "number rows to check memory");
+DEFINE_int64(max_query_memory_bytes,
+             0,
+             "The max memory used by each query in bytes, the query exceeding it fails, 0 means "
+             "no limit");
 DEFINE_int32(max_sessions_per_ip_per_user,
              300,
              "Maximum number of sessions that can be created per IP and per user");
 
+DEFINE_bool(enable_bulk_insert_fast_path,
+            true,
+            "Whether to parse INSERT statements of literal values without building expressions");
+
+DEFINE_bool(enable_concurrent_statements,
+            true,
+            "Whether to run the adjacent read-only statements of a query concurrently");
+
+// The cached results of a space are invalidated only by the writes taken by this graphd, the
+// writes through other graphds are seen once the cached results expire by the ttl.
+DEFINE_bool(enable_query_result_cache, false, "Whether to cache the results of read-only queries");
+DEFINE_int32(query_result_cache_capacity_mb,
+             256,
+             "Memory budget of the query result cache in MB, evicted in LRU order");
+DEFINE_int32(query_result_cache_ttl_secs,
+             60,
+             "Seconds a cached query result is served before it expires");
+
 DEFINE_bool(optimize_appendvertices, false, "if true, return directly without go through RPC");
 
 DEFINE_uint32(num_path_thread, 10, "number of threads to build path");
@@ -110,11 +164,23 @@ DEFINE_int32(min_batch_size,
              "The min batch size for handling dataset in multi job mode, only enabled when "
              "max_job_size is greater than 1.");
 DEFINE_int32(max_job_size, 1, "The max job size in multi job mode.");
+DEFINE_uint64(loop_parallel_threshold_rows,
+              100000,
+              "The rows of one step of a path loop from which the edges are extracted in multi "
+              "job mode, only enabled when max_job_size is greater than 1.");
 
 DEFINE_bool(enable_async_gc, false, "If enable async gc.");
 DEFINE_uint32(
     gc_worker_size,
     0,
     "Background garbage clean workers, default number is 0 which means using hardware core size.");
+DEFINE_uint32(gc_chunk_rows,
+              8192,
+              "The rows of a big dataset are released by the gc workers in parallel in chunks of "
+              "this size, 0 to release them by one worker.");
+DEFINE_double(gc_urgent_memory_ratio,
+              0.8,
+              "The garbage is released immediately instead of on the next gc round once the used "
+              "ratio of the memory tracked reaches this.");
 
 DEFINE_bool(graph_use_vertex_key, false, "whether allow insert or query the vertex key");
@@ -41,6 +41,11 @@ DECLARE_string(auth_type);
 DECLARE_string(cloud_http_url);
 DECLARE_uint32(max_allowed_statements);
 DECLARE_int32(max_sessions_per_ip_per_user);
+DECLARE_bool(enable_bulk_insert_fast_path);
+DECLARE_bool(enable_concurrent_statements);
+DECLARE_bool(enable_query_result_cache);
+DECLARE_int32(query_result_cache_capacity_mb);
+DECLARE_int32(query_result_cache_ttl_secs);
 
 DECLARE_uint32(max_statements);
 // Failed login attempt
@@ -53,6 +58,16 @@ DECLARE_uint32(password_lock_time_in_secs);
 
 // Optimizer
 DECLARE_bool(enable_optimizer);
+DECLARE_bool(enable_optimizer_cost_model);
+DECLARE_bool(enable_multiway_join);
+DECLARE_bool(enable_optimizer_cse);
+DECLARE_bool(enable_runtime_filter);
+DECLARE_uint32(runtime_filter_max_exact_keys);
+DECLARE_uint32(runtime_filter_max_keys);
+DECLARE_uint32(index_skip_scan_max_ndv);
+DECLARE_uint32(max_random_walks_per_start);
+DECLARE_uint32(max_graph_algorithm_iterations);
+DECLARE_uint64(max_graph_algorithm_edges);
 DECLARE_bool(optimize_appendvertice);
 DECLARE_uint32(num_path_thread);
 
@@ -65,12 +80,16 @@ DECLARE_bool(enable_client_white_list);
 DECLARE_string(client_white_list);
 
 DECLARE_int32(num_rows_to_check_memory);
+DECLARE_int64(max_query_memory_bytes);
 
 DECLARE_int32(min_batch_size);
 DECLARE_int32(max_job_size);
+DECLARE_uint64(loop_parallel_threshold_rows);
 
 DECLARE_bool(enable_async_gc);
 DECLARE_uint32(gc_worker_size);
+DECLARE_uint32(gc_chunk_rows);
+DECLARE_double(gc_urgent_memory_ratio);
 
 DECLARE_bool(graph_use_vertex_key);
 
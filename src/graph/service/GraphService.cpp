@@ -20,6 +20,7 @@
 #include "graph/service/PasswordAuthenticator.h"
 #include "graph/service/RequestContext.h"
 #include "graph/stats/GraphStats.h"
+#include "graph/util/ArrowEncoder.h"
 #include "version/Version.h"
 
 namespace nebula {
@@ -218,6 +219,39 @@ folly::Future<std::string> GraphService::future_executeJsonWithParameter(
   });
 }
 
+folly::Future<cpp2::ExecutionArrowResponse> GraphService::future_executeArrow(
+    int64_t sessionId,
+    const std::string& query,
+    const std::unordered_map<std::string, Value>& parameterMap) {
+  return future_executeWithParameter(sessionId, query, parameterMap).thenValue([](auto&& resp) {
+    cpp2::ExecutionArrowResponse ret;
+    ret.error_code_ref() = resp.errorCode;
+    ret.latency_in_us_ref() = resp.latencyInUs;
+    if (resp.data != nullptr) {
+      auto data = ArrowEncoder::encode(*resp.data);
+      if (data.ok()) {
+        ret.data_ref() = std::move(data).value();
+      } else {
+        ret.error_code_ref() = ErrorCode::E_EXECUTION_ERROR;
+        ret.error_msg_ref() = data.status().toString();
+      }
+    }
+    if (resp.spaceName != nullptr) {
+      ret.space_name_ref() = std::move(*resp.spaceName);
+    }
+    if (resp.errorMsg != nullptr && !ret.error_msg_ref().has_value()) {
+      ret.error_msg_ref() = std::move(*resp.errorMsg);
+    }
+    if (resp.planDesc != nullptr) {
+      ret.plan_desc_ref() = std::move(*resp.planDesc);
+    }
+    if (resp.comment != nullptr) {
+      ret.comment_ref() = std::move(*resp.comment);
+    }
+    return ret;
+  });
+}
+
 Status GraphService::auth(const std::string& username, const std::string& password) {
   auto metaClient = queryEngine_->metaClient();
 
@@ -48,6 +48,11 @@ class GraphService final : public cpp2::GraphServiceSvIf {
   folly::Future<std::string> future_executeJson(int64_t sessionId,
                                                 const std::string& stmt) override;
 
+  folly::Future<cpp2::ExecutionArrowResponse> future_executeArrow(
+      int64_t sessionId,
+      const std::string& stmt,
+      const std::unordered_map<std::string, Value>& parameterMap) override;
+
   folly::Future<cpp2::VerifyClientVersionResp> future_verifyClientVersion(
       const cpp2::VerifyClientVersionReq& req) override;
 
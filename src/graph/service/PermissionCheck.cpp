@@ -143,6 +143,8 @@ namespace graph {
     case Sentence::Kind::kFetchEdges:
     case Sentence::Kind::kFindPath:
     case Sentence::Kind::kGetSubgraph:
+    case Sentence::Kind::kRandomWalk:
+    case Sentence::Kind::kRunAlgorithm:
     case Sentence::Kind::kLimit:
     case Sentence::Kind::kGroupBy:
     case Sentence::Kind::kUnwind:
@@ -41,6 +41,7 @@ Status QueryEngine::init(std::shared_ptr<folly::IOThreadPoolExecutor> ioExecutor
     rulesets.emplace_back(&opt::RuleSet::QueryRules());
   }
   optimizer_ = std::make_unique<opt::Optimizer>(rulesets);
+  resultCache_ = std::make_unique<QueryResultCache>();
 
   return setupMemoryMonitorThread();
 }
@@ -53,7 +54,7 @@ void QueryEngine::execute(RequestContextPtr rctx) {
                                              storage_.get(),
                                              metaClient_,
                                              charsetInfo_);
-  auto* instance = new QueryInstance(std::move(qctx), optimizer_.get());
+  auto* instance = new QueryInstance(std::move(qctx), optimizer_.get(), resultCache_.get());
   instance->execute();
 }
 
@@ -18,6 +18,7 @@
 #include "common/meta/SchemaManager.h"
 #include "common/network/NetworkUtils.h"
 #include "graph/optimizer/Optimizer.h"
+#include "graph/service/QueryResultCache.h"
 #include "graph/service/RequestContext.h"
 #include "interface/gen-cpp2/GraphService.h"
 
@@ -51,6 +52,7 @@ class QueryEngine final : public boost::noncopyable, public cpp::NonMovable {
   std::unique_ptr<meta::IndexManager> indexManager_;
   std::unique_ptr<storage::StorageClient> storage_;
   std::unique_ptr<opt::Optimizer> optimizer_;
+  std::unique_ptr<QueryResultCache> resultCache_;
   std::unique_ptr<thread::GenericWorker> memoryMonitorThread_;
   meta::MetaClient* metaClient_{nullptr};
   CharsetInfo* charsetInfo_{nullptr};
@@ -15,9 +15,12 @@
 #include "graph/planner/plan/PlanNode.h"
 #include "graph/scheduler/AsyncMsgNotifyBasedScheduler.h"
 #include "graph/scheduler/Scheduler.h"
+#include "graph/service/GraphFlags.h"
 #include "graph/stats/GraphStats.h"
 #include "graph/util/AstUtils.h"
+#include "graph/util/ParserUtil.h"
 #include "graph/validator/Validator.h"
+#include "parser/BulkInsertParser.h"
 #include "parser/ExplainSentence.h"
 #include "parser/Sentence.h"
 #include "parser/SequentialSentences.h"
@@ -29,21 +32,31 @@ using nebula::opt::RuleSet;
 namespace nebula {
 namespace graph {
 
-QueryInstance::QueryInstance(std::unique_ptr<QueryContext> qctx, Optimizer *optimizer) {
+QueryInstance::QueryInstance(std::unique_ptr<QueryContext> qctx,
+                             Optimizer *optimizer,
+                             QueryResultCache *resultCache) {
   qctx_ = std::move(qctx);
   optimizer_ = DCHECK_NOTNULL(optimizer);
+  resultCache_ = DCHECK_NOTNULL(resultCache);
   scheduler_ = std::make_unique<AsyncMsgNotifyBasedScheduler>(qctx_.get());
   qctx_->rctx()->session()->addQuery(qctx_.get());
 }
 
 void QueryInstance::execute() {
   try {
+    // Attributes the memory of validating and planning to the query too
+    memory::MemoryScopeGuard scopeGuard(qctx_->memoryScope());
     Status status = validateAndOptimize();
     if (!status.ok()) {
       onError(std::move(status));
       return;
     }
 
+    if (cachedResult_ != nullptr) {
+      onFinish();
+      return;
+    }
+
     // Sentence is explain query, finish
     if (!explainOrContinue()) {
       onFinish();
@@ -78,10 +91,20 @@ Status QueryInstance::validateAndOptimize() {
   auto *rctx = qctx()->rctx();
   auto &spaceName = rctx->session()->space().name;
   VLOG(1) << "Parsing query: " << rctx->query();
-  // Result of parsing, get the parsing tree
-  auto result = GQLParser(qctx()).parse(rctx->query());
-  NG_RETURN_IF_ERROR(result);
-  sentence_ = std::move(result).value();
+  // Bulk loading statements of literals skip building expressions for each value
+  if (FLAGS_enable_bulk_insert_fast_path) {
+    sentence_ = BulkInsertParser(qctx()).tryParse(rctx->query());
+  }
+  if (sentence_ == nullptr) {
+    // Result of parsing, get the parsing tree
+    auto result = GQLParser(qctx()).parse(rctx->query());
+    NG_RETURN_IF_ERROR(result);
+    sentence_ = std::move(result).value();
+  }
+  readOnly_ = ParserUtil::isReadOnly(sentence_.get());
+  mutation_ = ParserUtil::isMutation(sentence_.get());
+  writeSpace_ = rctx->session()->space().id;
+  bumpWriteVersions();
   if (sentence_->kind() == Sentence::Kind::kSequential) {
     size_t num = static_cast<const SequentialSentences *>(sentence_.get())->numSentences();
     stats::StatsManager::addValue(kNumSentences, num);
@@ -99,6 +122,10 @@ Status QueryInstance::validateAndOptimize() {
 
   // Validate the query, if failed, return
   NG_RETURN_IF_ERROR(Validator::validate(sentence_.get(), qctx()));
+  // The cached result skips both the optimization and the execution
+  if (lookupResultCache()) {
+    return Status::OK();
+  }
   // Optimize the query, and get the execution plan. We should not pass the optimizer errors to user
   // since the message is often not easy to understand. Logging them is enough.
   if (auto status = findBestPlan(); !status.ok()) {
@@ -130,6 +157,11 @@ void QueryInstance::onFinish() {
   rctx->resp().spaceName = std::make_unique<std::string>(spaceName);
 
   fillRespData(&rctx->resp());
+  auto &resp = rctx->resp();
+  if (cacheKey_ != nullptr && resp.errorCode == ErrorCode::SUCCEEDED && resp.data != nullptr) {
+    resultCache_->put(std::move(*cacheKey_), *resp.data, cacheVersion_);
+  }
+  bumpWriteVersions();
 
   auto latency = rctx->duration().elapsedInUSec();
   rctx->resp().latencyInUs = latency;
@@ -206,6 +238,8 @@ void QueryInstance::onError(Status status) {
         stats::StatsManager::counterWithLabels(kNumQueryErrors, {{"space", spaceName}}));
   }
   addSlowQueryStats(latency, spaceName);
+  // Part of the writes may have been done
+  bumpWriteVersions();
   rctx->session()->deleteQuery(qctx_.get());
   rctx->finish();
   delete this;
@@ -232,6 +266,10 @@ void QueryInstance::addSlowQueryStats(uint64_t latency, const std::string &space
 
 // Get result from query context and fill the response
 void QueryInstance::fillRespData(ExecutionResponse *resp) {
+  if (cachedResult_ != nullptr) {
+    resp->data = std::move(cachedResult_);
+    return;
+  }
   auto ectx = DCHECK_NOTNULL(qctx_->ectx());
   auto plan = DCHECK_NOTNULL(qctx_->plan());
   const auto &name = plan->root()->outputVar();
@@ -262,5 +300,40 @@ Status QueryInstance::findBestPlan() {
   return Status::OK();
 }
 
+bool QueryInstance::lookupResultCache() {
+  if (!FLAGS_enable_query_result_cache || !readOnly_ || qctx_->isNonDeterministic()) {
+    return false;
+  }
+  auto *rctx = qctx_->rctx();
+  auto session = rctx->session();
+  auto space = session->space().id;
+  int32_t role = -1;
+  if (session->isGod()) {
+    role = static_cast<int32_t>(meta::cpp2::RoleType::GOD);
+  } else if (auto ret = session->roleWithSpace(space); ret.ok()) {
+    role = static_cast<int32_t>(ret.value());
+  }
+  auto key = QueryResultCache::makeKey(space, role, rctx->query(), rctx->parameterMap());
+  cacheVersion_ = resultCache_->version(space);
+  cachedResult_ = resultCache_->get(key);
+  if (cachedResult_ != nullptr) {
+    return true;
+  }
+  cacheKey_ = std::make_unique<QueryResultCache::Key>(std::move(key));
+  return false;
+}
+
+void QueryInstance::bumpWriteVersions() {
+  if (!mutation_) {
+    return;
+  }
+  auto space = qctx_->rctx()->session()->space().id;
+  resultCache_->bumpVersion(space);
+  // Switched by USE
+  if (space != writeSpace_) {
+    resultCache_->bumpVersion(writeSpace_);
+  }
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -13,6 +13,7 @@
 #include "graph/context/QueryContext.h"
 #include "graph/optimizer/Optimizer.h"
 #include "graph/scheduler/Scheduler.h"
+#include "graph/service/QueryResultCache.h"
 #include "parser/GQLParser.h"
 
 /**
@@ -26,7 +27,9 @@ namespace graph {
 
 class QueryInstance final : public boost::noncopyable, public cpp::NonMovable {
  public:
-  QueryInstance(std::unique_ptr<QueryContext> qctx, opt::Optimizer* optimizer);
+  QueryInstance(std::unique_ptr<QueryContext> qctx,
+                opt::Optimizer* optimizer,
+                QueryResultCache* resultCache);
   ~QueryInstance() = default;
 
   // Entrance of the Validate, Optimize, Schedule, Execute process
@@ -58,10 +61,25 @@ class QueryInstance final : public boost::noncopyable, public cpp::NonMovable {
   void fillRespData(ExecutionResponse* resp);
   Status findBestPlan();
 
+  // Returns true if the result of the query is found in the result cache.
+  bool lookupResultCache();
+  // Invalidates the cached results of the spaces the query may have written.
+  void bumpWriteVersions();
+
   std::unique_ptr<Sentence> sentence_;
   std::unique_ptr<QueryContext> qctx_;
   std::unique_ptr<Scheduler> scheduler_;
   opt::Optimizer* optimizer_{nullptr};
+  QueryResultCache* resultCache_{nullptr};
+  // The result of a read-only query is cacheable
+  bool readOnly_{true};
+  // A mutation invalidates the cached results of the space
+  bool mutation_{false};
+  GraphSpaceID writeSpace_{kInvalidSpaceID};
+  // Set if the result of the query is to be cached
+  std::unique_ptr<QueryResultCache::Key> cacheKey_;
+  uint64_t cacheVersion_{0};
+  std::unique_ptr<DataSet> cachedResult_;
 };
 
 }  // namespace graph
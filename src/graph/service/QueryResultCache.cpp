@@ -0,0 +1,172 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/service/QueryResultCache.h"
+
+#include "common/stats/StatsManager.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/stats/GraphStats.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// A rough estimation of the memory held by the value, the strings dominate most of results.
+std::size_t valueSize(const Value& value) {
+  std::size_t size = sizeof(Value);
+  switch (value.type()) {
+    case Value::Type::STRING:
+      size += value.getStr().size();
+      break;
+    case Value::Type::LIST:
+      for (const auto& v : value.getList().values) {
+        size += valueSize(v);
+      }
+      break;
+    case Value::Type::SET:
+      for (const auto& v : value.getSet().values) {
+        size += valueSize(v);
+      }
+      break;
+    case Value::Type::MAP:
+      for (const auto& kv : value.getMap().kvs) {
+        size += kv.first.size() + valueSize(kv.second);
+      }
+      break;
+    case Value::Type::VERTEX:
+    case Value::Type::EDGE:
+    case Value::Type::PATH:
+    case Value::Type::DATASET:
+    case Value::Type::GEOGRAPHY:
+      size += value.toString().size();
+      break;
+    default:
+      break;
+  }
+  return size;
+}
+
+}  // namespace
+
+std::size_t QueryResultCache::KeyHash::operator()(const Key& key) const {
+  auto hash = folly::hash::hash_combine(key.space, key.role, key.stmt);
+  for (const auto& param : key.params) {
+    hash = folly::hash::hash_combine(hash, param.first, param.second);
+  }
+  return hash;
+}
+
+// static
+QueryResultCache::Key QueryResultCache::makeKey(
+    GraphSpaceID space,
+    int32_t role,
+    std::string stmt,
+    const std::unordered_map<std::string, Value>& params) {
+  Key key{space, role, std::move(stmt), {params.begin(), params.end()}};
+  std::sort(key.params.begin(), key.params.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first < rhs.first;
+  });
+  return key;
+}
+
+uint64_t QueryResultCache::version(GraphSpaceID space) const {
+  std::lock_guard<std::mutex> lck(lock_);
+  return versionOf(space);
+}
+
+void QueryResultCache::bumpVersion(GraphSpaceID space) {
+  std::lock_guard<std::mutex> lck(lock_);
+  // The stale entries are left to get() or the eviction
+  ++versions_[space];
+}
+
+std::unique_ptr<DataSet> QueryResultCache::get(const Key& key) {
+  std::lock_guard<std::mutex> lck(lock_);
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    stats::StatsManager::addValue(kNumQueryResultCacheMisses);
+    return nullptr;
+  }
+  auto iter = found->second;
+  if (iter->version != versionOf(key.space) ||
+      iter->age.elapsedInSec() >= static_cast<uint64_t>(FLAGS_query_result_cache_ttl_secs)) {
+    erase(iter);
+    stats::StatsManager::addValue(kNumQueryResultCacheMisses);
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, iter);
+  stats::StatsManager::addValue(kNumQueryResultCacheHits);
+  return std::make_unique<DataSet>(iter->result);
+}
+
+void QueryResultCache::put(Key key, const DataSet& result, uint64_t version) {
+  auto bytes = estimateSize(key, result);
+  auto cap = capacity();
+  // Don't let a single huge result flush the whole cache
+  if (bytes > cap / 4) {
+    return;
+  }
+  std::lock_guard<std::mutex> lck(lock_);
+  if (version != versionOf(key.space)) {
+    return;
+  }
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    erase(found->second);
+  }
+  while (!entries_.empty() && usedBytes_ + bytes > cap) {
+    erase(std::prev(entries_.end()));
+    stats::StatsManager::addValue(kNumQueryResultCacheEvictions);
+  }
+  entries_.emplace_front(Entry{std::move(key), result, version, bytes, time::Duration()});
+  index_.emplace(entries_.front().key, entries_.begin());
+  usedBytes_ += bytes;
+}
+
+void QueryResultCache::clear() {
+  std::lock_guard<std::mutex> lck(lock_);
+  index_.clear();
+  entries_.clear();
+  usedBytes_ = 0;
+}
+
+// static
+std::size_t QueryResultCache::estimateSize(const Key& key, const DataSet& result) {
+  // The key is stored twice, by the entry and the index
+  std::size_t size = sizeof(Entry) + 2 * (sizeof(Key) + key.stmt.size());
+  for (const auto& param : key.params) {
+    size += 2 * (param.first.size() + valueSize(param.second));
+  }
+  for (const auto& col : result.colNames) {
+    size += sizeof(std::string) + col.size();
+  }
+  for (const auto& row : result.rows) {
+    size += sizeof(Row);
+    for (const auto& value : row.values) {
+      size += valueSize(value);
+    }
+  }
+  return size;
+}
+
+// static
+std::size_t QueryResultCache::capacity() {
+  return static_cast<std::size_t>(FLAGS_query_result_cache_capacity_mb) * 1024 * 1024;
+}
+
+uint64_t QueryResultCache::versionOf(GraphSpaceID space) const {
+  auto found = versions_.find(space);
+  return found == versions_.end() ? 0 : found->second;
+}
+
+void QueryResultCache::erase(EntryList::iterator iter) {
+  usedBytes_ -= iter->bytes;
+  index_.erase(iter->key);
+  entries_.erase(iter);
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,111 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_SERVICE_QUERYRESULTCACHE_H_
+#define GRAPH_SERVICE_QUERYRESULTCACHE_H_
+
+#include <boost/core/noncopyable.hpp>
+
+#include "common/base/Base.h"
+#include "common/cpp/helpers.h"
+#include "common/datatypes/DataSet.h"
+#include "common/thrift/ThriftTypes.h"
+#include "common/time/Duration.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * QueryResultCache keeps the results of read-only queries, so that the same query sent again
+ * by the same role is answered without touching storage, e.g. the ones of dashboards.
+ *
+ * Each space has a write version, which is bumped by every query of the space that may modify it,
+ * see ParserUtil::isMutation(). A cached result is dropped once the version of its space moves on,
+ * or after FLAGS_query_result_cache_ttl_secs, which bounds the staleness caused by the writes
+ * through other graphds. The entries are evicted in LRU order to keep the total size within
+ * FLAGS_query_result_cache_capacity_mb.
+ *
+ * The hits, misses and evictions are reported by the num_query_result_cache_* stats.
+ *
+ * The results of the queries calling non-deterministic functions, e.g. rand() or now(), or
+ * sampling edges are never cached.
+ */
+class QueryResultCache final : public boost::noncopyable, public cpp::NonMovable {
+ public:
+  struct Key {
+    GraphSpaceID space;
+    // The role of the user in the space, -1 if none
+    int32_t role;
+    // The query text as sent by the client. The printed sentence is not used since it is lossy,
+    // e.g. the quotes within string literals are not escaped.
+    std::string stmt;
+    // Sorted by name
+    std::vector<std::pair<std::string, Value>> params;
+
+    bool operator==(const Key& rhs) const {
+      return space == rhs.space && role == rhs.role && stmt == rhs.stmt && params == rhs.params;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  QueryResultCache() = default;
+
+  static Key makeKey(GraphSpaceID space,
+                     int32_t role,
+                     std::string stmt,
+                     const std::unordered_map<std::string, Value>& params);
+
+  // Returns the write version of the space, to be passed to put() after the query is done.
+  uint64_t version(GraphSpaceID space) const;
+
+  // Invalidates all the results of the space.
+  void bumpVersion(GraphSpaceID space);
+
+  // Returns nullptr on miss.
+  std::unique_ptr<DataSet> get(const Key& key);
+
+  // The result is discarded if the space has been written since `version'.
+  void put(Key key, const DataSet& result, uint64_t version);
+
+  void clear();
+
+  std::size_t usedBytes() const {
+    std::lock_guard<std::mutex> lck(lock_);
+    return usedBytes_;
+  }
+
+ private:
+  struct Entry {
+    Key key;
+    DataSet result;
+    uint64_t version;
+    std::size_t bytes;
+    time::Duration age;
+  };
+  using EntryList = std::list<Entry>;
+
+  static std::size_t estimateSize(const Key& key, const DataSet& result);
+
+  static std::size_t capacity();
+
+  // Must be called with the lock held
+  uint64_t versionOf(GraphSpaceID space) const;
+  void erase(EntryList::iterator iter);
+
+  mutable std::mutex lock_;
+  // The front is the most recently used one
+  EntryList entries_;
+  std::unordered_map<Key, EntryList::iterator, KeyHash> index_;
+  std::unordered_map<GraphSpaceID, uint64_t> versions_;
+  std::size_t usedBytes_{0};
+};
+
+}  // namespace graph
+}  // namespace nebula
+
+#endif  // GRAPH_SERVICE_QUERYRESULTCACHE_H_
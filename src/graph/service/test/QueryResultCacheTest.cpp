@@ -0,0 +1,191 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "graph/optimizer/OptRule.h"
+#include "graph/optimizer/Optimizer.h"
+#include "graph/planner/PlannersRegister.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/service/QueryInstance.h"
+#include "graph/service/QueryResultCache.h"
+#include "graph/validator/test/MockIndexManager.h"
+#include "graph/validator/test/MockSchemaManager.h"
+
+namespace nebula {
+namespace graph {
+
+class QueryResultCacheTest : public ::testing::Test {
+ protected:
+  static DataSet result(const std::string& str) {
+    DataSet ds(std::vector<std::string>{"a"});
+    ds.emplace_back(Row({str}));
+    return ds;
+  }
+};
+
+TEST_F(QueryResultCacheTest, Key) {
+  QueryResultCache::KeyHash hash;
+  std::unordered_map<std::string, Value> params = {{"p1", 1}, {"p2", "a"}, {"p3", true}};
+  auto key = QueryResultCache::makeKey(1, -1, "YIELD $p1", params);
+  auto same = QueryResultCache::makeKey(1, -1, "YIELD $p1", {params.rbegin(), params.rend()});
+  EXPECT_EQ(key, same);
+  EXPECT_EQ(hash(key), hash(same));
+
+  EXPECT_FALSE(key == QueryResultCache::makeKey(2, -1, "YIELD $p1", params));
+  EXPECT_FALSE(key == QueryResultCache::makeKey(1, 3, "YIELD $p1", params));
+  EXPECT_FALSE(key == QueryResultCache::makeKey(1, -1, "YIELD $p1", {{"p1", 2}}));
+  // Printed the same from the parsed sentences
+  EXPECT_FALSE(QueryResultCache::makeKey(1, -1, R"(YIELD "a\", \"b")", {}) ==
+               QueryResultCache::makeKey(1, -1, R"(YIELD "a", "b")", {}));
+}
+
+TEST_F(QueryResultCacheTest, Version) {
+  QueryResultCache cache;
+  auto key = QueryResultCache::makeKey(1, -1, "GO FROM 1 OVER e", {});
+  auto other = QueryResultCache::makeKey(2, -1, "GO FROM 1 OVER e", {});
+  cache.put(key, result("a"), cache.version(1));
+  cache.put(other, result("b"), cache.version(2));
+  auto found = cache.get(key);
+  ASSERT_NE(nullptr, found);
+  EXPECT_EQ(result("a"), *found);
+
+  cache.bumpVersion(1);
+  EXPECT_EQ(nullptr, cache.get(key));
+  // Other spaces are not affected
+  EXPECT_NE(nullptr, cache.get(other));
+
+  // Written while the query was running
+  auto version = cache.version(1);
+  cache.bumpVersion(1);
+  cache.put(key, result("a"), version);
+  EXPECT_EQ(nullptr, cache.get(key));
+
+  cache.put(key, result("c"), cache.version(1));
+  found = cache.get(key);
+  ASSERT_NE(nullptr, found);
+  EXPECT_EQ(result("c"), *found);
+}
+
+TEST_F(QueryResultCacheTest, Ttl) {
+  gflags::FlagSaver saver;
+  FLAGS_query_result_cache_ttl_secs = 0;
+  QueryResultCache cache;
+  auto key = QueryResultCache::makeKey(1, -1, "GO FROM 1 OVER e", {});
+  cache.put(key, result("a"), cache.version(1));
+  EXPECT_EQ(nullptr, cache.get(key));
+  EXPECT_EQ(0, cache.usedBytes());
+}
+
+TEST_F(QueryResultCacheTest, Evict) {
+  gflags::FlagSaver saver;
+  FLAGS_query_result_cache_capacity_mb = 1;
+  constexpr std::size_t kCapacity = 1024 * 1024;
+  QueryResultCache cache;
+  auto key = [](int32_t i) {
+    return QueryResultCache::makeKey(1, -1, folly::stringPrintf("YIELD %d", i), {});
+  };
+  // Larger than a quarter of the capacity
+  cache.put(key(0), result(std::string(kCapacity / 4, 'x')), 0);
+  EXPECT_EQ(nullptr, cache.get(key(0)));
+  EXPECT_EQ(0, cache.usedBytes());
+
+  // Only four of them fit in
+  std::string str(kCapacity / 4 - 1024, 'x');
+  for (auto i = 1; i <= 5; ++i) {
+    cache.put(key(i), result(str), 0);
+    EXPECT_LE(cache.usedBytes(), kCapacity);
+  }
+  EXPECT_EQ(nullptr, cache.get(key(1)));
+  EXPECT_NE(nullptr, cache.get(key(2)));
+  // The least recently used one is evicted first
+  cache.put(key(6), result(str), 0);
+  EXPECT_EQ(nullptr, cache.get(key(3)));
+  for (auto i : {2, 4, 5, 6}) {
+    EXPECT_NE(nullptr, cache.get(key(i))) << i;
+  }
+
+  cache.clear();
+  EXPECT_EQ(0, cache.usedBytes());
+  EXPECT_EQ(nullptr, cache.get(key(5)));
+}
+
+class QueryInstanceCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    meta::cpp2::Session session;
+    session.session_id_ref() = 0;
+    session.user_name_ref() = "root";
+    session_ = ClientSession::create(std::move(session), nullptr);
+    SpaceInfo spaceInfo;
+    spaceInfo.name = "test_space";
+    spaceInfo.id = 1;
+    spaceInfo.spaceDesc.space_name_ref() = "test_space";
+    session_->setSpace(std::move(spaceInfo));
+    schemaMng_ = MockSchemaManager::makeUnique();
+    indexMng_ = MockIndexManager::makeUnique();
+    optimizer_ = std::make_unique<opt::Optimizer>(
+        std::vector<const opt::RuleSet*>{&opt::RuleSet::DefaultRules()});
+    PlannersRegister::registerPlanners();
+  }
+
+  ExecutionResponse run(const std::string& query) {
+    auto rctx = std::make_unique<RequestContext<ExecutionResponse>>();
+    rctx->setQuery(query);
+    rctx->setSession(session_);
+    auto future = rctx->future();
+    auto qctx = std::make_unique<QueryContext>(std::move(rctx),
+                                               schemaMng_.get(),
+                                               indexMng_.get(),
+                                               nullptr,
+                                               nullptr,
+                                               CharsetInfo::instance());
+    // Deleted by itself once finished
+    auto* instance = new QueryInstance(std::move(qctx), optimizer_.get(), &cache_);
+    instance->execute();
+    return std::move(future).get();
+  }
+
+  bool cached(const std::string& query) {
+    // The session has no role in the space
+    return cache_.get(QueryResultCache::makeKey(1, -1, query, {})) != nullptr;
+  }
+
+  std::shared_ptr<ClientSession> session_;
+  std::unique_ptr<meta::SchemaManager> schemaMng_;
+  std::unique_ptr<meta::IndexManager> indexMng_;
+  std::unique_ptr<opt::Optimizer> optimizer_;
+  QueryResultCache cache_;
+};
+
+TEST_F(QueryInstanceCacheTest, WriteInvalidatesReads) {
+  gflags::FlagSaver saver;
+  FLAGS_enable_query_result_cache = true;
+  std::string read = "YIELD 1 AS a";
+  auto resp = run(read);
+  ASSERT_EQ(ErrorCode::SUCCEEDED, resp.errorCode);
+  ASSERT_TRUE(cached(read));
+  // Answered by the cache
+  auto hit = run(read);
+  ASSERT_EQ(ErrorCode::SUCCEEDED, hit.errorCode);
+  ASSERT_NE(nullptr, hit.data);
+  EXPECT_EQ(*resp.data, *hit.data);
+
+  // Never cached
+  std::string random = "YIELD rand() AS a";
+  ASSERT_EQ(ErrorCode::SUCCEEDED, run(random).errorCode);
+  EXPECT_FALSE(cached(random));
+
+  // Not executed
+  run("EXPLAIN INSERT VERTEX person(name, age) VALUES \"a\":(\"a\", 1)");
+  EXPECT_TRUE(cached(read));
+
+  // Even a failed write invalidates the results, since part of it may have been done
+  auto write = run("INSERT VERTEX no_such_tag(name) VALUES 1:(\"a\")");
+  ASSERT_NE(ErrorCode::SUCCEEDED, write.errorCode);
+  EXPECT_FALSE(cached(read));
+}
+
+}  // namespace graph
+}  // namespace nebula
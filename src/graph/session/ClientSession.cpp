@@ -47,6 +47,18 @@ void ClientSession::addQuery(QueryContext* qctx) {
   session_.queries_ref()->emplace(epId, std::move(queryDesc));
 }
 
+meta::cpp2::Session ClientSession::getSessionWithQueryStats() const {
+  folly::RWSpinLock::ReadHolder rHolder(rwSpinLock_);
+  auto session = session_;
+  for (auto& query : *session.queries_ref()) {
+    auto context = contexts_.find(query.first);
+    if (context != contexts_.end() && context->second->memoryScope() != nullptr) {
+      query.second.peak_memory_ref() = context->second->memoryScope()->peak();
+    }
+  }
+  return session;
+}
+
 void ClientSession::deleteQuery(QueryContext* qctx) {
   auto epId = qctx->plan()->id();
   VLOG(1) << "Delete query, epId: " << epId;
@@ -136,6 +136,9 @@ class ClientSession final {
     return session_;
   }
 
+  // Returns a copy of the session, with the peak memory of the running queries filled.
+  meta::cpp2::Session getSessionWithQueryStats() const;
+
   void updateSpaceName(const std::string& spaceName) {
     folly::RWSpinLock::WriteHolder wHolder(rwSpinLock_);
     session_.space_name_ref() = spaceName;
@@ -238,7 +238,7 @@ void GraphSessionManager::updateSessionsToMeta() {
 
     for (auto& ses : activeSessions_) {
       VLOG(3) << "Add Update session id: " << ses.second->getSession().get_session_id();
-      auto sessionCopy = ses.second->getSession();
+      auto sessionCopy = ses.second->getSessionWithQueryStats();
       for (auto& query : *sessionCopy.queries_ref()) {
         query.second.duration_ref() =
             time::WallClock::fastNowInMicroSec() - query.second.get_start_time();
@@ -30,6 +30,10 @@ stats::CounterId kNumQueriesHitMemoryWatermark;
 
 stats::CounterId kOptimizerLatencyUs;
 
+stats::CounterId kNumQueryResultCacheHits;
+stats::CounterId kNumQueryResultCacheMisses;
+stats::CounterId kNumQueryResultCacheEvictions;
+
 stats::CounterId kNumAggregateExecutors;
 stats::CounterId kNumSortExecutors;
 stats::CounterId kNumLimitExecutors;
@@ -62,6 +66,13 @@ void initGraphStats() {
   kOptimizerLatencyUs = stats::StatsManager::registerHisto(
       "optimizer_latency_us", 1000, 0, 2000, "avg, p75, p95, p99, p999");
 
+  kNumQueryResultCacheHits =
+      stats::StatsManager::registerStats("num_query_result_cache_hits", "rate, sum");
+  kNumQueryResultCacheMisses =
+      stats::StatsManager::registerStats("num_query_result_cache_misses", "rate, sum");
+  kNumQueryResultCacheEvictions =
+      stats::StatsManager::registerStats("num_query_result_cache_evictions", "rate, sum");
+
   kNumAggregateExecutors =
       stats::StatsManager::registerStats("num_aggregate_executors", "rate, sum");
   kNumSortExecutors = stats::StatsManager::registerStats("num_sort_executors", "rate, sum");
@@ -30,6 +30,11 @@ extern stats::CounterId kNumQueriesHitMemoryWatermark;
 
 extern stats::CounterId kOptimizerLatencyUs;
 
+// Query result cache
+extern stats::CounterId kNumQueryResultCacheHits;
+extern stats::CounterId kNumQueryResultCacheMisses;
+extern stats::CounterId kNumQueryResultCacheEvictions;
+
 // Executor
 extern stats::CounterId kNumAggregateExecutors;
 extern stats::CounterId kNumSortExecutors;
@@ -0,0 +1,856 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/util/ArrowEncoder.h"
+
+#include "common/datatypes/Edge.h"
+#include "common/datatypes/List.h"
+#include "common/datatypes/Set.h"
+#include "common/datatypes/Vertex.h"
+#include "common/time/TimeConversion.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+// The values of the enums and unions in format/Schema.fbs and format/Message.fbs of arrow
+enum class ArrowType : uint8_t {
+  kNull = 1,
+  kInt = 2,
+  kFloatingPoint = 3,
+  kUtf8 = 5,
+  kBool = 6,
+  kDate = 8,
+  kTime = 9,
+  kTimestamp = 10,
+  kList = 12,
+  kStruct = 13,
+};
+
+constexpr uint8_t kHeaderSchema = 1;
+constexpr uint8_t kHeaderDictionaryBatch = 2;
+constexpr uint8_t kHeaderRecordBatch = 3;
+constexpr int16_t kMetadataV5 = 4;
+constexpr int16_t kPrecisionDouble = 2;
+constexpr int16_t kDateUnitDay = 0;
+constexpr int16_t kTimeUnitMicrosecond = 2;
+constexpr uint32_t kContinuation = 0xFFFFFFFF;
+// The custom metadata of the fields whose values are encoded as Value::toString()
+constexpr char kEncodingKey[] = "nebula.encoding";
+constexpr char kTextEncoding[] = "text";
+
+size_t alignUp(size_t size, size_t align) {
+  return (size + align - 1) / align * align;
+}
+
+template <typename T>
+void append(std::string* buf, T value) {
+  buf->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void pad(std::string* buf, size_t align) {
+  buf->resize(alignUp(buf->size(), align), '\0');
+}
+
+// A minimal flatbuffers writer. The objects are laid out front to back, i.e. a table is written
+// before the objects it refers to, and its offset fields are patched once they are written.
+class FlatBufferWriter {
+ public:
+  // Writes an object and returns its position
+  using ObjectWriter = std::function<size_t(FlatBufferWriter&)>;
+
+  class Table {
+   public:
+    template <typename T>
+    Table& scalar(uint16_t id, T value) {
+      Slot slot{id, std::string(), sizeof(T), nullptr};
+      append(&slot.bytes, value);
+      slots_.emplace_back(std::move(slot));
+      return *this;
+    }
+
+    Table& object(uint16_t id, ObjectWriter writer) {
+      slots_.emplace_back(Slot{id, std::string(4, '\0'), 4, std::move(writer)});
+      return *this;
+    }
+
+   private:
+    friend class FlatBufferWriter;
+
+    struct Slot {
+      uint16_t id;
+      std::string bytes;
+      size_t align;
+      ObjectWriter child;
+    };
+
+    std::vector<Slot> slots_;
+  };
+
+  std::string finish(const ObjectWriter& root) {
+    buf_.clear();
+    append<uint32_t>(&buf_, 0);
+    auto pos = root(*this);
+    patch<uint32_t>(0, pos);
+    return std::move(buf_);
+  }
+
+  size_t table(const Table& table) {
+    // Place the larger fields first to save the padding
+    std::vector<const Table::Slot*> slots;
+    for (const auto& slot : table.slots_) {
+      slots.emplace_back(&slot);
+    }
+    std::stable_sort(slots.begin(), slots.end(), [](const auto* lhs, const auto* rhs) {
+      return lhs->bytes.size() > rhs->bytes.size();
+    });
+    size_t maxAlign = 4;
+    size_t inlineSize = 4;
+    uint16_t numFields = 0;
+    std::vector<size_t> offsets;
+    for (const auto* slot : slots) {
+      inlineSize = alignUp(inlineSize, slot->align);
+      offsets.emplace_back(inlineSize);
+      inlineSize += slot->bytes.size();
+      maxAlign = std::max(maxAlign, slot->align);
+      numFields = std::max<uint16_t>(numFields, slot->id + 1);
+    }
+    inlineSize = alignUp(inlineSize, maxAlign);
+
+    // The vtable is put right before the table, which is aligned to its largest field
+    size_t vtableSize = 4 + 2 * numFields;
+    while ((buf_.size() + vtableSize) % maxAlign != 0) {
+      buf_.push_back('\0');
+    }
+    auto vtablePos = buf_.size();
+    append<uint16_t>(&buf_, vtableSize);
+    append<uint16_t>(&buf_, inlineSize);
+    std::vector<uint16_t> fieldOffsets(numFields, 0);
+    for (size_t i = 0; i < slots.size(); ++i) {
+      fieldOffsets[slots[i]->id] = offsets[i];
+    }
+    for (auto offset : fieldOffsets) {
+      append<uint16_t>(&buf_, offset);
+    }
+
+    auto tablePos = buf_.size();
+    buf_.resize(tablePos + inlineSize, '\0');
+    patch<int32_t>(tablePos, tablePos - vtablePos);
+    for (size_t i = 0; i < slots.size(); ++i) {
+      buf_.replace(tablePos + offsets[i], slots[i]->bytes.size(), slots[i]->bytes);
+    }
+    for (size_t i = 0; i < slots.size(); ++i) {
+      if (slots[i]->child != nullptr) {
+        auto fieldPos = tablePos + offsets[i];
+        auto childPos = slots[i]->child(*this);
+        patch<uint32_t>(fieldPos, childPos - fieldPos);
+      }
+    }
+    return tablePos;
+  }
+
+  size_t string(const std::string& str) {
+    pad(&buf_, 4);
+    auto pos = buf_.size();
+    append<uint32_t>(&buf_, str.size());
+    buf_.append(str);
+    buf_.push_back('\0');
+    return pos;
+  }
+
+  // The vector of the structs of two longs, i.e. FieldNode and Buffer
+  size_t structVector(const std::vector<std::pair<int64_t, int64_t>>& structs) {
+    while ((buf_.size() + 4) % 8 != 0) {
+      buf_.push_back('\0');
+    }
+    auto pos = buf_.size();
+    append<uint32_t>(&buf_, structs.size());
+    for (const auto& s : structs) {
+      append<int64_t>(&buf_, s.first);
+      append<int64_t>(&buf_, s.second);
+    }
+    return pos;
+  }
+
+  size_t tableVector(const std::vector<ObjectWriter>& writers) {
+    pad(&buf_, 4);
+    auto pos = buf_.size();
+    append<uint32_t>(&buf_, writers.size());
+    auto slotsPos = buf_.size();
+    buf_.resize(slotsPos + 4 * writers.size(), '\0');
+    for (size_t i = 0; i < writers.size(); ++i) {
+      auto slotPos = slotsPos + 4 * i;
+      auto childPos = writers[i](*this);
+      patch<uint32_t>(slotPos, childPos - slotPos);
+    }
+    return pos;
+  }
+
+ private:
+  template <typename T>
+  void patch(size_t pos, T value) {
+    std::memcpy(&buf_[pos], &value, sizeof(T));
+  }
+
+  std::string buf_;
+};
+
+using Table = FlatBufferWriter::Table;
+using ObjectWriter = FlatBufferWriter::ObjectWriter;
+
+// A column laid out in the arrow format
+struct ArrowColumn {
+  std::string name;
+  ArrowType type{ArrowType::kNull};
+  // The id of the dictionary if encoded, then the buffers are of the int32 indices
+  int64_t dictId{-1};
+  // The values are encoded as Value::toString(), since they are of mixed types or of a type
+  // without an arrow counterpart
+  bool text{false};
+  int64_t length{0};
+  int64_t nullCount{0};
+  std::vector<std::string> buffers;
+  std::vector<ArrowColumn> children;
+};
+
+ObjectWriter typeWriter(ArrowType type) {
+  return [type](FlatBufferWriter& writer) {
+    Table table;
+    switch (type) {
+      case ArrowType::kInt:
+        table.scalar<int32_t>(0, 64).scalar<uint8_t>(1, 1);
+        break;
+      case ArrowType::kFloatingPoint:
+        table.scalar<int16_t>(0, kPrecisionDouble);
+        break;
+      case ArrowType::kDate:
+        table.scalar<int16_t>(0, kDateUnitDay);
+        break;
+      case ArrowType::kTime:
+        table.scalar<int16_t>(0, kTimeUnitMicrosecond).scalar<int32_t>(1, 64);
+        break;
+      case ArrowType::kTimestamp:
+        table.scalar<int16_t>(0, kTimeUnitMicrosecond).object(1, [](FlatBufferWriter& w) {
+          return w.string("UTC");
+        });
+        break;
+      default:
+        break;
+    }
+    return writer.table(table);
+  };
+}
+
+ObjectWriter fieldWriter(const ArrowColumn& column) {
+  return [&column](FlatBufferWriter& writer) {
+    Table table;
+    table.object(0, [&column](FlatBufferWriter& w) { return w.string(column.name); })
+        .scalar<uint8_t>(1, 1)
+        .scalar<uint8_t>(2, static_cast<uint8_t>(column.type))
+        .object(3, typeWriter(column.type));
+    if (column.dictId >= 0) {
+      table.object(4, [&column](FlatBufferWriter& w) {
+        Table encoding;
+        encoding.scalar<int64_t>(0, column.dictId)
+            .object(1,
+                    [](FlatBufferWriter& iw) {
+                      Table indexType;
+                      indexType.scalar<int32_t>(0, 32).scalar<uint8_t>(1, 1);
+                      return iw.table(indexType);
+                    })
+            .scalar<uint8_t>(2, 0);
+        return w.table(encoding);
+      });
+    }
+    table.object(5, [&column](FlatBufferWriter& w) {
+      std::vector<ObjectWriter> children;
+      for (const auto& child : column.children) {
+        children.emplace_back(fieldWriter(child));
+      }
+      return w.tableVector(children);
+    });
+    if (column.text) {
+      table.object(6, [](FlatBufferWriter& w) {
+        return w.tableVector({[](FlatBufferWriter& kw) {
+          Table keyValue;
+          keyValue.object(0, [](FlatBufferWriter& sw) { return sw.string(kEncodingKey); })
+              .object(1, [](FlatBufferWriter& sw) { return sw.string(kTextEncoding); });
+          return kw.table(keyValue);
+        }});
+      });
+    }
+    return writer.table(table);
+  };
+}
+
+// Flattens the columns in pre-order into the field nodes and the buffers of a record batch
+void layoutColumn(const ArrowColumn& column,
+                  std::vector<std::pair<int64_t, int64_t>>* nodes,
+                  std::vector<std::pair<int64_t, int64_t>>* buffers,
+                  std::string* body) {
+  nodes->emplace_back(column.length, column.nullCount);
+  for (const auto& buffer : column.buffers) {
+    buffers->emplace_back(body->size(), buffer.size());
+    body->append(buffer);
+    pad(body, 8);
+  }
+  for (const auto& child : column.children) {
+    layoutColumn(child, nodes, buffers, body);
+  }
+}
+
+void appendMessage(std::string* out, const std::string& metadata, const std::string& body) {
+  append<uint32_t>(out, kContinuation);
+  append<int32_t>(out, alignUp(metadata.size(), 8));
+  out->append(metadata);
+  pad(out, 8);
+  out->append(body);
+}
+
+ObjectWriter messageWriter(uint8_t headerType, ObjectWriter header, int64_t bodyLength) {
+  return [headerType, header = std::move(header), bodyLength](FlatBufferWriter& writer) {
+    Table message;
+    message.scalar<int16_t>(0, kMetadataV5)
+        .scalar<uint8_t>(1, headerType)
+        .object(2, header)
+        .scalar<int64_t>(3, bodyLength);
+    return writer.table(message);
+  };
+}
+
+// Appends a record batch message of the columns, or a dictionary batch one if dictId >= 0
+void appendBatch(std::string* out,
+                 const std::vector<const ArrowColumn*>& columns,
+                 int64_t length,
+                 int64_t dictId) {
+  std::vector<std::pair<int64_t, int64_t>> nodes;
+  std::vector<std::pair<int64_t, int64_t>> buffers;
+  std::string body;
+  for (const auto* column : columns) {
+    layoutColumn(*column, &nodes, &buffers, &body);
+  }
+  ObjectWriter batch = [&nodes, &buffers, length](FlatBufferWriter& writer) {
+    Table table;
+    table.scalar<int64_t>(0, length)
+        .object(1, [&nodes](FlatBufferWriter& w) { return w.structVector(nodes); })
+        .object(2, [&buffers](FlatBufferWriter& w) { return w.structVector(buffers); });
+    return writer.table(table);
+  };
+  FlatBufferWriter writer;
+  std::string metadata;
+  if (dictId < 0) {
+    metadata = writer.finish(messageWriter(kHeaderRecordBatch, batch, body.size()));
+  } else {
+    ObjectWriter dictBatch = [&batch, dictId](FlatBufferWriter& w) {
+      Table table;
+      table.scalar<int64_t>(0, dictId).object(1, batch).scalar<uint8_t>(2, 0);
+      return w.table(table);
+    };
+    metadata = writer.finish(messageWriter(kHeaderDictionaryBatch, dictBatch, body.size()));
+  }
+  appendMessage(out, metadata, body);
+}
+
+void appendSchema(std::string* out, const std::vector<ArrowColumn>& columns) {
+  ObjectWriter schema = [&columns](FlatBufferWriter& writer) {
+    Table table;
+    // Little endian
+    table.scalar<int16_t>(0, 0).object(1, [&columns](FlatBufferWriter& w) {
+      std::vector<ObjectWriter> fields;
+      for (const auto& column : columns) {
+        fields.emplace_back(fieldWriter(column));
+      }
+      return w.tableVector(fields);
+    });
+    return writer.table(table);
+  };
+  FlatBufferWriter writer;
+  appendMessage(out, writer.finish(messageWriter(kHeaderSchema, schema, 0)), "");
+}
+
+// Builds the arrow columns from the values
+class ColumnBuilder {
+ public:
+  StatusOr<ArrowColumn> build(const std::string& name, const std::vector<const Value*>& values);
+
+  const std::vector<ArrowColumn>& dictionaries() const {
+    return dictionaries_;
+  }
+
+ private:
+  enum class Kind {
+    kNull,
+    kBool,
+    kInt,
+    kDouble,
+    kString,
+    kDate,
+    kTime,
+    kDateTime,
+    kList,
+    kVertex,
+    kEdge,
+    // Encoded as the string of Value::toString()
+    kText,
+  };
+
+  static bool isNull(const Value* value) {
+    return value->isNull() || value->empty();
+  }
+
+  static Kind infer(const std::vector<const Value*>& values);
+
+  // Sets the length, the null count and the validity buffer
+  static void buildValidity(const std::vector<const Value*>& values, ArrowColumn* column);
+
+  template <typename T, typename Func>
+  static void buildFixedWidth(const std::vector<const Value*>& values,
+                              Func&& get,
+                              ArrowColumn* column);
+
+  static void buildBool(const std::vector<const Value*>& values, ArrowColumn* column);
+
+  Status buildString(const std::vector<const Value*>& values, ArrowColumn* column);
+
+  Status buildList(const std::vector<const Value*>& values, ArrowColumn* column);
+
+  Status buildVertex(const std::vector<const Value*>& values, ArrowColumn* column);
+
+  Status buildEdge(const std::vector<const Value*>& values, ArrowColumn* column);
+
+  Status addChild(const std::string& name,
+                  const std::vector<const Value*>& values,
+                  ArrowColumn* column);
+
+  // Keeps the values made up during the flattening, whose addresses must be stable
+  const Value* hold(Value value) {
+    holder_.emplace_back(std::move(value));
+    return &holder_.back();
+  }
+
+  std::deque<Value> holder_;
+  std::vector<ArrowColumn> dictionaries_;
+};
+
+ColumnBuilder::Kind ColumnBuilder::infer(const std::vector<const Value*>& values) {
+  std::set<Value::Type> types;
+  for (const auto* value : values) {
+    if (isNull(value)) {
+      continue;
+    }
+    auto type = value->type();
+    types.emplace(type == Value::Type::SET ? Value::Type::LIST : type);
+    if (types.size() > 2) {
+      return Kind::kText;
+    }
+  }
+  if (types.empty()) {
+    return Kind::kNull;
+  }
+  if (types.size() == 2) {
+    return types.count(Value::Type::INT) != 0 && types.count(Value::Type::FLOAT) != 0
+               ? Kind::kDouble
+               : Kind::kText;
+  }
+  switch (*types.begin()) {
+    case Value::Type::BOOL:
+      return Kind::kBool;
+    case Value::Type::INT:
+      return Kind::kInt;
+    case Value::Type::FLOAT:
+      return Kind::kDouble;
+    case Value::Type::STRING:
+      return Kind::kString;
+    case Value::Type::DATE:
+      return Kind::kDate;
+    case Value::Type::TIME:
+      return Kind::kTime;
+    case Value::Type::DATETIME:
+      return Kind::kDateTime;
+    case Value::Type::LIST:
+      return Kind::kList;
+    case Value::Type::VERTEX:
+      return Kind::kVertex;
+    case Value::Type::EDGE:
+      return Kind::kEdge;
+    default:
+      return Kind::kText;
+  }
+}
+
+void ColumnBuilder::buildValidity(const std::vector<const Value*>& values, ArrowColumn* column) {
+  column->length = values.size();
+  column->nullCount = 0;
+  std::string validity((values.size() + 7) / 8, '\0');
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (isNull(values[i])) {
+      ++column->nullCount;
+    } else {
+      validity[i / 8] |= static_cast<char>(1 << (i % 8));
+    }
+  }
+  // The validity buffer could be omitted if no null
+  column->buffers.emplace_back(column->nullCount == 0 ? std::string() : std::move(validity));
+}
+
+template <typename T, typename Func>
+void ColumnBuilder::buildFixedWidth(const std::vector<const Value*>& values,
+                                    Func&& get,
+                                    ArrowColumn* column) {
+  buildValidity(values, column);
+  std::string data;
+  data.reserve(values.size() * sizeof(T));
+  for (const auto* value : values) {
+    append<T>(&data, isNull(value) ? T() : get(*value));
+  }
+  column->buffers.emplace_back(std::move(data));
+}
+
+void ColumnBuilder::buildBool(const std::vector<const Value*>& values, ArrowColumn* column) {
+  buildValidity(values, column);
+  std::string data((values.size() + 7) / 8, '\0');
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (!isNull(values[i]) && values[i]->getBool()) {
+      data[i / 8] |= static_cast<char>(1 << (i % 8));
+    }
+  }
+  column->buffers.emplace_back(std::move(data));
+}
+
+Status ColumnBuilder::buildString(const std::vector<const Value*>& values, ArrowColumn* column) {
+  buildValidity(values, column);
+  std::unordered_map<folly::StringPiece, int32_t> dict;
+  std::vector<folly::StringPiece> dictValues;
+  for (const auto* value : values) {
+    if (!isNull(value)) {
+      auto res = dict.emplace(value->getStr(), dictValues.size());
+      if (res.second) {
+        dictValues.emplace_back(value->getStr());
+      }
+    }
+  }
+
+  auto buildUtf8 = [](const std::vector<folly::StringPiece>& strs,
+                      std::vector<std::string>* buffers) -> Status {
+    std::string offsets;
+    std::string data;
+    append<int32_t>(&offsets, 0);
+    for (const auto& str : strs) {
+      if (data.size() + str.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        return Status::Error("The strings of a column exceed 2GB");
+      }
+      data.append(str.data(), str.size());
+      append<int32_t>(&offsets, data.size());
+    }
+    buffers->emplace_back(std::move(offsets));
+    buffers->emplace_back(std::move(data));
+    return Status::OK();
+  };
+
+  if (!values.empty() && dictValues.size() * 2 <= values.size()) {
+    std::string indices;
+    indices.reserve(values.size() * sizeof(int32_t));
+    for (const auto* value : values) {
+      append<int32_t>(&indices, isNull(value) ? 0 : dict[value->getStr()]);
+    }
+    column->buffers.emplace_back(std::move(indices));
+
+    ArrowColumn dictColumn;
+    dictColumn.type = ArrowType::kUtf8;
+    dictColumn.length = dictValues.size();
+    dictColumn.buffers.emplace_back();
+    NG_RETURN_IF_ERROR(buildUtf8(dictValues, &dictColumn.buffers));
+    column->dictId = dictionaries_.size();
+    dictionaries_.emplace_back(std::move(dictColumn));
+    return Status::OK();
+  }
+
+  std::vector<folly::StringPiece> strs;
+  strs.reserve(values.size());
+  for (const auto* value : values) {
+    strs.emplace_back(isNull(value) ? folly::StringPiece() : folly::StringPiece(value->getStr()));
+  }
+  return buildUtf8(strs, &column->buffers);
+}
+
+Status ColumnBuilder::buildList(const std::vector<const Value*>& values, ArrowColumn* column) {
+  buildValidity(values, column);
+  std::vector<const Value*> items;
+  std::string offsets;
+  append<int32_t>(&offsets, 0);
+  for (const auto* value : values) {
+    if (value->isList()) {
+      for (const auto& item : value->getList().values) {
+        items.emplace_back(&item);
+      }
+    } else if (value->isSet()) {
+      for (const auto& item : value->getSet().values) {
+        items.emplace_back(&item);
+      }
+    }
+    if (items.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+      return Status::Error("The items of a list column exceed the limit of int32");
+    }
+    append<int32_t>(&offsets, items.size());
+  }
+  column->buffers.emplace_back(std::move(offsets));
+  return addChild("item", items, column);
+}
+
+Status ColumnBuilder::buildVertex(const std::vector<const Value*>& values, ArrowColumn* column) {
+  buildValidity(values, column);
+  // All the props of all the tags, sorted by the tag and then the prop
+  std::set<std::pair<std::string, std::string>> props;
+  for (const auto* value : values) {
+    if (value->isVertex()) {
+      for (const auto& tag : value->getVertex().tags) {
+        for (const auto& prop : tag.props) {
+          props.emplace(tag.name, prop.first);
+        }
+      }
+    }
+  }
+
+  std::vector<const Value*> vids;
+  std::vector<const Value*> tags;
+  vids.reserve(values.size());
+  tags.reserve(values.size());
+  for (const auto* value : values) {
+    if (!value->isVertex()) {
+      vids.emplace_back(&Value::kNullValue);
+      tags.emplace_back(&Value::kNullValue);
+      continue;
+    }
+    const auto& vertex = value->getVertex();
+    vids.emplace_back(&vertex.vid);
+    List tagNames;
+    for (const auto& tag : vertex.tags) {
+      tagNames.values.emplace_back(tag.name);
+    }
+    tags.emplace_back(hold(Value(std::move(tagNames))));
+  }
+  NG_RETURN_IF_ERROR(addChild("vid", vids, column));
+  NG_RETURN_IF_ERROR(addChild("tags", tags, column));
+
+  for (const auto& prop : props) {
+    std::vector<const Value*> propValues;
+    propValues.reserve(values.size());
+    for (const auto* value : values) {
+      const Value* propValue = &Value::kNullValue;
+      if (value->isVertex()) {
+        for (const auto& tag : value->getVertex().tags) {
+          if (tag.name != prop.first) {
+            continue;
+          }
+          auto found = tag.props.find(prop.second);
+          if (found != tag.props.end()) {
+            propValue = &found->second;
+          }
+          break;
+        }
+      }
+      propValues.emplace_back(propValue);
+    }
+    NG_RETURN_IF_ERROR(addChild(prop.first + "." + prop.second, propValues, column));
+  }
+  return Status::OK();
+}
+
+Status ColumnBuilder::buildEdge(const std::vector<const Value*>& values, ArrowColumn* column) {
+  buildValidity(values, column);
+  std::set<std::string> props;
+  for (const auto* value : values) {
+    if (value->isEdge()) {
+      for (const auto& prop : value->getEdge().props) {
+        props.emplace(prop.first);
+      }
+    }
+  }
+
+  std::vector<const Value*> srcs, dsts, types, ranks;
+  for (const auto* value : values) {
+    if (!value->isEdge()) {
+      srcs.emplace_back(&Value::kNullValue);
+      dsts.emplace_back(&Value::kNullValue);
+      types.emplace_back(&Value::kNullValue);
+      ranks.emplace_back(&Value::kNullValue);
+      continue;
+    }
+    const auto& edge = value->getEdge();
+    // The src and dst of the reversed edges are swapped, as what Edge::toString() prints
+    srcs.emplace_back(edge.type > 0 ? &edge.src : &edge.dst);
+    dsts.emplace_back(edge.type > 0 ? &edge.dst : &edge.src);
+    types.emplace_back(hold(Value(edge.name)));
+    ranks.emplace_back(hold(Value(edge.ranking)));
+  }
+  NG_RETURN_IF_ERROR(addChild("src", srcs, column));
+  NG_RETURN_IF_ERROR(addChild("dst", dsts, column));
+  NG_RETURN_IF_ERROR(addChild("type", types, column));
+  NG_RETURN_IF_ERROR(addChild("rank", ranks, column));
+
+  for (const auto& prop : props) {
+    std::vector<const Value*> propValues;
+    propValues.reserve(values.size());
+    for (const auto* value : values) {
+      const Value* propValue = &Value::kNullValue;
+      if (value->isEdge()) {
+        const auto& edgeProps = value->getEdge().props;
+        auto found = edgeProps.find(prop);
+        if (found != edgeProps.end()) {
+          propValue = &found->second;
+        }
+      }
+      propValues.emplace_back(propValue);
+    }
+    NG_RETURN_IF_ERROR(addChild(prop, propValues, column));
+  }
+  return Status::OK();
+}
+
+Status ColumnBuilder::addChild(const std::string& name,
+                               const std::vector<const Value*>& values,
+                               ArrowColumn* column) {
+  auto child = build(name, values);
+  NG_RETURN_IF_ERROR(child);
+  column->children.emplace_back(std::move(child).value());
+  return Status::OK();
+}
+
+StatusOr<ArrowColumn> ColumnBuilder::build(const std::string& name,
+                                           const std::vector<const Value*>& values) {
+  ArrowColumn column;
+  column.name = name;
+  switch (infer(values)) {
+    case Kind::kNull: {
+      column.type = ArrowType::kNull;
+      column.length = values.size();
+      column.nullCount = values.size();
+      break;
+    }
+    case Kind::kBool: {
+      column.type = ArrowType::kBool;
+      buildBool(values, &column);
+      break;
+    }
+    case Kind::kInt: {
+      column.type = ArrowType::kInt;
+      buildFixedWidth<int64_t>(
+          values, [](const Value& v) { return v.getInt(); }, &column);
+      break;
+    }
+    case Kind::kDouble: {
+      column.type = ArrowType::kFloatingPoint;
+      buildFixedWidth<double>(
+          values,
+          [](const Value& v) { return v.isInt() ? static_cast<double>(v.getInt()) : v.getFloat(); },
+          &column);
+      break;
+    }
+    case Kind::kDate: {
+      column.type = ArrowType::kDate;
+      buildFixedWidth<int32_t>(
+          values,
+          [](const Value& v) {
+            return static_cast<int32_t>(time::TimeConversion::dateToUnixSeconds(v.getDate()) /
+                                        86400);
+          },
+          &column);
+      break;
+    }
+    case Kind::kTime: {
+      column.type = ArrowType::kTime;
+      buildFixedWidth<int64_t>(
+          values,
+          [](const Value& v) {
+            const auto& t = v.getTime();
+            return (t.hour * 3600LL + t.minute * 60LL + t.sec) * 1000000LL + t.microsec;
+          },
+          &column);
+      break;
+    }
+    case Kind::kDateTime: {
+      column.type = ArrowType::kTimestamp;
+      buildFixedWidth<int64_t>(
+          values,
+          [](const Value& v) {
+            const auto& dt = v.getDateTime();
+            return time::TimeConversion::dateTimeToUnixSeconds(dt) * 1000000LL + dt.microsec;
+          },
+          &column);
+      break;
+    }
+    case Kind::kString: {
+      column.type = ArrowType::kUtf8;
+      NG_RETURN_IF_ERROR(buildString(values, &column));
+      break;
+    }
+    case Kind::kList: {
+      column.type = ArrowType::kList;
+      NG_RETURN_IF_ERROR(buildList(values, &column));
+      break;
+    }
+    case Kind::kVertex: {
+      column.type = ArrowType::kStruct;
+      NG_RETURN_IF_ERROR(buildVertex(values, &column));
+      break;
+    }
+    case Kind::kEdge: {
+      column.type = ArrowType::kStruct;
+      NG_RETURN_IF_ERROR(buildEdge(values, &column));
+      break;
+    }
+    case Kind::kText: {
+      std::vector<const Value*> texts;
+      texts.reserve(values.size());
+      for (const auto* value : values) {
+        texts.emplace_back(isNull(value) ? value : hold(Value(value->toString())));
+      }
+      column.type = ArrowType::kUtf8;
+      column.text = true;
+      NG_RETURN_IF_ERROR(buildString(texts, &column));
+      break;
+    }
+  }
+  return column;
+}
+
+}  // namespace
+
+// static
+StatusOr<std::string> ArrowEncoder::encode(const DataSet& ds) {
+  ColumnBuilder builder;
+  std::vector<ArrowColumn> columns;
+  columns.reserve(ds.colNames.size());
+  for (size_t i = 0; i < ds.colNames.size(); ++i) {
+    std::vector<const Value*> values;
+    values.reserve(ds.rows.size());
+    for (const auto& row : ds.rows) {
+      values.emplace_back(i < row.size() ? &row[i] : &Value::kNullValue);
+    }
+    auto column = builder.build(ds.colNames[i], values);
+    NG_RETURN_IF_ERROR(column);
+    columns.emplace_back(std::move(column).value());
+  }
+
+  std::string out;
+  appendSchema(&out, columns);
+  const auto& dictionaries = builder.dictionaries();
+  for (size_t i = 0; i < dictionaries.size(); ++i) {
+    appendBatch(&out, {&dictionaries[i]}, dictionaries[i].length, i);
+  }
+  std::vector<const ArrowColumn*> batch;
+  for (const auto& column : columns) {
+    batch.emplace_back(&column);
+  }
+  appendBatch(&out, batch, ds.rows.size(), -1);
+  // End of the stream
+  append<uint32_t>(&out, kContinuation);
+  append<int32_t>(&out, 0);
+  return out;
+}
+
+}  // namespace graph
+}  // namespace nebula
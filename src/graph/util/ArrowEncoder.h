@@ -0,0 +1,42 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_UTIL_ARROWENCODER_H_
+#define GRAPH_UTIL_ARROWENCODER_H_
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include "common/datatypes/DataSet.h"
+
+namespace nebula {
+namespace graph {
+
+/**
+ * ArrowEncoder encodes a DataSet as an Apache Arrow IPC stream, i.e. the schema message, the
+ * dictionary batches and one record batch, which is read by e.g. pyarrow.ipc.open_stream()
+ * without converting the values one by one.
+ *
+ * The type of each column is inferred from its values:
+ *   - bool, int, float, date and time are encoded as the arrow types of the same meaning,
+ *     datetime as timestamp[us, UTC], and the mixed int and float as double.
+ *   - string is dictionary encoded if at most half of the values are distinct, utf8 otherwise.
+ *   - list and set are encoded as the list of the type inferred from all their items.
+ *   - vertex is flattened to struct<vid, tags, <tag>.<prop>...>, and edge to
+ *     struct<src, dst, type, rank, <prop>...>.
+ *   - the others, and the columns of mixed types e.g. int and string, are encoded as utf8 of
+ *     Value::toString(), i.e. the strings are quoted and the int 1 reads as "1". Their fields
+ *     carry the custom metadata {"nebula.encoding": "text"}, so that the clients could tell them
+ *     from the string columns.
+ *   - null and empty are encoded as nulls.
+ */
+class ArrowEncoder final {
+ public:
+  static StatusOr<std::string> encode(const DataSet& ds);
+};
+
+}  // namespace graph
+}  // namespace nebula
+
+#endif  // GRAPH_UTIL_ARROWENCODER_H_
@@ -0,0 +1,282 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/util/CardinalityEstimator.h"
+
+#include "clients/meta/MetaClient.h"
+#include "common/expression/ContainerExpression.h"
+#include "common/expression/LogicalExpression.h"
+#include "common/expression/RelationalExpression.h"
+#include "common/expression/UnaryExpression.h"
+#include "graph/context/QueryContext.h"
+
+namespace nebula {
+namespace graph {
+
+CardinalityEstimator::CardinalityEstimator(QueryContext *qctx, GraphSpaceID space)
+    : qctx_(qctx), space_(space) {
+  auto *metaClient = qctx_ == nullptr ? nullptr : qctx_->getMetaClient();
+  if (metaClient == nullptr) {
+    return;
+  }
+  auto statsRet = metaClient->getStatsFromCache(space_);
+  if (statsRet.ok()) {
+    stats_ = std::move(statsRet).value();
+  }
+}
+
+double CardinalityEstimator::numVertices() const {
+  if (!hasStats()) {
+    return kDefaultVertices;
+  }
+  return std::max(1.0, static_cast<double>(stats_->get_space_vertices()));
+}
+
+double CardinalityEstimator::numVertices(TagID tagId) const {
+  if (!hasStats()) {
+    return kDefaultVertices * kDefaultSchemaFraction;
+  }
+  auto tagName = qctx_->schemaMng()->toTagName(space_, tagId);
+  if (!tagName.ok()) {
+    return 0.0;
+  }
+  const auto &tagVertices = stats_->get_tag_vertices();
+  auto iter = tagVertices.find(tagName.value());
+  return iter == tagVertices.end() ? 0.0 : static_cast<double>(iter->second);
+}
+
+double CardinalityEstimator::numEdges() const {
+  if (!hasStats()) {
+    return kDefaultEdges;
+  }
+  return static_cast<double>(stats_->get_space_edges());
+}
+
+double CardinalityEstimator::numEdges(EdgeType edgeType) const {
+  if (!hasStats()) {
+    return kDefaultEdges * kDefaultSchemaFraction;
+  }
+  auto edgeName = qctx_->schemaMng()->toEdgeName(space_, std::abs(edgeType));
+  if (!edgeName.ok()) {
+    return 0.0;
+  }
+  const auto &edges = stats_->get_edges();
+  auto iter = edges.find(edgeName.value());
+  return iter == edges.end() ? 0.0 : static_cast<double>(iter->second);
+}
+
+double CardinalityEstimator::avgDegree(const std::vector<EdgeType> &edgeTypes,
+                                       storage::cpp2::EdgeDirection direction) const {
+  double vertices = numVertices();
+  if (edgeTypes.empty()) {
+    double factor = direction == storage::cpp2::EdgeDirection::BOTH ? 2.0 : 1.0;
+    return numEdges() * factor / vertices;
+  }
+  // The reversely walked edge types have been negated already
+  double edges = 0.0;
+  for (auto edgeType : edgeTypes) {
+    edges += numEdges(edgeType);
+  }
+  return edges / vertices;
+}
+
+double CardinalityEstimator::schemaRows(int32_t schemaId, bool isEdge) const {
+  return isEdge ? numEdges(schemaId) : numVertices(schemaId);
+}
+
+double CardinalityEstimator::scanRows(const std::vector<int32_t> &schemaIds,
+                                      bool isEdge,
+                                      const Expression *filter) const {
+  double rows = 0.0;
+  if (schemaIds.empty()) {
+    rows = isEdge ? numEdges() : numVertices();
+  }
+  for (auto schemaId : schemaIds) {
+    rows += schemaRows(schemaId, isEdge);
+  }
+  return rows * filterSelectivity(filter);
+}
+
+double CardinalityEstimator::indexScanRows(
+    int32_t schemaId,
+    bool isEdge,
+    const std::vector<storage::cpp2::IndexQueryContext> &contexts) const {
+  double total = schemaRows(schemaId, isEdge);
+  double rows = 0.0;
+  for (const auto &ctx : contexts) {
+    rows += total * indexSelectivity(ctx);
+  }
+  return std::min(rows, total);
+}
+
+const meta::cpp2::IndexStats *CardinalityEstimator::indexStats(IndexID indexId) const {
+  if (!hasStats() || !stats_->index_stats_ref().has_value()) {
+    return nullptr;
+  }
+  const auto &indexStats = *stats_->index_stats_ref();
+  auto iter = indexStats.find(indexId);
+  return iter == indexStats.end() ? nullptr : &iter->second;
+}
+
+double CardinalityEstimator::indexSelectivity(const storage::cpp2::IndexQueryContext &ctx) const {
+  if (ctx.range_hints_ref().has_value() && !ctx.range_hints_ref()->empty()) {
+    double selectivity = 0.0;
+    for (const auto &hints : *ctx.range_hints_ref()) {
+      selectivity += hintsSelectivity(ctx.get_index_id(), hints);
+    }
+    return std::min(selectivity, 1.0);
+  }
+  return hintsSelectivity(ctx.get_index_id(), ctx.get_column_hints());
+}
+
+int64_t CardinalityEstimator::columnNdv(IndexID indexId, const std::string &column) const {
+  const auto *stats = indexStats(indexId);
+  if (stats == nullptr) {
+    return -1;
+  }
+  for (const auto &col : stats->get_columns()) {
+    if (col.get_name() == column) {
+      return col.get_ndv();
+    }
+  }
+  return -1;
+}
+
+double CardinalityEstimator::hintsSelectivity(
+    IndexID indexId, const std::vector<storage::cpp2::IndexColumnHint> &hints) const {
+  const auto *stats = indexStats(indexId);
+  double selectivity = 1.0;
+  for (const auto &hint : hints) {
+    const meta::cpp2::IndexColumnStats *column = nullptr;
+    if (stats != nullptr) {
+      for (const auto &col : stats->get_columns()) {
+        if (col.get_name() == hint.get_column_name()) {
+          column = &col;
+          break;
+        }
+      }
+    }
+    if (column != nullptr) {
+      selectivity *= columnSelectivity(*column, stats->get_rows(), hint);
+    } else if (hint.get_scan_type() == storage::cpp2::ScanType::PREFIX) {
+      selectivity *= kEqualSelectivity;
+    } else {
+      selectivity *= kRangeSelectivity;
+    }
+  }
+  return selectivity;
+}
+
+// static
+double CardinalityEstimator::columnSelectivity(const meta::cpp2::IndexColumnStats &column,
+                                               int64_t rows,
+                                               const storage::cpp2::IndexColumnHint &hint) {
+  if (rows <= 0) {
+    return hint.get_scan_type() == storage::cpp2::ScanType::PREFIX ? kEqualSelectivity
+                                                                    : kRangeSelectivity;
+  }
+  double nonNullFraction =
+      std::max<int64_t>(rows - column.get_null_count(), 0) / static_cast<double>(rows);
+  double selectivity = 0.0;
+  if (hint.get_scan_type() == storage::cpp2::ScanType::PREFIX) {
+    // Assume the values are distributed uniformly among the distinct values
+    selectivity = column.get_ndv() > 0 ? nonNullFraction / column.get_ndv() : kEqualSelectivity;
+  } else if (column.get_histogram().empty()) {
+    selectivity = nonNullFraction * kRangeSelectivity;
+  } else {
+    const auto &histogram = column.get_histogram();
+    double begin = histogramFraction(histogram, hint.get_begin_value());
+    double end = histogramFraction(histogram, hint.get_end_value());
+    selectivity = nonNullFraction * std::max(end - begin, 0.0);
+  }
+  // At least one row is returned, the estimation of an empty result is not reliable
+  return std::min(std::max(selectivity, 1.0 / rows), 1.0);
+}
+
+// static
+double CardinalityEstimator::histogramFraction(const std::vector<Value> &histogram,
+                                               const Value &value) {
+  if (value.empty() || value.isNull()) {
+    return 0.0;
+  }
+  auto iter = std::lower_bound(histogram.begin(), histogram.end(), value);
+  auto bucket = static_cast<size_t>(std::distance(histogram.begin(), iter));
+  if (bucket == histogram.size()) {
+    return 1.0;
+  }
+  // Interpolate in the bucket which contains the value for the numeric values, otherwise assume
+  // the value is in the middle of the bucket
+  double inBucket = 0.5;
+  if (bucket > 0 && value.isNumeric() && histogram[bucket - 1].isNumeric() &&
+      histogram[bucket].isNumeric()) {
+    auto toDouble = [](const Value &v) {
+      return v.isInt() ? static_cast<double>(v.getInt()) : v.getFloat();
+    };
+    double lower = toDouble(histogram[bucket - 1]);
+    double upper = toDouble(histogram[bucket]);
+    if (upper > lower) {
+      inBucket = std::min(std::max((toDouble(value) - lower) / (upper - lower), 0.0), 1.0);
+    }
+  }
+  return (bucket + inBucket) / histogram.size();
+}
+
+// static
+double CardinalityEstimator::filterSelectivity(const Expression *filter) {
+  if (filter == nullptr) {
+    return 1.0;
+  }
+  switch (filter->kind()) {
+    case Expression::Kind::kLogicalAnd: {
+      double selectivity = 1.0;
+      for (const auto *operand : static_cast<const LogicalExpression *>(filter)->operands()) {
+        selectivity *= filterSelectivity(operand);
+      }
+      return selectivity;
+    }
+    case Expression::Kind::kLogicalOr: {
+      // Assume the operands are independent of each other
+      double selectivity = 0.0;
+      for (const auto *operand : static_cast<const LogicalExpression *>(filter)->operands()) {
+        auto s = filterSelectivity(operand);
+        selectivity = selectivity + s - selectivity * s;
+      }
+      return selectivity;
+    }
+    case Expression::Kind::kUnaryNot:
+      return 1.0 - filterSelectivity(static_cast<const UnaryExpression *>(filter)->operand());
+    case Expression::Kind::kRelEQ:
+      return kEqualSelectivity;
+    case Expression::Kind::kRelNE:
+      return 1.0 - kEqualSelectivity;
+    case Expression::Kind::kRelLT:
+    case Expression::Kind::kRelLE:
+    case Expression::Kind::kRelGT:
+    case Expression::Kind::kRelGE:
+      return kRangeSelectivity;
+    case Expression::Kind::kRelIn: {
+      const auto *right = static_cast<const RelationalExpression *>(filter)->right();
+      if (right->kind() == Expression::Kind::kList || right->kind() == Expression::Kind::kSet) {
+        auto size = static_cast<const ContainerExpression *>(right)->size();
+        return std::min(1.0, size * kEqualSelectivity);
+      }
+      return kDefaultSelectivity;
+    }
+    case Expression::Kind::kStartsWith:
+    case Expression::Kind::kEndsWith:
+    case Expression::Kind::kContains:
+    case Expression::Kind::kRelREG:
+      return kLikeSelectivity;
+    case Expression::Kind::kIsNull:
+      return kEqualSelectivity;
+    case Expression::Kind::kIsNotNull:
+      return 1.0 - kEqualSelectivity;
+    default:
+      return kDefaultSelectivity;
+  }
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,103 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#ifndef NEBULA_GRAPH_UTIL_CARDINALITYESTIMATOR_H_
+#define NEBULA_GRAPH_UTIL_CARDINALITYESTIMATOR_H_
+
+#include "common/base/Base.h"
+#include "common/thrift/ThriftTypes.h"
+#include "interface/gen-cpp2/meta_types.h"
+#include "interface/gen-cpp2/storage_types.h"
+
+namespace nebula {
+
+class Expression;
+
+namespace graph {
+
+class QueryContext;
+
+// Estimate the number of rows produced by the storage accesses of a query, based on the
+// statistics collected by the `SUBMIT JOB STATS` of the space. When no finished statistics
+// are available, fixed default values are used so that the estimations are still comparable
+// among each other.
+class CardinalityEstimator final {
+ public:
+  // Used when the space has no statistics
+  static constexpr double kDefaultVertices = 10000.0;
+  static constexpr double kDefaultEdges = 100000.0;
+  static constexpr double kDefaultSchemaFraction = 0.1;
+  // Selectivity of the predicates whose distribution is unknown
+  static constexpr double kEqualSelectivity = 0.1;
+  static constexpr double kRangeSelectivity = 1.0 / 3;
+  static constexpr double kLikeSelectivity = 0.25;
+  static constexpr double kDefaultSelectivity = 0.5;
+
+  CardinalityEstimator(QueryContext *qctx, GraphSpaceID space);
+
+  bool hasStats() const {
+    return stats_ != nullptr;
+  }
+
+  double numVertices() const;
+
+  // Number of vertices with the tag
+  double numVertices(TagID tagId) const;
+
+  double numEdges() const;
+
+  // Number of edges of the type, the sign of `edgeType` is ignored
+  double numEdges(EdgeType edgeType) const;
+
+  // Average number of edges of `edgeTypes` visited from one vertex, the negative edge type means
+  // walking the edge reversely. All edge types are used if `edgeTypes` is empty.
+  double avgDegree(const std::vector<EdgeType> &edgeTypes,
+                   storage::cpp2::EdgeDirection direction) const;
+
+  // Rows of scanning all the vertices/edges of the schemas and then filtering by `filter`
+  double scanRows(const std::vector<int32_t> &schemaIds,
+                  bool isEdge,
+                  const Expression *filter = nullptr) const;
+
+  // Rows returned by the index scan, the contexts are unioned.
+  double indexScanRows(int32_t schemaId,
+                       bool isEdge,
+                       const std::vector<storage::cpp2::IndexQueryContext> &contexts) const;
+
+  // Fraction of rows left after applying the column hints of index query context, the statistics
+  // collected by `SUBMIT JOB INDEX STATS` are used if exist.
+  double indexSelectivity(const storage::cpp2::IndexQueryContext &ctx) const;
+
+  // Number of distinct values of the index column, -1 if the index has no statistics
+  int64_t columnNdv(IndexID indexId, const std::string &column) const;
+
+  // Fraction of the `rows` index entries satisfying the column hint
+  static double columnSelectivity(const meta::cpp2::IndexColumnStats &column,
+                                  int64_t rows,
+                                  const storage::cpp2::IndexColumnHint &hint);
+
+  // Fraction of rows satisfying the filter, in range [0, 1].
+  static double filterSelectivity(const Expression *filter);
+
+ private:
+  double schemaRows(int32_t schemaId, bool isEdge) const;
+
+  const meta::cpp2::IndexStats *indexStats(IndexID indexId) const;
+
+  // Fraction of rows left after applying the column hints of one range of the index
+  double hintsSelectivity(IndexID indexId,
+                          const std::vector<storage::cpp2::IndexColumnHint> &hints) const;
+
+  // Fraction of the non-null values less than `value` by the equi-depth histogram
+  static double histogramFraction(const std::vector<Value> &histogram, const Value &value);
+
+  QueryContext *qctx_{nullptr};
+  GraphSpaceID space_{-1};
+  std::shared_ptr<const meta::cpp2::StatsItem> stats_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+
+#endif  // NEBULA_GRAPH_UTIL_CARDINALITYESTIMATOR_H_
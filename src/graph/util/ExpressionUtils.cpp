@@ -12,6 +12,7 @@
 #include "common/expression/Expression.h"
 #include "common/expression/PropertyExpression.h"
 #include "common/function/AggFunctionManager.h"
+#include "common/function/FunctionManager.h"
 #include "graph/context/QueryContext.h"
 #include "graph/context/QueryExpressionContext.h"
 #include "graph/visitor/FoldConstantExprVisitor.h"
@@ -1242,6 +1243,24 @@ bool ExpressionUtils::findInnerRandFunction(const Expression *expr) {
   return false;
 }
 
+bool ExpressionUtils::isNonDeterministic(const Expression *expr) {
+  if (expr->kind() == Expression::Kind::kUUID) {
+    return true;
+  }
+  if (expr->kind() != Expression::Kind::kFunctionCall) {
+    return false;
+  }
+  auto *call = static_cast<const FunctionCallExpression *>(expr);
+  auto func = call->name();
+  std::transform(func.begin(), func.end(), func.begin(), ::tolower);
+  // The rand functions are registered as pure ones
+  if (func == "rand" || func == "rand32" || func == "rand64") {
+    return true;
+  }
+  auto pure = FunctionManager::getIsPure(func, call->args()->numArgs());
+  return !pure.ok() || !pure.value();
+}
+
 // Negate the given relational expr
 RelationalExpression *ExpressionUtils::reverseRelExpr(RelationalExpression *expr) {
   ObjectPool *pool = expr->getObjPool();
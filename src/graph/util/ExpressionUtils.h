@@ -231,6 +231,10 @@ class ExpressionUtils {
   // Checks if expr contains function call expression that generate a random value
   static bool findInnerRandFunction(const Expression* expr);
 
+  // Checks if the expression itself, regardless of its operands, may evaluate to different values
+  // on the same input, e.g. rand(), now() and uuid()
+  static bool isNonDeterministic(const Expression* expr);
+
   // Checks if expr contains function EdgeDst expr or id($$) expr
   static bool findEdgeDstExpr(const Expression* expr);
 
@@ -41,5 +41,34 @@ StatusOr<::nebula::plugin::ESAdapter> FTIndexUtils::getESAdapter(meta::MetaClien
   return ::nebula::plugin::ESAdapter(std::move(clients));
 }
 
+StatusOr<std::unordered_map<HostAddr, std::vector<PartitionID>>> FTIndexUtils::localFTIndexHosts(
+    meta::MetaClient* client, GraphSpaceID space) {
+  auto listenerHosts =
+      client->getListenerHostsBySpaceTypeFromCache(space, meta::cpp2::ListenerType::LOCAL_FULLTEXT);
+  NG_RETURN_IF_ERROR(listenerHosts);
+  if (listenerHosts.value().empty()) {
+    return listenerHosts;
+  }
+  auto partsNum = client->partsNum(space);
+  NG_RETURN_IF_ERROR(partsNum);
+  // Each part is searched in only one of its listeners, and every part must have one, otherwise
+  // the documents of the part are missed silently
+  std::unordered_map<HostAddr, std::vector<PartitionID>> hostParts;
+  std::unordered_set<PartitionID> searched;
+  for (auto& host : listenerHosts.value()) {
+    for (auto part : host.second) {
+      if (searched.emplace(part).second) {
+        hostParts[host.first].emplace_back(part);
+      }
+    }
+  }
+  for (PartitionID part = 1; part <= partsNum.value(); ++part) {
+    if (searched.count(part) == 0) {
+      return Status::Error("Part %d of space %d has no local fulltext listener", part, space);
+    }
+  }
+  return hostParts;
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -22,6 +22,11 @@ class FTIndexUtils final {
 
   static StatusOr<::nebula::plugin::ESAdapter> getESAdapter(meta::MetaClient* client);
 
+  // Gets the parts served by each local fulltext listener of the space, empty if the fulltext
+  // index is maintained by elasticsearch. It fails if any part of the space has no listener.
+  static StatusOr<std::unordered_map<HostAddr, std::vector<PartitionID>>> localFTIndexHosts(
+      meta::MetaClient* client, GraphSpaceID space);
+
   // Converts TextSearchExpression into a relational expression that could be pushed down
   static StatusOr<Expression*> rewriteTSFilter(ObjectPool* pool,
                                                bool isEdge,
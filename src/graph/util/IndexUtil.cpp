@@ -26,8 +26,42 @@ Status IndexUtil::validateIndexParams(const std::vector<IndexParamItem *> &param
         indexParams.s2_max_cells_ref() = std::move(ret2).value();
         break;
       }
+      case IndexParamItem::VECTOR_METRIC: {
+        auto ret = param->getVectorMetric();
+        NG_RETURN_IF_ERROR(ret);
+        indexParams.vector_metric_ref() = ret.value() == "cosine" ? meta::cpp2::VectorMetric::COSINE
+                                                                  : meta::cpp2::VectorMetric::L2;
+        break;
+      }
+      case IndexParamItem::HNSW_M: {
+        auto ret = param->getHnswM();
+        NG_RETURN_IF_ERROR(ret);
+        indexParams.hnsw_m_ref() = std::move(ret).value();
+        break;
+      }
+      case IndexParamItem::HNSW_EF_CONSTRUCTION: {
+        auto ret = param->getHnswEfConstruction();
+        NG_RETURN_IF_ERROR(ret);
+        indexParams.hnsw_ef_construction_ref() = std::move(ret).value();
+        break;
+      }
+      case IndexParamItem::S2_MIN_LEVEL: {
+        auto ret = param->getS2MinLevel();
+        NG_RETURN_IF_ERROR(ret);
+        indexParams.s2_min_level_ref() = std::move(ret).value();
+        break;
+      }
+      case IndexParamItem::INCLUDE: {
+        auto ret = param->getIncludedFields();
+        NG_RETURN_IF_ERROR(ret);
+        indexParams.included_fields_ref() = std::move(ret).value();
+        break;
+      }
     }
   }
+  if (indexParams.s2_min_level_ref().value_or(0) > indexParams.s2_max_level_ref().value_or(30)) {
+    return Status::SemanticError("'s2_min_level' should not be greater than 's2_max_level'");
+  }
 
   return Status::OK();
 }
@@ -77,6 +111,10 @@ StatusOr<DataSet> IndexUtil::toShowCreateIndex(bool isTagIndex,
   const auto *indexParams = indexItem.get_index_params();
   std::vector<std::string> params;
   if (indexParams) {
+    if (indexParams->s2_min_level_ref().has_value()) {
+      params.emplace_back("s2_min_level = " +
+                          std::to_string(indexParams->s2_min_level_ref().value()));
+    }
     if (indexParams->s2_max_level_ref().has_value()) {
       params.emplace_back("s2_max_level = " +
                           std::to_string(indexParams->s2_max_level_ref().value()));
@@ -85,6 +123,26 @@ StatusOr<DataSet> IndexUtil::toShowCreateIndex(bool isTagIndex,
       params.emplace_back("s2_max_cells = " +
                           std::to_string(indexParams->s2_max_cells_ref().value()));
     }
+    if (indexParams->vector_metric_ref().has_value()) {
+      auto metric = *indexParams->vector_metric_ref() == meta::cpp2::VectorMetric::COSINE
+                        ? "cosine"
+                        : "l2";
+      params.emplace_back(folly::sformat("vector_metric = \"{}\"", metric));
+    }
+    if (indexParams->hnsw_m_ref().has_value()) {
+      params.emplace_back("hnsw_m = " + std::to_string(indexParams->hnsw_m_ref().value()));
+    }
+    if (indexParams->hnsw_ef_construction_ref().has_value()) {
+      params.emplace_back("hnsw_ef_construction = " +
+                          std::to_string(indexParams->hnsw_ef_construction_ref().value()));
+    }
+    if (indexParams->included_fields_ref().has_value()) {
+      std::vector<std::string> fields;
+      for (const auto &field : *indexParams->included_fields_ref()) {
+        fields.emplace_back("`" + field + "`");
+      }
+      params.emplace_back("include = (" + folly::join(", ", fields) + ")");
+    }
   }
   if (!params.empty()) {
     createStr += " WITH (";
@@ -7,7 +7,10 @@
 
 #include "common/base/Status.h"
 #include "common/datatypes/Value.h"
+#include "common/utils/IndexKeyUtils.h"
 #include "graph/planner/plan/Query.h"
+#include "graph/service/GraphFlags.h"
+#include "graph/util/CardinalityEstimator.h"
 #include "graph/util/ExpressionUtils.h"
 #include "graph/util/IndexUtil.h"
 
@@ -46,6 +49,8 @@ struct IndexResult {
   // expressions not used in all `ScoredColumnHint'
   std::vector<const Expression*> unusedExprs;
   std::vector<ScoredColumnHint> hints;
+  // whether the index returns all the required columns without reading base data
+  bool covering{false};
 
   bool operator<(const IndexResult& rhs) const {
     if (hints.empty()) return true;
@@ -58,7 +63,10 @@ struct IndexResult {
         return false;
       }
     }
-    return hints.size() < rhs.hints.size();
+    if (hints.size() != rhs.hints.size()) {
+      return hints.size() < rhs.hints.size();
+    }
+    return !covering && rhs.covering;
   }
 };
 
@@ -317,47 +325,29 @@ StatusOr<IndexResult> selectIndex(const Expression* expr, const IndexItem& index
   return Status::Error("Invalid expression kind.");
 }
 
-}  // namespace
-
-void OptimizerUtils::eraseInvalidIndexItems(
-    int32_t schemaId, std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>>* indexItems) {
-  // Erase invalid index items
-  for (auto iter = indexItems->begin(); iter != indexItems->end();) {
-    auto schema = (*iter)->get_schema_id();
-    if (schema.tag_id_ref().has_value() && schema.get_tag_id() != schemaId) {
-      iter = indexItems->erase(iter);
-    } else if (schema.edge_type_ref().has_value() && schema.get_edge_type() != schemaId) {
-      iter = indexItems->erase(iter);
-    } else {
-      iter++;
-    }
-  }
-}
-
-bool OptimizerUtils::findOptimalIndex(const Expression* condition,
+// Score the indexes by the condition, the best one is the last
+std::vector<IndexResult> scoreIndexes(const Expression* condition,
                                       const std::vector<std::shared_ptr<IndexItem>>& indexItems,
-                                      bool* isPrefixScan,
-                                      IndexQueryContext* ictx) {
-  // Return directly if there is no valid index to use.
-  if (indexItems.empty()) {
-    return false;
-  }
-
+                                      const std::vector<std::string>* returnColumns) {
   std::vector<IndexResult> results;
   for (auto& index : indexItems) {
     auto resStatus = selectIndex(condition, *index);
     if (resStatus.ok()) {
-      results.emplace_back(std::move(resStatus).value());
+      auto result = std::move(resStatus).value();
+      result.covering =
+          returnColumns != nullptr && OptimizerUtils::isCoveringIndex(*index, *returnColumns);
+      results.emplace_back(std::move(result));
     }
   }
-
-  if (results.empty()) {
-    return false;
-  }
-
   std::sort(results.begin(), results.end());
+  return results;
+}
 
-  auto& index = results.back();
+// Make the context to scan the scored index, false if the index is no better than a full scan
+bool makeIndexQueryContext(const Expression* condition,
+                           IndexResult& index,
+                           bool* isPrefixScan,
+                           IndexQueryContext* ictx) {
   if (index.hints.empty()) {
     return false;
   }
@@ -396,6 +386,177 @@ bool OptimizerUtils::findOptimalIndex(const Expression* condition,
   return true;
 }
 
+}  // namespace
+
+
+void OptimizerUtils::eraseInvalidIndexItems(
+    int32_t schemaId, std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>>* indexItems) {
+  // Erase invalid index items, the vector index could only be used by vector search
+  for (auto iter = indexItems->begin(); iter != indexItems->end();) {
+    auto schema = (*iter)->get_schema_id();
+    if (IndexKeyUtils::isVectorIndex(**iter)) {
+      iter = indexItems->erase(iter);
+    } else if (schema.tag_id_ref().has_value() && schema.get_tag_id() != schemaId) {
+      iter = indexItems->erase(iter);
+    } else if (schema.edge_type_ref().has_value() && schema.get_edge_type() != schemaId) {
+      iter = indexItems->erase(iter);
+    } else {
+      iter++;
+    }
+  }
+}
+
+bool OptimizerUtils::findOptimalIndex(const Expression* condition,
+                                      const std::vector<std::shared_ptr<IndexItem>>& indexItems,
+                                      bool* isPrefixScan,
+                                      IndexQueryContext* ictx,
+                                      const std::vector<std::string>* returnColumns) {
+  // Return directly if there is no valid index to use.
+  if (indexItems.empty()) {
+    return false;
+  }
+
+  auto results = scoreIndexes(condition, indexItems, returnColumns);
+  if (results.empty()) {
+    return false;
+  }
+  return makeIndexQueryContext(condition, results.back(), isPrefixScan, ictx);
+}
+
+std::vector<OptimizerUtils::IndexCandidate> OptimizerUtils::findIndexCandidates(
+    QueryContext* qctx,
+    GraphSpaceID space,
+    const Expression* condition,
+    const std::vector<std::shared_ptr<IndexItem>>& indexItems,
+    const std::vector<std::string>* returnColumns) {
+  std::vector<IndexCandidate> candidates;
+  if (FLAGS_enable_optimizer_cost_model && CardinalityEstimator(qctx, space).hasStats()) {
+    auto results = scoreIndexes(condition, indexItems, returnColumns);
+    for (auto iter = results.rbegin(); iter != results.rend(); ++iter) {
+      IndexCandidate candidate;
+      if (makeIndexQueryContext(condition, *iter, &candidate.isPrefixScan, &candidate.ictx)) {
+        candidates.emplace_back(std::move(candidate));
+      }
+    }
+  } else {
+    IndexCandidate candidate;
+    if (findOptimalIndex(
+            condition, indexItems, &candidate.isPrefixScan, &candidate.ictx, returnColumns)) {
+      candidates.emplace_back(std::move(candidate));
+    }
+  }
+  if (candidates.empty()) {
+    IndexCandidate candidate;
+    if (findSkipScanIndex(qctx, space, condition, indexItems, &candidate.ictx, returnColumns)) {
+      candidates.emplace_back(std::move(candidate));
+    }
+  }
+  return candidates;
+}
+
+bool OptimizerUtils::isCoveringIndex(const IndexItem& index,
+                                     const std::vector<std::string>& columns) {
+  const auto& fields = index.get_fields();
+  const auto* params = index.get_index_params();
+  for (const auto& col : columns) {
+    if (col == kVid || col == kTag || col == kSrc || col == kDst || col == kRank || col == kType) {
+      continue;
+    }
+    // The string and geography in index key are not the original values
+    auto iter = std::find_if(fields.begin(), fields.end(), [&col](const auto& field) {
+      return field.get_name() == col;
+    });
+    if (iter != fields.end()) {
+      auto type = iter->get_type().get_type();
+      if (type != nebula::cpp2::PropertyType::FIXED_STRING &&
+          type != nebula::cpp2::PropertyType::GEOGRAPHY) {
+        continue;
+      }
+      return false;
+    }
+    if (params == nullptr || !params->included_fields_ref().has_value()) {
+      return false;
+    }
+    const auto& included = *params->included_fields_ref();
+    if (std::find(included.begin(), included.end(), col) == included.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool OptimizerUtils::findSkipScanIndex(QueryContext* qctx,
+                                       GraphSpaceID space,
+                                       const Expression* condition,
+                                       const std::vector<std::shared_ptr<IndexItem>>& indexItems,
+                                       IndexQueryContext* ictx,
+                                       const std::vector<std::string>* returnColumns) {
+  if (FLAGS_index_skip_scan_max_ndv == 0) {
+    return false;
+  }
+  CardinalityEstimator estimator(qctx, space);
+  std::vector<std::shared_ptr<IndexItem>> candidates;
+  for (auto& index : indexItems) {
+    const auto& fields = index->get_fields();
+    if (fields.size() < 2) {
+      continue;
+    }
+    // Storage decodes the leading values from index keys, which is exact for fixed length types
+    auto type = IndexKeyUtils::toValueType(fields.front().get_type().get_type());
+    if (type == Value::Type::STRING || type == Value::Type::GEOGRAPHY) {
+      continue;
+    }
+    auto ndv = estimator.columnNdv(index->get_index_id(), fields.front().get_name());
+    if (ndv < 0 || ndv > static_cast<int64_t>(FLAGS_index_skip_scan_max_ndv)) {
+      continue;
+    }
+    // Select the hints as if the index has no leading field
+    auto candidate = std::make_shared<IndexItem>(*index);
+    candidate->fields_ref()->erase(candidate->fields_ref()->begin());
+    candidates.emplace_back(std::move(candidate));
+  }
+  bool isPrefixScan = false;
+  if (!findOptimalIndex(condition, candidates, &isPrefixScan, ictx, returnColumns)) {
+    return false;
+  }
+  ictx->skip_scan_ref() = true;
+  return true;
+}
+
+void OptimizerUtils::mergeRangeContexts(IndexQueryContextList& contexts) {
+  IndexQueryContextList merged;
+  for (auto& ctx : contexts) {
+    auto iter = merged.end();
+    // The full scan of index covers all ranges
+    if (!ctx.get_column_hints().empty() && !ctx.get_skip_scan()) {
+      iter = std::find_if(merged.begin(), merged.end(), [&ctx](const IndexQueryContext& m) {
+        return m.range_hints_ref().has_value() && m.get_index_id() == ctx.get_index_id() &&
+               m.get_filter() == ctx.get_filter();
+      });
+      if (iter == merged.end()) {
+        ctx.range_hints_ref() = std::vector<std::vector<IndexColumnHint>>{ctx.get_column_hints()};
+      }
+    }
+    if (iter == merged.end()) {
+      merged.emplace_back(std::move(ctx));
+    } else {
+      iter->range_hints_ref()->emplace_back(std::move(*ctx.column_hints_ref()));
+    }
+  }
+  // A single range is still scanned by column hints
+  for (auto& ctx : merged) {
+    if (!ctx.range_hints_ref().has_value()) {
+      continue;
+    }
+    if (ctx.range_hints_ref()->size() == 1) {
+      ctx.range_hints_ref().reset();
+    } else {
+      ctx.column_hints_ref()->clear();
+    }
+  }
+  contexts = std::move(merged);
+}
+
 // Check if the relational expression has a valid index
 // The left operand should either be a kEdgeProperty or kTagProperty expr
 bool OptimizerUtils::relExprHasIndex(
@@ -549,7 +710,7 @@ std::vector<IndexItemPtr> OptimizerUtils::allIndexesBySchema(graph::QueryContext
     const auto& schemaId = index->get_schema_id();
     // TODO (sky) : ignore rebuilding indexes
     auto id = isEdge ? schemaId.get_edge_type() : schemaId.get_tag_id();
-    if (id == node->schemaId()) {
+    if (id == node->schemaId() && !IndexKeyUtils::isVectorIndex(*index)) {
       indexes.emplace_back(index);
     }
   }
@@ -890,10 +1051,17 @@ IndexItemPtr OptimizerUtils::findLightestIndex(graph::QueryContext* qctx, const
     return nullptr;
   }
 
+  // Prefer the covering index, and then the index with fewer fields
+  const auto& columns = node->returnColumns();
   auto result = indexes[0];
+  auto covering = isCoveringIndex(*result, columns);
   for (size_t i = 1; i < indexes.size(); i++) {
-    if (result->get_fields().size() > indexes[i]->get_fields().size()) {
+    auto isCovering = isCoveringIndex(*indexes[i], columns);
+    if ((isCovering && !covering) ||
+        (isCovering == covering &&
+         result->get_fields().size() > indexes[i]->get_fields().size())) {
       result = indexes[i];
+      covering = isCovering;
     }
   }
   return result;
@@ -63,11 +63,51 @@ class OptimizerUtils {
   // For logical `OR' condition expression, use above steps to generate
   // different `IndexQueryContext' for each operand of filter condition, nebula
   // storage will union all results of multiple index contexts
+  //
+  // If `returnColumns' is given, the covering index is preferred among the indexes with the same
+  // score, which returns all the columns without reading base data
   static bool findOptimalIndex(
       const Expression *condition,
       const std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>> &indexItems,
       bool *isPrefixScan,
-      nebula::storage::cpp2::IndexQueryContext *ictx);
+      nebula::storage::cpp2::IndexQueryContext *ictx,
+      const std::vector<std::string> *returnColumns = nullptr);
+
+  struct IndexCandidate {
+    bool isPrefixScan{false};
+    nebula::storage::cpp2::IndexQueryContext ictx;
+  };
+
+  // The indexes to scan by the condition. If the cost model is enabled and the space has
+  // statistics, all the usable indexes are returned in the order of `findOptimalIndex' and taken
+  // as the alternatives of the memo, so the cheapest one is chosen by the cost. Otherwise only the
+  // one found by `findOptimalIndex' or `findSkipScanIndex' is returned.
+  static std::vector<IndexCandidate> findIndexCandidates(
+      QueryContext *qctx,
+      GraphSpaceID space,
+      const Expression *condition,
+      const std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>> &indexItems,
+      const std::vector<std::string> *returnColumns = nullptr);
+
+  // Find the index whose leading field is skipped by storage, see `skip_scan' of
+  // `IndexQueryContext'. The hints are selected by `findOptimalIndex' on the fields after the
+  // leading one, and the leading field should have at most `--index_skip_scan_max_ndv' distinct
+  // values by the index statistics.
+  static bool findSkipScanIndex(
+      QueryContext *qctx,
+      GraphSpaceID space,
+      const Expression *condition,
+      const std::vector<std::shared_ptr<nebula::meta::cpp2::IndexItem>> &indexItems,
+      nebula::storage::cpp2::IndexQueryContext *ictx,
+      const std::vector<std::string> *returnColumns = nullptr);
+
+  // Merge the contexts which scan different ranges of the same index with the same filter into
+  // one context with `range_hints', so that storage visits the ranges by one iterator
+  static void mergeRangeContexts(std::vector<nebula::storage::cpp2::IndexQueryContext> &contexts);
+
+  // Whether the index key and the included fields of index contain all the columns
+  static bool isCoveringIndex(const nebula::meta::cpp2::IndexItem &index,
+                              const std::vector<std::string> &columns);
 
   static bool relExprHasIndex(
       const Expression *expr,
@@ -7,6 +7,9 @@
 #include "common/base/ObjectPool.h"
 #include "common/base/Status.h"
 #include "common/base/StatusOr.h"
+#include "parser/ExplainSentence.h"
+#include "parser/SequentialSentences.h"
+#include "parser/TraverseSentences.h"
 
 namespace nebula {
 namespace graph {
@@ -183,5 +186,173 @@ void ParserUtil::rewriteReduce(QueryContext *qctx,
   reduce->setMapping(newMapping);
 }
 
+// static
+bool ParserUtil::isReadOnly(const Sentence *sentence) {
+  switch (sentence->kind()) {
+    case Sentence::Kind::kGo:
+    case Sentence::Kind::kMatch:
+    case Sentence::Kind::kLookup:
+    case Sentence::Kind::kFetchVertices:
+    case Sentence::Kind::kFetchEdges:
+    case Sentence::Kind::kFindPath:
+    case Sentence::Kind::kGetSubgraph:
+    case Sentence::Kind::kYield:
+    case Sentence::Kind::kOrderBy:
+    case Sentence::Kind::kLimit:
+    case Sentence::Kind::kGroupBy:
+    case Sentence::Kind::kUnwind:
+      return true;
+    // e.g. GO ... | DELETE VERTEX $-.id
+    case Sentence::Kind::kPipe: {
+      auto *pipe = static_cast<const PipedSentence *>(sentence);
+      return isReadOnly(pipe->left()) && isReadOnly(pipe->right());
+    }
+    case Sentence::Kind::kSet: {
+      auto *set = const_cast<SetSentence *>(static_cast<const SetSentence *>(sentence));
+      return isReadOnly(set->left()) && isReadOnly(set->right());
+    }
+    case Sentence::Kind::kSequential: {
+      auto sentences = static_cast<const SequentialSentences *>(sentence)->sentences();
+      return std::all_of(sentences.begin(), sentences.end(), isReadOnly);
+    }
+    default:
+      return false;
+  }
+}
+
+// static
+bool ParserUtil::isMutation(const Sentence *sentence) {
+  // No default branch, so that a new kind of sentence must be classified here
+  switch (sentence->kind()) {
+    case Sentence::Kind::kInsertVertices:
+    case Sentence::Kind::kInsertEdges:
+    case Sentence::Kind::kUpdateVertex:
+    case Sentence::Kind::kUpdateEdge:
+    case Sentence::Kind::kDeleteVertices:
+    case Sentence::Kind::kDeleteTags:
+    case Sentence::Kind::kDeleteEdges:
+    case Sentence::Kind::kCreateTag:
+    case Sentence::Kind::kAlterTag:
+    case Sentence::Kind::kDropTag:
+    case Sentence::Kind::kCreateEdge:
+    case Sentence::Kind::kAlterEdge:
+    case Sentence::Kind::kDropEdge:
+    case Sentence::Kind::kCreateTagIndex:
+    case Sentence::Kind::kCreateEdgeIndex:
+    case Sentence::Kind::kDropTagIndex:
+    case Sentence::Kind::kDropEdgeIndex:
+    case Sentence::Kind::kCreateFTIndex:
+    case Sentence::Kind::kDropFTIndex:
+    case Sentence::Kind::kCreateSpace:
+    case Sentence::Kind::kCreateSpaceAs:
+    case Sentence::Kind::kAlterSpace:
+    case Sentence::Kind::kDropSpace:
+    case Sentence::Kind::kClearSpace:
+    // e.g. rebuilding indexes, ingesting or collecting stats
+    case Sentence::Kind::kAdminJob:
+    case Sentence::Kind::kCreateUser:
+    case Sentence::Kind::kDropUser:
+    case Sentence::Kind::kAlterUser:
+    case Sentence::Kind::kChangePassword:
+    case Sentence::Kind::kGrant:
+    case Sentence::Kind::kRevoke:
+    case Sentence::Kind::kUnknown:
+      return true;
+    case Sentence::Kind::kGo:
+    case Sentence::Kind::kMatch:
+    case Sentence::Kind::kLookup:
+    case Sentence::Kind::kFetchVertices:
+    case Sentence::Kind::kFetchEdges:
+    case Sentence::Kind::kFindPath:
+    case Sentence::Kind::kGetSubgraph:
+    case Sentence::Kind::kRandomWalk:
+    case Sentence::Kind::kRunAlgorithm:
+    case Sentence::Kind::kYield:
+    case Sentence::Kind::kOrderBy:
+    case Sentence::Kind::kLimit:
+    case Sentence::Kind::kGroupBy:
+    case Sentence::Kind::kUnwind:
+    case Sentence::Kind::kReturn:
+    case Sentence::Kind::kUse:
+    case Sentence::Kind::kDescribeTag:
+    case Sentence::Kind::kDescribeEdge:
+    case Sentence::Kind::kDescribeTagIndex:
+    case Sentence::Kind::kDescribeEdgeIndex:
+    case Sentence::Kind::kDescribeSpace:
+    case Sentence::Kind::kDescribeUser:
+    case Sentence::Kind::kDescribeZone:
+    case Sentence::Kind::kShowHosts:
+    case Sentence::Kind::kShowSpaces:
+    case Sentence::Kind::kShowParts:
+    case Sentence::Kind::kShowTags:
+    case Sentence::Kind::kShowEdges:
+    case Sentence::Kind::kShowTagIndexes:
+    case Sentence::Kind::kShowEdgeIndexes:
+    case Sentence::Kind::kShowTagIndexStatus:
+    case Sentence::Kind::kShowEdgeIndexStatus:
+    case Sentence::Kind::kShowUsers:
+    case Sentence::Kind::kShowRoles:
+    case Sentence::Kind::kShowCreateSpace:
+    case Sentence::Kind::kShowCreateTag:
+    case Sentence::Kind::kShowCreateEdge:
+    case Sentence::Kind::kShowCreateTagIndex:
+    case Sentence::Kind::kShowCreateEdgeIndex:
+    case Sentence::Kind::kShowSnapshots:
+    case Sentence::Kind::kShowCharset:
+    case Sentence::Kind::kShowCollation:
+    case Sentence::Kind::kShowGroups:
+    case Sentence::Kind::kShowZones:
+    case Sentence::Kind::kShowStats:
+    case Sentence::Kind::kShowServiceClients:
+    case Sentence::Kind::kShowFTIndexes:
+    case Sentence::Kind::kShowConfigs:
+    case Sentence::Kind::kShowListener:
+    case Sentence::Kind::kShowSessions:
+    case Sentence::Kind::kShowQueries:
+    case Sentence::Kind::kShowMetaLeader:
+    case Sentence::Kind::kAdminShowJobs:
+    case Sentence::Kind::kListZones:
+    case Sentence::Kind::kGetConfig:
+    // The cluster management doesn't change what the queries return
+    case Sentence::Kind::kSetConfig:
+    case Sentence::Kind::kAddHosts:
+    case Sentence::Kind::kDropHosts:
+    case Sentence::Kind::kMergeZone:
+    case Sentence::Kind::kRenameZone:
+    case Sentence::Kind::kDropZone:
+    case Sentence::Kind::kDivideZone:
+    case Sentence::Kind::kAddHostsIntoZone:
+    case Sentence::Kind::kAddListener:
+    case Sentence::Kind::kRemoveListener:
+    case Sentence::Kind::kSignInService:
+    case Sentence::Kind::kSignOutService:
+    case Sentence::Kind::kCreateSnapshot:
+    case Sentence::Kind::kDropSnapshot:
+    case Sentence::Kind::kKillSession:
+    case Sentence::Kind::kKillQuery:
+      return false;
+    case Sentence::Kind::kExplain: {
+      auto *explain = static_cast<const ExplainSentence *>(sentence);
+      return explain->isProfile() && isMutation(explain->seqSentences());
+    }
+    case Sentence::Kind::kAssignment:
+      return isMutation(static_cast<const AssignmentSentence *>(sentence)->sentence());
+    case Sentence::Kind::kPipe: {
+      auto *pipe = static_cast<const PipedSentence *>(sentence);
+      return isMutation(pipe->left()) || isMutation(pipe->right());
+    }
+    case Sentence::Kind::kSet: {
+      auto *set = const_cast<SetSentence *>(static_cast<const SetSentence *>(sentence));
+      return isMutation(set->left()) || isMutation(set->right());
+    }
+    case Sentence::Kind::kSequential: {
+      auto sentences = static_cast<const SequentialSentences *>(sentence)->sentences();
+      return std::any_of(sentences.begin(), sentences.end(), isMutation);
+    }
+  }
+  DLOG(FATAL) << "Unknown sentence kind: " << static_cast<uint32_t>(sentence->kind());
+  return true;
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -38,6 +38,14 @@ class ParserUtil final {
                             ReduceExpression *reduce,
                             const std::string &oldAccName,
                             const std::string &oldVarName);
+
+  // Returns true if the sentence neither modifies the data or schema nor defines variables.
+  static bool isReadOnly(const Sentence *sentence);
+
+  // Returns true if the sentence may modify the data, schema or indexes of a space, or the roles of
+  // users. Unlike isReadOnly(), SHOW, DESCRIBE and EXPLAIN are not mutations, while PROFILE is the
+  // same as the sentence profiled.
+  static bool isMutation(const Sentence *sentence);
 };
 
 }  // namespace graph
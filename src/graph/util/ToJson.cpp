@@ -148,12 +148,31 @@ folly::dynamic toJson(const meta::cpp2::SchemaProp &prop) {
 
 folly::dynamic toJson(const meta::cpp2::IndexParams &params) {
   folly::dynamic object = folly::dynamic::object();
+  if (params.s2_min_level_ref().has_value()) {
+    object.insert("s2_min_level", *params.s2_min_level_ref());
+  }
   if (params.s2_max_level_ref().has_value()) {
     object.insert("s2_max_level", *params.s2_max_level_ref());
   }
   if (params.s2_max_cells_ref().has_value()) {
     object.insert("s2_max_cells", *params.s2_max_cells_ref());
   }
+  if (params.vector_metric_ref().has_value()) {
+    object.insert("vector_metric", apache::thrift::util::enumNameSafe(*params.vector_metric_ref()));
+  }
+  if (params.hnsw_m_ref().has_value()) {
+    object.insert("hnsw_m", *params.hnsw_m_ref());
+  }
+  if (params.hnsw_ef_construction_ref().has_value()) {
+    object.insert("hnsw_ef_construction", *params.hnsw_ef_construction_ref());
+  }
+  if (params.included_fields_ref().has_value()) {
+    folly::dynamic fields = folly::dynamic::array();
+    for (const auto &field : *params.included_fields_ref()) {
+      fields.push_back(field);
+    }
+    object.insert("included_fields", std::move(fields));
+  }
   return object;
 }
 
@@ -290,6 +309,34 @@ folly::dynamic toJson(const storage::cpp2::IndexQueryContext &iqc) {
       iqc.get_filter().empty() ? "" : Expression::decode(&tempPool, iqc.get_filter())->toString();
   obj.insert("filter", filter);
   obj.insert("columnHints", toJson(iqc.get_column_hints()));
+  if (iqc.range_hints_ref().has_value()) {
+    folly::dynamic rangeHints = folly::dynamic::array();
+    for (const auto &hints : *iqc.range_hints_ref()) {
+      rangeHints.push_back(toJson(hints));
+    }
+    obj.insert("rangeHints", rangeHints);
+  }
+  if (iqc.get_skip_scan()) {
+    obj.insert("skipScan", true);
+  }
+  if (iqc.vector_query_ref().has_value()) {
+    const auto &query = *iqc.vector_query_ref();
+    folly::dynamic vectorQuery = folly::dynamic::object();
+    vectorQuery.insert("dimension", query.get_vector().size());
+    vectorQuery.insert("k", query.get_k());
+    if (query.ef_ref().has_value()) {
+      vectorQuery.insert("ef", *query.ef_ref());
+    }
+    obj.insert("vectorQuery", vectorQuery);
+  }
+  if (iqc.geo_knn_query_ref().has_value()) {
+    const auto &query = *iqc.geo_knn_query_ref();
+    folly::dynamic geoKnnQuery = folly::dynamic::object();
+    geoKnnQuery.insert("longitude", query.get_longitude());
+    geoKnnQuery.insert("latitude", query.get_latitude());
+    geoKnnQuery.insert("k", query.get_k());
+    obj.insert("geoKnnQuery", geoKnnQuery);
+  }
   return obj;
 }
 
@@ -0,0 +1,137 @@
+// Copyright (c) 2023 vesoft inc. All rights reserved.
+//
+// This source code is licensed under Apache 2.0 License.
+
+#include <gtest/gtest.h>
+
+#include "common/expression/ConstantExpression.h"
+#include "graph/context/QueryContext.h"
+#include "graph/util/CardinalityEstimator.h"
+#include "parser/GQLParser.h"
+
+namespace nebula {
+namespace graph {
+
+class CardinalityEstimatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    qctx_ = std::make_unique<QueryContext>();
+  }
+
+  void TearDown() override {
+    qctx_.reset();
+  }
+
+  Expression *parse(const std::string &expr) {
+    std::string query = "LOOKUP on t1 WHERE " + expr;
+    GQLParser parser(qctx_.get());
+    auto result = parser.parse(std::move(query));
+    CHECK(result.ok()) << result.status();
+    auto stmt = std::move(result).value();
+    auto *seq = static_cast<SequentialSentences *>(stmt.get());
+    auto *lookup = static_cast<LookupSentence *>(seq->sentences()[0]);
+    return lookup->whereClause()->filter()->clone();
+  }
+
+  double selectivity(const std::string &expr) {
+    return CardinalityEstimator::filterSelectivity(parse(expr));
+  }
+
+ protected:
+  std::unique_ptr<QueryContext> qctx_;
+};
+
+TEST_F(CardinalityEstimatorTest, FilterSelectivity) {
+  EXPECT_DOUBLE_EQ(1.0, CardinalityEstimator::filterSelectivity(nullptr));
+  EXPECT_DOUBLE_EQ(CardinalityEstimator::kEqualSelectivity, selectivity("t1.c1 == 1"));
+  EXPECT_DOUBLE_EQ(1 - CardinalityEstimator::kEqualSelectivity, selectivity("t1.c1 != 1"));
+  EXPECT_DOUBLE_EQ(CardinalityEstimator::kRangeSelectivity, selectivity("t1.c1 > 1"));
+  EXPECT_DOUBLE_EQ(CardinalityEstimator::kLikeSelectivity, selectivity("t1.c1 STARTS WITH \"a\""));
+  EXPECT_DOUBLE_EQ(3 * CardinalityEstimator::kEqualSelectivity, selectivity("t1.c1 IN [1, 2, 3]"));
+  EXPECT_DOUBLE_EQ(1.0, selectivity("t1.c1 IN [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11]"));
+  EXPECT_DOUBLE_EQ(1 - CardinalityEstimator::kEqualSelectivity, selectivity("NOT t1.c1 == 1"));
+  {
+    // Conjunctions multiply the selectivity of operands
+    auto s1 = CardinalityEstimator::kEqualSelectivity;
+    auto s2 = CardinalityEstimator::kRangeSelectivity;
+    EXPECT_DOUBLE_EQ(s1 * s2, selectivity("t1.c1 == 1 AND t1.c2 < 2"));
+  }
+  {
+    auto s1 = CardinalityEstimator::kEqualSelectivity;
+    auto s2 = CardinalityEstimator::kRangeSelectivity;
+    EXPECT_DOUBLE_EQ(s1 + s2 - s1 * s2, selectivity("t1.c1 == 1 OR t1.c2 < 2"));
+  }
+  {
+    // More predicates never select more rows
+    auto s1 = selectivity("t1.c1 == 1");
+    auto s2 = selectivity("t1.c1 == 1 AND t1.c2 == 2");
+    auto s3 = selectivity("t1.c1 == 1 AND t1.c2 == 2 AND t1.c3 > 3");
+    EXPECT_LT(s2, s1);
+    EXPECT_LT(s3, s2);
+  }
+}
+
+TEST_F(CardinalityEstimatorTest, WithoutStats) {
+  CardinalityEstimator estimator(qctx_.get(), 1);
+  ASSERT_FALSE(estimator.hasStats());
+  EXPECT_DOUBLE_EQ(CardinalityEstimator::kDefaultVertices, estimator.numVertices());
+  EXPECT_DOUBLE_EQ(CardinalityEstimator::kDefaultEdges, estimator.numEdges());
+  EXPECT_DOUBLE_EQ(estimator.numVertices(1), estimator.numVertices(2));
+
+  auto outDegree = estimator.avgDegree({}, storage::cpp2::EdgeDirection::OUT_EDGE);
+  auto bothDegree = estimator.avgDegree({}, storage::cpp2::EdgeDirection::BOTH);
+  EXPECT_DOUBLE_EQ(2 * outDegree, bothDegree);
+  EXPECT_DOUBLE_EQ(estimator.avgDegree({1, -1}, storage::cpp2::EdgeDirection::BOTH),
+                   2 * estimator.avgDegree({1}, storage::cpp2::EdgeDirection::OUT_EDGE));
+
+  auto all = estimator.scanRows({1}, false);
+  auto filtered = estimator.scanRows({1}, false, ConstantExpression::make(qctx_->objPool(), true));
+  EXPECT_DOUBLE_EQ(all * CardinalityEstimator::kDefaultSelectivity, filtered);
+  EXPECT_DOUBLE_EQ(2 * all, estimator.scanRows({1, 2}, false));
+
+  storage::cpp2::IndexQueryContext ictx;
+  EXPECT_DOUBLE_EQ(1.0, estimator.indexSelectivity(ictx));
+  storage::cpp2::IndexColumnHint hint;
+  hint.scan_type_ref() = storage::cpp2::ScanType::PREFIX;
+  ictx.column_hints_ref()->emplace_back(hint);
+  EXPECT_DOUBLE_EQ(CardinalityEstimator::kEqualSelectivity, estimator.indexSelectivity(ictx));
+  EXPECT_DOUBLE_EQ(estimator.numVertices(1) * CardinalityEstimator::kEqualSelectivity,
+                   estimator.indexScanRows(1, false, {ictx}));
+}
+
+TEST_F(CardinalityEstimatorTest, ColumnSelectivity) {
+  // 1000 rows, 100 of them are null, the non-null values are 0..899
+  meta::cpp2::IndexColumnStats column;
+  column.name_ref() = "c1";
+  column.ndv_ref() = 900;
+  column.null_count_ref() = 100;
+  for (int64_t i = 1; i <= 9; ++i) {
+    column.histogram_ref()->emplace_back(i * 100 - 1);
+  }
+
+  storage::cpp2::IndexColumnHint hint;
+  hint.column_name_ref() = "c1";
+  hint.scan_type_ref() = storage::cpp2::ScanType::PREFIX;
+  hint.begin_value_ref() = 10;
+  EXPECT_DOUBLE_EQ(0.001, CardinalityEstimator::columnSelectivity(column, 1000, hint));
+
+  hint.scan_type_ref() = storage::cpp2::ScanType::RANGE;
+  hint.begin_value_ref() = 199;
+  hint.end_value_ref() = 499;
+  EXPECT_NEAR(0.3, CardinalityEstimator::columnSelectivity(column, 1000, hint), 0.01);
+
+  // Out of the range of histogram
+  hint.begin_value_ref() = 10000;
+  hint.end_value_ref() = 20000;
+  EXPECT_DOUBLE_EQ(0.001, CardinalityEstimator::columnSelectivity(column, 1000, hint));
+
+  // Fall back to the default selectivity without histogram
+  column.histogram_ref()->clear();
+  hint.begin_value_ref() = 199;
+  hint.end_value_ref() = 499;
+  EXPECT_DOUBLE_EQ(0.9 * CardinalityEstimator::kRangeSelectivity,
+                   CardinalityEstimator::columnSelectivity(column, 1000, hint));
+}
+
+}  // namespace graph
+}  // namespace nebula
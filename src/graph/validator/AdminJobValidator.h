@@ -35,6 +35,7 @@ class AdminJobValidator final : public Validator {
           case meta::cpp2::JobType::REBUILD_EDGE_INDEX:
           case meta::cpp2::JobType::REBUILD_FULLTEXT_INDEX:
           case meta::cpp2::JobType::STATS:
+          case meta::cpp2::JobType::INDEX_STATS:
           case meta::cpp2::JobType::COMPACT:
           case meta::cpp2::JobType::FLUSH:
           case meta::cpp2::JobType::DOWNLOAD:
@@ -6,6 +6,7 @@
 #include "graph/validator/LookupValidator.h"
 
 #include "common/base/Status.h"
+#include "common/utils/IndexKeyUtils.h"
 #include "common/meta/NebulaSchemaProvider.h"
 #include "graph/context/ast/QueryAstContext.h"
 #include "graph/planner/plan/Query.h"
@@ -186,6 +187,12 @@ Status LookupValidator::validateWhere() {
         return Status::SemanticError("Undefined parameters: %s", msg.c_str());
       }
       filter = graph::ExpressionUtils::rewriteParameter(filter, qctx_);
+      auto knnRet = extractKnnSearch(filter);
+      NG_RETURN_IF_ERROR(knnRet);
+      filter = std::move(knnRet).value();
+      if (filter == nullptr) {
+        return Status::OK();
+      }
     }
     auto ret = checkFilter(filter);
     NG_RETURN_IF_ERROR(ret);
@@ -201,6 +208,208 @@ Status LookupValidator::validateWhere() {
   return Status::OK();
 }
 
+// Extract vector_near() or st_knn() which is the filter or an operand of the top level AND, and
+// return the rest of filter, which is nullptr if nothing left.
+StatusOr<Expression*> LookupValidator::extractKnnSearch(Expression* filter) {
+  auto knnName = [](const Expression* expr) -> std::string {
+    if (expr->kind() != ExprKind::kFunctionCall) {
+      return "";
+    }
+    auto name = static_cast<const FunctionCallExpression*>(expr)->name();
+    folly::toLowerAscii(name);
+    return name == "vector_near" || name == "st_knn" ? name : "";
+  };
+  auto isKnn = [&knnName](const Expression* expr) { return !knnName(expr).empty(); };
+  FunctionCallExpression* knnExpr = nullptr;
+  Expression* rest = filter;
+  if (isKnn(filter)) {
+    knnExpr = static_cast<FunctionCallExpression*>(filter);
+    rest = nullptr;
+  } else if (filter->kind() == ExprKind::kLogicalAnd) {
+    ExpressionUtils::pullAnds(filter);
+    std::vector<Expression*> operands;
+    for (auto* operand : static_cast<LogicalExpression*>(filter)->operands()) {
+      if (!isKnn(operand)) {
+        operands.emplace_back(operand);
+      } else if (knnExpr == nullptr) {
+        knnExpr = static_cast<FunctionCallExpression*>(operand);
+      } else {
+        return Status::SemanticError("Only one vector_near() or st_knn() is allowed in `%s'",
+                                     filter->toString().c_str());
+      }
+    }
+    if (knnExpr != nullptr) {
+      if (operands.size() == 1) {
+        rest = operands.front();
+      } else {
+        auto* andExpr = LogicalExpression::makeAnd(qctx_->objPool());
+        andExpr->setOperands(std::move(operands));
+        rest = andExpr;
+      }
+    }
+  }
+  if (knnExpr == nullptr) {
+    auto funcs = ExpressionUtils::collectAll(filter, {ExprKind::kFunctionCall});
+    auto iter = std::find_if(funcs.begin(), funcs.end(), isKnn);
+    if (iter != funcs.end()) {
+      return Status::SemanticError("%s() should be an operand of the top level AND: %s",
+                                   knnName(*iter).c_str(),
+                                   filter->toString().c_str());
+    }
+    return filter;
+  }
+  if (knnName(knnExpr) == "vector_near") {
+    NG_RETURN_IF_ERROR(checkVectorSearch(knnExpr));
+  } else {
+    NG_RETURN_IF_ERROR(checkGeoKnnSearch(knnExpr));
+  }
+  return rest;
+}
+
+// Check the first argument of a k nearest neighbors search, which should be a property of the tag.
+StatusOr<std::string> LookupValidator::checkKnnProp(const FunctionCallExpression* expr) {
+  if (lookupCtx_->isEdge) {
+    return Status::SemanticError("K nearest neighbors search is not supported on edge: %s",
+                                 expr->toString().c_str());
+  }
+  const auto& args = expr->args()->args();
+  if (args[0]->kind() != ExprKind::kLabelAttribute) {
+    return Status::SemanticError("The first argument of %s should be a property",
+                                 expr->toString().c_str());
+  }
+  auto* la = static_cast<const LabelAttributeExpression*>(args[0]);
+  if (la->left()->name() != sentence()->from()) {
+    return Status::SemanticError("Schema name error: %s", la->left()->name().c_str());
+  }
+  return la->right()->value().getStr();
+}
+
+// Evaluate an argument of a k nearest neighbors search, which should be a constant.
+StatusOr<Value> LookupValidator::evalKnnArg(Expression* arg, const FunctionCallExpression* expr) {
+  if (!ExpressionUtils::isEvaluableExpr(arg, qctx_)) {
+    return Status::SemanticError("'%s' is not an evaluable expression in %s",
+                                 arg->toString().c_str(),
+                                 expr->toString().c_str());
+  }
+  return Expression::eval(arg, QueryExpressionContext(qctx_->ectx())());
+}
+
+// Check vector_near(schema.prop, vector, k[, ef]) and build the vector query on the vector index
+// of the property.
+Status LookupValidator::checkVectorSearch(const FunctionCallExpression* expr) {
+  const auto& args = expr->args()->args();
+  if (args.size() < 3 || args.size() > 4) {
+    return Status::SemanticError("Expression %s has wrong number arguments",
+                                 expr->toString().c_str());
+  }
+  auto propRet = checkKnnProp(expr);
+  NG_RETURN_IF_ERROR(propRet);
+  auto prop = std::move(propRet).value();
+
+  auto indexesRet = qctx_->getMetaClient()->getTagIndexesFromCache(spaceId());
+  NG_RETURN_IF_ERROR(indexesRet);
+  auto indexes = std::move(indexesRet).value();
+  auto iter = std::find_if(indexes.begin(), indexes.end(), [this, &prop](const auto& index) {
+    return index->get_schema_id().get_tag_id() == schemaId() &&
+           IndexKeyUtils::isVectorIndex(*index) && index->get_fields().front().get_name() == prop;
+  });
+  if (iter == indexes.end()) {
+    return Status::SemanticError(
+        "No vector index on %s.%s", sentence()->from().c_str(), prop.c_str());
+  }
+
+  auto vecRet = evalKnnArg(args[1], expr);
+  NG_RETURN_IF_ERROR(vecRet);
+  auto vec = std::move(vecRet).value();
+  if (!vec.isList() || vec.getList().empty()) {
+    return Status::SemanticError("The query vector of %s should be a non-empty list",
+                                 expr->toString().c_str());
+  }
+  std::vector<double> query;
+  for (const auto& v : vec.getList().values) {
+    if (!v.isNumeric()) {
+      return Status::SemanticError("The query vector of %s should only contain numbers",
+                                   expr->toString().c_str());
+    }
+    query.emplace_back(v.isInt() ? static_cast<double>(v.getInt()) : v.getFloat());
+  }
+  auto kRet = evalKnnArg(args[2], expr);
+  NG_RETURN_IF_ERROR(kRet);
+  auto k = std::move(kRet).value();
+  if (!k.isInt() || k.getInt() <= 0) {
+    return Status::SemanticError("k of %s should be a positive integer", expr->toString().c_str());
+  }
+
+  storage::cpp2::VectorQuery vectorQuery;
+  vectorQuery.vector_ref() = std::move(query);
+  vectorQuery.k_ref() = k.getInt();
+  if (args.size() == 4) {
+    auto efRet = evalKnnArg(args[3], expr);
+    NG_RETURN_IF_ERROR(efRet);
+    auto ef = std::move(efRet).value();
+    if (!ef.isInt() || ef.getInt() <= 0) {
+      return Status::SemanticError("ef of %s should be a positive integer",
+                                   expr->toString().c_str());
+    }
+    vectorQuery.ef_ref() = ef.getInt();
+  }
+  lookupCtx_->isVectorIndex = true;
+  lookupCtx_->knnIndexId = (*iter)->get_index_id();
+  lookupCtx_->vectorQuery = std::move(vectorQuery);
+  return Status::OK();
+}
+
+// Check st_knn(schema.prop, point, k) and build the query on the geography index of the property.
+Status LookupValidator::checkGeoKnnSearch(const FunctionCallExpression* expr) {
+  const auto& args = expr->args()->args();
+  if (args.size() != 3) {
+    return Status::SemanticError("Expression %s has wrong number arguments",
+                                 expr->toString().c_str());
+  }
+  auto propRet = checkKnnProp(expr);
+  NG_RETURN_IF_ERROR(propRet);
+  auto prop = std::move(propRet).value();
+
+  auto indexesRet = qctx_->getMetaClient()->getTagIndexesFromCache(spaceId());
+  NG_RETURN_IF_ERROR(indexesRet);
+  auto indexes = std::move(indexesRet).value();
+  auto iter = std::find_if(indexes.begin(), indexes.end(), [this, &prop](const auto& index) {
+    const auto& fields = index->get_fields();
+    return index->get_schema_id().get_tag_id() == schemaId() &&
+           !IndexKeyUtils::isVectorIndex(*index) && fields.size() == 1 &&
+           fields.front().get_name() == prop &&
+           fields.front().get_type().get_type() == nebula::cpp2::PropertyType::GEOGRAPHY;
+  });
+  if (iter == indexes.end()) {
+    return Status::SemanticError(
+        "No geography index on %s.%s", sentence()->from().c_str(), prop.c_str());
+  }
+
+  auto pointRet = evalKnnArg(args[1], expr);
+  NG_RETURN_IF_ERROR(pointRet);
+  auto point = std::move(pointRet).value();
+  if (!point.isGeography() || point.getGeography().shape() != GeoShape::POINT) {
+    return Status::SemanticError("The query point of %s should be a point",
+                                 expr->toString().c_str());
+  }
+  auto kRet = evalKnnArg(args[2], expr);
+  NG_RETURN_IF_ERROR(kRet);
+  auto k = std::move(kRet).value();
+  if (!k.isInt() || k.getInt() <= 0) {
+    return Status::SemanticError("k of %s should be a positive integer", expr->toString().c_str());
+  }
+
+  const auto& coord = point.getGeography().point().coord;
+  storage::cpp2::GeoKnnQuery geoKnnQuery;
+  geoKnnQuery.longitude_ref() = coord.x;
+  geoKnnQuery.latitude_ref() = coord.y;
+  geoKnnQuery.k_ref() = k.getInt();
+  lookupCtx_->isGeoKnn = true;
+  lookupCtx_->knnIndexId = (*iter)->get_index_id();
+  lookupCtx_->geoKnnQuery = std::move(geoKnnQuery);
+  return Status::OK();
+}
+
 StatusOr<Expression*> LookupValidator::handleLogicalExprOperands(LogicalExpression* lExpr) {
   auto& operands = lExpr->operands();
   for (auto i = 0u; i < operands.size(); i++) {
@@ -574,6 +783,7 @@ Status LookupValidator::validateYieldColumn(YieldColumn* col, bool isEdge) {
   }
 
   bool isScoreCol = false;
+  bool isDistanceCol = false;
   switch (col->expr()->kind()) {
     case Expression::Kind::kLabelAttribute: {
       auto expr = static_cast<LabelAttributeExpression*>(col->expr());
@@ -591,6 +801,15 @@ Status LookupValidator::validateYieldColumn(YieldColumn* col, bool isEdge) {
         }
         isScoreCol = true;
         lookupCtx_->hasScore = true;
+      } else if (funcExpr->name() == "distance") {
+        if (!lookupCtx_->isVectorIndex && !lookupCtx_->isGeoKnn) {
+          return Status::SemanticError("distance() should be used with vector_near() or st_knn()");
+        }
+        if (col->alias().empty()) {
+          return Status::SemanticError("Yield column should have an alias for distance()");
+        }
+        isDistanceCol = true;
+        lookupCtx_->hasDistance = true;
       }
       break;
     }
@@ -602,6 +821,9 @@ Status LookupValidator::validateYieldColumn(YieldColumn* col, bool isEdge) {
   if (isScoreCol) {
     // Rewrite score() to $score
     colExpr = VariablePropertyExpression::make(qctx_->objPool(), "", kScore);
+  } else if (isDistanceCol) {
+    // Rewrite distance() to $_distance, which is returned by the vector index scan
+    colExpr = VariablePropertyExpression::make(qctx_->objPool(), "", kDistance);
   } else {
     colExpr = ExpressionUtils::rewriteLabelAttr2PropExpr(col->expr(), isEdge);
   }
@@ -610,7 +832,7 @@ Status LookupValidator::validateYieldColumn(YieldColumn* col, bool isEdge) {
 
   auto typeStatus = deduceExprType(colExpr);
   NG_RETURN_IF_ERROR(typeStatus);
-  auto type = isScoreCol ? Value::Type::FLOAT : typeStatus.value();
+  auto type = isScoreCol || isDistanceCol ? Value::Type::FLOAT : typeStatus.value();
   outputs_.emplace_back(col->name(), type);
   lookupCtx_->yieldExpr->addColumn(col->clone().release());
   if (isEdge) {
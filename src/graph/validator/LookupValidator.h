@@ -33,6 +33,11 @@ class LookupValidator final : public Validator {
   Status validateYieldEdge();
   Status validateYieldColumn(YieldColumn* col, bool isEdge);
 
+  StatusOr<Expression*> extractKnnSearch(Expression* filter);
+  StatusOr<std::string> checkKnnProp(const FunctionCallExpression* expr);
+  StatusOr<Value> evalKnnArg(Expression* arg, const FunctionCallExpression* expr);
+  Status checkVectorSearch(const FunctionCallExpression* expr);
+  Status checkGeoKnnSearch(const FunctionCallExpression* expr);
   StatusOr<Expression*> checkFilter(Expression* expr);
   Status checkRelExpr(RelationalExpression* expr);
   Status checkGeoPredicate(const Expression* expr) const;
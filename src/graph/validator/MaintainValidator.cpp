@@ -615,15 +615,20 @@ Status CreateFTIndexValidator::validateImpl() {
   if (!ok) {
     return Status::SyntaxError("Fulltext index name can only contain [_0-9a-z].");
   }
-  auto esAdapterRet = FTIndexUtils::getESAdapter(qctx_->getMetaClient());
-  NG_RETURN_IF_ERROR(esAdapterRet);
-  auto esAdapter = std::move(esAdapterRet).value();
-  auto existResult = esAdapter.isIndexExist(name.toString());
-  NG_RETURN_IF_ERROR(existResult);
-  if (existResult.value()) {
-    return Status::Error(fmt::format("text search index exist : {}", name));
-  }
   auto space = vctx_->whichSpace();
+  auto localHosts = FTIndexUtils::localFTIndexHosts(qctx_->getMetaClient(), space.id);
+  NG_RETURN_IF_ERROR(localHosts);
+  // The existence of local fulltext index is checked by meta
+  if (localHosts.value().empty()) {
+    auto esAdapterRet = FTIndexUtils::getESAdapter(qctx_->getMetaClient());
+    NG_RETURN_IF_ERROR(esAdapterRet);
+    auto esAdapter = std::move(esAdapterRet).value();
+    auto existResult = esAdapter.isIndexExist(name.toString());
+    NG_RETURN_IF_ERROR(existResult);
+    if (existResult.value()) {
+      return Status::Error(fmt::format("text search index exist : {}", name));
+    }
+  }
   auto status = sentence->isEdge()
                     ? qctx_->schemaMng()->toEdgeType(space.id, *sentence->schemaName())
                     : qctx_->schemaMng()->toTagID(space.id, *sentence->schemaName());
@@ -95,33 +95,53 @@ Status InsertVerticesValidator::check() {
   return Status::OK();
 }
 
+// Rows built by the bulk insert parser carry literal values, which need no evaluation.
+static Status checkLiteralVid(const Value &vid, Value::Type vidType) {
+  if (vid.type() != vidType) {
+    LOG(ERROR) << vid << " is the wrong vertex id type: " << vid.typeName();
+    return Status::Error("Wrong vertex id type: %s", vid.toString().c_str());
+  }
+  return Status::OK();
+}
+
 // Check validity of vertices data.
 // Check vid type, check properties value, fill to NewVertex structure.
 Status InsertVerticesValidator::prepareVertices() {
   vertices_.reserve(rows_.size());
   for (auto i = 0u; i < rows_.size(); i++) {
     auto *row = rows_[i];
-    if (propSize_ != row->values().size()) {
-      return Status::SemanticError("Column count doesn't match value count.");
-    }
-    if (!ExpressionUtils::isEvaluableExpr(row->id(), qctx_)) {
-      LOG(ERROR) << "Wrong vid expression `" << row->id()->toString() << "\"";
-      return Status::SemanticError("Wrong vid expression `%s'", row->id()->toString().c_str());
-    }
-    auto idStatus = SchemaUtil::toVertexID(row->id(), vidType_);
-    NG_RETURN_IF_ERROR(idStatus);
-    auto vertexId = std::move(idStatus).value();
-
-    // check value expr
-    for (auto &value : row->values()) {
-      if (!ExpressionUtils::isEvaluableExpr(value, qctx_)) {
-        LOG(ERROR) << "Insert wrong value: `" << value->toString() << "'.";
-        return Status::SemanticError("Insert wrong value: `%s'.", value->toString().c_str());
+    Value vertexId;
+    std::vector<Value> values;
+    if (row->isLiteral()) {
+      if (propSize_ != row->literals().size()) {
+        return Status::SemanticError("Column count doesn't match value count.");
+      }
+      NG_RETURN_IF_ERROR(checkLiteralVid(row->literalId(), vidType_));
+      vertexId = row->literalId();
+      values = row->literals();
+    } else {
+      if (propSize_ != row->values().size()) {
+        return Status::SemanticError("Column count doesn't match value count.");
+      }
+      if (!ExpressionUtils::isEvaluableExpr(row->id(), qctx_)) {
+        LOG(ERROR) << "Wrong vid expression `" << row->id()->toString() << "\"";
+        return Status::SemanticError("Wrong vid expression `%s'", row->id()->toString().c_str());
       }
+      auto idStatus = SchemaUtil::toVertexID(row->id(), vidType_);
+      NG_RETURN_IF_ERROR(idStatus);
+      vertexId = std::move(idStatus).value();
+
+      // check value expr
+      for (auto &value : row->values()) {
+        if (!ExpressionUtils::isEvaluableExpr(value, qctx_)) {
+          LOG(ERROR) << "Insert wrong value: `" << value->toString() << "'.";
+          return Status::SemanticError("Insert wrong value: `%s'.", value->toString().c_str());
+        }
+      }
+      auto valsRet = SchemaUtil::toValueVec(qctx_, row->values());
+      NG_RETURN_IF_ERROR(valsRet);
+      values = std::move(valsRet).value();
     }
-    auto valsRet = SchemaUtil::toValueVec(qctx_, row->values());
-    NG_RETURN_IF_ERROR(valsRet);
-    auto values = std::move(valsRet).value();
 
     std::vector<storage::cpp2::NewTag> tags(schemas_.size());
     int32_t handleValueNum = 0;
@@ -141,7 +161,7 @@ Status InsertVerticesValidator::prepareVertices() {
     }
 
     storage::cpp2::NewVertex vertex;
-    vertex.id_ref() = vertexId;
+    vertex.id_ref() = std::move(vertexId);
     vertex.tags_ref() = std::move(tags);
     vertices_.emplace_back(std::move(vertex));
   }
@@ -214,76 +234,98 @@ Status InsertEdgesValidator::prepareEdges() {
   auto size = rows_.size() * 2;
   edges_.reserve(size);
 
+  // Resolve every field of the schema to its position in the inserted props, or to its default
+  // value, once for all rows.
   size_t fieldNum = schema_->getNumFields();
+  std::vector<int64_t> propIndexes(fieldNum, -1);
+  std::vector<Expression *> defaultExprs(fieldNum, nullptr);
+  const char *missingField = nullptr;
+  ObjectPool pool;
   for (size_t j = 0; j < fieldNum; ++j) {
-    entirePropNames_.emplace_back(schema_->field(j)->name());
+    auto *field = schema_->field(j);
+    entirePropNames_.emplace_back(field->name());
+    auto iter = std::find(propNames_.begin(), propNames_.end(), entirePropNames_.back());
+    if (iter != propNames_.end()) {
+      propIndexes[j] = std::distance(propNames_.begin(), iter);
+    } else if (field->hasDefault()) {
+      auto &defaultValue = field->defaultValue();
+      DCHECK(!defaultValue.empty());
+      defaultExprs[j] =
+          Expression::decode(&pool, folly::StringPiece(defaultValue.data(), defaultValue.size()));
+    } else if (!field->nullable() && missingField == nullptr) {
+      missingField = field->name();
+    }
   }
+
   for (auto i = 0u; i < rows_.size(); i++) {
     auto *row = rows_[i];
-    if (propNames_.size() != row->values().size()) {
-      return Status::SemanticError("Column count doesn't match value count.");
-    }
-    if (!ExpressionUtils::isEvaluableExpr(row->srcid(), qctx_)) {
-      LOG(ERROR) << "Wrong src vid expression `" << row->srcid()->toString() << "\"";
-      return Status::SemanticError("Wrong src vid expression `%s'",
-                                   row->srcid()->toString().c_str());
-    }
-
-    if (!ExpressionUtils::isEvaluableExpr(row->dstid(), qctx_)) {
-      LOG(ERROR) << "Wrong dst vid expression `" << row->dstid()->toString() << "\"";
-      return Status::SemanticError("Wrong dst vid expression `%s'",
-                                   row->dstid()->toString().c_str());
-    }
+    Value srcId, dstId;
+    std::vector<Value> props;
+    if (row->isLiteral()) {
+      if (propNames_.size() != row->literals().size()) {
+        return Status::SemanticError("Column count doesn't match value count.");
+      }
+      NG_RETURN_IF_ERROR(checkLiteralVid(row->literalSrcid(), vidType_));
+      NG_RETURN_IF_ERROR(checkLiteralVid(row->literalDstid(), vidType_));
+      srcId = row->literalSrcid();
+      dstId = row->literalDstid();
+      props = row->literals();
+    } else {
+      if (propNames_.size() != row->values().size()) {
+        return Status::SemanticError("Column count doesn't match value count.");
+      }
+      if (!ExpressionUtils::isEvaluableExpr(row->srcid(), qctx_)) {
+        LOG(ERROR) << "Wrong src vid expression `" << row->srcid()->toString() << "\"";
+        return Status::SemanticError("Wrong src vid expression `%s'",
+                                     row->srcid()->toString().c_str());
+      }
 
-    auto idStatus = SchemaUtil::toVertexID(row->srcid(), vidType_);
-    NG_RETURN_IF_ERROR(idStatus);
-    auto srcId = std::move(idStatus).value();
-    idStatus = SchemaUtil::toVertexID(row->dstid(), vidType_);
-    NG_RETURN_IF_ERROR(idStatus);
-    auto dstId = std::move(idStatus).value();
+      if (!ExpressionUtils::isEvaluableExpr(row->dstid(), qctx_)) {
+        LOG(ERROR) << "Wrong dst vid expression `" << row->dstid()->toString() << "\"";
+        return Status::SemanticError("Wrong dst vid expression `%s'",
+                                     row->dstid()->toString().c_str());
+      }
 
-    int64_t rank = row->rank();
+      auto idStatus = SchemaUtil::toVertexID(row->srcid(), vidType_);
+      NG_RETURN_IF_ERROR(idStatus);
+      srcId = std::move(idStatus).value();
+      idStatus = SchemaUtil::toVertexID(row->dstid(), vidType_);
+      NG_RETURN_IF_ERROR(idStatus);
+      dstId = std::move(idStatus).value();
 
-    // check value expr
-    for (auto &value : row->values()) {
-      if (!ExpressionUtils::isEvaluableExpr(value, qctx_)) {
-        LOG(ERROR) << "Insert wrong value: `" << value->toString() << "'.";
-        return Status::SemanticError("Insert wrong value: `%s'.", value->toString().c_str());
+      // check value expr
+      for (auto &value : row->values()) {
+        if (!ExpressionUtils::isEvaluableExpr(value, qctx_)) {
+          LOG(ERROR) << "Insert wrong value: `" << value->toString() << "'.";
+          return Status::SemanticError("Insert wrong value: `%s'.", value->toString().c_str());
+        }
       }
+
+      auto valsRet = SchemaUtil::toValueVec(qctx_, row->values());
+      NG_RETURN_IF_ERROR(valsRet);
+      props = std::move(valsRet).value();
     }
 
-    auto valsRet = SchemaUtil::toValueVec(qctx_, row->values());
-    NG_RETURN_IF_ERROR(valsRet);
-    auto props = std::move(valsRet).value();
+    int64_t rank = row->rank();
+    if (missingField != nullptr) {
+      return Status::SemanticError("The property `%s' is not nullable and has no default value.",
+                                   missingField);
+    }
 
     std::vector<Value> entirePropValues;
+    entirePropValues.reserve(fieldNum);
     for (size_t j = 0; j < fieldNum; ++j) {
-      auto *field = schema_->field(j);
-      auto propName = entirePropNames_[j];
-      auto iter = std::find(propNames_.begin(), propNames_.end(), propName);
-      if (iter == propNames_.end()) {
-        if (field->hasDefault()) {
-          auto &defaultValue = field->defaultValue();
-          DCHECK(!defaultValue.empty());
-          ObjectPool pool;
-          auto expr = Expression::decode(
-              &pool, folly::StringPiece(defaultValue.data(), defaultValue.size()));
-          auto v = expr->eval(QueryExpressionContext()(nullptr));
-          entirePropValues.emplace_back(v);
-        } else {
-          if (!field->nullable()) {
-            return Status::SemanticError(
-                "The property `%s' is not nullable and has no default value.", field->name());
-          }
-          entirePropValues.emplace_back(Value(NullType::__NULL__));
-        }
-      } else {
-        auto v = props[std::distance(propNames_.begin(), iter)];
-        if (!field->nullable() && v.isNull()) {
+      if (propIndexes[j] >= 0) {
+        auto &v = props[propIndexes[j]];
+        if (!schema_->field(j)->nullable() && v.isNull()) {
           return Status::SemanticError("The non-nullable property `%s' could not be NULL.",
-                                       field->name());
+                                       schema_->field(j)->name());
         }
-        entirePropValues.emplace_back(v);
+        entirePropValues.emplace_back(std::move(v));
+      } else if (defaultExprs[j] != nullptr) {
+        entirePropValues.emplace_back(defaultExprs[j]->eval(QueryExpressionContext()(nullptr)));
+      } else {
+        entirePropValues.emplace_back(Value(NullType::__NULL__));
       }
     }
     storage::cpp2::NewEdge edge;
@@ -298,10 +340,10 @@ Status InsertEdgesValidator::prepareEdges() {
     edges_.emplace_back(edge);
     {
       // inbound
-      key.src_ref() = dstId;
-      key.dst_ref() = srcId;
+      key.src_ref() = std::move(dstId);
+      key.dst_ref() = std::move(srcId);
       key.edge_type_ref() = -edgeType_;
-      edge.key_ref() = key;
+      edge.key_ref() = std::move(key);
       edges_.emplace_back(std::move(edge));
     }
   }
@@ -0,0 +1,82 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/validator/RandomWalkValidator.h"
+
+#include "graph/service/GraphFlags.h"
+#include "graph/util/SchemaUtil.h"
+#include "graph/util/ValidateUtil.h"
+#include "parser/TraverseSentences.h"
+
+namespace nebula {
+namespace graph {
+
+Status RandomWalkValidator::validateImpl() {
+  auto* rwSentence = static_cast<RandomWalkSentence*>(sentence_);
+  walkCtx_ = getContext<RandomWalkContext>();
+
+  NG_RETURN_IF_ERROR(ValidateUtil::validateStep(rwSentence->step(), walkCtx_->steps));
+  if (walkCtx_->steps.isMToN()) {
+    return Status::SemanticError("`%s', only a fixed number of steps is supported by random walk",
+                                 walkCtx_->steps.toString().c_str());
+  }
+  if (walkCtx_->steps.steps() == 0) {
+    return Status::SemanticError("`%s', a random walk should take at least one step",
+                                 walkCtx_->steps.toString().c_str());
+  }
+  NG_RETURN_IF_ERROR(validateStarts(rwSentence->from(), walkCtx_->from));
+  NG_RETURN_IF_ERROR(ValidateUtil::validateOver(qctx_, rwSentence->over(), walkCtx_->over));
+  NG_RETURN_IF_ERROR(validateWeight(rwSentence->weightProp()));
+
+  auto restart = rwSentence->restart();
+  if (restart < 0.0 || restart >= 1.0) {
+    return Status::SemanticError("The restart probability should be within [0, 1), but was %f",
+                                 restart);
+  }
+  walkCtx_->restart = restart;
+
+  auto walks = rwSentence->walks();
+  if (walks <= 0 || walks > FLAGS_max_random_walks_per_start) {
+    return Status::SemanticError("The walks per start should be within [1, %u], but was %ld",
+                                 FLAGS_max_random_walks_per_start,
+                                 walks);
+  }
+  walkCtx_->walks = walks;
+
+  outputs_.emplace_back("seed", vidType_);
+  outputs_.emplace_back("walk", Value::Type::LIST);
+  walkCtx_->colNames = getOutColNames();
+  return Status::OK();
+}
+
+Status RandomWalkValidator::validateWeight(const std::string* prop) {
+  if (prop == nullptr) {
+    return Status::OK();
+  }
+  auto spaceId = space_.id;
+  for (auto edgeType : walkCtx_->over.edgeTypes) {
+    auto schema = qctx_->schemaMng()->getEdgeSchema(spaceId, edgeType);
+    if (schema == nullptr) {
+      return Status::SemanticError("No schema found for edge type %d", edgeType);
+    }
+    auto edgeName = qctx_->schemaMng()->toEdgeName(spaceId, edgeType);
+    NG_RETURN_IF_ERROR(edgeName);
+    if (schema->getFieldIndex(*prop) < 0) {
+      return Status::SemanticError(
+          "`%s' not found in edge `%s'", prop->c_str(), edgeName.value().c_str());
+    }
+    auto type = SchemaUtil::propTypeToValueType(schema->getFieldType(*prop));
+    if (type != Value::Type::INT && type != Value::Type::FLOAT) {
+      return Status::SemanticError("The weight `%s.%s' should be numeric",
+                                   edgeName.value().c_str(),
+                                   prop->c_str());
+    }
+  }
+  walkCtx_->weightProp = *prop;
+  return Status::OK();
+}
+
+}  // namespace graph
+}  // namespace nebula
@@ -0,0 +1,35 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_VALIDATOR_RANDOMWALKVALIDATOR_H_
+#define GRAPH_VALIDATOR_RANDOMWALKVALIDATOR_H_
+
+#include "graph/context/ast/QueryAstContext.h"
+#include "graph/validator/Validator.h"
+
+namespace nebula {
+namespace graph {
+
+class RandomWalkValidator final : public Validator {
+ public:
+  RandomWalkValidator(Sentence* sentence, QueryContext* context) : Validator(sentence, context) {}
+
+ private:
+  Status validateImpl() override;
+
+  AstContext* getAstContext() override {
+    return walkCtx_.get();
+  }
+
+  // The weight must be a numeric prop of all the edge types walked over
+  Status validateWeight(const std::string* prop);
+
+ private:
+  std::unique_ptr<RandomWalkContext> walkCtx_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // GRAPH_VALIDATOR_RANDOMWALKVALIDATOR_H_
@@ -0,0 +1,88 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/validator/RunAlgorithmValidator.h"
+
+#include "graph/service/GraphFlags.h"
+#include "graph/util/ExpressionUtils.h"
+#include "graph/util/ValidateUtil.h"
+#include "parser/TraverseSentences.h"
+
+namespace nebula {
+namespace graph {
+
+namespace {
+
+double toDouble(const Value& value) {
+  return value.isInt() ? static_cast<double>(value.getInt()) : value.getFloat();
+}
+
+}  // namespace
+
+Status RunAlgorithmValidator::validateImpl() {
+  auto* algoSentence = static_cast<RunAlgorithmSentence*>(sentence_);
+  algoCtx_ = getContext<GraphAlgoContext>();
+
+  auto algorithm = *algoSentence->algorithm();
+  folly::toLowerAscii(algorithm);
+  if (algorithm != "pagerank" && algorithm != "wcc" && algorithm != "lpa") {
+    return Status::SemanticError("Unknown algorithm `%s', expected one of pagerank, wcc and lpa",
+                                 algoSentence->algorithm()->c_str());
+  }
+  algoCtx_->algorithm = std::move(algorithm);
+  NG_RETURN_IF_ERROR(ValidateUtil::validateOver(qctx_, algoSentence->over(), algoCtx_->over));
+  NG_RETURN_IF_ERROR(validateOptions(algoSentence->options()));
+
+  outputs_.emplace_back("vid", vidType_);
+  if (algoCtx_->algorithm == "pagerank") {
+    outputs_.emplace_back("score", Value::Type::FLOAT);
+  } else if (algoCtx_->algorithm == "wcc") {
+    outputs_.emplace_back("component", vidType_);
+  } else {
+    outputs_.emplace_back("label", vidType_);
+  }
+  algoCtx_->colNames = getOutColNames();
+  return Status::OK();
+}
+
+Status RunAlgorithmValidator::validateOptions(MapExpression* options) {
+  if (options == nullptr) {
+    return Status::OK();
+  }
+  bool isPageRank = algoCtx_->algorithm == "pagerank";
+  QueryExpressionContext ctx(qctx_->ectx());
+  for (const auto& item : options->items()) {
+    const auto& name = item.first;
+    if (!ExpressionUtils::isEvaluableExpr(item.second, qctx_)) {
+      return Status::SemanticError("`%s' is not evaluable.", item.second->toString().c_str());
+    }
+    auto value = item.second->eval(ctx());
+    if (name == "max_iterations") {
+      if (!value.isInt() || value.getInt() <= 0 ||
+          value.getInt() > static_cast<int64_t>(FLAGS_max_graph_algorithm_iterations)) {
+        return Status::SemanticError("`max_iterations' should be an integer within [1, %u]",
+                                     FLAGS_max_graph_algorithm_iterations);
+      }
+      algoCtx_->maxIterations = value.getInt();
+    } else if (isPageRank && name == "damping") {
+      if (!value.isNumeric() || toDouble(value) <= 0.0 || toDouble(value) >= 1.0) {
+        return Status::SemanticError("`damping' should be a number within (0, 1)");
+      }
+      algoCtx_->damping = toDouble(value);
+    } else if (isPageRank && name == "tolerance") {
+      if (!value.isNumeric() || toDouble(value) < 0.0) {
+        return Status::SemanticError("`tolerance' should be a non-negative number");
+      }
+      algoCtx_->tolerance = toDouble(value);
+    } else {
+      return Status::SemanticError(
+          "Unknown option `%s' of algorithm `%s'", name.c_str(), algoCtx_->algorithm.c_str());
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace graph
+}  // namespace nebula
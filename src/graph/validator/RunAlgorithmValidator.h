@@ -0,0 +1,35 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef GRAPH_VALIDATOR_RUNALGORITHMVALIDATOR_H_
+#define GRAPH_VALIDATOR_RUNALGORITHMVALIDATOR_H_
+
+#include "graph/context/ast/QueryAstContext.h"
+#include "graph/validator/Validator.h"
+
+namespace nebula {
+namespace graph {
+
+class RunAlgorithmValidator final : public Validator {
+ public:
+  RunAlgorithmValidator(Sentence* sentence, QueryContext* context)
+      : Validator(sentence, context) {}
+
+ private:
+  Status validateImpl() override;
+
+  AstContext* getAstContext() override {
+    return algoCtx_.get();
+  }
+
+  Status validateOptions(MapExpression* options);
+
+ private:
+  std::unique_ptr<GraphAlgoContext> algoCtx_;
+};
+
+}  // namespace graph
+}  // namespace nebula
+#endif  // GRAPH_VALIDATOR_RUNALGORITHMVALIDATOR_H_
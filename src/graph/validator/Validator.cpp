@@ -30,6 +30,8 @@
 #include "graph/validator/MutateValidator.h"
 #include "graph/validator/OrderByValidator.h"
 #include "graph/validator/PipeValidator.h"
+#include "graph/validator/RandomWalkValidator.h"
+#include "graph/validator/RunAlgorithmValidator.h"
 #include "graph/validator/ReportError.h"
 #include "graph/validator/SequentialValidator.h"
 #include "graph/validator/SetValidator.h"
@@ -262,6 +264,10 @@ std::unique_ptr<Validator> Validator::makeValidator(Sentence* sentence, QueryCon
       return std::make_unique<ClearSpaceValidator>(sentence, context);
     case Sentence::Kind::kUnwind:
       return std::make_unique<UnwindValidator>(sentence, context);
+    case Sentence::Kind::kRandomWalk:
+      return std::make_unique<RandomWalkValidator>(sentence, context);
+    case Sentence::Kind::kRunAlgorithm:
+      return std::make_unique<RunAlgorithmValidator>(sentence, context);
     case Sentence::Kind::kUnknown:
     case Sentence::Kind::kReturn: {
       // nothing
@@ -3,6 +3,7 @@
  * This source code is licensed under Apache 2.0 License.
  */
 
+#include "graph/service/GraphFlags.h"
 #include "graph/validator/MatchValidator.h"
 #include "graph/validator/test/ValidatorTestBase.h"
 
@@ -549,5 +550,23 @@ TEST_F(MatchValidatorTest, validateAlias) {
   }
 }
 
+TEST_F(MatchValidatorTest, MultiwayJoin) {
+  gflags::FlagSaver saver;
+  FLAGS_enable_multiway_join = true;
+  // The cyclic patterns are joined pairwise without the statistics of space
+  std::vector<std::string> queries = {
+      "MATCH (a:person)-[e1:like]->(b)-[e2:like]->(a) RETURN a, b",
+      "MATCH (a:person)-[e1:like]->(b)-[e2:like]->(c)-[e3:like]->(a) RETURN a, b, c",
+      "MATCH (a:person)-[e1:like]->(b), (b)-[e2:like]->(c), (c)-[e3:like]->(a) RETURN a, b, c"};
+  for (const auto& query : queries) {
+    auto result = validate(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+    std::vector<PlanNode::Kind> kinds;
+    bfsTraverse(result.value()->plan()->root(), kinds);
+    EXPECT_EQ(kinds.end(), std::find(kinds.begin(), kinds.end(), PlanNode::Kind::kMultiwayJoin))
+        << query;
+  }
+}
+
 }  // namespace graph
 }  // namespace nebula
@@ -1006,6 +1006,31 @@ TEST_F(QueryValidatorTest, TestSetValidator) {
   }
 }
 
+TEST_F(QueryValidatorTest, TestConcurrentStatements) {
+  {
+    std::string query = "YIELD 1 AS a; YIELD 2 AS b";
+    std::vector<PlanNode::Kind> expected = {
+        PK::kPassThrough,
+        PK::kProject,
+        PK::kProject,
+        PK::kStart,
+    };
+    EXPECT_TRUE(checkResult(query, expected));
+  }
+  {
+    std::string query = "YIELD 1 AS a; YIELD 2 AS b; $var = YIELD 3 AS c; YIELD $var.c AS c";
+    std::vector<PlanNode::Kind> expected = {
+        PK::kProject,
+        PK::kProject,
+        PK::kPassThrough,
+        PK::kProject,
+        PK::kProject,
+        PK::kStart,
+    };
+    EXPECT_TRUE(checkResult(query, expected));
+  }
+}
+
 TEST_F(QueryValidatorTest, TestMaxAllowedStatements) {
   std::vector<std::string> stmts;
   for (uint32_t i = 0; i < FLAGS_max_allowed_statements; i++) {
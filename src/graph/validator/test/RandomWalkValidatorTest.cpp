@@ -0,0 +1,89 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "graph/service/GraphFlags.h"
+#include "graph/validator/test/ValidatorTestBase.h"
+
+namespace nebula {
+namespace graph {
+
+class RandomWalkValidatorTest : public ValidatorTestBase {};
+
+using PK = nebula::graph::PlanNode::Kind;
+
+TEST_F(RandomWalkValidatorTest, Valid) {
+  std::vector<PlanNode::Kind> expected = {PK::kRandomWalk, PK::kStart};
+  {
+    std::string query = "RANDOM WALK 3 STEPS FROM \"1\", \"2\" OVER like BIDIRECT WALKS 10";
+    EXPECT_TRUE(checkResult(query, expected, {"seed", "walk"}));
+  }
+  {
+    std::string query = "RANDOM WALK 5 STEPS FROM \"1\" OVER like WEIGHT BY likeness RESTART 0.15";
+    EXPECT_TRUE(checkResult(query, expected, {"seed", "walk"}));
+  }
+}
+
+TEST_F(RandomWalkValidatorTest, InvalidLength) {
+  {
+    std::string query = "RANDOM WALK 1 TO 3 STEPS FROM \"1\" OVER like";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: `1 TO 3 STEPS', only a fixed number of steps is supported by "
+              "random walk");
+  }
+  {
+    std::string query = "RANDOM WALK 0 STEPS FROM \"1\" OVER like";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: `0 STEPS', a random walk should take at least one step");
+  }
+}
+
+TEST_F(RandomWalkValidatorTest, InvalidCount) {
+  gflags::FlagSaver saver;
+  FLAGS_max_random_walks_per_start = 10;
+  {
+    std::string query = "RANDOM WALK FROM \"1\" OVER like WALKS 0";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: The walks per start should be within [1, 10], but was 0");
+  }
+  {
+    std::string query = "RANDOM WALK FROM \"1\" OVER like WALKS 11";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: The walks per start should be within [1, 10], but was 11");
+  }
+  {
+    std::string query = "RANDOM WALK FROM \"1\" OVER like RESTART 1.0";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: The restart probability should be within [0, 1), but was 1.000000");
+  }
+}
+
+TEST_F(RandomWalkValidatorTest, InvalidWeight) {
+  {
+    std::string query = "RANDOM WALK FROM \"1\" OVER like WEIGHT BY nope";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()), "SemanticError: `nope' not found in edge `like'");
+  }
+  {
+    // Only found in some of the edges
+    std::string query = "RANDOM WALK FROM \"1\" OVER like, serve WEIGHT BY likeness";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: `likeness' not found in edge `serve'");
+  }
+  {
+    std::string query = "RANDOM WALK FROM \"1\" OVER like WEIGHT BY start";
+    auto result = checkResult(query);
+    EXPECT_EQ(std::string(result.message()),
+              "SemanticError: The weight `like.start' should be numeric");
+  }
+}
+
+}  // namespace graph
+}  // namespace nebula
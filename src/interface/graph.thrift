@@ -89,6 +89,19 @@ struct ExecutionResponse {
 } (cpp.type = "nebula::ExecutionResponse", cpp.noncopyable)
 
 
+// Same as ExecutionResponse, but the result is encoded in the Apache Arrow IPC stream format
+struct ExecutionArrowResponse {
+    1: required common.ErrorCode        error_code;
+    2: required i64                     latency_in_us;
+    // The schema, the dictionary batches and one record batch of the result
+    3: optional binary                  data;
+    4: optional binary                  space_name;
+    5: optional binary                  error_msg;
+    6: optional PlanDescription         plan_desc;
+    7: optional binary                  comment;
+}
+
+
 struct AuthResponse {
     1: required common.ErrorCode   error_code;
     2: optional binary             error_msg;
@@ -119,6 +132,10 @@ service GraphService {
     // Same as execute(), but response will be a json string
     binary executeJson(1: i64 sessionId, 2: binary stmt)
     binary executeJsonWithParameter(1: i64 sessionId, 2: binary stmt, 3: map<binary, common.Value>(cpp.template = "std::unordered_map") parameterMap)
+    // Same as executeWithParameter(), but the result is returned as an Arrow IPC stream, which is
+    // read by the dataframe libraries without converting the values one by one. The columns of
+    // mixed types are returned as the text of the values, marked by {"nebula.encoding": "text"}.
+    ExecutionArrowResponse executeArrow(1: i64 sessionId, 2: binary stmt, 3: map<binary, common.Value>(cpp.template = "std::unordered_map") parameterMap)
     
     VerifyClientVersionResp verifyClientVersion(1: VerifyClientVersionReq req)
 }
@@ -141,9 +141,22 @@ struct EdgeItem {
     4: Schema           schema,
 }
 
+// Distance metric of the vector index
+enum VectorMetric {
+    L2      = 0x01,
+    COSINE  = 0x02,
+} (cpp.enum_strict)
+
 struct IndexParams {
-    1: optional i32     s2_max_level,
-    2: optional i32     s2_max_cells,
+    1: optional i32             s2_max_level,
+    2: optional i32             s2_max_cells,
+    // The index is a HNSW vector index if vector_metric is set
+    3: optional VectorMetric    vector_metric,
+    4: optional i32             hnsw_m,
+    5: optional i32             hnsw_ef_construction,
+    6: optional i32             s2_min_level,
+    // Non-key properties stored in the index value, so that they are read without base data
+    7: optional list<binary>    included_fields,
 }
 
 struct IndexItem {
@@ -240,6 +253,7 @@ enum JobType {
     INGEST                   = 8,
     LEADER_BALANCE           = 9,
     ZONE_BALANCE             = 10,
+    INDEX_STATS              = 11,
     UNKNOWN                  = 99,
 } (cpp.enum_strict)
 
@@ -308,6 +322,30 @@ struct Correlativity {
     2: double             proportion,
 }
 
+// Statistics of one column of an index
+struct IndexColumnStats {
+    1: binary                   name,
+    // The number of distinct values, estimated by HyperLogLog
+    2: i64                      ndv,
+    3: i64                      null_count,
+    // The upper bounds of equi-depth histogram buckets in ascending order,
+    // every bucket holds about the same number of rows.
+    4: list<common.Value>       histogram,
+    // The registers of HyperLogLog, used to merge the results of partitions
+    5: optional binary          sketch,
+    // The values sampled from partitions, used to build the histogram
+    6: optional list<common.Value> samples,
+}
+
+struct IndexStats {
+    1: common.IndexID           index_id,
+    // The number of entries of the index
+    2: i64                      rows,
+    3: list<IndexColumnStats>   columns,
+    // The time in seconds when the statistics is collected
+    4: i64                      update_time,
+}
+
 struct StatsItem {
     // The number of vertices of tagName
     1: map<binary, i64>
@@ -328,6 +366,9 @@ struct StatsItem {
     6: map<common.PartitionID, list<Correlativity>>
         (cpp.template = "std::unordered_map") negative_part_correlativity,
     7: JobStatus                              status,
+    // The statistics of indexes, collected by the INDEX_STATS job
+    8: optional map<common.IndexID, IndexStats>
+        (cpp.template = "std::unordered_map") index_stats,
 }
 
 // Graph space related operations.
@@ -902,6 +943,8 @@ struct ListZonesResp {
 enum ListenerType {
     UNKNOWN       = 0x00,
     ELASTICSEARCH = 0x01,
+    // Fulltext index maintained in the listener host itself
+    LOCAL_FULLTEXT = 0x02,
 } (cpp.enum_strict)
 
 struct AddListenerReq {
@@ -1046,6 +1089,8 @@ struct FTIndex {
     2: common.SchemaID      depend_schema,
     3: list<binary>         fields,
     4: binary               analyzer,
+    // Set by meta when created, tells the index created again after dropped with the same name
+    5: optional i64         create_time,
 }
 
 struct CreateFTIndexReq {
@@ -1080,6 +1125,7 @@ struct QueryDesc {
     // The session might transfer between query engines, but the query do not, we must
     // record which query engine the query belongs to
     5: common.HostAddr graph_addr,
+    6: optional i64 peak_memory,
 }
 
 struct Session {
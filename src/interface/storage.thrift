@@ -125,6 +125,17 @@ enum EdgeDirection {
 //
 ///////////////////////////////////////////////////////////
 
+// The filter built from the keys of the other side of a join at runtime, either the keys
+//   themselves or the bloom filter of them
+struct RuntimeFilter {
+    1: optional list<common.Value>              keys,
+    // The bits of bloom filter, each key is hashed as its raw bytes, which are the
+    //   8 bytes of int64 for int vid, or the string itself for string vid
+    2: optional binary                          bloom,
+    3: optional i32                             num_hashes,
+}
+
+
 struct TraverseSpec {
     // When edge_type > 0, going along the out-edge, otherwise, along the in-edge
     // If the edge type list is empty, all edges will be scanned
@@ -163,6 +174,8 @@ struct TraverseSpec {
     //            when filter contains logicalOR expression
     //            bcz $^.player.age > 30 OR like.likeness > 80 can't filter data only by tag_Filter
     12: optional binary                         tag_filter,
+    // If provided, only the edges whose dst satisfied the runtime filter will be returned
+    13: optional RuntimeFilter                  dst_filter,
 }
 
 
@@ -537,6 +550,22 @@ struct IndexColumnHint {
     6: bool                     include_end = false,
 }
 
+struct VectorQuery {
+    1: list<double>             vector,
+    // Number of the nearest neighbors returned in each part
+    2: i32                      k,
+    // Size of the dynamic candidate list when searching, which is at least k
+    3: optional i32             ef,
+}
+
+// Search the k nearest geographies to a point by the geo index
+struct GeoKnnQuery {
+    1: double                   longitude,
+    2: double                   latitude,
+    // Number of the nearest neighbors returned in each part
+    3: i32                      k,
+}
+
 struct IndexQueryContext {
     1: common.IndexID           index_id,
     // filter is an encoded expression of where clause.
@@ -547,6 +576,16 @@ struct IndexQueryContext {
     //    to be empty, At least one index column must be hit.
     // When the field size of index_id IndexItem is zero, the columns_hints must be empty.
     3: list<IndexColumnHint>    column_hints,
+    // Search the nearest neighbors by the vector index, column_hints must be empty
+    4: optional VectorQuery     vector_query,
+    // Search the nearest neighbors by the geo index, column_hints must be empty
+    5: optional GeoKnnQuery     geo_knn_query,
+    // Each element is the column hints of a range like column_hints. When it is not empty,
+    // column_hints is ignored and all ranges are visited in key order by one iterator.
+    6: optional list<list<IndexColumnHint>> range_hints,
+    // The leading field of index is not constrained, the hints begin from the second field.
+    // Storage seeks over the keys of each distinct value of the leading field.
+    7: bool                     skip_scan = false,
 }
 
 
@@ -572,6 +611,44 @@ struct LookupIndexRequest {
 }
 
 
+// Statistics of the fields and terms a fulltext query reads, which are summed up over
+//   all parts, so that the documents of different parts are scored by the same BM25 parameters.
+struct FulltextStats {
+    // document count of each field
+    1: map<binary, i64>                     doc_count,
+    // total length of each field
+    2: map<binary, i64>                     total_length,
+    // document frequency of each term, keyed by field \0 term
+    3: map<binary, i64>                     doc_freq,
+}
+
+// Search the fulltext index maintained by the local fulltext listener of each part,
+//   the request is sent to the listener hosts instead of the part leaders.
+struct FulltextSearchRequest {
+    1: required common.GraphSpaceID         space_id,
+    2: required list<common.PartitionID>    parts,
+    3: binary                               index,
+    // query in the syntax of elasticsearch query string
+    4: binary                               query,
+    // max row count of each partition in this response, ordered by score
+    5: i64                                  limit,
+    6: optional RequestCommon               common,
+    // only collect the statistics of the parts, no document is returned
+    7: bool                                 stats_only = false,
+    // statistics of all parts, the documents are scored by the ones of each part if absent
+    8: optional FulltextStats               stats,
+}
+
+struct FulltextSearchResponse {
+    1: required ResponseCommon              result,
+    // The columns are "vid", "src", "dst", "rank" and "score", vid is empty for edge,
+    // and src/dst are empty for vertex
+    2: optional common.DataSet              data,
+    // statistics summed up over the parts of request if stats_only
+    3: optional FulltextStats               stats,
+}
+
+
 // This request will make the storage lookup the index first, then traverse
 //   to the neighbor nodes from the index results. So it is the combination
 //   of lookupIndex() and getNeighbors()
@@ -707,6 +784,8 @@ service GraphStorageService {
 
     GetNeighborsResponse lookupAndTraverse(1: LookupAndTraverseRequest req);
 
+    FulltextSearchResponse fulltextSearch(1: FulltextSearchRequest req);
+
     UpdateResponse chainUpdateEdge(1: UpdateEdgeRequest req);
     ExecResponse chainAddEdges(1: AddEdgesRequest req);
     ExecResponse chainDeleteEdges(1: DeleteEdgesRequest req);
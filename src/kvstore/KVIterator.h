@@ -43,6 +43,18 @@ class KVIterator {
    * @return folly::StringPiece Value
    */
   virtual folly::StringPiece val() const = 0;
+
+  /**
+   * @brief Move to the first key/value whose key is not less than target, only moves forward. The
+   * default implementation steps over the keys one by one.
+   *
+   * @param target Key to seek
+   */
+  virtual void seek(folly::StringPiece target) {
+    while (valid() && key() < target) {
+      next();
+    }
+  }
 };
 
 }  // namespace kvstore
@@ -18,6 +18,7 @@
 #include "kvstore/NebulaSnapshotManager.h"
 #include "kvstore/RocksEngine.h"
 #include "kvstore/listener/elasticsearch/ESListener.h"
+#include "kvstore/listener/fulltext/LocalFTListener.h"
 
 DEFINE_string(engine_type, "rocksdb", "rocksdb, memory...");
 DEFINE_int32(num_workers, 4, "Number of worker threads");
@@ -662,6 +663,18 @@ std::shared_ptr<Listener> NebulaStore::newListener(GraphSpaceID spaceId,
   if (type == meta::cpp2::ListenerType::ELASTICSEARCH) {
     listener = std::make_shared<ESListener>(
         spaceId, partId, raftAddr_, walPath, ioPool_, bgWorkers_, workers_, options_.schemaMan_);
+  } else if (type == meta::cpp2::ListenerType::LOCAL_FULLTEXT) {
+    auto dataPath =
+        folly::stringPrintf("%s/%d/%d/fulltext", options_.listenerPath_.c_str(), spaceId, partId);
+    listener = std::make_shared<LocalFTListener>(spaceId,
+                                                 partId,
+                                                 raftAddr_,
+                                                 walPath,
+                                                 dataPath,
+                                                 ioPool_,
+                                                 bgWorkers_,
+                                                 workers_,
+                                                 options_.schemaMan_);
   } else {
     LOG(FATAL) << "Should not reach here";
     return nullptr;
@@ -1273,6 +1286,24 @@ ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<SpaceListenerInfo>> NebulaStore
   return it->second;
 }
 
+ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<Listener>> NebulaStore::listener(
+    GraphSpaceID spaceId, PartitionID partId, meta::cpp2::ListenerType type) {
+  folly::RWSpinLock::ReadHolder rh(&lock_);
+  auto spaceIt = spaceListeners_.find(spaceId);
+  if (UNLIKELY(spaceIt == spaceListeners_.end())) {
+    return nebula::cpp2::ErrorCode::E_SPACE_NOT_FOUND;
+  }
+  auto partIt = spaceIt->second->listeners_.find(partId);
+  if (UNLIKELY(partIt == spaceIt->second->listeners_.end())) {
+    return nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND;
+  }
+  auto it = partIt->second.find(type);
+  if (UNLIKELY(it == partIt->second.end())) {
+    return nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND;
+  }
+  return it->second;
+}
+
 int32_t NebulaStore::allLeader(
     std::unordered_map<GraphSpaceID, std::vector<meta::cpp2::LeaderInfo>>& leaderIds) {
   folly::RWSpinLock::ReadHolder rh(&lock_);
@@ -536,6 +536,18 @@ class NebulaStore : public KVStore, public Handler {
   ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<SpaceListenerInfo>> spaceListener(
       GraphSpaceID spaceId);
 
+  /**
+   * @brief Try to retrieve the listener of given type on a partition
+   *
+   * @param spaceId
+   * @param partId
+   * @param type Listener type
+   * @return ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<Listener>> Return the listener when
+   * succeed, return Errorcode when failed
+   */
+  ErrorOr<nebula::cpp2::ErrorCode, std::shared_ptr<Listener>> listener(
+      GraphSpaceID spaceId, PartitionID partId, meta::cpp2::ListenerType type);
+
   /**
    * @brief Add a space, called from part manager
    *
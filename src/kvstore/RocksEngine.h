@@ -58,6 +58,12 @@ class RocksRangeIter : public KVIterator {
     return folly::StringPiece(iter_->value().data(), iter_->value().size());
   }
 
+  void seek(folly::StringPiece target) override {
+    if (valid() && key() < target) {
+      iter_->Seek(toSlice(target));
+    }
+  }
+
   const rocksdb::Slice* upperBound() {
     return &upperBound_;
   }
@@ -116,6 +122,12 @@ class RocksPrefixIter : public KVIterator {
     return folly::StringPiece(iter_->value().data(), iter_->value().size());
   }
 
+  void seek(folly::StringPiece target) override {
+    if (valid() && key() < target) {
+      iter_->Seek(toSlice(target));
+    }
+  }
+
   const rocksdb::Slice* upperBound() {
     return &upperBound_;
   }
@@ -169,6 +181,12 @@ class RocksCommonIter : public KVIterator {
     return folly::StringPiece(iter_->value().data(), iter_->value().size());
   }
 
+  void seek(folly::StringPiece target) override {
+    if (valid() && key() < target) {
+      iter_->Seek(toSlice(target));
+    }
+  }
+
  protected:
   std::unique_ptr<rocksdb::Iterator> iter_;
 };
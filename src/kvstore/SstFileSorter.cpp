@@ -0,0 +1,180 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "kvstore/SstFileSorter.h"
+
+#include <rocksdb/sst_file_reader.h>
+#include <rocksdb/sst_file_writer.h>
+
+#include <queue>
+
+#include "common/fs/FileUtils.h"
+
+namespace nebula {
+namespace kvstore {
+
+using fs::FileUtils;
+
+SstFileSorter::SstFileSorter(std::string dir, size_t bufferSize)
+    : dir_(std::move(dir)), bufferSize_(bufferSize) {}
+
+SstFileSorter::~SstFileSorter() {
+  for (const auto& run : runs_) {
+    FileUtils::remove(run.c_str());
+  }
+}
+
+std::string SstFileSorter::nextFile() {
+  return folly::sformat("{}/{}.sst", dir_, fileId_++);
+}
+
+nebula::cpp2::ErrorCode SstFileSorter::add(std::string key, std::string val) {
+  bufferedBytes_ += key.size() + val.size();
+  buffer_.emplace_back(std::move(key), std::move(val));
+  count_++;
+  if (bufferedBytes_ >= bufferSize_) {
+    return spill();
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode SstFileSorter::spill() {
+  if (buffer_.empty()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  if (!FileUtils::exist(dir_) && !FileUtils::makeDir(dir_)) {
+    LOG(WARNING) << "Make dir " << dir_ << " failed";
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  // Keep the first added one of the duplicated keys
+  std::stable_sort(buffer_.begin(), buffer_.end(), [](const KV& lhs, const KV& rhs) {
+    return lhs.first < rhs.first;
+  });
+
+  auto path = nextFile();
+  rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), rocksdb::Options());
+  auto s = writer.Open(path);
+  if (!s.ok()) {
+    LOG(WARNING) << "Open sst file " << path << " failed: " << s.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  runs_.emplace_back(path);
+  for (size_t i = 0; i < buffer_.size(); ++i) {
+    if (i > 0 && buffer_[i].first == buffer_[i - 1].first) {
+      continue;
+    }
+    s = writer.Put(buffer_[i].first, buffer_[i].second);
+    if (!s.ok()) {
+      LOG(WARNING) << "Write sst file " << path << " failed: " << s.ToString();
+      return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+    }
+  }
+  s = writer.Finish();
+  if (!s.ok()) {
+    LOG(WARNING) << "Finish sst file " << path << " failed: " << s.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  buffer_.clear();
+  bufferedBytes_ = 0;
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::string> SstFileSorter::finish() {
+  if (count_ == 0) {
+    return std::string();
+  }
+  auto code = spill();
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  // Each run is a sorted sst file already
+  if (runs_.size() == 1) {
+    auto path = std::move(runs_.back());
+    runs_.clear();
+    return path;
+  }
+  auto path = nextFile();
+  code = merge(path);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    FileUtils::remove(path.c_str());
+    return code;
+  }
+  for (const auto& run : runs_) {
+    FileUtils::remove(run.c_str());
+  }
+  runs_.clear();
+  return path;
+}
+
+nebula::cpp2::ErrorCode SstFileSorter::merge(const std::string& path) {
+  rocksdb::Options options;
+  std::vector<std::unique_ptr<rocksdb::SstFileReader>> readers;
+  std::vector<std::unique_ptr<rocksdb::Iterator>> iters;
+  for (const auto& run : runs_) {
+    auto reader = std::make_unique<rocksdb::SstFileReader>(options);
+    auto s = reader->Open(run);
+    if (!s.ok()) {
+      LOG(WARNING) << "Open sst file " << run << " failed: " << s.ToString();
+      return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+    }
+    iters.emplace_back(reader->NewIterator(rocksdb::ReadOptions()));
+    iters.back()->SeekToFirst();
+    readers.emplace_back(std::move(reader));
+  }
+
+  // The smallest key on the top, the earlier run wins if keys are equal
+  auto greater = [&iters](size_t lhs, size_t rhs) {
+    auto cmp = iters[lhs]->key().compare(iters[rhs]->key());
+    return cmp > 0 || (cmp == 0 && lhs > rhs);
+  };
+  std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> heap(greater);
+  for (size_t i = 0; i < iters.size(); ++i) {
+    if (iters[i]->Valid()) {
+      heap.push(i);
+    }
+  }
+
+  rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), options);
+  auto s = writer.Open(path);
+  if (!s.ok()) {
+    LOG(WARNING) << "Open sst file " << path << " failed: " << s.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  std::string lastKey;
+  bool first = true;
+  while (!heap.empty()) {
+    auto i = heap.top();
+    heap.pop();
+    auto* iter = iters[i].get();
+    if (first || iter->key() != rocksdb::Slice(lastKey)) {
+      s = writer.Put(iter->key(), iter->value());
+      if (!s.ok()) {
+        LOG(WARNING) << "Write sst file " << path << " failed: " << s.ToString();
+        return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+      }
+      lastKey = iter->key().ToString();
+      first = false;
+    }
+    iter->Next();
+    if (iter->Valid()) {
+      heap.push(i);
+    }
+  }
+  for (const auto& iter : iters) {
+    if (!iter->status().ok()) {
+      LOG(WARNING) << "Read sst file failed: " << iter->status().ToString();
+      return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+    }
+  }
+  s = writer.Finish();
+  if (!s.ok()) {
+    LOG(WARNING) << "Finish sst file " << path << " failed: " << s.ToString();
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+}  // namespace kvstore
+}  // namespace nebula
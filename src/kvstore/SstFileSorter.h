@@ -0,0 +1,75 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef KVSTORE_SSTFILESORTER_H_
+#define KVSTORE_SSTFILESORTER_H_
+
+#include "common/base/Base.h"
+#include "common/base/ErrorOr.h"
+#include "interface/gen-cpp2/common_types.h"
+#include "kvstore/Common.h"
+
+namespace nebula {
+namespace kvstore {
+
+/**
+ * @brief Sort key/values in bounded memory and write them into one sst file, which could be
+ * ingested into rocksdb atomically. Once the buffered key/values exceed the buffer size, they are
+ * sorted and spilled into a run file under the given directory, and all runs are merged into the
+ * result file when finished. For duplicated keys, only the first added one is kept.
+ */
+class SstFileSorter final {
+ public:
+  /**
+   * @brief Construct a new sorter
+   *
+   * @param dir Directory to hold the run files and the result file, it is created if not exists
+   * @param bufferSize Max bytes of key/values sorted in memory
+   */
+  SstFileSorter(std::string dir, size_t bufferSize);
+
+  /**
+   * @brief Remove all run files, the result file is kept
+   */
+  ~SstFileSorter();
+
+  nebula::cpp2::ErrorCode add(std::string key, std::string val);
+
+  /**
+   * @brief Merge all key/values into the result file
+   *
+   * @return ErrorOr<nebula::cpp2::ErrorCode, std::string> Path of the result file, or empty string
+   * if nothing is added
+   */
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> finish();
+
+  /**
+   * @brief Number of key/values added
+   */
+  size_t size() const {
+    return count_;
+  }
+
+ private:
+  nebula::cpp2::ErrorCode spill();
+
+  nebula::cpp2::ErrorCode merge(const std::string& path);
+
+  std::string nextFile();
+
+ private:
+  std::string dir_;
+  size_t bufferSize_;
+  std::vector<KV> buffer_;
+  size_t bufferedBytes_{0};
+  std::vector<std::string> runs_;
+  size_t count_{0};
+  size_t fileId_{0};
+};
+
+}  // namespace kvstore
+}  // namespace nebula
+
+#endif  // KVSTORE_SSTFILESORTER_H_
@@ -54,7 +54,7 @@ class ESListener : public Listener {
    * @param data Key/value to apply
    * @return True if succeed. False if failed.
    */
-  bool apply(const BatchHolder& batch);
+  virtual bool apply(const BatchHolder& batch);
 
   /**
    * @brief Persist commitLogId commitLogTerm and lastApplyLogId
@@ -104,7 +104,7 @@ class ESListener : public Listener {
    */
   std::string encodeAppliedId(LogID lastId, TermID lastTerm, LogID lastApplyLogId) const;
 
- private:
+ protected:
   meta::SchemaManager* schemaMan_{nullptr};
   using PickFunc = std::function<void(BatchLogType type,
                                       const std::string& index,
@@ -120,6 +120,7 @@ class ESListener : public Listener {
 
   std::string normalizeVid(const std::string& vid);
 
+ private:
   StatusOr<::nebula::plugin::ESAdapter> getESAdapter();
 
   std::unique_ptr<std::string> lastApplyLogFile_{nullptr};
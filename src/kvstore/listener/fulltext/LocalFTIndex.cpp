@@ -0,0 +1,1032 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "kvstore/listener/fulltext/LocalFTIndex.h"
+
+#include <folly/Varint.h>
+#include <thrift/lib/cpp/util/EnumUtils.h>
+
+#include <cmath>
+
+namespace nebula {
+namespace kvstore {
+
+namespace {
+
+constexpr char kPosting = 0x01;
+constexpr char kTerm = 0x02;
+constexpr char kStats = 0x03;
+constexpr char kDoc = 0x04;
+constexpr char kIndex = 0x05;
+
+// Max number of terms a prefix or wildcard clause expanded to
+constexpr size_t kMaxExpansions = 1024;
+// Max number of terms a fuzzy clause expanded to, same as elasticsearch
+constexpr size_t kMaxFuzzyExpansions = 50;
+constexpr int32_t kMaxFuzziness = 2;
+
+// Parameters of BM25
+constexpr double kK1 = 1.2;
+constexpr double kB = 0.75;
+
+struct FieldTerms {
+  std::string field;
+  uint64_t length;
+  std::vector<std::string> terms;
+};
+
+std::string fieldPrefix(char type, const std::string& index, const std::string& field) {
+  std::string key;
+  key.reserve(index.size() + field.size() + 3);
+  key.append(1, type).append(index).append(1, '\0').append(field).append(1, '\0');
+  return key;
+}
+
+std::string statsKey(const std::string& index, const std::string& field) {
+  std::string key;
+  key.reserve(index.size() + field.size() + 2);
+  key.append(1, kStats).append(index).append(1, '\0').append(field);
+  return key;
+}
+
+// Key of the document frequency in Stats
+std::string termStatsKey(const std::string& field, const std::string& term) {
+  std::string key;
+  key.reserve(field.size() + term.size() + 1);
+  key.append(field).append(1, '\0').append(term);
+  return key;
+}
+
+std::string docKey(const std::string& index, const std::string& docId) {
+  std::string key;
+  key.reserve(index.size() + docId.size() + 2);
+  key.append(1, kDoc).append(index).append(1, '\0').append(docId);
+  return key;
+}
+
+std::string indexKey(const std::string& index) {
+  std::string key;
+  key.reserve(index.size() + 1);
+  key.append(1, kIndex).append(index);
+  return key;
+}
+
+void appendVarint(std::string* buf, uint64_t val) {
+  uint8_t bytes[folly::kMaxVarintLength64];
+  auto len = folly::encodeVarint(val, bytes);
+  buf->append(reinterpret_cast<const char*>(bytes), len);
+}
+
+bool readVarint(folly::StringPiece* data, uint64_t* val) {
+  auto ret = folly::tryDecodeVarint(*data);
+  if (ret.hasError()) {
+    return false;
+  }
+  *val = ret.value();
+  return true;
+}
+
+void appendString(std::string* buf, folly::StringPiece str) {
+  appendVarint(buf, str.size());
+  buf->append(str.data(), str.size());
+}
+
+bool readString(folly::StringPiece* data, std::string* str) {
+  uint64_t len = 0;
+  if (!readVarint(data, &len) || data->size() < len) {
+    return false;
+  }
+  *str = data->subpiece(0, len).str();
+  data->advance(len);
+  return true;
+}
+
+std::string encodeDoc(const std::vector<FieldTerms>& doc) {
+  std::string val;
+  appendVarint(&val, doc.size());
+  for (const auto& field : doc) {
+    appendString(&val, field.field);
+    appendVarint(&val, field.length);
+    appendVarint(&val, field.terms.size());
+    for (const auto& term : field.terms) {
+      appendString(&val, term);
+    }
+  }
+  return val;
+}
+
+bool decodeDoc(folly::StringPiece data, std::vector<FieldTerms>* doc) {
+  uint64_t numFields = 0;
+  if (!readVarint(&data, &numFields)) {
+    return false;
+  }
+  for (uint64_t i = 0; i < numFields; ++i) {
+    FieldTerms field;
+    uint64_t numTerms = 0;
+    if (!readString(&data, &field.field) || !readVarint(&data, &field.length) ||
+        !readVarint(&data, &numTerms)) {
+      return false;
+    }
+    field.terms.resize(numTerms);
+    for (auto& term : field.terms) {
+      if (!readString(&data, &term)) {
+        return false;
+      }
+    }
+    doc->emplace_back(std::move(field));
+  }
+  return true;
+}
+
+}  // namespace
+
+void LocalFTIndex::put(const std::string& index,
+                       const std::string& vid,
+                       const std::string& src,
+                       const std::string& dst,
+                       int64_t rank,
+                       const std::map<std::string, std::string>& data) {
+  if (batch_ == nullptr) {
+    batch_ = engine_->startBatchWrite();
+  }
+  auto id = docId(vid, src, dst, rank);
+  removeDoc(index, id);
+
+  std::vector<FieldTerms> doc;
+  for (const auto& kv : data) {
+    auto tokens = tokenize(kv.second);
+    if (tokens.empty()) {
+      continue;
+    }
+    // Ordered by term, so the terms of document are encoded in order
+    std::map<std::string, std::vector<uint32_t>> positions;
+    for (uint32_t i = 0; i < tokens.size(); ++i) {
+      positions[tokens[i]].emplace_back(i);
+    }
+    FieldTerms field{kv.first, tokens.size(), {}};
+    auto postingPrefix = fieldPrefix(kPosting, index, kv.first);
+    auto termPrefix = fieldPrefix(kTerm, index, kv.first);
+    for (const auto& termPos : positions) {
+      std::string val;
+      appendVarint(&val, tokens.size());
+      appendVarint(&val, termPos.second.size());
+      uint32_t last = 0;
+      for (auto pos : termPos.second) {
+        appendVarint(&val, pos - last);
+        last = pos;
+      }
+      batch_->put(postingPrefix + termPos.first + '\0' + id, val);
+      dfDelta_[termPrefix + termPos.first]++;
+      field.terms.emplace_back(termPos.first);
+    }
+    auto& stats = statsDelta_[statsKey(index, kv.first)];
+    stats.first++;
+    stats.second += tokens.size();
+    doc.emplace_back(std::move(field));
+  }
+
+  auto key = docKey(index, id);
+  if (doc.empty()) {
+    docs_[key] = std::nullopt;
+    return;
+  }
+  auto val = encodeDoc(doc);
+  batch_->put(key, val);
+  docs_[key] = std::move(val);
+}
+
+void LocalFTIndex::remove(const std::string& index,
+                          const std::string& vid,
+                          const std::string& src,
+                          const std::string& dst,
+                          int64_t rank) {
+  if (batch_ == nullptr) {
+    batch_ = engine_->startBatchWrite();
+  }
+  removeDoc(index, docId(vid, src, dst, rank));
+}
+
+void LocalFTIndex::removeDoc(const std::string& index, const std::string& docId) {
+  auto key = docKey(index, docId);
+  std::string val;
+  auto it = docs_.find(key);
+  if (it != docs_.end()) {
+    if (!it->second.has_value()) {
+      return;
+    }
+    val = *it->second;
+  } else {
+    auto code = engine_->get(key, &val);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      if (code != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+        LOG(WARNING) << "Get fulltext document failed: "
+                     << apache::thrift::util::enumNameSafe(code);
+      }
+      return;
+    }
+  }
+
+  std::vector<FieldTerms> doc;
+  if (!decodeDoc(val, &doc)) {
+    LOG(WARNING) << "Decode fulltext document of index " << index << " failed";
+    return;
+  }
+  for (const auto& field : doc) {
+    auto postingPrefix = fieldPrefix(kPosting, index, field.field);
+    auto termPrefix = fieldPrefix(kTerm, index, field.field);
+    for (const auto& term : field.terms) {
+      batch_->remove(postingPrefix + term + '\0' + docId);
+      dfDelta_[termPrefix + term]--;
+    }
+    auto& stats = statsDelta_[statsKey(index, field.field)];
+    stats.first--;
+    stats.second -= field.length;
+  }
+  batch_->remove(key);
+  docs_[key] = std::nullopt;
+}
+
+nebula::cpp2::ErrorCode LocalFTIndex::commit() {
+  if (batch_ == nullptr) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  SCOPE_EXIT {
+    batch_.reset();
+    docs_.clear();
+    dfDelta_.clear();
+    statsDelta_.clear();
+  };
+  // The term frequency and stats are only modified in the write thread, so read and write them
+  // back in the same batch is safe
+  for (const auto& kv : dfDelta_) {
+    if (kv.second == 0) {
+      continue;
+    }
+    std::string val;
+    auto code = engine_->get(kv.first, &val);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED &&
+        code != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+      return code;
+    }
+    uint64_t df = 0;
+    folly::StringPiece data(val);
+    if (code == nebula::cpp2::ErrorCode::SUCCEEDED && !readVarint(&data, &df)) {
+      df = 0;
+    }
+    auto newDf = static_cast<int64_t>(df) + kv.second;
+    if (newDf > 0) {
+      std::string newVal;
+      appendVarint(&newVal, newDf);
+      batch_->put(kv.first, newVal);
+    } else {
+      batch_->remove(kv.first);
+    }
+  }
+  for (const auto& kv : statsDelta_) {
+    if (kv.second.first == 0 && kv.second.second == 0) {
+      continue;
+    }
+    std::string val;
+    auto code = engine_->get(kv.first, &val);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED &&
+        code != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+      return code;
+    }
+    uint64_t count = 0;
+    uint64_t length = 0;
+    folly::StringPiece data(val);
+    if (code == nebula::cpp2::ErrorCode::SUCCEEDED &&
+        (!readVarint(&data, &count) || !readVarint(&data, &length))) {
+      count = 0;
+      length = 0;
+    }
+    auto newCount = static_cast<int64_t>(count) + kv.second.first;
+    auto newLength = static_cast<int64_t>(length) + kv.second.second;
+    if (newCount > 0) {
+      std::string newVal;
+      appendVarint(&newVal, newCount);
+      appendVarint(&newVal, std::max<int64_t>(newLength, 0));
+      batch_->put(kv.first, newVal);
+    } else {
+      batch_->remove(kv.first);
+    }
+  }
+  return engine_->commitBatchWrite(std::move(batch_), false, false, true);
+}
+
+nebula::cpp2::ErrorCode LocalFTIndex::drop(const std::string& index) {
+  DCHECK(batch_ == nullptr);
+  auto batch = engine_->startBatchWrite();
+  // The names of index and field have no '\0', so all keys of the index start with
+  // type index '\0'
+  for (auto type : {kPosting, kTerm, kStats, kDoc}) {
+    std::string start;
+    start.append(1, type).append(index).append(1, '\0');
+    std::string end;
+    end.append(1, type).append(index).append(1, '\1');
+    auto code = batch->removeRange(start, end);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
+  auto code = batch->remove(indexKey(index));
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  return engine_->commitBatchWrite(std::move(batch), false, false, true);
+}
+
+nebula::cpp2::ErrorCode LocalFTIndex::syncIndexes(
+    const std::unordered_map<std::string, std::string>& indexes) {
+  std::unique_ptr<KVIterator> iter;
+  auto code = engine_->prefix(std::string(1, kIndex), &iter);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  std::unordered_map<std::string, std::string> existing;
+  for (; iter->valid(); iter->next()) {
+    existing.emplace(iter->key().subpiece(1).str(), iter->val().str());
+  }
+  iter.reset();
+
+  for (const auto& kv : existing) {
+    auto found = indexes.find(kv.first);
+    if (found != indexes.end() && found->second == kv.second) {
+      continue;
+    }
+    LOG(INFO) << "Drop local fulltext index " << kv.first;
+    code = drop(kv.first);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
+
+  std::vector<KV> data;
+  for (const auto& kv : indexes) {
+    auto found = existing.find(kv.first);
+    if (found == existing.end() || found->second != kv.second) {
+      data.emplace_back(indexKey(kv.first), kv.second);
+    }
+  }
+  if (data.empty()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  return engine_->multiPut(std::move(data));
+}
+
+void LocalFTIndex::Stats::merge(const Stats& other) {
+  for (const auto& kv : other.fields) {
+    auto& field = fields[kv.first];
+    field.first += kv.second.first;
+    field.second += kv.second.second;
+  }
+  for (const auto& kv : other.terms) {
+    terms[kv.first] += kv.second;
+  }
+}
+
+StatusOr<LocalFTIndex::Stats> LocalFTIndex::collectStats(const std::string& index,
+                                                         const std::string& query) const {
+  auto clausesRet = parse(query);
+  NG_RETURN_IF_ERROR(clausesRet);
+  auto clauses = std::move(clausesRet).value();
+  auto allFields = fields(index);
+
+  Stats result;
+  for (const auto& clause : clauses) {
+    auto clauseFields = clause.field.empty() ? allFields : std::vector<std::string>{clause.field};
+    for (const auto& field : clauseFields) {
+      auto fieldStats = stats(index, field);
+      if (fieldStats.first <= 0) {
+        continue;
+      }
+      result.fields[field] = fieldStats;
+      std::vector<std::string> terms;
+      auto code = clauseTerms(index, field, clause, &terms);
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        return Status::Error("Read fulltext index failed: %s",
+                             apache::thrift::util::enumNameSafe(code).c_str());
+      }
+      for (const auto& term : terms) {
+        result.terms[termStatsKey(field, term)] = docFreq(index, field, term);
+      }
+    }
+  }
+  return result;
+}
+
+StatusOr<plugin::ESQueryResult> LocalFTIndex::search(const std::string& index,
+                                                     const std::string& query,
+                                                     int64_t limit,
+                                                     const Stats* global) const {
+  auto clausesRet = parse(query);
+  NG_RETURN_IF_ERROR(clausesRet);
+  auto clauses = std::move(clausesRet).value();
+  auto allFields = fields(index);
+
+  std::vector<Scores> musts;
+  Scores shoulds;
+  std::unordered_set<std::string> mustNots;
+  for (const auto& clause : clauses) {
+    auto scoresRet = clause.field.empty() ? evalClause(index, allFields, clause, global)
+                                          : evalClause(index, {clause.field}, clause, global);
+    NG_RETURN_IF_ERROR(scoresRet);
+    auto scores = std::move(scoresRet).value();
+    switch (clause.occur) {
+      case Clause::Occur::kMust:
+        musts.emplace_back(std::move(scores));
+        break;
+      case Clause::Occur::kShould:
+        for (const auto& kv : scores) {
+          shoulds[kv.first] += kv.second;
+        }
+        break;
+      case Clause::Occur::kMustNot:
+        for (const auto& kv : scores) {
+          mustNots.emplace(kv.first);
+        }
+        break;
+    }
+  }
+
+  // The documents must match all must clauses if any, otherwise any of should clauses
+  Scores scores;
+  if (!musts.empty()) {
+    scores = std::move(musts.front());
+    for (size_t i = 1; i < musts.size(); ++i) {
+      for (auto it = scores.begin(); it != scores.end();) {
+        auto found = musts[i].find(it->first);
+        if (found == musts[i].end()) {
+          it = scores.erase(it);
+        } else {
+          it->second += found->second;
+          ++it;
+        }
+      }
+    }
+    for (const auto& kv : shoulds) {
+      auto it = scores.find(kv.first);
+      if (it != scores.end()) {
+        it->second += kv.second;
+      }
+    }
+  } else {
+    scores = std::move(shoulds);
+  }
+  for (const auto& doc : mustNots) {
+    scores.erase(doc);
+  }
+
+  std::vector<std::pair<std::string, double>> docs(scores.begin(), scores.end());
+  auto k = limit < 0 ? docs.size() : std::min(docs.size(), static_cast<size_t>(limit));
+  std::partial_sort(
+      docs.begin(), docs.begin() + k, docs.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+      });
+  plugin::ESQueryResult result;
+  result.items.reserve(k);
+  for (size_t i = 0; i < k; ++i) {
+    result.items.emplace_back(decodeDocId(docs[i].first, docs[i].second));
+  }
+  return result;
+}
+
+StatusOr<std::vector<LocalFTIndex::Clause>> LocalFTIndex::parse(const std::string& query) const {
+  std::vector<Clause> clauses;
+  auto isSpace = [](char c) { return std::isspace(static_cast<unsigned char>(c)); };
+  auto isKeyword = [&query, &isSpace](size_t pos, folly::StringPiece keyword) {
+    return folly::StringPiece(query).subpiece(pos).startsWith(keyword) &&
+           (pos + keyword.size() == query.size() || isSpace(query[pos + keyword.size()]));
+  };
+  bool nextMust = false;
+  bool nextMustNot = false;
+  size_t i = 0;
+  while (true) {
+    while (i < query.size() && isSpace(query[i])) {
+      i++;
+    }
+    if (i >= query.size()) {
+      break;
+    }
+    if (isKeyword(i, "AND") || isKeyword(i, "&&")) {
+      if (!clauses.empty() && clauses.back().occur == Clause::Occur::kShould) {
+        clauses.back().occur = Clause::Occur::kMust;
+      }
+      nextMust = true;
+      i += query[i] == 'A' ? 3 : 2;
+      continue;
+    }
+    if (isKeyword(i, "OR") || isKeyword(i, "||")) {
+      i += 2;
+      continue;
+    }
+    if (isKeyword(i, "NOT")) {
+      nextMustNot = true;
+      i += 3;
+      continue;
+    }
+
+    Clause clause;
+    clause.occur = nextMustNot ? Clause::Occur::kMustNot
+                               : (nextMust ? Clause::Occur::kMust : Clause::Occur::kShould);
+    nextMust = false;
+    nextMustNot = false;
+    if (query[i] == '+' || query[i] == '-' || query[i] == '!') {
+      clause.occur = query[i] == '+' ? Clause::Occur::kMust : Clause::Occur::kMustNot;
+      i++;
+    }
+    if (i < query.size() && (query[i] == '(' || query[i] == ')')) {
+      return Status::SyntaxError("Grouping is not supported by local fulltext index: `%s'",
+                                 query.c_str());
+    }
+    auto j = i;
+    while (j < query.size() && (std::isalnum(static_cast<unsigned char>(query[j])) ||
+                                query[j] == '_' || query[j] == '.')) {
+      j++;
+    }
+    if (j > i && j < query.size() && query[j] == ':') {
+      clause.field = query.substr(i, j - i);
+      i = j + 1;
+    }
+
+    std::string text;
+    bool quoted = false;
+    bool wildcard = false;
+    if (i < query.size() && query[i] == '"') {
+      quoted = true;
+      i++;
+      while (i < query.size() && query[i] != '"') {
+        if (query[i] == '\\' && i + 1 < query.size()) {
+          i++;
+        }
+        text += query[i++];
+      }
+      if (i >= query.size()) {
+        return Status::SyntaxError("Unclosed quote in query: `%s'", query.c_str());
+      }
+      i++;
+    } else {
+      while (i < query.size() && !isSpace(query[i]) && query[i] != '~' && query[i] != '^') {
+        if (query[i] == '(' || query[i] == ')') {
+          return Status::SyntaxError("Grouping is not supported by local fulltext index: `%s'",
+                                     query.c_str());
+        }
+        if (query[i] == '\\' && i + 1 < query.size()) {
+          text += query[i + 1];
+          i += 2;
+          continue;
+        }
+        if (query[i] == '*' || query[i] == '?') {
+          wildcard = true;
+        }
+        text += query[i++];
+      }
+    }
+
+    // Suffix of fuzziness and boost
+    bool fuzzy = false;
+    int32_t fuzziness = kMaxFuzziness;
+    while (i < query.size() && (query[i] == '~' || query[i] == '^')) {
+      auto op = query[i++];
+      j = i;
+      while (j < query.size() && (std::isdigit(static_cast<unsigned char>(query[j])) ||
+                                  query[j] == '.')) {
+        j++;
+      }
+      auto num = query.substr(i, j - i);
+      i = j;
+      if (op == '~') {
+        // The slop of phrase is ignored
+        fuzzy = !quoted;
+        if (!num.empty()) {
+          auto ret = folly::tryTo<double>(num);
+          if (ret.hasError()) {
+            return Status::SyntaxError("Invalid fuzziness `%s' in query", num.c_str());
+          }
+          fuzziness = std::min(static_cast<int32_t>(ret.value()), kMaxFuzziness);
+        }
+      } else {
+        auto ret = folly::tryTo<double>(num);
+        if (ret.hasError()) {
+          return Status::SyntaxError("Invalid boost `%s' in query", num.c_str());
+        }
+        clause.boost = ret.value();
+      }
+    }
+    if (i < query.size() && !isSpace(query[i])) {
+      return Status::SyntaxError("Syntax error near `%s' in query", query.substr(i).c_str());
+    }
+
+    if (wildcard) {
+      for (auto& c : text) {
+        if (static_cast<unsigned char>(c) < 0x80) {
+          c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+      }
+      auto firstWildcard = text.find_first_of("*?");
+      if (firstWildcard == text.size() - 1 && text.back() == '*') {
+        clause.kind = Clause::Kind::kPrefix;
+        text.pop_back();
+      } else {
+        clause.kind = Clause::Kind::kWildcard;
+      }
+      clause.terms.emplace_back(std::move(text));
+      clauses.emplace_back(std::move(clause));
+      continue;
+    }
+    auto tokens = tokenize(text);
+    if (quoted && tokens.size() > 1) {
+      clause.kind = Clause::Kind::kPhrase;
+      clause.terms = std::move(tokens);
+      clauses.emplace_back(std::move(clause));
+      continue;
+    }
+    // The unquoted text with several terms matches any of them
+    for (auto& token : tokens) {
+      Clause termClause = clause;
+      termClause.kind = fuzzy ? Clause::Kind::kFuzzy : Clause::Kind::kTerm;
+      termClause.fuzziness = fuzziness;
+      termClause.terms.emplace_back(std::move(token));
+      clauses.emplace_back(std::move(termClause));
+    }
+  }
+  return clauses;
+}
+
+StatusOr<LocalFTIndex::Scores> LocalFTIndex::evalClause(const std::string& index,
+                                                        const std::vector<std::string>& fields,
+                                                        const Clause& clause,
+                                                        const Stats* global) const {
+  Scores scores;
+  for (const auto& field : fields) {
+    auto fieldStats = stats(index, field);
+    if (fieldStats.first <= 0) {
+      continue;
+    }
+    if (global != nullptr) {
+      auto found = global->fields.find(field);
+      if (found != global->fields.end() && found->second.first > 0) {
+        fieldStats = found->second;
+      }
+    }
+    // The document frequency of all parts if given, otherwise the one of this index
+    auto termDf = [global, &field](const std::string& term, size_t localDf) {
+      if (global != nullptr) {
+        auto found = global->terms.find(termStatsKey(field, term));
+        if (found != global->terms.end()) {
+          return static_cast<double>(found->second);
+        }
+      }
+      return static_cast<double>(localDf);
+    };
+    auto docCount = static_cast<double>(fieldStats.first);
+    auto avgLength = static_cast<double>(fieldStats.second) / docCount;
+    auto bm25 = [docCount, avgLength](double df, const Posting& posting) {
+      auto idf = std::log(1 + (docCount - df + 0.5) / (df + 0.5));
+      auto tf = static_cast<double>(posting.positions.size());
+      auto norm = 1 - kB + kB * posting.fieldLength / std::max(avgLength, 1.0);
+      return idf * tf * (kK1 + 1) / (tf + kK1 * norm);
+    };
+
+    Scores fieldScores;
+    if (clause.kind == Clause::Kind::kPhrase) {
+      std::vector<std::unordered_map<std::string, Posting>> lists(clause.terms.size());
+      for (size_t i = 0; i < clause.terms.size(); ++i) {
+        auto code = postings(index, field, clause.terms[i], &lists[i]);
+        if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+          return Status::Error("Read fulltext index failed: %s",
+                               apache::thrift::util::enumNameSafe(code).c_str());
+        }
+      }
+      for (const auto& doc : lists.front()) {
+        std::vector<const Posting*> docPostings{&doc.second};
+        for (size_t i = 1; i < lists.size(); ++i) {
+          auto found = lists[i].find(doc.first);
+          if (found == lists[i].end()) {
+            break;
+          }
+          docPostings.emplace_back(&found->second);
+        }
+        if (docPostings.size() != lists.size()) {
+          continue;
+        }
+        // The terms are adjacent in order
+        bool matched = false;
+        for (auto pos : doc.second.positions) {
+          matched = true;
+          for (size_t i = 1; i < docPostings.size(); ++i) {
+            const auto& positions = docPostings[i]->positions;
+            if (!std::binary_search(positions.begin(), positions.end(), pos + i)) {
+              matched = false;
+              break;
+            }
+          }
+          if (matched) {
+            break;
+          }
+        }
+        if (!matched) {
+          continue;
+        }
+        double score = 0;
+        for (size_t i = 0; i < lists.size(); ++i) {
+          score += bm25(termDf(clause.terms[i], lists[i].size()), *docPostings[i]);
+        }
+        fieldScores[doc.first] = score;
+      }
+    } else {
+      std::vector<std::string> terms;
+      auto code = clauseTerms(index, field, clause, &terms);
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        return Status::Error("Read fulltext index failed: %s",
+                             apache::thrift::util::enumNameSafe(code).c_str());
+      }
+      for (const auto& term : terms) {
+        std::unordered_map<std::string, Posting> list;
+        auto code = postings(index, field, term, &list);
+        if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+          return Status::Error("Read fulltext index failed: %s",
+                               apache::thrift::util::enumNameSafe(code).c_str());
+        }
+        // The best matched term of an expanded clause is used
+        for (const auto& doc : list) {
+          auto& score = fieldScores[doc.first];
+          score = std::max(score, bm25(termDf(term, list.size()), doc.second));
+        }
+      }
+    }
+    // The best matched field is used
+    for (const auto& kv : fieldScores) {
+      auto& score = scores[kv.first];
+      score = std::max(score, kv.second * clause.boost);
+    }
+  }
+  return scores;
+}
+
+nebula::cpp2::ErrorCode LocalFTIndex::clauseTerms(const std::string& index,
+                                                  const std::string& field,
+                                                  const Clause& clause,
+                                                  std::vector<std::string>* terms) const {
+  if (clause.kind == Clause::Kind::kTerm || clause.kind == Clause::Kind::kPhrase) {
+    *terms = clause.terms;
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  return expand(index, field, clause, terms);
+}
+
+nebula::cpp2::ErrorCode LocalFTIndex::expand(const std::string& index,
+                                             const std::string& field,
+                                             const Clause& clause,
+                                             std::vector<std::string>* terms) const {
+  const auto& pattern = clause.terms.front();
+  auto prefix = fieldPrefix(kTerm, index, field);
+  std::string literal;
+  if (clause.kind == Clause::Kind::kPrefix) {
+    literal = pattern;
+  } else if (clause.kind == Clause::Kind::kWildcard) {
+    literal = pattern.substr(0, pattern.find_first_of("*?"));
+  }
+  std::unique_ptr<KVIterator> iter;
+  auto code = engine_->prefix(prefix + literal, &iter);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  std::vector<std::pair<int32_t, std::string>> fuzzyTerms;
+  for (; iter->valid() && terms->size() < kMaxExpansions; iter->next()) {
+    auto term = iter->key().subpiece(prefix.size());
+    switch (clause.kind) {
+      case Clause::Kind::kPrefix:
+        terms->emplace_back(term.str());
+        break;
+      case Clause::Kind::kWildcard:
+        if (wildcardMatch(pattern, term)) {
+          terms->emplace_back(term.str());
+        }
+        break;
+      case Clause::Kind::kFuzzy: {
+        auto distance = editDistance(pattern, term, clause.fuzziness);
+        if (distance <= clause.fuzziness) {
+          fuzzyTerms.emplace_back(distance, term.str());
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  if (!fuzzyTerms.empty()) {
+    std::sort(fuzzyTerms.begin(), fuzzyTerms.end());
+    for (size_t i = 0; i < fuzzyTerms.size() && i < kMaxFuzzyExpansions; ++i) {
+      terms->emplace_back(std::move(fuzzyTerms[i].second));
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode LocalFTIndex::postings(
+    const std::string& index,
+    const std::string& field,
+    const std::string& term,
+    std::unordered_map<std::string, Posting>* result) const {
+  auto prefix = fieldPrefix(kPosting, index, field) + term + '\0';
+  std::unique_ptr<KVIterator> iter;
+  auto code = engine_->prefix(prefix, &iter);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  for (; iter->valid(); iter->next()) {
+    auto val = iter->val();
+    uint64_t fieldLength = 0;
+    uint64_t tf = 0;
+    if (!readVarint(&val, &fieldLength) || !readVarint(&val, &tf)) {
+      LOG(WARNING) << "Decode posting of term " << term << " failed";
+      continue;
+    }
+    Posting posting;
+    posting.fieldLength = fieldLength;
+    posting.positions.reserve(tf);
+    uint64_t pos = 0;
+    for (uint64_t i = 0; i < tf; ++i) {
+      uint64_t delta = 0;
+      if (!readVarint(&val, &delta)) {
+        break;
+      }
+      pos += delta;
+      posting.positions.emplace_back(pos);
+    }
+    result->emplace(iter->key().subpiece(prefix.size()).str(), std::move(posting));
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+std::pair<int64_t, int64_t> LocalFTIndex::stats(const std::string& index,
+                                                const std::string& field) const {
+  std::string val;
+  if (engine_->get(statsKey(index, field), &val) != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return {0, 0};
+  }
+  folly::StringPiece data(val);
+  uint64_t count = 0;
+  uint64_t length = 0;
+  if (!readVarint(&data, &count) || !readVarint(&data, &length)) {
+    return {0, 0};
+  }
+  return {count, length};
+}
+
+int64_t LocalFTIndex::docFreq(const std::string& index,
+                              const std::string& field,
+                              const std::string& term) const {
+  std::string val;
+  if (engine_->get(fieldPrefix(kTerm, index, field) + term, &val) !=
+      nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return 0;
+  }
+  folly::StringPiece data(val);
+  uint64_t df = 0;
+  if (!readVarint(&data, &df)) {
+    return 0;
+  }
+  return df;
+}
+
+std::vector<std::string> LocalFTIndex::fields(const std::string& index) const {
+  std::vector<std::string> result;
+  auto prefix = statsKey(index, "");
+  std::unique_ptr<KVIterator> iter;
+  if (engine_->prefix(prefix, &iter) != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return result;
+  }
+  for (; iter->valid(); iter->next()) {
+    result.emplace_back(iter->key().subpiece(prefix.size()).str());
+  }
+  return result;
+}
+
+std::vector<std::string> LocalFTIndex::tokenize(folly::StringPiece text) {
+  std::vector<std::string> tokens;
+  std::string current;
+  auto flush = [&tokens, &current]() {
+    if (!current.empty()) {
+      tokens.emplace_back(std::move(current));
+      current.clear();
+    }
+  };
+  size_t i = 0;
+  while (i < text.size()) {
+    auto c = static_cast<unsigned char>(text[i]);
+    if (c < 0x80) {
+      if (std::isalnum(c)) {
+        current += static_cast<char>(std::tolower(c));
+      } else {
+        flush();
+      }
+      i++;
+      continue;
+    }
+    size_t len = c >= 0xF0 ? 4 : (c >= 0xE0 ? 3 : (c >= 0xC0 ? 2 : 1));
+    len = std::min(len, text.size() - i);
+    if (c == 0xE2) {
+      // General punctuation and symbols
+      flush();
+    } else if (len >= 3) {
+      flush();
+      tokens.emplace_back(text.subpiece(i, len).str());
+    } else {
+      current.append(text.data() + i, len);
+    }
+    i += len;
+  }
+  flush();
+  return tokens;
+}
+
+std::string LocalFTIndex::docId(const std::string& vid,
+                                const std::string& src,
+                                const std::string& dst,
+                                int64_t rank) {
+  std::string id;
+  if (!vid.empty()) {
+    id.reserve(vid.size() + 1);
+    id.append(1, 'v').append(vid);
+    return id;
+  }
+  id.reserve(src.size() + dst.size() + sizeof(int64_t) + 5);
+  id.append(1, 'e');
+  appendString(&id, src);
+  appendString(&id, dst);
+  id.append(reinterpret_cast<const char*>(&rank), sizeof(int64_t));
+  return id;
+}
+
+plugin::ESQueryResult::Item LocalFTIndex::decodeDocId(folly::StringPiece docId, double score) {
+  if (docId.startsWith('v')) {
+    return plugin::ESQueryResult::Item(docId.subpiece(1).str(), score);
+  }
+  docId.advance(1);
+  std::string src;
+  std::string dst;
+  int64_t rank = 0;
+  if (readString(&docId, &src) && readString(&docId, &dst) && docId.size() == sizeof(int64_t)) {
+    memcpy(&rank, docId.data(), sizeof(int64_t));
+  }
+  return plugin::ESQueryResult::Item(src, dst, rank, score);
+}
+
+bool LocalFTIndex::wildcardMatch(folly::StringPiece pattern, folly::StringPiece text) {
+  size_t p = 0;
+  size_t t = 0;
+  size_t star = std::string::npos;
+  size_t matched = 0;
+  while (t < text.size()) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t])) {
+      p++;
+      t++;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      star = p++;
+      matched = t;
+    } else if (star != std::string::npos) {
+      p = star + 1;
+      t = ++matched;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') {
+    p++;
+  }
+  return p == pattern.size();
+}
+
+int32_t LocalFTIndex::editDistance(folly::StringPiece lhs, folly::StringPiece rhs, int32_t max) {
+  auto diff = static_cast<int64_t>(lhs.size()) - static_cast<int64_t>(rhs.size());
+  if (std::abs(diff) > max) {
+    return max + 1;
+  }
+  std::vector<int32_t> prev(rhs.size() + 1);
+  std::vector<int32_t> cur(rhs.size() + 1);
+  for (size_t j = 0; j <= rhs.size(); ++j) {
+    prev[j] = j;
+  }
+  for (size_t i = 1; i <= lhs.size(); ++i) {
+    cur[0] = i;
+    auto rowMin = cur[0];
+    for (size_t j = 1; j <= rhs.size(); ++j) {
+      auto cost = lhs[i - 1] == rhs[j - 1] ? 0 : 1;
+      cur[j] = std::min({prev[j] + 1, cur[j - 1] + 1, prev[j - 1] + cost});
+      rowMin = std::min(rowMin, cur[j]);
+    }
+    // Stop early if all of the distances exceed
+    if (rowMin > max) {
+      return max + 1;
+    }
+    std::swap(prev, cur);
+  }
+  return prev[rhs.size()];
+}
+
+}  // namespace kvstore
+}  // namespace nebula
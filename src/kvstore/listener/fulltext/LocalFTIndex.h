@@ -0,0 +1,193 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef KVSTORE_LISTENER_FULLTEXT_LOCALFTINDEX_H_
+#define KVSTORE_LISTENER_FULLTEXT_LOCALFTINDEX_H_
+
+#include "common/base/Base.h"
+#include "common/base/StatusOr.h"
+#include "common/plugin/fulltext/elasticsearch/ESAdapter.h"
+#include "kvstore/KVEngine.h"
+
+namespace nebula {
+namespace kvstore {
+
+/**
+ * @brief Inverted index of the text properties, which is stored in a local kv engine. A document
+ * is a vertex or an edge, and the text of each field is tokenized into terms. The key layout:
+ *
+ * posting: kPosting index \0 field \0 term \0 docId => fieldLength tf positions(delta)
+ * term:    kTerm index \0 field \0 term => document frequency
+ * stats:   kStats index \0 field => document count, total length of field
+ * document kDoc index \0 docId => terms of each field, used to remove the postings
+ * index:   kIndex index => identity of the index definition, see syncIndexes()
+ *
+ * All integers in value are varint encoded. The documents are put or removed in a batch, and
+ * committed at once. It is not thread-safe to write, but search could run concurrently with write.
+ */
+class LocalFTIndex final {
+ public:
+  /**
+   * @brief Statistics of the fields and terms a query reads, which are summed up over the parts
+   * so that the documents of all parts are scored by the same BM25 parameters
+   */
+  struct Stats {
+    // Document count and total length of each field
+    std::unordered_map<std::string, std::pair<int64_t, int64_t>> fields;
+    // Document frequency of each term, keyed by field \0 term
+    std::unordered_map<std::string, int64_t> terms;
+
+    void merge(const Stats& other);
+  };
+
+  explicit LocalFTIndex(KVEngine* engine) : engine_(engine) {
+    CHECK_NOTNULL(engine_);
+  }
+
+  /**
+   * @brief Put a document of vertex or edge into the batch, the old one is replaced
+   *
+   * @param data Text of each field
+   */
+  void put(const std::string& index,
+           const std::string& vid,
+           const std::string& src,
+           const std::string& dst,
+           int64_t rank,
+           const std::map<std::string, std::string>& data);
+
+  /**
+   * @brief Remove a document of vertex or edge in the batch
+   */
+  void remove(const std::string& index,
+              const std::string& vid,
+              const std::string& src,
+              const std::string& dst,
+              int64_t rank);
+
+  /**
+   * @brief Write the batch into engine
+   */
+  nebula::cpp2::ErrorCode commit();
+
+  /**
+   * @brief Remove all the keys of the index from engine, should not be called with a batch
+   * uncommitted
+   */
+  nebula::cpp2::ErrorCode drop(const std::string& index);
+
+  /**
+   * @brief Drop the indexes which no longer exist or whose identity changed, i.e. have been
+   * dropped and created again, and record the identities of the current ones
+   *
+   * @param indexes Identity of each existing index
+   */
+  nebula::cpp2::ErrorCode syncIndexes(const std::unordered_map<std::string, std::string>& indexes);
+
+  /**
+   * @brief Search the index with elasticsearch query string, supports term, "phrase", prefix*,
+   * wild?card*, fuzzy~N, field:term, term^boost, +must, -mustNot, AND, OR and NOT. The documents
+   * are scored by BM25.
+   *
+   * @param limit Max number of documents returned, ordered by score descending
+   * @param global Statistics of all parts collected by collectStats(), the ones of this index are
+   * used if null. The scores of different parts are comparable only if scored by the same one.
+   */
+  StatusOr<plugin::ESQueryResult> search(const std::string& index,
+                                         const std::string& query,
+                                         int64_t limit,
+                                         const Stats* global = nullptr) const;
+
+  /**
+   * @brief Collect the statistics of the fields and terms, including the expanded ones, which the
+   * query reads in this index
+   */
+  StatusOr<Stats> collectStats(const std::string& index, const std::string& query) const;
+
+  /**
+   * @brief Split the text into lowercase terms. A term is a run of ascii letters and digits, or a
+   * single character of CJK, which is encoded in 3 or 4 bytes in utf8.
+   */
+  static std::vector<std::string> tokenize(folly::StringPiece text);
+
+ private:
+  struct Clause {
+    enum class Kind : uint8_t { kTerm, kPrefix, kWildcard, kFuzzy, kPhrase };
+    enum class Occur : uint8_t { kShould, kMust, kMustNot };
+
+    Kind kind{Kind::kTerm};
+    Occur occur{Occur::kShould};
+    // Search all fields if empty
+    std::string field;
+    // Terms of phrase, or the only term of others
+    std::vector<std::string> terms;
+    int32_t fuzziness{0};
+    double boost{1.0};
+  };
+  struct Posting {
+    uint32_t fieldLength;
+    std::vector<uint32_t> positions;
+  };
+  using Scores = std::unordered_map<std::string, double>;
+
+  StatusOr<std::vector<Clause>> parse(const std::string& query) const;
+
+  StatusOr<Scores> evalClause(const std::string& index,
+                              const std::vector<std::string>& fields,
+                              const Clause& clause,
+                              const Stats* global) const;
+
+  // The terms of clause, the ones of prefix, wildcard and fuzzy clauses are expanded
+  nebula::cpp2::ErrorCode clauseTerms(const std::string& index,
+                                      const std::string& field,
+                                      const Clause& clause,
+                                      std::vector<std::string>* terms) const;
+
+  // Expand the terms of prefix, wildcard and fuzzy clauses
+  nebula::cpp2::ErrorCode expand(const std::string& index,
+                                 const std::string& field,
+                                 const Clause& clause,
+                                 std::vector<std::string>* terms) const;
+
+  nebula::cpp2::ErrorCode postings(const std::string& index,
+                                   const std::string& field,
+                                   const std::string& term,
+                                   std::unordered_map<std::string, Posting>* result) const;
+
+  // Document count and total length of field
+  std::pair<int64_t, int64_t> stats(const std::string& index, const std::string& field) const;
+
+  int64_t docFreq(const std::string& index,
+                  const std::string& field,
+                  const std::string& term) const;
+
+  std::vector<std::string> fields(const std::string& index) const;
+
+  void removeDoc(const std::string& index, const std::string& docId);
+
+  static std::string docId(const std::string& vid,
+                           const std::string& src,
+                           const std::string& dst,
+                           int64_t rank);
+
+  static plugin::ESQueryResult::Item decodeDocId(folly::StringPiece docId, double score);
+
+  static bool wildcardMatch(folly::StringPiece pattern, folly::StringPiece text);
+
+  static int32_t editDistance(folly::StringPiece lhs, folly::StringPiece rhs, int32_t max);
+
+ private:
+  KVEngine* engine_{nullptr};
+  std::unique_ptr<WriteBatch> batch_;
+  // Pending writes which have not been committed
+  std::unordered_map<std::string, std::optional<std::string>> docs_;
+  std::unordered_map<std::string, int64_t> dfDelta_;
+  std::unordered_map<std::string, std::pair<int64_t, int64_t>> statsDelta_;
+};
+
+}  // namespace kvstore
+}  // namespace nebula
+
+#endif  // KVSTORE_LISTENER_FULLTEXT_LOCALFTINDEX_H_
@@ -0,0 +1,59 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "kvstore/listener/fulltext/LocalFTListener.h"
+
+#include "common/utils/MetaKeyUtils.h"
+
+namespace nebula {
+namespace kvstore {
+
+void LocalFTListener::processLogs() {
+  auto indexesRet = schemaMan_->getFTIndexes(spaceId_);
+  if (indexesRet.ok()) {
+    // The serialized definition, including the create time
+    std::unordered_map<std::string, std::string> indexes;
+    for (const auto& kv : indexesRet.value()) {
+      indexes.emplace(kv.first, MetaKeyUtils::fulltextIndexVal(kv.second));
+    }
+    auto code = index_->syncIndexes(indexes);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      LOG(ERROR) << idStr_ << "Sync local fulltext indexes failed: "
+                 << apache::thrift::util::enumNameSafe(code);
+    }
+  } else {
+    VLOG(1) << idStr_ << "Get fulltext indexes failed: " << indexesRet.status();
+  }
+  ESListener::processLogs();
+}
+
+bool LocalFTListener::apply(const BatchHolder& batch) {
+  auto callback = [this](BatchLogType type,
+                         const std::string& index,
+                         const std::string& vid,
+                         const std::string& src,
+                         const std::string& dst,
+                         int64_t rank,
+                         std::map<std::string, std::string> data) {
+    if (type == BatchLogType::OP_BATCH_PUT) {
+      index_->put(index, vid, src, dst, rank, data);
+    } else if (type == BatchLogType::OP_BATCH_REMOVE) {
+      index_->remove(index, vid, src, dst, rank);
+    }
+  };
+  for (const auto& log : batch.getBatch()) {
+    pickTagAndEdgeData(std::get<0>(log), std::get<1>(log), std::get<2>(log), callback);
+  }
+  auto code = index_->commit();
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(ERROR) << idStr_ << "Write local fulltext index failed: "
+               << apache::thrift::util::enumNameSafe(code);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace kvstore
+}  // namespace nebula
@@ -0,0 +1,102 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef KVSTORE_LISTENER_FULLTEXT_LOCALFTLISTENER_H_
+#define KVSTORE_LISTENER_FULLTEXT_LOCALFTLISTENER_H_
+
+#include "kvstore/RocksEngine.h"
+#include "kvstore/listener/elasticsearch/ESListener.h"
+#include "kvstore/listener/fulltext/LocalFTIndex.h"
+
+namespace nebula {
+namespace kvstore {
+
+/**
+ * @brief Listener which maintains the fulltext index in a local rocksdb instead of elasticsearch.
+ * The documents are picked from logs in the same way as ESListener, and the index is searched
+ * in process by the storage service of the listener host.
+ */
+class LocalFTListener : public ESListener {
+ public:
+  /**
+   * @brief Construct a new local fulltext listener
+   *
+   * @param spaceId
+   * @param partId
+   * @param localAddr Listener ip/addr
+   * @param walPath Listener's wal path
+   * @param dataPath Path of the rocksdb to store index
+   * @param ioPool IOThreadPool for listener
+   * @param workers Background thread for listener
+   * @param handlers Worker thread for listener
+   * @param schemaMan Schema manager
+   */
+  LocalFTListener(GraphSpaceID spaceId,
+                  PartitionID partId,
+                  HostAddr localAddr,
+                  const std::string& walPath,
+                  const std::string& dataPath,
+                  std::shared_ptr<folly::IOThreadPoolExecutor> ioPool,
+                  std::shared_ptr<thread::GenericThreadPool> workers,
+                  std::shared_ptr<folly::Executor> handlers,
+                  meta::SchemaManager* schemaMan)
+      : ESListener(spaceId,
+                   partId,
+                   std::move(localAddr),
+                   walPath,
+                   std::move(ioPool),
+                   std::move(workers),
+                   std::move(handlers),
+                   schemaMan),
+        // The keys of fulltext index have no vid in prefix
+        engine_(std::make_unique<RocksEngine>(spaceId, 0, dataPath)),
+        index_(std::make_unique<LocalFTIndex>(engine_.get())) {}
+
+  /**
+   * @brief Search the fulltext index of this part
+   *
+   * @param index Fulltext index name
+   * @param query Query in the syntax of elasticsearch query string
+   * @param limit Max number of documents returned, ordered by score
+   * @param global Statistics of all parts to score the documents, see LocalFTIndex::search()
+   */
+  StatusOr<plugin::ESQueryResult> search(const std::string& index,
+                                         const std::string& query,
+                                         int64_t limit,
+                                         const LocalFTIndex::Stats* global = nullptr) const {
+    return index_->search(index, query, limit, global);
+  }
+
+  /**
+   * @brief Collect the statistics of the fields and terms the query reads in this part
+   */
+  StatusOr<LocalFTIndex::Stats> collectStats(const std::string& index,
+                                             const std::string& query) const {
+    return index_->collectStats(index, query);
+  }
+
+ protected:
+  /**
+   * @brief Drop the data of the indexes dropped before applying the logs, which is also called
+   * periodically when there is no log
+   */
+  void processLogs() override;
+
+  /**
+   * @brief Write the documents into local index
+   *
+   * @param data Key/value to apply
+   * @return True if succeed. False if failed.
+   */
+  bool apply(const BatchHolder& batch) override;
+
+ private:
+  std::unique_ptr<RocksEngine> engine_;
+  std::unique_ptr<LocalFTIndex> index_;
+};
+
+}  // namespace kvstore
+}  // namespace nebula
+#endif  // KVSTORE_LISTENER_FULLTEXT_LOCALFTLISTENER_H_
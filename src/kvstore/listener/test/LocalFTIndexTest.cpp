@@ -0,0 +1,273 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "common/fs/TempDir.h"
+#include "kvstore/RocksEngine.h"
+#include "kvstore/listener/fulltext/LocalFTIndex.h"
+
+namespace nebula {
+namespace kvstore {
+
+class LocalFTIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    rootPath_ = std::make_unique<fs::TempDir>("/tmp/LocalFTIndexTest.XXXXXX");
+    engine_ = std::make_unique<RocksEngine>(0, 0, rootPath_->path());
+    index_ = std::make_unique<LocalFTIndex>(engine_.get());
+  }
+
+  void putVertex(const std::string& vid, const std::string& text) {
+    index_->put("idx", vid, "", "", 0, {{"text", text}});
+  }
+
+  std::vector<std::string> search(const std::string& query, int64_t limit = 10) {
+    auto ret = index_->search("idx", query, limit);
+    EXPECT_TRUE(ret.ok()) << ret.status();
+    std::vector<std::string> vids;
+    if (ret.ok()) {
+      for (const auto& item : ret.value().items) {
+        vids.emplace_back(item.vid);
+      }
+    }
+    return vids;
+  }
+
+  std::set<std::string> searchSet(const std::string& query) {
+    auto vids = search(query);
+    return std::set<std::string>(vids.begin(), vids.end());
+  }
+
+  std::unique_ptr<fs::TempDir> rootPath_;
+  std::unique_ptr<RocksEngine> engine_;
+  std::unique_ptr<LocalFTIndex> index_;
+};
+
+TEST_F(LocalFTIndexTest, TokenizeTest) {
+  using Tokens = std::vector<std::string>;
+  EXPECT_EQ(Tokens({"hello", "world", "42"}), LocalFTIndex::tokenize("Hello, WORLD! 42"));
+  EXPECT_EQ(Tokens(), LocalFTIndex::tokenize("  ,. "));
+  // Each CJK character is a term
+  EXPECT_EQ(Tokens({"abc", "中", "文"}), LocalFTIndex::tokenize("abc中文"));
+}
+
+TEST_F(LocalFTIndexTest, TermTest) {
+  putVertex("1", "the quick brown fox");
+  putVertex("2", "the lazy dog");
+  putVertex("3", "quick quick quick");
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+
+  EXPECT_EQ(std::set<std::string>({"1", "2"}), searchSet("the"));
+  EXPECT_EQ(std::set<std::string>({"2"}), searchSet("DOG"));
+  EXPECT_TRUE(searchSet("cat").empty());
+  // The higher term frequency ranks first
+  EXPECT_EQ(std::vector<std::string>({"3", "1"}), search("quick"));
+  EXPECT_EQ(std::vector<std::string>({"3"}), search("quick", 1));
+  EXPECT_EQ(std::set<std::string>({"1", "2", "3"}), searchSet("fox dog quick"));
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("text:fox"));
+  EXPECT_TRUE(searchSet("other:fox").empty());
+}
+
+TEST_F(LocalFTIndexTest, BooleanTest) {
+  putVertex("1", "apple banana");
+  putVertex("2", "apple cherry");
+  putVertex("3", "banana cherry");
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("apple AND banana"));
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("+apple +banana"));
+  EXPECT_EQ(std::set<std::string>({"1", "2", "3"}), searchSet("apple OR banana"));
+  EXPECT_EQ(std::set<std::string>({"2"}), searchSet("apple -banana"));
+  EXPECT_EQ(std::set<std::string>({"3"}), searchSet("cherry NOT apple"));
+  EXPECT_FALSE(index_->search("idx", "(apple OR banana)", 10).ok());
+  EXPECT_FALSE(index_->search("idx", "\"apple", 10).ok());
+}
+
+TEST_F(LocalFTIndexTest, PhraseAndWildcardTest) {
+  putVertex("1", "new york city");
+  putVertex("2", "york new");
+  putVertex("3", "newton");
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("\"new york\""));
+  EXPECT_EQ(std::set<std::string>({"2"}), searchSet("\"york new\""));
+  EXPECT_EQ(std::set<std::string>({"1", "2", "3"}), searchSet("new*"));
+  EXPECT_EQ(std::set<std::string>({"3"}), searchSet("ne?t*"));
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("c?ty"));
+  // york is one edit away from yorc, and two edits away from yoxx
+  EXPECT_EQ(std::set<std::string>({"1", "2"}), searchSet("yorc~1"));
+  EXPECT_TRUE(searchSet("yoxx~1").empty());
+  EXPECT_EQ(std::set<std::string>({"1", "2"}), searchSet("yoxx~"));
+}
+
+TEST_F(LocalFTIndexTest, UpdateAndRemoveTest) {
+  putVertex("1", "red");
+  index_->put("idx", "", "1", "2", 3, {{"text", "red blue"}});
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+  {
+    auto ret = index_->search("idx", "blue", 10);
+    ASSERT_TRUE(ret.ok());
+    ASSERT_EQ(1UL, ret.value().items.size());
+    const auto& item = ret.value().items.front();
+    EXPECT_EQ("1", item.src);
+    EXPECT_EQ("2", item.dst);
+    EXPECT_EQ(3, item.rank);
+  }
+
+  // Replace the document, the old terms are removed
+  putVertex("1", "green");
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("green"));
+  // Only the edge, whose vid is empty, is left
+  EXPECT_EQ(std::set<std::string>({""}), searchSet("red"));
+
+  // Put and remove in the same batch
+  putVertex("2", "green");
+  index_->remove("idx", "", "1", "2", 3);
+  index_->remove("idx", "2", "", "", 0);
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+  EXPECT_TRUE(searchSet("red").empty());
+  EXPECT_EQ(std::set<std::string>({"1"}), searchSet("green"));
+
+  // The documents of other index are not affected
+  index_->put("other", "1", "", "", 0, {{"text", "green"}});
+  index_->remove("idx", "1", "", "", 0);
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+  EXPECT_TRUE(searchSet("green").empty());
+  auto ret = index_->search("other", "green", 10);
+  ASSERT_TRUE(ret.ok());
+  EXPECT_EQ(1UL, ret.value().items.size());
+}
+
+TEST_F(LocalFTIndexTest, GlobalStatsTest) {
+  // The documents are split into two parts, and the whole ones are put in index_ as reference
+  fs::TempDir partPath1("/tmp/LocalFTIndexTest.part1.XXXXXX");
+  fs::TempDir partPath2("/tmp/LocalFTIndexTest.part2.XXXXXX");
+  RocksEngine engine1(0, 0, partPath1.path());
+  RocksEngine engine2(0, 0, partPath2.path());
+  LocalFTIndex part1(&engine1);
+  LocalFTIndex part2(&engine2);
+  std::vector<std::pair<std::string, std::string>> docs1 = {{"1", "rare apple"},
+                                                            {"2", "rare banana split"}};
+  std::vector<std::pair<std::string, std::string>> docs2 = {
+      {"3", "rare cherry"}, {"4", "common apple"}, {"5", "common banana"}, {"6", "common"}};
+  for (const auto& doc : docs1) {
+    part1.put("idx", doc.first, "", "", 0, {{"text", doc.second}});
+    putVertex(doc.first, doc.second);
+  }
+  for (const auto& doc : docs2) {
+    part2.put("idx", doc.first, "", "", 0, {{"text", doc.second}});
+    putVertex(doc.first, doc.second);
+  }
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, part1.commit());
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, part2.commit());
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+
+  auto scoresOf = [](const StatusOr<plugin::ESQueryResult>& ret) {
+    EXPECT_TRUE(ret.ok()) << ret.status();
+    std::map<std::string, double> scores;
+    if (ret.ok()) {
+      for (const auto& item : ret.value().items) {
+        scores[item.vid] = item.score;
+      }
+    }
+    return scores;
+  };
+  std::vector<std::string> queries = {
+      "rare", "rare apple", "ban*", "+rare +apple", "\"banana split\""};
+  for (const auto& query : queries) {
+    auto stats1 = part1.collectStats("idx", query);
+    auto stats2 = part2.collectStats("idx", query);
+    ASSERT_TRUE(stats1.ok() && stats2.ok());
+    LocalFTIndex::Stats global = std::move(stats1).value();
+    global.merge(stats2.value());
+    auto whole = index_->collectStats("idx", query);
+    ASSERT_TRUE(whole.ok());
+    EXPECT_EQ(whole.value().fields, global.fields) << query;
+    EXPECT_EQ(whole.value().terms, global.terms) << query;
+
+    // Scored by the statistics of all parts, it's the same as searching the whole documents
+    auto expected = scoresOf(index_->search("idx", query, 10));
+    auto actual = scoresOf(part1.search("idx", query, 10, &global));
+    for (const auto& kv : scoresOf(part2.search("idx", query, 10, &global))) {
+      actual.emplace(kv);
+    }
+    ASSERT_EQ(expected.size(), actual.size()) << query;
+    for (const auto& kv : expected) {
+      ASSERT_EQ(1UL, actual.count(kv.first)) << query;
+      EXPECT_DOUBLE_EQ(kv.second, actual[kv.first]) << query;
+    }
+  }
+  // Scored by the statistics of each part, "rare" is common in part1 and scores lower
+  auto local1 = scoresOf(part1.search("idx", "rare", 10));
+  auto local2 = scoresOf(part2.search("idx", "rare", 10));
+  EXPECT_LT(local1["1"], local2["3"]);
+
+  // The malformed query is a syntax error
+  auto ret = part1.collectStats("idx", "\"rare");
+  ASSERT_FALSE(ret.ok());
+  EXPECT_TRUE(ret.status().isSyntaxError());
+}
+
+TEST_F(LocalFTIndexTest, DropTest) {
+  auto keysOf = [this](const std::string& index) {
+    std::unique_ptr<KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine_->prefix("", &iter));
+    size_t count = 0;
+    for (; iter->valid(); iter->next()) {
+      if (iter->key().subpiece(1).startsWith(index + '\0')) {
+        ++count;
+      }
+    }
+    return count;
+  };
+
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            index_->syncIndexes({{"idx", "1"}, {"other", "1"}}));
+  putVertex("1", "red apple");
+  putVertex("2", "green apple");
+  index_->put("other", "1", "", "", 0, {{"text", "red"}});
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+  EXPECT_EQ(std::set<std::string>({"1", "2"}), searchSet("apple"));
+  EXPECT_LT(0UL, keysOf("idx"));
+
+  // Dropped
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->syncIndexes({{"other", "1"}}));
+  EXPECT_TRUE(searchSet("apple").empty());
+  EXPECT_EQ(0UL, keysOf("idx"));
+  auto ret = index_->search("other", "red", 10);
+  ASSERT_TRUE(ret.ok());
+  EXPECT_EQ(1UL, ret.value().items.size());
+
+  // Created again, and the old documents are not served
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            index_->syncIndexes({{"idx", "2"}, {"other", "1"}}));
+  putVertex("3", "yellow apple");
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, index_->commit());
+  EXPECT_EQ(std::set<std::string>({"3"}), searchSet("apple"));
+  EXPECT_TRUE(searchSet("red").empty());
+
+  // Dropped and created again between two syncs
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            index_->syncIndexes({{"idx", "3"}, {"other", "1"}}));
+  EXPECT_TRUE(searchSet("apple").empty());
+  EXPECT_EQ(0UL, keysOf("idx"));
+  ret = index_->search("other", "red", 10);
+  ASSERT_TRUE(ret.ok());
+  EXPECT_EQ(1UL, ret.value().items.size());
+}
+
+}  // namespace kvstore
+}  // namespace nebula
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::init(&argc, &argv, true);
+  google::SetStderrLogging(google::INFO);
+
+  return RUN_ALL_TESTS();
+}
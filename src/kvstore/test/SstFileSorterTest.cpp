@@ -0,0 +1,77 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/base/Base.h"
+#include "common/fs/FileUtils.h"
+#include "common/fs/TempDir.h"
+#include "kvstore/RocksEngine.h"
+#include "kvstore/SstFileSorter.h"
+
+namespace nebula {
+namespace kvstore {
+
+const int32_t kDefaultVIdLen = 8;
+
+TEST(SstFileSorterTest, EmptyTest) {
+  fs::TempDir rootPath("/tmp/SstFileSorterTest_EmptyTest.XXXXXX");
+  SstFileSorter sorter(folly::sformat("{}/sort", rootPath.path()), 1024);
+  auto ret = sorter.finish();
+  ASSERT_TRUE(ok(ret));
+  EXPECT_TRUE(value(ret).empty());
+}
+
+TEST(SstFileSorterTest, SortAndIngestTest) {
+  fs::TempDir rootPath("/tmp/SstFileSorterTest_SortAndIngestTest.XXXXXX");
+  // A small buffer to make sure the key/values are spilled into several runs
+  for (size_t bufferSize : {64UL, 1024UL * 1024}) {
+    auto dir = folly::sformat("{}/sort_{}", rootPath.path(), bufferSize);
+    SstFileSorter sorter(dir, bufferSize);
+    // Added in descending order, and each key is added twice with different values
+    for (int32_t i = 999; i >= 0; --i) {
+      auto key = folly::sformat("key_{:04d}", i);
+      EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, sorter.add(key, folly::sformat("first_{}", i)));
+    }
+    for (int32_t i = 0; i < 1000; ++i) {
+      auto key = folly::sformat("key_{:04d}", i);
+      EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+                sorter.add(key, folly::sformat("second_{}", i)));
+    }
+    EXPECT_EQ(2000UL, sorter.size());
+    auto ret = sorter.finish();
+    ASSERT_TRUE(ok(ret));
+    auto file = value(ret);
+    ASSERT_FALSE(file.empty());
+    // Only the result file is left
+    EXPECT_EQ(1UL, fs::FileUtils::listAllFilesInDir(dir.c_str()).size());
+
+    auto engine = std::make_unique<RocksEngine>(
+        0, kDefaultVIdLen, folly::sformat("{}/engine_{}", rootPath.path(), bufferSize));
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->ingest({file}));
+
+    std::unique_ptr<KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, engine->range("key_", "key_~", &iter));
+    int32_t i = 0;
+    while (iter->valid()) {
+      EXPECT_EQ(folly::sformat("key_{:04d}", i), iter->key());
+      EXPECT_EQ(folly::sformat("first_{}", i), iter->val());
+      iter->next();
+      i++;
+    }
+    EXPECT_EQ(1000, i);
+  }
+}
+
+}  // namespace kvstore
+}  // namespace nebula
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::init(&argc, &argv, true);
+  google::SetStderrLogging(google::INFO);
+
+  return RUN_ALL_TESTS();
+}
@@ -385,6 +385,24 @@ ErrorOr<nebula::cpp2::ErrorCode, IndexID> BaseProcessor<RESP>::getIndexID(
   return retCode;
 }
 
+template <typename RESP>
+nebula::cpp2::ErrorCode BaseProcessor<RESP>::removeIndexStats(GraphSpaceID spaceId,
+                                                              IndexID indexId,
+                                                              kvstore::BatchHolder* batchHolder) {
+  auto statsKey = MetaKeyUtils::indexStatsKey(spaceId);
+  auto ret = doGet(statsKey);
+  if (!nebula::ok(ret)) {
+    auto retCode = nebula::error(ret);
+    return retCode == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND ? nebula::cpp2::ErrorCode::SUCCEEDED
+                                                               : retCode;
+  }
+  auto statsItem = MetaKeyUtils::parseStatsVal(nebula::value(ret));
+  if (statsItem.index_stats_ref().has_value() && statsItem.index_stats_ref()->erase(indexId) > 0) {
+    batchHolder->put(std::move(statsKey), MetaKeyUtils::statsVal(statsItem));
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
 template <typename RESP>
 ErrorOr<nebula::cpp2::ErrorCode, bool> BaseProcessor<RESP>::checkPassword(
     const std::string& account, const std::string& password) {
@@ -518,6 +536,41 @@ bool BaseProcessor<RESP>::checkIndexExist(const std::vector<cpp2::IndexFieldDef>
   return true;
 }
 
+template <typename RESP>
+nebula::cpp2::ErrorCode BaseProcessor<RESP>::checkIncludedFields(
+    const cpp2::IndexParams* params,
+    const std::vector<cpp2::IndexFieldDef>& fields,
+    const std::vector<cpp2::ColumnDef>& schemaCols) {
+  if (params == nullptr || !params->included_fields_ref().has_value()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  if (params->vector_metric_ref().has_value()) {
+    LOG(INFO) << "Included fields are not allowed in vector index";
+    return nebula::cpp2::ErrorCode::E_UNSUPPORTED;
+  }
+  std::set<std::string> included;
+  for (const auto& name : *params->included_fields_ref()) {
+    if (!included.emplace(name).second) {
+      LOG(INFO) << "Conflict included field " << name;
+      return nebula::cpp2::ErrorCode::E_INVALID_PARM;
+    }
+    auto isIndexField = std::any_of(
+        fields.begin(), fields.end(), [&name](const auto& f) { return f.get_name() == name; });
+    if (isIndexField) {
+      LOG(INFO) << "Field " << name << " is both indexed and included";
+      return nebula::cpp2::ErrorCode::E_INVALID_PARM;
+    }
+    auto inSchema = std::any_of(schemaCols.begin(), schemaCols.end(), [&name](const auto& col) {
+      return col.get_name() == name;
+    });
+    if (!inSchema) {
+      LOG(INFO) << "Included field " << name << " not found";
+      return nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
 template <typename RESP>
 nebula::cpp2::ErrorCode BaseProcessor<RESP>::zoneExist(const std::string& zoneName) {
   auto zoneKey = MetaKeyUtils::zoneKey(zoneName);
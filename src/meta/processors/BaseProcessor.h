@@ -322,6 +322,19 @@ class BaseProcessor {
   ErrorOr<nebula::cpp2::ErrorCode, cpp2::Schema> getLatestEdgeSchema(GraphSpaceID spaceId,
                                                                      const EdgeType edgeType);
 
+  /**
+   * @brief Remove the statistics collected by the index stats job of the dropped index
+   *
+   * @tparam RESP
+   * @param spaceId
+   * @param indexId
+   * @param batchHolder
+   * @return nebula::cpp2::ErrorCode
+   */
+  nebula::cpp2::ErrorCode removeIndexStats(GraphSpaceID spaceId,
+                                           IndexID indexId,
+                                           kvstore::BatchHolder* batchHolder);
+
   /**
    * @brief Get index id by space id and index name
    *
@@ -400,6 +413,20 @@ class BaseProcessor {
    */
   bool checkIndexExist(const std::vector<cpp2::IndexFieldDef>& fields, const cpp2::IndexItem& item);
 
+  /**
+   * @brief Check the included fields of index params, which should be the properties of schema
+   * and not the index fields.
+   *
+   * @tparam RESP
+   * @param params
+   * @param fields
+   * @param schemaCols
+   * @return nebula::cpp2::ErrorCode
+   */
+  nebula::cpp2::ErrorCode checkIncludedFields(const cpp2::IndexParams* params,
+                                              const std::vector<cpp2::IndexFieldDef>& fields,
+                                              const std::vector<cpp2::ColumnDef>& schemaCols);
+
   /**
    * @brief Check if given zone exist.
    *
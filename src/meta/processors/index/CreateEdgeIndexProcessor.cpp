@@ -37,6 +37,17 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
     return;
   }
 
+  if (req.index_params_ref().has_value()) {
+    const auto& params = *req.index_params_ref();
+    if (params.vector_metric_ref().has_value() || params.hnsw_m_ref().has_value() ||
+        params.hnsw_ef_construction_ref().has_value()) {
+      LOG(INFO) << "Vector index on edge is not supported";
+      handleErrorCode(nebula::cpp2::ErrorCode::E_UNSUPPORTED);
+      onFinished();
+      return;
+    }
+  }
+
   folly::SharedMutex::ReadHolder rHolder(LockUtils::snapshotLock());
   folly::SharedMutex::WriteHolder holder(LockUtils::lock());
   // check if the space already exist index has the same index name
@@ -201,6 +212,13 @@ void CreateEdgeIndexProcessor::process(const cpp2::CreateEdgeIndexReq& req) {
     columns.emplace_back(col);
   }
 
+  auto includedCode = checkIncludedFields(req.get_index_params(), fields, schemaCols);
+  if (includedCode != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    handleErrorCode(includedCode);
+    onFinished();
+    return;
+  }
+
   // add index item
   std::vector<kvstore::KV> data;
   auto edgeIndexRet = autoIncrementIdInSpace(space);
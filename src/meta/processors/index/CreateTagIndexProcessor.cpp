@@ -37,6 +37,26 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
     return;
   }
 
+  // The vector index is built on a single list<float> column
+  bool isVectorIndex = false;
+  if (req.index_params_ref().has_value()) {
+    const auto& params = *req.index_params_ref();
+    isVectorIndex = params.vector_metric_ref().has_value();
+    if (!isVectorIndex &&
+        (params.hnsw_m_ref().has_value() || params.hnsw_ef_construction_ref().has_value())) {
+      LOG(INFO) << "The hnsw params are only allowed in vector index";
+      handleErrorCode(nebula::cpp2::ErrorCode::E_INVALID_PARM);
+      onFinished();
+      return;
+    }
+    if (isVectorIndex && fields.size() != 1) {
+      LOG(INFO) << "Only support to create vector index on a single column";
+      handleErrorCode(nebula::cpp2::ErrorCode::E_UNSUPPORTED);
+      onFinished();
+      return;
+    }
+  }
+
   folly::SharedMutex::ReadHolder rHolder(LockUtils::snapshotLock());
   folly::SharedMutex::WriteHolder holder(LockUtils::lock());
 
@@ -144,6 +164,17 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
       onFinished();
       return;
     }
+    if (isVectorIndex) {
+      if (col.type.get_type() != nebula::cpp2::PropertyType::LIST_FLOAT) {
+        LOG(INFO) << "Field " << field.get_name() << " in Tag " << tagName
+                  << " is not list<float>, which can not be vector indexed.";
+        handleErrorCode(nebula::cpp2::ErrorCode::E_INVALID_PARM);
+        onFinished();
+        return;
+      }
+      columns.emplace_back(col);
+      continue;
+    }
     // Add checks for list and set types that cannot be indexed
     if (col.type.get_type() == nebula::cpp2::PropertyType::LIST_STRING ||
         col.type.get_type() == nebula::cpp2::PropertyType::LIST_INT ||
@@ -201,6 +232,13 @@ void CreateTagIndexProcessor::process(const cpp2::CreateTagIndexReq& req) {
     columns.emplace_back(col);
   }
 
+  auto includedCode = checkIncludedFields(req.get_index_params(), fields, schemaCols);
+  if (includedCode != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    handleErrorCode(includedCode);
+    onFinished();
+    return;
+  }
+
   std::vector<kvstore::KV> data;
   auto tagIndexRet = autoIncrementIdInSpace(space);
   if (!nebula::ok(tagIndexRet)) {
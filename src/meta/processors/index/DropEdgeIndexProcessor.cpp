@@ -62,6 +62,14 @@ void DropEdgeIndexProcessor::process(const cpp2::DropEdgeIndexReq& req) {
   }
 
   batchHolder->remove(std::move(indexKey));
+  auto statsRet = removeIndexStats(spaceID, edgeIndexID, batchHolder.get());
+  if (statsRet != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(INFO) << "Drop Edge Index Failed: SpaceID " << spaceID << " Index Name: " << indexName
+              << " error: " << apache::thrift::util::enumNameSafe(statsRet);
+    handleErrorCode(statsRet);
+    onFinished();
+    return;
+  }
   LOG(INFO) << "Drop Edge Index " << indexName;
   resp_.id_ref() = to(edgeIndexID, EntryType::INDEX);
 
@@ -63,6 +63,14 @@ void DropTagIndexProcessor::process(const cpp2::DropTagIndexReq& req) {
   }
 
   batchHolder->remove(std::move(indexKey));
+  auto statsRet = removeIndexStats(spaceID, tagIndexID, batchHolder.get());
+  if (statsRet != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(INFO) << "Drop Tag Index Failed: SpaceID " << spaceID << " Index Name: " << indexName
+              << " error: " << apache::thrift::util::enumNameSafe(statsRet);
+    handleErrorCode(statsRet);
+    onFinished();
+    return;
+  }
   LOG(INFO) << "Drop Tag Index " << indexName;
   resp_.id_ref() = to(tagIndexID, EntryType::INDEX);
 
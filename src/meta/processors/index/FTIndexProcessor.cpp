@@ -104,42 +104,54 @@ void CreateFTIndexProcessor::process(const cpp2::CreateFTIndexReq& req) {
     // }
     it->next();
   }
-  const auto& serviceKey = MetaKeyUtils::serviceKey(cpp2::ExternalServiceType::ELASTICSEARCH);
-  auto getRet = doGet(serviceKey);
-  if (!nebula::ok(getRet)) {
-    auto retCode = nebula::error(getRet);
-    LOG(INFO) << "Create fulltext index failed, error: "
-              << apache::thrift::util::enumNameSafe(retCode);
-    handleErrorCode(retCode);
+  // The index of space with local fulltext listeners is maintained by the listeners themselves
+  auto localRet = listenerExist(index.get_space_id(), cpp2::ListenerType::LOCAL_FULLTEXT);
+  if (localRet != nebula::cpp2::ErrorCode::SUCCEEDED &&
+      localRet != nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND) {
+    handleErrorCode(localRet);
     onFinished();
     return;
   }
+  if (localRet == nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND) {
+    const auto& serviceKey = MetaKeyUtils::serviceKey(cpp2::ExternalServiceType::ELASTICSEARCH);
+    auto getRet = doGet(serviceKey);
+    if (!nebula::ok(getRet)) {
+      auto retCode = nebula::error(getRet);
+      LOG(INFO) << "Create fulltext index failed, error: "
+                << apache::thrift::util::enumNameSafe(retCode);
+      handleErrorCode(retCode);
+      onFinished();
+      return;
+    }
 
-  auto clients = MetaKeyUtils::parseServiceClients(nebula::value(getRet));
-  if (clients.size() <= 0) {
-    handleErrorCode(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND);
-    onFinished();
-    return;
-  }
-  std::vector<plugin::ESClient> esClients;
-  for (auto& client : clients) {
-    std::string protocol = client.conn_type_ref().has_value() ? *client.get_conn_type() : "http";
-    std::string user = client.user_ref().has_value() ? *client.get_user() : "";
-    std::string password = client.pwd_ref().has_value() ? *client.get_pwd() : "";
-    esClients.emplace_back(
-        HttpClient::instance(), protocol, client.get_host().toRawString(), user, password);
-  }
-  plugin::ESAdapter esAdapter(std::move(esClients));
-  auto createIndexresult = esAdapter.createIndex(name, index.get_fields(), index.get_analyzer());
-  if (!createIndexresult.ok()) {
-    LOG(ERROR) << createIndexresult.message();
-    handleErrorCode(nebula::cpp2::ErrorCode::E_ACCESS_ES_FAILURE);
-    onFinished();
-    return;
+    auto clients = MetaKeyUtils::parseServiceClients(nebula::value(getRet));
+    if (clients.size() <= 0) {
+      handleErrorCode(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND);
+      onFinished();
+      return;
+    }
+    std::vector<plugin::ESClient> esClients;
+    for (auto& client : clients) {
+      std::string protocol = client.conn_type_ref().has_value() ? *client.get_conn_type() : "http";
+      std::string user = client.user_ref().has_value() ? *client.get_user() : "";
+      std::string password = client.pwd_ref().has_value() ? *client.get_pwd() : "";
+      esClients.emplace_back(
+          HttpClient::instance(), protocol, client.get_host().toRawString(), user, password);
+    }
+    plugin::ESAdapter esAdapter(std::move(esClients));
+    auto createIndexresult = esAdapter.createIndex(name, index.get_fields(), index.get_analyzer());
+    if (!createIndexresult.ok()) {
+      LOG(ERROR) << createIndexresult.message();
+      handleErrorCode(nebula::cpp2::ErrorCode::E_ACCESS_ES_FAILURE);
+      onFinished();
+      return;
+    }
   }
-  std::vector<kvstore::KV> data;
-  data.emplace_back(MetaKeyUtils::fulltextIndexKey(name), MetaKeyUtils::fulltextIndexVal(index));
   auto timeInMilliSec = time::WallClock::fastNowInMilliSec();
+  auto newIndex = index;
+  newIndex.create_time_ref() = timeInMilliSec;
+  std::vector<kvstore::KV> data;
+  data.emplace_back(MetaKeyUtils::fulltextIndexKey(name), MetaKeyUtils::fulltextIndexVal(newIndex));
   LastUpdateTimeMan::update(data, timeInMilliSec);
   auto result = doSyncPut(std::move(data));
   handleErrorCode(result);
@@ -166,39 +178,51 @@ void DropFTIndexProcessor::process(const cpp2::DropFTIndexReq& req) {
     return;
   }
 
-  const auto& serviceKey = MetaKeyUtils::serviceKey(cpp2::ExternalServiceType::ELASTICSEARCH);
-  auto getRet = doGet(serviceKey);
-  if (!nebula::ok(getRet)) {
-    auto retCode = nebula::error(getRet);
-    LOG(INFO) << "Drop fulltext index failed, error: "
-              << apache::thrift::util::enumNameSafe(retCode);
-    handleErrorCode(retCode);
+  auto space = MetaKeyUtils::parsefulltextIndex(nebula::value(ret)).get_space_id();
+  auto localRet = listenerExist(space, cpp2::ListenerType::LOCAL_FULLTEXT);
+  if (localRet != nebula::cpp2::ErrorCode::SUCCEEDED &&
+      localRet != nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND) {
+    handleErrorCode(localRet);
     onFinished();
     return;
   }
+  if (localRet == nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND) {
+    const auto& serviceKey = MetaKeyUtils::serviceKey(cpp2::ExternalServiceType::ELASTICSEARCH);
+    auto getRet = doGet(serviceKey);
+    if (!nebula::ok(getRet)) {
+      auto retCode = nebula::error(getRet);
+      LOG(INFO) << "Drop fulltext index failed, error: "
+                << apache::thrift::util::enumNameSafe(retCode);
+      handleErrorCode(retCode);
+      onFinished();
+      return;
+    }
 
-  auto clients = MetaKeyUtils::parseServiceClients(nebula::value(getRet));
-  if (clients.size() <= 0) {
-    handleErrorCode(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND);
-    onFinished();
-    return;
-  }
-  std::vector<plugin::ESClient> esClients;
-  for (auto& client : clients) {
-    std::string protocol = client.conn_type_ref().has_value() ? *client.get_conn_type() : "http";
-    std::string user = client.user_ref().has_value() ? *client.get_user() : "";
-    std::string password = client.pwd_ref().has_value() ? *client.get_pwd() : "";
-    esClients.emplace_back(
-        HttpClient::instance(), protocol, client.get_host().toRawString(), user, password);
-  }
-  plugin::ESAdapter esAdapter(std::move(esClients));
-  auto dropIndexresult = esAdapter.dropIndex(req.get_fulltext_index_name());
-  if (!dropIndexresult.ok()) {
-    LOG(ERROR) << dropIndexresult.message();
-    handleErrorCode(nebula::cpp2::ErrorCode::E_ACCESS_ES_FAILURE);
-    onFinished();
-    return;
+    auto clients = MetaKeyUtils::parseServiceClients(nebula::value(getRet));
+    if (clients.size() <= 0) {
+      handleErrorCode(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND);
+      onFinished();
+      return;
+    }
+    std::vector<plugin::ESClient> esClients;
+    for (auto& client : clients) {
+      std::string protocol = client.conn_type_ref().has_value() ? *client.get_conn_type() : "http";
+      std::string user = client.user_ref().has_value() ? *client.get_user() : "";
+      std::string password = client.pwd_ref().has_value() ? *client.get_pwd() : "";
+      esClients.emplace_back(
+          HttpClient::instance(), protocol, client.get_host().toRawString(), user, password);
+    }
+    plugin::ESAdapter esAdapter(std::move(esClients));
+    auto dropIndexresult = esAdapter.dropIndex(req.get_fulltext_index_name());
+    if (!dropIndexresult.ok()) {
+      LOG(ERROR) << dropIndexresult.message();
+      handleErrorCode(nebula::cpp2::ErrorCode::E_ACCESS_ES_FAILURE);
+      onFinished();
+      return;
+    }
   }
+  // The local fulltext listeners remove the data of the index once they find it dropped, see
+  // LocalFTListener::processLogs()
 
   auto batchHolder = std::make_unique<kvstore::BatchHolder>();
   batchHolder->remove(std::move(indexKey));
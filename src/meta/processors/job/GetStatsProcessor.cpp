@@ -37,6 +37,15 @@ void GetStatsProcessor::process(const cpp2::GetStatsReq& req) {
     return;
   }
 
+  // The index statistics is collected by another job, attach it if exists
+  auto indexStatsRet = doGet(MetaKeyUtils::indexStatsKey(spaceId));
+  if (nebula::ok(indexStatsRet)) {
+    auto indexStats = MetaKeyUtils::parseStatsVal(nebula::value(indexStatsRet));
+    if (indexStats.index_stats_ref().has_value()) {
+      statsItem.index_stats_ref() = std::move(*indexStats.index_stats_ref());
+    }
+  }
+
   handleErrorCode(nebula::cpp2::ErrorCode::SUCCEEDED);
   resp_.stats_ref() = std::move(statsItem);
   onFinished();
@@ -0,0 +1,227 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "meta/processors/job/IndexStatsJobExecutor.h"
+
+#include "common/time/WallClock.h"
+#include "common/utils/IndexStatsUtils.h"
+#include "common/utils/MetaKeyUtils.h"
+#include "meta/processors/Common.h"
+
+DEFINE_uint32(index_stats_histogram_buckets,
+              64,
+              "The number of buckets of the equi-depth histogram of an index column");
+DEFINE_uint32(index_stats_max_samples,
+              16384,
+              "The max number of sampled values kept for an index column to build histogram");
+
+namespace nebula {
+namespace meta {
+
+nebula::cpp2::ErrorCode IndexStatsJobExecutor::save(const std::string& key,
+                                                    const std::string& val) {
+  std::vector<kvstore::KV> data{std::make_pair(key, val)};
+  folly::Baton<true, std::atomic> baton;
+  auto rc = nebula::cpp2::ErrorCode::SUCCEEDED;
+  kvstore_->asyncMultiPut(
+      kDefaultSpaceId, kDefaultPartId, std::move(data), [&](nebula::cpp2::ErrorCode code) {
+        rc = code;
+        baton.post();
+      });
+  baton.wait();
+  return rc;
+}
+
+nebula::cpp2::ErrorCode IndexStatsJobExecutor::doRemove(const std::string& key) {
+  folly::Baton<true, std::atomic> baton;
+  auto rc = nebula::cpp2::ErrorCode::SUCCEEDED;
+  kvstore_->asyncRemove(kDefaultSpaceId, kDefaultPartId, key, [&](nebula::cpp2::ErrorCode code) {
+    rc = code;
+    baton.post();
+  });
+  baton.wait();
+  return rc;
+}
+
+nebula::cpp2::ErrorCode IndexStatsJobExecutor::prepare() {
+  // The value of paras_ are index name
+  auto spaceRet = spaceExist();
+  if (spaceRet != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(INFO) << "Can't find the space, spaceId " << space_;
+    return spaceRet;
+  }
+
+  std::string indexValue;
+  for (const auto& indexName : paras_) {
+    auto indexKey = MetaKeyUtils::indexIndexKey(space_, indexName);
+    auto retCode = kvstore_->get(kDefaultSpaceId, kDefaultPartId, indexKey, &indexValue);
+    if (retCode != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      LOG(INFO) << "Get indexKey error indexName: " << indexName
+                << " error: " << apache::thrift::util::enumNameSafe(retCode);
+      return retCode;
+    }
+    auto indexId = *reinterpret_cast<const IndexID*>(indexValue.c_str());
+    taskParameters_.emplace_back(folly::to<std::string>(indexId));
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+folly::Future<Status> IndexStatsJobExecutor::executeInternal(HostAddr&& address,
+                                                             std::vector<PartitionID>&& parts) {
+  folly::Promise<Status> pro;
+  auto f = pro.getFuture();
+  adminClient_
+      ->addTask(cpp2::JobType::INDEX_STATS,
+                jobId_,
+                taskId_++,
+                space_,
+                std::move(address),
+                taskParameters_,
+                std::move(parts))
+      .then([pro = std::move(pro)](auto&& t) mutable {
+        CHECK(!t.hasException());
+        auto status = std::move(t).value();
+        if (status.ok()) {
+          pro.setValue(Status::OK());
+        } else {
+          pro.setValue(status.status());
+        }
+      });
+  return f;
+}
+
+/**
+ * @brief caller will guarantee there won't be any conflict read / write.
+ */
+nebula::cpp2::ErrorCode IndexStatsJobExecutor::saveSpecialTaskStatus(
+    const cpp2::ReportTaskReq& req) {
+  if (!req.stats_ref().has_value() || !req.stats_ref()->index_stats_ref().has_value()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  cpp2::StatsItem statsItem;
+  auto tempKey = toTempKey(req.get_job_id());
+  std::string val;
+  auto ret = kvstore_->get(kDefaultSpaceId, kDefaultPartId, tempKey, &val);
+  if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    statsItem = MetaKeyUtils::parseStatsVal(val);
+  } else if (ret != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    return ret;
+  }
+
+  if (!statsItem.index_stats_ref().has_value()) {
+    statsItem.index_stats_ref() = {};
+  }
+  auto& indexStats = *statsItem.index_stats_ref();
+  for (const auto& [indexId, stats] : *req.stats_ref()->index_stats_ref()) {
+    IndexStatsUtils::merge(indexStats[indexId], stats, FLAGS_index_stats_max_samples);
+  }
+  return save(tempKey, MetaKeyUtils::statsVal(statsItem));
+}
+
+/**
+ * @brief Separate the partial result by job, the previous statistics is still available until
+ * the job finishes.
+ * @return std::string
+ */
+std::string IndexStatsJobExecutor::toTempKey(int32_t jobId) {
+  std::string key = MetaKeyUtils::indexStatsKey(space_);
+  return key.append(reinterpret_cast<const char*>(&jobId), sizeof(int32_t));
+}
+
+nebula::cpp2::ErrorCode IndexStatsJobExecutor::finish(bool exeSuccessed) {
+  auto tempKey = toTempKey(jobId_);
+  if (!exeSuccessed) {
+    // Keep the previous statistics
+    LOG(INFO) << "Index stats job failed, spaceId : " << space_;
+    return doRemove(tempKey);
+  }
+
+  std::string val;
+  auto ret = kvstore_->get(kDefaultSpaceId, kDefaultPartId, tempKey, &val);
+  if (ret == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    LOG(INFO) << "No index stats collected, spaceId : " << space_;
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return ret;
+  }
+  auto partial = MetaKeyUtils::parseStatsVal(val);
+  if (!partial.index_stats_ref().has_value()) {
+    return doRemove(tempKey);
+  }
+
+  // Only replace the statistics of indexes collected by this job
+  auto indexStatsKey = MetaKeyUtils::indexStatsKey(space_);
+  cpp2::StatsItem statsItem;
+  ret = kvstore_->get(kDefaultSpaceId, kDefaultPartId, indexStatsKey, &val);
+  if (ret == nebula::cpp2::ErrorCode::SUCCEEDED) {
+    statsItem = MetaKeyUtils::parseStatsVal(val);
+  } else if (ret != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    return ret;
+  }
+  if (!statsItem.index_stats_ref().has_value()) {
+    statsItem.index_stats_ref() = {};
+  }
+  auto& indexStats = *statsItem.index_stats_ref();
+  for (auto& [indexId, stats] : *partial.index_stats_ref()) {
+    // The index dropped while the job is running
+    ret = kvstore_->get(
+        kDefaultSpaceId, kDefaultPartId, MetaKeyUtils::indexKey(space_, indexId), &val);
+    if (ret == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+      continue;
+    }
+    if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return ret;
+    }
+    IndexStatsUtils::finalize(stats, FLAGS_index_stats_histogram_buckets);
+    stats.update_time_ref() = time::WallClock::fastNowInSec();
+    indexStats[indexId] = std::move(stats);
+  }
+  statsItem.status_ref() = cpp2::JobStatus::FINISHED;
+
+  auto retCode = save(indexStatsKey, MetaKeyUtils::statsVal(statsItem));
+  if (retCode != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(INFO) << "Save index stats failed, error " << apache::thrift::util::enumNameSafe(retCode);
+    return retCode;
+  }
+  return doRemove(tempKey);
+}
+
+nebula::cpp2::ErrorCode IndexStatsJobExecutor::stop() {
+  auto errOrTargetHost = getTargetHost(space_);
+  if (!nebula::ok(errOrTargetHost)) {
+    LOG(INFO) << "Get target host failed";
+    auto retCode = nebula::error(errOrTargetHost);
+    if (retCode != nebula::cpp2::ErrorCode::E_LEADER_CHANGED) {
+      retCode = nebula::cpp2::ErrorCode::E_NO_HOSTS;
+    }
+    return retCode;
+  }
+
+  auto& hosts = nebula::value(errOrTargetHost);
+  std::vector<folly::Future<StatusOr<bool>>> futures;
+  for (auto& host : hosts) {
+    // Will convert StorageAddr to AdminAddr in AdminClient
+    auto future = adminClient_->stopTask(host.first, jobId_, 0);
+    futures.emplace_back(std::move(future));
+  }
+
+  auto tries = folly::collectAll(std::move(futures)).get();
+  if (std::any_of(tries.begin(), tries.end(), [](auto& t) { return t.hasException(); })) {
+    LOG(INFO) << "index stats job stop() RPC failure.";
+    return nebula::cpp2::ErrorCode::E_RPC_FAILURE;
+  }
+
+  for (const auto& t : tries) {
+    if (!t.value().ok()) {
+      LOG(INFO) << "Stop index stats job Failed";
+      return nebula::cpp2::ErrorCode::E_RPC_FAILURE;
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+}  // namespace meta
+}  // namespace nebula
@@ -0,0 +1,68 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef META_INDEXSTATSJOBEXECUTOR_H_
+#define META_INDEXSTATSJOBEXECUTOR_H_
+
+#include "interface/gen-cpp2/meta_types.h"
+#include "meta/processors/admin/AdminClient.h"
+#include "meta/processors/job/StorageJobExecutor.h"
+
+namespace nebula {
+namespace meta {
+
+/**
+ * @brief Collect the statistics of the given indexes, or all indexes of the space if no index is
+ * given. Only the statistics of the collected indexes are replaced when job finishes, the others
+ * are kept as before.
+ */
+class IndexStatsJobExecutor : public StorageJobExecutor {
+ public:
+  IndexStatsJobExecutor(GraphSpaceID space,
+                        JobID jobId,
+                        kvstore::KVStore* kvstore,
+                        AdminClient* adminClient,
+                        const std::vector<std::string>& paras)
+      : StorageJobExecutor(space, jobId, kvstore, adminClient, paras) {
+    toHost_ = TargetHosts::LEADER;
+  }
+
+  /**
+   * @brief Convert the index names to index ids
+   *
+   * @return
+   */
+  nebula::cpp2::ErrorCode prepare() override;
+
+  nebula::cpp2::ErrorCode stop() override;
+
+  folly::Future<Status> executeInternal(HostAddr&& address,
+                                        std::vector<PartitionID>&& parts) override;
+
+  /**
+   * @brief Build the ndv and histograms from the merged partial results, and save them
+   *
+   * @param exeSuccessed
+   * @return
+   */
+  nebula::cpp2::ErrorCode finish(bool exeSuccessed) override;
+
+  nebula::cpp2::ErrorCode saveSpecialTaskStatus(const cpp2::ReportTaskReq& req) override;
+
+ private:
+  nebula::cpp2::ErrorCode save(const std::string& key, const std::string& val);
+
+  nebula::cpp2::ErrorCode doRemove(const std::string& key);
+
+  std::string toTempKey(int32_t jobId);
+
+ private:
+  std::vector<std::string> taskParameters_;
+};
+
+}  // namespace meta
+}  // namespace nebula
+
+#endif  // META_INDEXSTATSJOBEXECUTOR_H_
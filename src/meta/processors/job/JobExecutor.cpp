@@ -16,6 +16,7 @@
 #include "meta/processors/job/DataBalanceJobExecutor.h"
 #include "meta/processors/job/DownloadJobExecutor.h"
 #include "meta/processors/job/FlushJobExecutor.h"
+#include "meta/processors/job/IndexStatsJobExecutor.h"
 #include "meta/processors/job/IngestJobExecutor.h"
 #include "meta/processors/job/LeaderBalanceJobExecutor.h"
 #include "meta/processors/job/RebuildEdgeJobExecutor.h"
@@ -84,6 +85,10 @@ std::unique_ptr<JobExecutor> JobExecutorFactory::createJobExecutor(const JobDesc
     case cpp2::JobType::STATS:
       ret.reset(new StatsJobExecutor(jd.getSpace(), jd.getJobId(), store, client, jd.getParas()));
       break;
+    case cpp2::JobType::INDEX_STATS:
+      ret.reset(
+          new IndexStatsJobExecutor(jd.getSpace(), jd.getJobId(), store, client, jd.getParas()));
+      break;
     default:
       break;
   }
@@ -144,6 +144,10 @@ folly::Future<nebula::cpp2::ErrorCode> StorageJobExecutor::execute() {
     }
     case TargetHosts::LISTENER: {
       addressesRet = getListenerHost(space_, cpp2::ListenerType::ELASTICSEARCH);
+      if (!nebula::ok(addressesRet) &&
+          nebula::error(addressesRet) == nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND) {
+        addressesRet = getListenerHost(space_, cpp2::ListenerType::LOCAL_FULLTEXT);
+      }
       break;
     }
     case TargetHosts::DEFAULT: {
@@ -103,6 +103,22 @@ void DropSpaceProcessor::process(const cpp2::DropSpaceReq& req) {
   auto statskey = MetaKeyUtils::statsKey(spaceId);
   batchHolder->remove(std::move(statskey));
 
+  // Also the partial results of the index stats job, which are prefixed with the key
+  auto indexStatsRet = doPrefix(MetaKeyUtils::indexStatsKey(spaceId));
+  if (!nebula::ok(indexStatsRet)) {
+    auto retCode = nebula::error(indexStatsRet);
+    LOG(INFO) << "Drop space Failed, space " << spaceName
+              << " error: " << apache::thrift::util::enumNameSafe(retCode);
+    handleErrorCode(retCode);
+    onFinished();
+    return;
+  }
+  auto indexStatsIter = nebula::value(indexStatsRet).get();
+  while (indexStatsIter->valid()) {
+    batchHolder->remove(indexStatsIter->key().str());
+    indexStatsIter->next();
+  }
+
   // 6. Delete related fulltext index meta data
   auto ftPrefix = MetaKeyUtils::fulltextIndexPrefix();
   auto ftRet = doPrefix(ftPrefix);
@@ -6,11 +6,13 @@
 #include <folly/synchronization/Baton.h>
 #include <gtest/gtest.h>
 
+#include "common/algorithm/HyperLogLog.h"
 #include "common/base/Base.h"
 #include "common/fs/TempDir.h"
 #include "interface/gen-cpp2/meta_types.h"
 #include "kvstore/Common.h"
 #include "meta/processors/job/GetStatsProcessor.h"
+#include "meta/processors/job/IndexStatsJobExecutor.h"
 #include "meta/processors/job/JobManager.h"
 #include "meta/test/MockAdminClient.h"
 #include "meta/test/TestUtils.h"
@@ -608,6 +610,87 @@ TEST_F(GetStatsTest, MockMultiMachineTest) {
   }
 }
 
+TEST_F(GetStatsTest, IndexStatsJob) {
+  GraphSpaceID space = 1;
+  JobID jobId = 20;
+  TestUtils::mockTagIndex(kv_.get(), 2, "tag_2", 10, "tag_2_index", {});
+  IndexStatsJobExecutor executor(space, jobId, kv_.get(), nullptr, {});
+
+  // Each partition reports 50 rows of 50 distinct values, 10 of them shared with the other one
+  auto partial = [](IndexID indexId, int64_t from) {
+    algorithm::HyperLogLog hll;
+    cpp2::IndexColumnStats column;
+    column.name_ref() = "c1";
+    column.null_count_ref() = 0;
+    column.samples_ref() = std::vector<Value>();
+    for (int64_t i = from; i < from + 50; ++i) {
+      hll.add(std::to_string(i));
+      column.samples_ref()->emplace_back(i);
+    }
+    column.sketch_ref() = hll.registers();
+    cpp2::IndexStats stats;
+    stats.index_id_ref() = indexId;
+    stats.rows_ref() = 50;
+    stats.columns_ref() = {column};
+    cpp2::ReportTaskReq req;
+    req.code_ref() = nebula::cpp2::ErrorCode::SUCCEEDED;
+    req.job_id_ref() = 20;
+    req.stats_ref() = cpp2::StatsItem();
+    req.stats_ref()->index_stats_ref() = {{indexId, stats}};
+    return req;
+  };
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, executor.saveSpecialTaskStatus(partial(10, 0)));
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, executor.saveSpecialTaskStatus(partial(10, 40)));
+  // The index 11 doesn't exist, it's dropped while the job is running
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, executor.saveSpecialTaskStatus(partial(11, 0)));
+
+  // The statistics are only visible after the job finishes
+  auto indexStatsKey = MetaKeyUtils::indexStatsKey(space);
+  auto tempKey = indexStatsKey;
+  tempKey.append(reinterpret_cast<const char*>(&jobId), sizeof(JobID));
+  std::string val;
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            kv_->get(kDefaultSpaceId, kDefaultPartId, tempKey, &val));
+  ASSERT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND,
+            kv_->get(kDefaultSpaceId, kDefaultPartId, indexStatsKey, &val));
+
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, executor.finish(true));
+  ASSERT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND,
+            kv_->get(kDefaultSpaceId, kDefaultPartId, tempKey, &val));
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            kv_->get(kDefaultSpaceId, kDefaultPartId, indexStatsKey, &val));
+  auto statsItem = MetaKeyUtils::parseStatsVal(val);
+  ASSERT_TRUE(statsItem.index_stats_ref().has_value());
+  const auto& indexStats = *statsItem.index_stats_ref();
+  ASSERT_EQ(1, indexStats.size());
+  const auto& stats = indexStats.at(10);
+  ASSERT_EQ(100, stats.get_rows());
+  ASSERT_EQ(1, stats.get_columns().size());
+  const auto& column = stats.get_columns().front();
+  ASSERT_GE(column.get_ndv(), 85);
+  ASSERT_LE(column.get_ndv(), 95);
+  ASSERT_FALSE(column.get_histogram().empty());
+  ASSERT_TRUE(std::is_sorted(column.get_histogram().begin(), column.get_histogram().end()));
+  ASSERT_FALSE(column.sketch_ref().has_value());
+  ASSERT_FALSE(column.samples_ref().has_value());
+
+  // A failed job keeps the previous statistics and cleans up its partial result
+  IndexStatsJobExecutor failed(space, jobId + 1, kv_.get(), nullptr, {});
+  auto req = partial(10, 0);
+  req.job_id_ref() = jobId + 1;
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, failed.saveSpecialTaskStatus(req));
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, failed.finish(false));
+  std::unique_ptr<kvstore::KVIterator> iter;
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            kv_->prefix(kDefaultSpaceId, kDefaultPartId, indexStatsKey, &iter));
+  size_t count = 0;
+  for (; iter->valid(); iter->next()) {
+    ASSERT_EQ(indexStatsKey, iter->key());
+    ++count;
+  }
+  ASSERT_EQ(1, count);
+}
+
 }  // namespace meta
 }  // namespace nebula
 
@@ -509,6 +509,109 @@ TEST(IndexProcessorTest, TagIndexTestV2) {
   }
 }
 
+TEST(IndexProcessorTest, DropTagIndexStatsTest) {
+  fs::TempDir rootPath("/tmp/DropTagIndexStatsTest.XXXXXX");
+  std::unique_ptr<kvstore::KVStore> kv(MockCluster::initMetaKV(rootPath.path()));
+  TestUtils::createSomeHosts(kv.get());
+  TestUtils::assembleSpace(kv.get(), 1, 1);
+  TestUtils::mockTag(kv.get(), 2, 0, true);
+  {
+    cpp2::CreateTagIndexReq req;
+    req.space_id_ref() = 1;
+    req.tag_name_ref() = "tag_0";
+    cpp2::IndexFieldDef field;
+    field.name_ref() = "tag_0_col_0";
+    req.fields_ref() = {field};
+    req.index_name_ref() = "single_field_index";
+    auto* processor = CreateTagIndexProcessor::instance(kv.get());
+    auto f = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(f).get();
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, resp.get_code());
+    ASSERT_EQ(1, resp.get_id().get_index_id());
+  }
+  {
+    // The statistics of the index and another one
+    cpp2::StatsItem statsItem;
+    cpp2::IndexStats stats;
+    stats.rows_ref() = 10;
+    statsItem.index_stats_ref() = {{1, stats}, {100, stats}};
+    std::vector<kvstore::KV> data{
+        {MetaKeyUtils::indexStatsKey(1), MetaKeyUtils::statsVal(statsItem)}};
+    folly::Baton<true, std::atomic> baton;
+    kv->asyncMultiPut(
+        kDefaultSpaceId, kDefaultPartId, std::move(data), [&](nebula::cpp2::ErrorCode code) {
+          ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, code);
+          baton.post();
+        });
+    baton.wait();
+  }
+  {
+    cpp2::DropTagIndexReq req;
+    req.space_id_ref() = 1;
+    req.index_name_ref() = "single_field_index";
+    auto* processor = DropTagIndexProcessor::instance(kv.get());
+    auto f = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(f).get();
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, resp.get_code());
+  }
+  {
+    std::string val;
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              kv->get(kDefaultSpaceId, kDefaultPartId, MetaKeyUtils::indexStatsKey(1), &val));
+    auto statsItem = MetaKeyUtils::parseStatsVal(val);
+    ASSERT_TRUE(statsItem.index_stats_ref().has_value());
+    ASSERT_EQ(1, statsItem.index_stats_ref()->size());
+    ASSERT_EQ(1, statsItem.index_stats_ref()->count(100));
+  }
+}
+
+TEST(IndexProcessorTest, TagIndexIncludedFieldsTest) {
+  fs::TempDir rootPath("/tmp/TagIndexIncludedFieldsTest.XXXXXX");
+  std::unique_ptr<kvstore::KVStore> kv(MockCluster::initMetaKV(rootPath.path()));
+  TestUtils::createSomeHosts(kv.get());
+  TestUtils::assembleSpace(kv.get(), 1, 1);
+  TestUtils::mockTag(kv.get(), 1, 0, true);
+  auto createIndex = [&kv](const std::string& name, std::vector<std::string> included) {
+    cpp2::CreateTagIndexReq req;
+    req.space_id_ref() = 1;
+    req.tag_name_ref() = "tag_0";
+    cpp2::IndexFieldDef field;
+    field.name_ref() = "tag_0_col_0";
+    req.fields_ref() = {field};
+    req.index_name_ref() = name;
+    cpp2::IndexParams params;
+    params.included_fields_ref() = std::move(included);
+    req.index_params_ref() = std::move(params);
+    auto* processor = CreateTagIndexProcessor::instance(kv.get());
+    auto f = processor->getFuture();
+    processor->process(req);
+    return std::move(f).get().get_code();
+  };
+  // Included field is not a property of tag
+  ASSERT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND, createIndex("idx", {"not_exist"}));
+  // Included field is the index field
+  ASSERT_EQ(nebula::cpp2::ErrorCode::E_INVALID_PARM, createIndex("idx", {"tag_0_col_0"}));
+  // Duplicated included fields
+  ASSERT_EQ(nebula::cpp2::ErrorCode::E_INVALID_PARM,
+            createIndex("idx", {"tag_0_col_1", "tag_0_col_1"}));
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, createIndex("idx", {"tag_0_col_1"}));
+  {
+    cpp2::GetTagIndexReq req;
+    req.space_id_ref() = 1;
+    req.index_name_ref() = "idx";
+    auto* processor = GetTagIndexProcessor::instance(kv.get());
+    auto f = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(f).get();
+    ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, resp.get_code());
+    const auto* params = resp.get_item().get_index_params();
+    ASSERT_NE(nullptr, params);
+    ASSERT_EQ(std::vector<std::string>{"tag_0_col_1"}, *params->included_fields_ref());
+  }
+}
+
 TEST(IndexProcessorTest, EdgeIndexTest) {
   fs::TempDir rootPath("/tmp/EdgeIndexTest.XXXXXX");
   std::unique_ptr<kvstore::KVStore> kv(MockCluster::initMetaKV(rootPath.path()));
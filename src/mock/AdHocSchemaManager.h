@@ -108,6 +108,11 @@ class AdHocSchemaManager final : public nebula::meta::SchemaManager {
     return Status::Error("Unimplemented");
   }
 
+  StatusOr<std::unordered_map<std::string, nebula::meta::cpp2::FTIndex>> getFTIndexes(
+      GraphSpaceID) override {
+    return Status::Error("Unimplemented");
+  }
+
   StatusOr<int32_t> getPartsNum(GraphSpaceID) override {
     return partNum_;
   }
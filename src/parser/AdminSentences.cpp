@@ -214,6 +214,9 @@ std::string AddListenerSentence::toString() const {
     case meta::cpp2::ListenerType::ELASTICSEARCH:
       buf += "ELASTICSEARCH ";
       break;
+    case meta::cpp2::ListenerType::LOCAL_FULLTEXT:
+      buf += "FULLTEXT ";
+      break;
     case meta::cpp2::ListenerType::UNKNOWN:
       DLOG(FATAL) << "Unknown listener type.";
       return "";
@@ -230,6 +233,9 @@ std::string RemoveListenerSentence::toString() const {
     case meta::cpp2::ListenerType::ELASTICSEARCH:
       buf += "ELASTICSEARCH ";
       break;
+    case meta::cpp2::ListenerType::LOCAL_FULLTEXT:
+      buf += "FULLTEXT ";
+      break;
     case meta::cpp2::ListenerType::UNKNOWN:
       DLOG(FATAL) << "Unknown listener type.";
       return "";
@@ -257,6 +263,11 @@ std::string AdminJobSentence::toString() const {
           return "REBUILD FULLTEXT INDEX";
         case meta::cpp2::JobType::STATS:
           return "SUBMIT JOB STATS";
+        case meta::cpp2::JobType::INDEX_STATS:
+          if (paras_.empty()) {
+            return "SUBMIT JOB INDEX STATS";
+          }
+          return folly::stringPrintf("SUBMIT JOB INDEX STATS %s", folly::join(",", paras_).c_str());
         case meta::cpp2::JobType::DOWNLOAD:
           return folly::stringPrintf("SUBMIT JOB DOWNLOAD HDFS \"%s\"", paras_[0].c_str());
         case meta::cpp2::JobType::INGEST:
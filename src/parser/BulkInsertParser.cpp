@@ -0,0 +1,356 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "parser/BulkInsertParser.h"
+
+#include "parser/GQLParser.h"
+#include "parser/MutateSentences.h"
+#include "parser/SequentialSentences.h"
+
+namespace nebula {
+
+namespace {
+
+// Same as the LABEL rule of the scanner, non-ascii bytes are taken as part of a label.
+bool isLabelChar(char c) {
+  auto uc = static_cast<unsigned char>(c);
+  return std::isalnum(uc) || c == '_' || uc >= 0x80;
+}
+
+bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+constexpr uint64_t kMaxAbsInteger =
+    static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1;
+
+}  // namespace
+
+std::unique_ptr<Sentence> BulkInsertParser::tryParse(const std::string &query) {
+  if (query.size() > static_cast<size_t>(FLAGS_max_allowed_query_size)) {
+    return nullptr;
+  }
+  pos_ = query.data();
+  end_ = pos_ + query.size();
+  if (!consumeKeyword("INSERT")) {
+    return nullptr;
+  }
+  bool isEdge = false;
+  if (consumeKeyword("EDGE")) {
+    isEdge = true;
+  } else if (!consumeKeyword("VERTEX")) {
+    return nullptr;
+  }
+  if (!skipToValues()) {
+    return nullptr;
+  }
+
+  // Parse the statement with a single placeholder row to get the names and options
+  std::string header(query.data(), pos_);
+  header += isEdge ? " 0->0:()" : " 0:()";
+  auto result = GQLParser(qctx_).parse(std::move(header));
+  if (!result.ok()) {
+    return nullptr;
+  }
+  auto sentences = std::move(result).value();
+  if (sentences->kind() != Sentence::Kind::kSequential) {
+    return nullptr;
+  }
+  auto *seq = static_cast<SequentialSentences *>(sentences.get());
+  if (seq->numSentences() != 1) {
+    return nullptr;
+  }
+  auto *sentence = seq->sentences().front();
+  auto expected = isEdge ? Sentence::Kind::kInsertEdges : Sentence::Kind::kInsertVertices;
+  if (sentence->kind() != expected) {
+    return nullptr;
+  }
+
+  if (!(isEdge ? parseEdgeRows(sentence) : parseVertexRows(sentence)) || !atEnd()) {
+    return nullptr;
+  }
+  return sentences;
+}
+
+void BulkInsertParser::skipBlanks() {
+  while (pos_ < end_ && (*pos_ == ' ' || *pos_ == '\t' || *pos_ == '\r' || *pos_ == '\n')) {
+    ++pos_;
+  }
+}
+
+bool BulkInsertParser::consume(char c) {
+  skipBlanks();
+  if (pos_ < end_ && *pos_ == c) {
+    ++pos_;
+    return true;
+  }
+  return false;
+}
+
+bool BulkInsertParser::consumeToken(folly::StringPiece token) {
+  skipBlanks();
+  if (static_cast<size_t>(end_ - pos_) < token.size() ||
+      folly::StringPiece(pos_, token.size()) != token) {
+    return false;
+  }
+  pos_ += token.size();
+  return true;
+}
+
+bool BulkInsertParser::consumeKeyword(folly::StringPiece keyword) {
+  skipBlanks();
+  if (static_cast<size_t>(end_ - pos_) < keyword.size()) {
+    return false;
+  }
+  if (!folly::StringPiece(pos_, keyword.size()).equals(keyword, folly::AsciiCaseInsensitive())) {
+    return false;
+  }
+  auto *next = pos_ + keyword.size();
+  if (next < end_ && isLabelChar(*next)) {
+    return false;
+  }
+  pos_ = next;
+  return true;
+}
+
+bool BulkInsertParser::skipToValues() {
+  int32_t depth = 0;
+  while (true) {
+    skipBlanks();
+    if (pos_ >= end_) {
+      return false;
+    }
+    auto c = *pos_;
+    if (c == '(') {
+      ++depth;
+      ++pos_;
+    } else if (c == ')') {
+      if (--depth < 0) {
+        return false;
+      }
+      ++pos_;
+    } else if (c == ',') {
+      ++pos_;
+    } else if (c == '`') {
+      auto *close = static_cast<const char *>(::memchr(pos_ + 1, '`', end_ - pos_ - 1));
+      if (close == nullptr) {
+        return false;
+      }
+      pos_ = close + 1;
+    } else if (isLabelChar(c)) {
+      auto *start = pos_;
+      while (pos_ < end_ && isLabelChar(*pos_)) {
+        ++pos_;
+      }
+      // Props named `values' are allowed within the parentheses
+      if (depth == 0 &&
+          folly::StringPiece(start, pos_).equals("VALUES", folly::AsciiCaseInsensitive())) {
+        return true;
+      }
+    } else {
+      return false;
+    }
+  }
+}
+
+bool BulkInsertParser::parseVertexRows(Sentence *sentence) {
+  auto rows = std::make_unique<VertexRowList>();
+  do {
+    Value vid;
+    std::vector<Value> values;
+    if (!parseVid(&vid) || !consume(':') || !parseLiterals(&values)) {
+      return false;
+    }
+    rows->addRow(new VertexRowItem(std::move(vid), std::move(values)));
+  } while (consume(','));
+  static_cast<InsertVerticesSentence *>(sentence)->setRows(rows.release());
+  return true;
+}
+
+bool BulkInsertParser::parseEdgeRows(Sentence *sentence) {
+  auto rows = std::make_unique<EdgeRowList>();
+  do {
+    Value src, dst, rank(0);
+    std::vector<Value> values;
+    if (!parseVid(&src) || !consumeToken("->") || !parseVid(&dst)) {
+      return false;
+    }
+    if (consume('@') && !parseNumber(&rank, false)) {
+      return false;
+    }
+    if (!consume(':') || !parseLiterals(&values)) {
+      return false;
+    }
+    rows->addRow(
+        new EdgeRowItem(std::move(src), std::move(dst), rank.getInt(), std::move(values)));
+  } while (consume(','));
+  static_cast<InsertEdgesSentence *>(sentence)->setRows(rows.release());
+  return true;
+}
+
+bool BulkInsertParser::parseVid(Value *vid) {
+  skipBlanks();
+  if (pos_ >= end_) {
+    return false;
+  }
+  if (*pos_ == '"' || *pos_ == '\'') {
+    return parseString(vid);
+  }
+  return parseNumber(vid, false);
+}
+
+bool BulkInsertParser::parseLiterals(std::vector<Value> *values) {
+  if (!consume('(')) {
+    return false;
+  }
+  if (consume(')')) {
+    return true;
+  }
+  while (true) {
+    Value value;
+    if (!parseLiteral(&value)) {
+      return false;
+    }
+    values->emplace_back(std::move(value));
+    if (consume(')')) {
+      return true;
+    }
+    if (!consume(',')) {
+      return false;
+    }
+    // A trailing comma is allowed by the grammar
+    if (consume(')')) {
+      return true;
+    }
+  }
+}
+
+bool BulkInsertParser::parseLiteral(Value *value) {
+  skipBlanks();
+  if (pos_ >= end_) {
+    return false;
+  }
+  auto c = *pos_;
+  if (c == '"' || c == '\'') {
+    return parseString(value);
+  }
+  if (isDigit(c) || c == '-' || c == '+' || c == '.') {
+    return parseNumber(value, true);
+  }
+  if (consumeKeyword("NULL")) {
+    *value = Value(NullType::__NULL__);
+    return true;
+  }
+  if (consumeKeyword("TRUE")) {
+    *value = Value(true);
+    return true;
+  }
+  if (consumeKeyword("FALSE")) {
+    *value = Value(false);
+    return true;
+  }
+  return false;
+}
+
+bool BulkInsertParser::parseNumber(Value *value, bool allowDouble) {
+  skipBlanks();
+  bool negative = false;
+  if (pos_ < end_ && (*pos_ == '-' || *pos_ == '+')) {
+    negative = *pos_ == '-';
+    ++pos_;
+  }
+  auto *start = pos_;
+  while (pos_ < end_ && isDigit(*pos_)) {
+    ++pos_;
+  }
+  auto intDigits = pos_ - start;
+  bool isDouble = false;
+  if (pos_ < end_ && *pos_ == '.') {
+    ++pos_;
+    auto *frac = pos_;
+    while (pos_ < end_ && isDigit(*pos_)) {
+      ++pos_;
+    }
+    // `1..2' is a range
+    if (intDigits + (pos_ - frac) == 0 || (pos_ < end_ && *pos_ == '.')) {
+      return false;
+    }
+    isDouble = true;
+  } else if (intDigits == 0) {
+    return false;
+  }
+  if (pos_ < end_ && (*pos_ == 'e' || *pos_ == 'E')) {
+    ++pos_;
+    if (pos_ < end_ && (*pos_ == '-' || *pos_ == '+')) {
+      ++pos_;
+    }
+    auto *exp = pos_;
+    while (pos_ < end_ && isDigit(*pos_)) {
+      ++pos_;
+    }
+    if (pos_ == exp) {
+      return false;
+    }
+    isDouble = true;
+  }
+  // Hex, octal and IP literals are left to the scanner
+  if (pos_ < end_ && (isLabelChar(*pos_) || *pos_ == '.')) {
+    return false;
+  }
+  folly::StringPiece text(start, pos_);
+  if (isDouble) {
+    if (!allowDouble) {
+      return false;
+    }
+    auto ret = folly::tryTo<double>(text);
+    if (ret.hasError()) {
+      return false;
+    }
+    *value = Value(negative ? -ret.value() : ret.value());
+    return true;
+  }
+  if (intDigits > 1 && *start == '0') {
+    return false;
+  }
+  auto ret = folly::tryTo<uint64_t>(text);
+  if (ret.hasError() || ret.value() > kMaxAbsInteger) {
+    return false;
+  }
+  auto val = ret.value();
+  if (val == kMaxAbsInteger) {
+    if (!negative) {
+      return false;
+    }
+    *value = Value(std::numeric_limits<int64_t>::min());
+    return true;
+  }
+  *value = Value(negative ? -static_cast<int64_t>(val) : static_cast<int64_t>(val));
+  return true;
+}
+
+bool BulkInsertParser::parseString(Value *value) {
+  auto quote = *pos_++;
+  auto *start = pos_;
+  while (pos_ < end_ && *pos_ != quote) {
+    // Escapes are left to the scanner
+    if (*pos_ == '\\' || *pos_ == '\n' || *pos_ == '\0') {
+      return false;
+    }
+    ++pos_;
+  }
+  if (pos_ >= end_) {
+    return false;
+  }
+  *value = Value(std::string(start, pos_));
+  ++pos_;
+  return true;
+}
+
+bool BulkInsertParser::atEnd() {
+  consume(';');
+  skipBlanks();
+  return pos_ == end_;
+}
+
+}  // namespace nebula
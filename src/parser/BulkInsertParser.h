@@ -0,0 +1,71 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#ifndef PARSER_BULKINSERTPARSER_H_
+#define PARSER_BULKINSERTPARSER_H_
+
+#include "common/base/Base.h"
+#include "parser/Sentence.h"
+
+namespace nebula {
+
+namespace graph {
+class QueryContext;
+}  // namespace graph
+
+/**
+ * BulkInsertParser is the fast path of bulk loading statements, i.e. a single
+ * `INSERT VERTEX ... VALUES ...' or `INSERT EDGE ... VALUES ...' whose ids and values are
+ * all literals. The part before VALUES is parsed by GQLParser as usual, while the rows are
+ * scanned by hand straight into `Value's, without building an expression for each of them.
+ *
+ * Anything beyond literals, e.g. function calls, parameters, escaped strings or comments,
+ * makes it give up, and the query should be parsed by GQLParser instead, which also reports
+ * the syntax errors.
+ */
+class BulkInsertParser final {
+ public:
+  explicit BulkInsertParser(graph::QueryContext *qctx) : qctx_(qctx) {}
+
+  // Returns nullptr if the query is not eligible for the fast path.
+  std::unique_ptr<Sentence> tryParse(const std::string &query);
+
+ private:
+  void skipBlanks();
+
+  bool consume(char c);
+
+  // Consumes a multi-char token, e.g. `->', which must not be split by blanks.
+  bool consumeToken(folly::StringPiece token);
+
+  bool consumeKeyword(folly::StringPiece keyword);
+
+  // Moves to the end of the top level VALUES keyword, returns false if not found.
+  bool skipToValues();
+
+  bool parseVertexRows(Sentence *sentence);
+
+  bool parseEdgeRows(Sentence *sentence);
+
+  bool parseVid(Value *vid);
+
+  bool parseLiterals(std::vector<Value> *values);
+
+  bool parseLiteral(Value *value);
+
+  bool parseNumber(Value *value, bool allowDouble);
+
+  bool parseString(Value *value);
+
+  // Only blanks and one optional semicolon are allowed after the rows.
+  bool atEnd();
+
+  graph::QueryContext *qctx_{nullptr};
+  const char *pos_{nullptr};
+  const char *end_{nullptr};
+};
+
+}  // namespace nebula
+
+#endif  // PARSER_BULKINSERTPARSER_H_
@@ -238,6 +238,21 @@ std::string IndexParamItem::toString() const {
       return folly::stringPrintf("s2_max_level = %ld", paramValue_.getInt());
     case S2_MAX_CELLS:
       return folly::stringPrintf("s2_max_cells = \"%ld\"", paramValue_.getInt());
+    case VECTOR_METRIC:
+      return folly::stringPrintf("vector_metric = \"%s\"", paramValue_.getStr().c_str());
+    case HNSW_M:
+      return folly::stringPrintf("hnsw_m = %ld", paramValue_.getInt());
+    case HNSW_EF_CONSTRUCTION:
+      return folly::stringPrintf("hnsw_ef_construction = %ld", paramValue_.getInt());
+    case S2_MIN_LEVEL:
+      return folly::stringPrintf("s2_min_level = %ld", paramValue_.getInt());
+    case INCLUDE: {
+      std::vector<std::string> fields;
+      for (auto& field : paramValue_.getList().values) {
+        fields.emplace_back(field.getStr());
+      }
+      return folly::stringPrintf("include = (%s)", folly::join(", ", fields).c_str());
+    }
   }
   DLOG(FATAL) << "Index param type illegal";
   return "";
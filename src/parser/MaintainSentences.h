@@ -572,7 +572,15 @@ class IndexFieldList final {
 
 class IndexParamItem final {
  public:
-  enum ParamType : uint8_t { S2_MAX_LEVEL, S2_MAX_CELLS };
+  enum ParamType : uint8_t {
+    S2_MAX_LEVEL,
+    S2_MAX_CELLS,
+    VECTOR_METRIC,
+    HNSW_M,
+    HNSW_EF_CONSTRUCTION,
+    S2_MIN_LEVEL,
+    INCLUDE,
+  };
 
   IndexParamItem(ParamType op, Value val) {
     paramType_ = op;
@@ -599,6 +607,50 @@ class IndexParamItem final {
     }
   }
 
+  StatusOr<int> getS2MinLevel() {
+    if (paramType_ == S2_MIN_LEVEL) {
+      return paramValue_.getInt();
+    } else {
+      return Status::Error("Not exists s2_min_level.");
+    }
+  }
+
+  StatusOr<std::string> getVectorMetric() {
+    if (paramType_ == VECTOR_METRIC) {
+      return paramValue_.getStr();
+    } else {
+      return Status::Error("Not exists vector_metric.");
+    }
+  }
+
+  StatusOr<int> getHnswM() {
+    if (paramType_ == HNSW_M) {
+      return paramValue_.getInt();
+    } else {
+      return Status::Error("Not exists hnsw_m.");
+    }
+  }
+
+  StatusOr<int> getHnswEfConstruction() {
+    if (paramType_ == HNSW_EF_CONSTRUCTION) {
+      return paramValue_.getInt();
+    } else {
+      return Status::Error("Not exists hnsw_ef_construction.");
+    }
+  }
+
+  StatusOr<std::vector<std::string>> getIncludedFields() {
+    if (paramType_ == INCLUDE) {
+      std::vector<std::string> fields;
+      for (auto &field : paramValue_.getList().values) {
+        fields.emplace_back(field.getStr());
+      }
+      return fields;
+    } else {
+      return Status::Error("Not exists include.");
+    }
+  }
+
   std::string toString() const;
 
  private:
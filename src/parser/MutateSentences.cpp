@@ -60,13 +60,25 @@ std::string ValueList::toString() const {
   return buf;
 }
 
+// Literals are printed the same way as ConstantExpression
+static std::string literalsToString(const std::vector<Value> &literals) {
+  std::stringstream out;
+  for (size_t i = 0; i < literals.size(); ++i) {
+    if (i != 0) {
+      out << ",";
+    }
+    out << literals[i];
+  }
+  return out.str();
+}
+
 std::string VertexRowItem::toString() const {
   std::string buf;
   buf.reserve(256);
-  buf += id_->toString();
+  buf += isLiteral_ ? literalId_.toString() : id_->toString();
   buf += ":";
   buf += "(";
-  buf += values_->toString();
+  buf += isLiteral_ ? literalsToString(literals_) : values_->toString();
   buf += ")";
   return buf;
 }
@@ -101,9 +113,9 @@ std::string EdgeRowItem::toString() const {
   std::string buf;
   buf.reserve(256);
 
-  buf += srcid_->toString();
+  buf += isLiteral_ ? literalSrcid_.toString() : srcid_->toString();
   buf += "->";
-  buf += dstid_->toString();
+  buf += isLiteral_ ? literalDstid_.toString() : dstid_->toString();
   if (rank_ != 0) {
     buf += "@";
     buf += std::to_string(rank_);
@@ -111,7 +123,7 @@ std::string EdgeRowItem::toString() const {
   buf += ":";
 
   buf += "(";
-  buf += values_->toString();
+  buf += isLiteral_ ? literalsToString(literals_) : values_->toString();
   buf += ")";
   return buf;
 }
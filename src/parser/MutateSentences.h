@@ -111,19 +111,41 @@ class VertexRowItem final {
     values_.reset(values);
   }
 
+  // A row whose id and values are all literals, built by the bulk insert parser without
+  // creating any expression.
+  VertexRowItem(Value id, std::vector<Value> literals)
+      : isLiteral_(true), literalId_(std::move(id)), literals_(std::move(literals)) {}
+
+  bool isLiteral() const {
+    return isLiteral_;
+  }
+
   Expression *id() const {
+    DCHECK(!isLiteral_);
     return id_;
   }
 
-  std::vector<Expression *> values() const {
+  const std::vector<Expression *> &values() const {
+    DCHECK(!isLiteral_);
     return values_->values();
   }
 
+  const Value &literalId() const {
+    return literalId_;
+  }
+
+  const std::vector<Value> &literals() const {
+    return literals_;
+  }
+
   std::string toString() const;
 
  private:
   Expression *id_{nullptr};
   std::unique_ptr<ValueList> values_;
+  bool isLiteral_{false};
+  Value literalId_;
+  std::vector<Value> literals_;
 };
 
 class VertexRowList final {
@@ -132,6 +154,10 @@ class VertexRowList final {
     rows_.emplace_back(row);
   }
 
+  void reserve(size_t size) {
+    rows_.reserve(size);
+  }
+
   /**
    * For now, we haven't execution plan cache supported.
    * So to avoid too many deep copying, we return the fields or nodes
@@ -175,6 +201,10 @@ class InsertVerticesSentence final : public Sentence {
     return rows_->rows();
   }
 
+  void setRows(VertexRowList *rows) {
+    rows_.reset(rows);
+  }
+
   std::string toString() const override;
 
   bool isIfNotExists() const {
@@ -207,11 +237,25 @@ class EdgeRowItem final {
     values_.reset(values);
   }
 
+  // A row whose ids and values are all literals, see VertexRowItem.
+  EdgeRowItem(Value srcid, Value dstid, int64_t rank, std::vector<Value> literals)
+      : rank_(rank),
+        isLiteral_(true),
+        literalSrcid_(std::move(srcid)),
+        literalDstid_(std::move(dstid)),
+        literals_(std::move(literals)) {}
+
+  bool isLiteral() const {
+    return isLiteral_;
+  }
+
   auto srcid() const {
+    DCHECK(!isLiteral_);
     return srcid_;
   }
 
   auto dstid() const {
+    DCHECK(!isLiteral_);
     return dstid_;
   }
 
@@ -219,10 +263,23 @@ class EdgeRowItem final {
     return rank_;
   }
 
-  std::vector<Expression *> values() const {
+  const std::vector<Expression *> &values() const {
+    DCHECK(!isLiteral_);
     return values_->values();
   }
 
+  const Value &literalSrcid() const {
+    return literalSrcid_;
+  }
+
+  const Value &literalDstid() const {
+    return literalDstid_;
+  }
+
+  const std::vector<Value> &literals() const {
+    return literals_;
+  }
+
   std::string toString() const;
 
  private:
@@ -230,6 +287,10 @@ class EdgeRowItem final {
   Expression *dstid_{nullptr};
   EdgeRanking rank_{0};
   std::unique_ptr<ValueList> values_;
+  bool isLiteral_{false};
+  Value literalSrcid_;
+  Value literalDstid_;
+  std::vector<Value> literals_;
 };
 
 class EdgeRowList final {
@@ -238,6 +299,10 @@ class EdgeRowList final {
     rows_.emplace_back(row);
   }
 
+  void reserve(size_t size) {
+    rows_.reserve(size);
+  }
+
   std::vector<EdgeRowItem *> rows() const {
     std::vector<EdgeRowItem *> result;
     result.resize(rows_.size());
@@ -284,6 +349,10 @@ class InsertEdgesSentence final : public Sentence {
     return rows_->rows();
   }
 
+  void setRows(EdgeRowList *rows) {
+    rows_.reset(rows);
+  }
+
   bool isIfNotExists() const {
     return ifNotExists_;
   }
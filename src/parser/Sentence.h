@@ -134,6 +134,8 @@ class Sentence {
     kAlterSpace,
     kClearSpace,
     kUnwind,
+    kRandomWalk,
+    kRunAlgorithm,
   };
 
   Kind kind() const {
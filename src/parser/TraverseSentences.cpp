@@ -299,4 +299,42 @@ std::string GetSubgraphSentence::toString() const {
   }
   return buf;
 }
+
+std::string RandomWalkSentence::toString() const {
+  std::string buf;
+  buf.reserve(256);
+  buf += "RANDOM WALK ";
+  buf += step_->toString();
+  buf += " ";
+  buf += from_->toString();
+  buf += " ";
+  buf += over_->toString();
+  if (weightProp_ != nullptr) {
+    buf += " WEIGHT BY ";
+    buf += *weightProp_;
+  }
+  if (restart_ != 0.0) {
+    buf += " RESTART ";
+    buf += folly::to<std::string>(restart_);
+  }
+  if (walks_ != 1) {
+    buf += " WALKS ";
+    buf += std::to_string(walks_);
+  }
+  return buf;
+}
+
+std::string RunAlgorithmSentence::toString() const {
+  std::string buf;
+  buf.reserve(256);
+  buf += "RUN LOCAL ALGORITHM ";
+  buf += *algorithm_;
+  buf += " ";
+  buf += over_->toString();
+  if (options_ != nullptr) {
+    buf += " WITH ";
+    buf += options_->toString();
+  }
+  return buf;
+}
 }  // namespace nebula
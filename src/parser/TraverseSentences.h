@@ -5,6 +5,7 @@
 #ifndef PARSER_TRAVERSESENTENCES_H_
 #define PARSER_TRAVERSESENTENCES_H_
 
+#include "common/expression/ContainerExpression.h"
 #include "parser/Clauses.h"
 #include "parser/EdgeKey.h"
 #include "parser/MutateSentences.h"
@@ -690,5 +691,97 @@ class GetSubgraphSentence final : public Sentence {
   std::unique_ptr<WhereClause> where_;
   std::unique_ptr<YieldClause> yield_;
 };
+
+// RANDOM WALK <n> STEPS FROM <vids> OVER <edges>
+//   [WEIGHT BY <edge prop>] [RESTART <probability>] [WALKS <walks per start>]
+class RandomWalkSentence final : public Sentence {
+ public:
+  RandomWalkSentence(StepClause* step, FromClause* from, OverClause* over) {
+    kind_ = Kind::kRandomWalk;
+    step_.reset(step);
+    from_.reset(from);
+    over_.reset(over);
+  }
+
+  StepClause* step() const {
+    return step_.get();
+  }
+
+  FromClause* from() const {
+    return from_.get();
+  }
+
+  OverClause* over() const {
+    return over_.get();
+  }
+
+  // nullptr if the walks are uniform
+  const std::string* weightProp() const {
+    return weightProp_.get();
+  }
+
+  double restart() const {
+    return restart_;
+  }
+
+  int64_t walks() const {
+    return walks_;
+  }
+
+  void setWeightProp(std::string* prop) {
+    weightProp_.reset(prop);
+  }
+
+  void setRestart(double restart) {
+    restart_ = restart;
+  }
+
+  void setWalks(int64_t walks) {
+    walks_ = walks;
+  }
+
+  std::string toString() const override;
+
+ private:
+  std::unique_ptr<StepClause> step_;
+  std::unique_ptr<FromClause> from_;
+  std::unique_ptr<OverClause> over_;
+  std::unique_ptr<std::string> weightProp_;
+  double restart_{0.0};
+  int64_t walks_{1};
+};
+
+// RUN LOCAL ALGORITHM <pagerank | wcc | lpa> OVER <edges> [WITH {<option>: <value>, ...}]
+// The whole graph of the edges is loaded into the graphd which runs the query, like SHOW LOCAL
+// QUERIES, LOCAL names the graphd it's handled by.
+class RunAlgorithmSentence final : public Sentence {
+ public:
+  RunAlgorithmSentence(std::string* algorithm, OverClause* over, MapExpression* options) {
+    kind_ = Kind::kRunAlgorithm;
+    algorithm_.reset(algorithm);
+    over_.reset(over);
+    options_ = options;
+  }
+
+  const std::string* algorithm() const {
+    return algorithm_.get();
+  }
+
+  OverClause* over() const {
+    return over_.get();
+  }
+
+  // nullptr if not specified
+  MapExpression* options() const {
+    return options_;
+  }
+
+  std::string toString() const override;
+
+ private:
+  std::unique_ptr<std::string> algorithm_;
+  std::unique_ptr<OverClause> over_;
+  MapExpression* options_{nullptr};
+};
 }  // namespace nebula
 #endif  // PARSER_TRAVERSESENTENCES_H_
@@ -178,7 +178,7 @@ using namespace nebula;
 %token KW_NO KW_OVERWRITE KW_IN KW_DESCRIBE KW_DESC KW_SHOW KW_HOST KW_HOSTS KW_PART KW_PARTS KW_ADD
 %token KW_PARTITION_NUM KW_REPLICA_FACTOR KW_CHARSET KW_COLLATE KW_COLLATION KW_VID_TYPE
 %token KW_ATOMIC_EDGE
-%token KW_COMMENT KW_S2_MAX_LEVEL KW_S2_MAX_CELLS
+%token KW_COMMENT KW_S2_MIN_LEVEL KW_S2_MAX_LEVEL KW_S2_MAX_CELLS KW_VECTOR_METRIC KW_HNSW_M KW_HNSW_EF_CONSTRUCTION KW_INCLUDE
 %token KW_DROP KW_CLEAR KW_REMOVE KW_SPACES KW_INGEST KW_INDEX KW_INDEXES
 %token KW_IF KW_NOT KW_EXISTS KW_WITH
 %token KW_BY KW_DOWNLOAD KW_HDFS KW_UUID KW_CONFIGS KW_FORCE
@@ -189,6 +189,7 @@ using namespace nebula;
 %token KW_DISTINCT KW_ALL KW_OF
 %token KW_BALANCE KW_LEADER KW_RESET KW_PLAN
 %token KW_SHORTEST KW_PATH KW_NOLOOP KW_SHORTESTPATH KW_ALLSHORTESTPATHS
+%token KW_RANDOM KW_WALK KW_WALKS KW_RESTART KW_WEIGHT KW_RUN KW_ALGORITHM
 %token KW_IS KW_NULL KW_DEFAULT
 %token KW_SNAPSHOT KW_SNAPSHOTS KW_LOOKUP
 %token KW_JOBS KW_JOB KW_RECOVER KW_FLUSH KW_COMPACT KW_REBUILD KW_SUBMIT KW_STATS KW_STATUS
@@ -351,6 +352,10 @@ using namespace nebula;
 %type <service_client_list> service_client_list
 
 %type <intval> legal_integer unary_integer rank port
+%type <intval> opt_walk_times
+%type <doubleval> opt_walk_restart
+%type <strval> opt_walk_weight
+%type <expr> opt_algorithm_options
 
 %type <strval>         comment_prop_assignment comment_prop opt_comment_prop
 %type <col_property>   column_property
@@ -399,6 +404,7 @@ using namespace nebula;
 
 %type <sentence> traverse_sentence unwind_sentence
 %type <sentence> go_sentence match_sentence lookup_sentence find_path_sentence get_subgraph_sentence
+%type <sentence> random_walk_sentence run_algorithm_sentence
 %type <sentence> group_by_sentence order_by_sentence limit_sentence
 %type <sentence> fetch_sentence fetch_vertices_sentence fetch_edges_sentence
 %type <sentence> set_sentence piped_sentence assignment_sentence match_sentences
@@ -564,8 +570,13 @@ unreserved_keyword
     | KW_RESET              { $$ = new std::string("reset"); }
     | KW_PLAN               { $$ = new std::string("plan"); }
     | KW_COMMENT            { $$ = new std::string("comment"); }
+    | KW_S2_MIN_LEVEL       { $$ = new std::string("s2_min_level"); }
     | KW_S2_MAX_LEVEL       { $$ = new std::string("s2_max_level"); }
     | KW_S2_MAX_CELLS       { $$ = new std::string("s2_max_cells"); }
+    | KW_VECTOR_METRIC      { $$ = new std::string("vector_metric"); }
+    | KW_HNSW_M             { $$ = new std::string("hnsw_m"); }
+    | KW_HNSW_EF_CONSTRUCTION { $$ = new std::string("hnsw_ef_construction"); }
+    | KW_INCLUDE            { $$ = new std::string("include"); }
     | KW_SESSION            { $$ = new std::string("session"); }
     | KW_SESSIONS           { $$ = new std::string("sessions"); }
     | KW_LOCAL              { $$ = new std::string("local"); }
@@ -584,6 +595,13 @@ unreserved_keyword
     | KW_RENAME             { $$ = new std::string("rename"); }
     | KW_CLEAR              { $$ = new std::string("clear"); }
     | KW_ANALYZER           { $$ = new std::string("analyzer"); }
+    | KW_RANDOM             { $$ = new std::string("random"); }
+    | KW_WALK               { $$ = new std::string("walk"); }
+    | KW_WALKS              { $$ = new std::string("walks"); }
+    | KW_RESTART            { $$ = new std::string("restart"); }
+    | KW_WEIGHT             { $$ = new std::string("weight"); }
+    | KW_RUN                { $$ = new std::string("run"); }
+    | KW_ALGORITHM          { $$ = new std::string("algorithm"); }
     ;
 
 expression
@@ -762,6 +780,9 @@ compound_expression
         $$ = $1;
     }
     | function_call_expression {
+        if (graph::ExpressionUtils::isNonDeterministic($1)) {
+            qctx->setNonDeterministic();
+        }
         $$ = $1;
     }
     | container_expression {
@@ -1155,6 +1176,7 @@ function_call_expression
 
 uuid_expression
     : KW_UUID L_PAREN R_PAREN {
+        qctx->setNonDeterministic();
         $$ = UUIDExpression::make(qctx->objPool());
     }
     ;
@@ -1414,6 +1436,8 @@ truncate_clause
         if(graph::ExpressionUtils::findAny($2, {Expression::Kind::kVar})) {
             throw nebula::GraphParser::syntax_error(@2, "Parameter is not supported in sample clause");
         }
+        // The edges are sampled at random
+        qctx->setNonDeterministic();
         $$ = new TruncateClause($2, true);
     }
     | KW_LIMIT expression {
@@ -1467,6 +1491,9 @@ vid
         $$ = ConstantExpression::make(qctx->objPool(), $1);
     }
     | function_call_expression {
+        if (graph::ExpressionUtils::isNonDeterministic($1)) {
+            qctx->setNonDeterministic();
+        }
         $$ = $1;
     }
     | uuid_expression {
@@ -2428,6 +2455,42 @@ get_subgraph_sentence
         $$ = new GetSubgraphSentence($3, $4, $5, $6, $7, $8, $9, $10);
     }
 
+random_walk_sentence
+    : KW_RANDOM KW_WALK step_clause from_clause over_clause opt_walk_weight opt_walk_restart opt_walk_times {
+        auto *s = new RandomWalkSentence($3, $4, $5);
+        s->setWeightProp($6);
+        s->setRestart($7);
+        s->setWalks($8);
+        $$ = s;
+    }
+    ;
+
+opt_walk_weight
+    : %empty { $$ = nullptr; }
+    | KW_WEIGHT KW_BY name_label { $$ = $3; }
+    ;
+
+opt_walk_restart
+    : %empty { $$ = 0.0; }
+    | KW_RESTART DOUBLE { $$ = $2; }
+    ;
+
+opt_walk_times
+    : %empty { $$ = 1; }
+    | KW_WALKS legal_integer { $$ = $2; }
+    ;
+
+run_algorithm_sentence
+    : KW_RUN KW_LOCAL KW_ALGORITHM name_label over_clause opt_algorithm_options {
+        $$ = new RunAlgorithmSentence($4, $5, static_cast<MapExpression*>($6));
+    }
+    ;
+
+opt_algorithm_options
+    : %empty { $$ = nullptr; }
+    | KW_WITH map_expression { $$ = $2; }
+    ;
+
 use_sentence
     : KW_USE name_label { $$ = new UseSentence($2); }
     ;
@@ -2816,7 +2879,13 @@ index_param_list
     ;
 
 index_param_item
-    : KW_S2_MAX_LEVEL ASSIGN legal_integer {
+    : KW_S2_MIN_LEVEL ASSIGN legal_integer {
+        if ($3 < 0 || $3 > 30) {
+            throw nebula::GraphParser::syntax_error(@3, "'s2_min_level' value must be between 0 and 30 inclusive");
+        }
+        $$ = new IndexParamItem(IndexParamItem::S2_MIN_LEVEL, $3);
+    }
+    | KW_S2_MAX_LEVEL ASSIGN legal_integer {
         if ($3 < 0 || $3 > 30) {
             throw nebula::GraphParser::syntax_error(@3, "'s2_max_level' value must be between 0 and 30 inclusive");
         }
@@ -2828,6 +2897,35 @@ index_param_item
         }
         $$ = new IndexParamItem(IndexParamItem::S2_MAX_CELLS, $3);
     }
+    | KW_VECTOR_METRIC ASSIGN STRING {
+        auto metric = *$3;
+        delete $3;
+        folly::toLowerAscii(metric);
+        if (metric != "l2" && metric != "cosine") {
+            throw nebula::GraphParser::syntax_error(@3, "'vector_metric' value must be \"l2\" or \"cosine\"");
+        }
+        $$ = new IndexParamItem(IndexParamItem::VECTOR_METRIC, metric);
+    }
+    | KW_HNSW_M ASSIGN legal_integer {
+        if ($3 < 2 || $3 > 128) {
+            throw nebula::GraphParser::syntax_error(@3, "'hnsw_m' value must be between 2 and 128 inclusive");
+        }
+        $$ = new IndexParamItem(IndexParamItem::HNSW_M, $3);
+    }
+    | KW_HNSW_EF_CONSTRUCTION ASSIGN legal_integer {
+        if ($3 < 1 || $3 > 4096) {
+            throw nebula::GraphParser::syntax_error(@3, "'hnsw_ef_construction' value must be between 1 and 4096 inclusive");
+        }
+        $$ = new IndexParamItem(IndexParamItem::HNSW_EF_CONSTRUCTION, $3);
+    }
+    | KW_INCLUDE ASSIGN L_PAREN name_label_list R_PAREN {
+        List fields;
+        for (auto *label : $4->labels()) {
+            fields.emplace_back(*label);
+        }
+        delete $4;
+        $$ = new IndexParamItem(IndexParamItem::INCLUDE, std::move(fields));
+    }
     ;
 
 
@@ -2975,6 +3073,8 @@ traverse_sentence
     | find_path_sentence { $$ = $1; }
     | yield_sentence { $$ = $1; }
     | get_subgraph_sentence { $$ = $1; }
+    | random_walk_sentence { $$ = $1; }
+    | run_algorithm_sentence { $$ = $1; }
     | delete_vertex_sentence { $$ = $1; }
     | delete_tag_sentence { $$ = $1; }
     | delete_edge_sentence { $$ = $1; }
@@ -3395,6 +3495,18 @@ admin_job_sentence
                                              meta::cpp2::JobType::STATS);
         $$ = sentence;
     }
+    | KW_SUBMIT KW_JOB KW_INDEX KW_STATS {
+        auto sentence = new AdminJobSentence(meta::cpp2::JobOp::ADD,
+                                             meta::cpp2::JobType::INDEX_STATS);
+        $$ = sentence;
+    }
+    | KW_SUBMIT KW_JOB KW_INDEX KW_STATS name_label_list {
+        auto sentence = new AdminJobSentence(meta::cpp2::JobOp::ADD,
+                                             meta::cpp2::JobType::INDEX_STATS);
+        sentence->addPara(*$5);
+        delete $5;
+        $$ = sentence;
+    }
     | KW_SHOW KW_JOBS {
         auto sentence = new AdminJobSentence(meta::cpp2::JobOp::SHOW_All);
         $$ = sentence;
@@ -3911,12 +4023,18 @@ add_listener_sentence
     : KW_ADD KW_LISTENER KW_ELASTICSEARCH host_list {
         $$ = new AddListenerSentence(meta::cpp2::ListenerType::ELASTICSEARCH, $4);
     }
+    | KW_ADD KW_LISTENER KW_FULLTEXT host_list {
+        $$ = new AddListenerSentence(meta::cpp2::ListenerType::LOCAL_FULLTEXT, $4);
+    }
     ;
 
 remove_listener_sentence
     : KW_REMOVE KW_LISTENER KW_ELASTICSEARCH {
         $$ = new RemoveListenerSentence(meta::cpp2::ListenerType::ELASTICSEARCH);
     }
+    | KW_REMOVE KW_LISTENER KW_FULLTEXT {
+        $$ = new RemoveListenerSentence(meta::cpp2::ListenerType::LOCAL_FULLTEXT);
+    }
     ;
 
 list_listener_sentence
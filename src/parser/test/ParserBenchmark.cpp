@@ -6,8 +6,10 @@
 
 #include "common/base/Base.h"
 #include "common/expression/Expression.h"
+#include "parser/BulkInsertParser.h"
 #include "parser/GQLParser.h"
 
+using nebula::BulkInsertParser;
 using nebula::GQLParser;
 
 auto simpleQuery = "USE myspace";
@@ -18,6 +20,36 @@ auto complexQuery =
 auto matchConflictQuery =
     "MATCH (a)-[r:like*2..3]->(b:team) WHERE a.prop1 = b.prop2 AND (a)-(b) RETURN a, b";
 
+// INSERT EDGE of 1000 rows
+std::string bulkInsertQuery() {
+  std::string query = "INSERT EDGE transfer(amount, time_, memo) VALUES ";
+  for (auto i = 0; i < 1000; i++) {
+    if (i != 0) {
+      query += ",";
+    }
+    query += folly::stringPrintf(
+        "\"%d\"->\"%d\"@%d:(%d.75, 1537408527, \"transfer %d\")", i, i + 1, i, i, i);
+  }
+  return query;
+}
+
+// Returns the number of rows parsed
+size_t BulkInsert(size_t iters, bool fastPath) {
+  constexpr size_t ops = 100UL;
+  static const auto query = bulkInsertQuery();
+  for (auto i = 0UL; i < iters * ops; i++) {
+    auto qctx = std::make_unique<nebula::graph::QueryContext>();
+    if (fastPath) {
+      auto result = BulkInsertParser(qctx.get()).tryParse(query);
+      folly::doNotOptimizeAway(result);
+    } else {
+      auto result = GQLParser(qctx.get()).parse(query);
+      folly::doNotOptimizeAway(result);
+    }
+  }
+  return iters * ops * 1000;
+}
+
 size_t SimpleQuery(size_t iters, size_t nrThreads) {
   constexpr size_t ops = 500000UL;
 
@@ -121,6 +153,11 @@ BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MatchConflictQuery, 16_thread, 16)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MatchConflictQuery, 32_thread, 32)
 BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(MatchConflictQuery, 48_thread, 48)
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM_MULTI(BulkInsert, gql_parser, false)
+BENCHMARK_RELATIVE_NAMED_PARAM_MULTI(BulkInsert, fast_path, true)
+
 int main(int argc, char **argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
   {
@@ -135,6 +172,10 @@ int main(int argc, char **argv) {
     auto result = parser.parse(complexQuery);
     CHECK(result.ok()) << result.status();
   }
+  {
+    auto qctx = std::make_unique<nebula::graph::QueryContext>();
+    CHECK(BulkInsertParser(qctx.get()).tryParse(bulkInsertQuery()) != nullptr);
+  }
 
   folly::runBenchmarks();
   return 0;
@@ -7,6 +7,7 @@
 
 #include "common/base/Base.h"
 #include "graph/util/AstUtils.h"
+#include "parser/BulkInsertParser.h"
 #include "parser/GQLParser.h"
 
 namespace nebula {
@@ -601,6 +602,39 @@ TEST_F(ParserTest, IndexOperation) {
     auto& sentence = result.value();
     EXPECT_EQ(query, sentence->toString());
   }
+  {
+    std::string query =
+        "CREATE TAG INDEX embedding_index ON person(embedding) "
+        "WITH (vector_metric = \"COSINE\", hnsw_m = 16, hnsw_ef_construction = 100)";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+    auto& sentence = result.value();
+    EXPECT_EQ(
+        "CREATE TAG INDEX embedding_index ON person(embedding)WITH ( vector_metric = \"cosine\", "
+        "hnsw_m = 16, hnsw_ef_construction = 100)",
+        sentence->toString());
+  }
+  {
+    std::string query =
+        "CREATE TAG INDEX embedding_index ON person(embedding) WITH (vector_metric = \"dot\")";
+    auto result = parse(query);
+    ASSERT_FALSE(result.ok());
+  }
+  {
+    std::string query =
+        "CREATE TAG INDEX embedding_index ON person(embedding) WITH (vector_metric = \"l2\", "
+        "hnsw_m = 1)";
+    auto result = parse(query);
+    ASSERT_FALSE(result.ok());
+  }
+  {
+    std::string query = "CREATE TAG INDEX age_index ON person(age) WITH (include = (name, city))";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+    auto& sentence = result.value();
+    EXPECT_EQ("CREATE TAG INDEX age_index ON person(age)WITH ( include = (name, city))",
+              sentence->toString());
+  }
   {
     std::string query = "CREATE EDGE INDEX IF NOT EXISTS empty_field_index ON service()";
     auto result = parse(query);
@@ -1083,6 +1117,88 @@ TEST_F(ParserTest, InsertEdge) {
   }
 }
 
+TEST_F(ParserTest, BulkInsert) {
+  // Same parsing tree as GQLParser
+  std::vector<std::string> eligible = {
+      "INSERT VERTEX person(name, age) VALUES \"Tom\":(\"Tom\", 18), \"Ann\":('Ann', 20);",
+      "insert vertex if not exists person(name, age), student() VALUES 1:(\"a\", 1,), 2:(NULL, 2)",
+      "INSERT VERTEX person VALUES \"Tom\":()",
+      "INSERT VERTEX person(name) VALUES 1:(true)",
+      "INSERT EDGE transfer(amount, time_) VALUES \"1\"->\"2\"@10:(3.75, 1537408527)",
+      "INSERT EDGE IF NOT EXISTS IGNORE_EXISTED_INDEX `e`(a) VALUES 1 -> 2 : (0.5),"
+      " 3->4:(FALSE)",
+      "INSERT EDGE transfer() VALUES 1->2:()\n",
+  };
+  for (const auto &query : eligible) {
+    auto expected = parse(query);
+    ASSERT_TRUE(expected.ok()) << expected.status();
+    auto sentence = BulkInsertParser(qctx_.get()).tryParse(query);
+    ASSERT_NE(sentence, nullptr) << query;
+    ASSERT_EQ(expected.value()->toString(), sentence->toString());
+  }
+  {
+    std::string query =
+        "INSERT EDGE e(a, b) VALUES -1->2@-3:(-9223372036854775808, -1.5), 4->5:(+2, 1.0)";
+    auto sentence = BulkInsertParser(qctx_.get()).tryParse(query);
+    ASSERT_NE(sentence, nullptr);
+    auto *seq = static_cast<SequentialSentences *>(sentence.get());
+    auto rows = static_cast<InsertEdgesSentence *>(seq->sentences().front())->rows();
+    ASSERT_EQ(2, rows.size());
+    ASSERT_TRUE(rows[0]->isLiteral());
+    EXPECT_EQ(Value(-1), rows[0]->literalSrcid());
+    EXPECT_EQ(-3, rows[0]->rank());
+    EXPECT_EQ(std::vector<Value>({Value(std::numeric_limits<int64_t>::min()), Value(-1.5)}),
+              rows[0]->literals());
+    EXPECT_EQ(std::vector<Value>({Value(2), Value(1.0)}), rows[1]->literals());
+  }
+  // Left to GQLParser
+  std::vector<std::string> ineligible = {
+      "INSERT VERTEX person(name) VALUES hash(\"Tom\"):(\"Tom\")",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(\"T\\\"om\")",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(1 + 1)",
+      "INSERT VERTEX person(name) VALUES \"Tom\":($p)",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(0x10)",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(9223372036854775808)",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(1) # comment",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(1); GO FROM \"Tom\" OVER like",
+      "INSERT VERTEX person(name) VALUES \"Tom\":(1",
+      "INSERT EDGE e(a) VALUES 1->2:(date(\"2020-01-01\"))",
+      "INSERT EDGE e(a) VALUES 1.5->2:(1)",
+      "INSERT EDGE go(a) VALUES 1->2:(1)",
+      "EXPLAIN INSERT EDGE e(a) VALUES 1->2:(1)",
+  };
+  for (const auto &query : ineligible) {
+    ASSERT_EQ(BulkInsertParser(qctx_.get()).tryParse(query), nullptr) << query;
+  }
+  // Rejected by GQLParser, so must never be taken by the fast path
+  std::vector<std::string> invalid = {
+      "INSERT EDGE e(a) VALUES 1 - > 2:(1)",
+      "INSERT EDGE e(a) VALUES 1-\n>2:(1)",
+      "INSERT EDGE e(a) VALUES 1-->2:(1)",
+      "INSERT EDGE e(a) VALUES 1->>2:(1)",
+      "INSERT EDGE e(a) VALUES 1<-2:(1)",
+      "INSERT EDGE e(a) VALUES 1->2@:(1)",
+      "INSERT EDGE e(a) VALUES 1->2@1.5:(1)",
+      "INSERT EDGE e(a) VALUES 1->2@9223372036854775808:(1)",
+      "INSERT EDGE e(a) VALUES 1->2:(1),",
+      "INSERT VERTEX person(name) VALUES 1:(,)",
+      "INSERT VERTEX person(name) VALUES 1:(1,,)",
+      "INSERT VERTEX person(name) VALUES 1:(1e)",
+      "INSERT VERTEX person(name) VALUES 1:(1.e)",
+      "INSERT VERTEX person(name) VALUES 1:(+9223372036854775808)",
+      "INSERT VERTEX person(name) VALUES 1:(\"a\nb\")",
+      "INSERT VERTEX person(name) VALUES 1:(\"a)",
+      "INSERT VERTEX person(name) VALUES 1:(1) 2:(2)",
+      "INSERT VERTEX person(name) VALUES 1.0:(1)",
+      "INSERT VERTEX person(name) VALUES NULL:(1)",
+  };
+  for (const auto &query : invalid) {
+    auto result = parse(query);
+    ASSERT_FALSE(result.ok()) << query;
+    ASSERT_EQ(BulkInsertParser(qctx_.get()).tryParse(query), nullptr) << query;
+  }
+}
+
 TEST_F(ParserTest, UpdateEdge) {
   {
     std::string query =
@@ -1483,6 +1599,73 @@ TEST_F(ParserTest, subgraph) {
   }
 }
 
+TEST_F(ParserTest, RandomWalk) {
+  {
+    std::string query = "RANDOM WALK FROM \"TOM\" OVER like";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query = "RANDOM WALK 3 STEPS FROM \"TOM\", \"Jerry\" OVER like BIDIRECT WALKS 10";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query =
+        "RANDOM WALK 5 STEPS FROM \"TOM\" OVER like REVERSELY WEIGHT BY likeness RESTART 0.15";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query = "GO FROM \"TOM\" OVER like YIELD dst(edge) AS id | "
+                        "RANDOM WALK 2 STEPS FROM $-.id OVER * WALKS 3";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query = "RANDOM WALK 1 TO 3 STEPS FROM \"TOM\" OVER like";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+}
+
+TEST_F(ParserTest, RunAlgorithm) {
+  {
+    std::string query = "RUN LOCAL ALGORITHM pagerank OVER like";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query =
+        "RUN LOCAL ALGORITHM pagerank OVER like, serve REVERSELY "
+        "WITH {max_iterations: 30, damping: 0.9, tolerance: 0.0001}";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query = "RUN LOCAL ALGORITHM wcc OVER *";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query =
+        "RUN LOCAL ALGORITHM lpa OVER like BIDIRECT WITH {max_iterations: 10} "
+        "| YIELD $-.label AS label, count(*) AS size";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query = "RUN LOCAL ALGORITHM pagerank FROM \"TOM\" OVER like";
+    auto result = parse(query);
+    ASSERT_FALSE(result.ok());
+  }
+  {
+    std::string query = "RUN ALGORITHM pagerank OVER like";
+    auto result = parse(query);
+    ASSERT_FALSE(result.ok());
+  }
+}
+
 TEST_F(ParserTest, AdminOperation) {
   {
     GQLParser parser;
@@ -2976,6 +3159,16 @@ TEST_F(ParserTest, FullTextServiceTest) {
     auto result = parse(query);
     ASSERT_TRUE(result.ok()) << result.status();
   }
+  {
+    std::string query = "ADD LISTENER FULLTEXT 127.0.0.1:12000";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
+  {
+    std::string query = "REMOVE LISTENER FULLTEXT";
+    auto result = parse(query);
+    ASSERT_TRUE(result.ok()) << result.status();
+  }
   {
     std::string query = "SHOW LISTENER";
     auto result = parse(query);
@@ -3116,6 +3309,8 @@ TEST_F(ParserTest, JobTest) {
   checkTest("SUBMIT JOB INGEST", "SUBMIT JOB INGEST");
 
   checkTest("SUBMIT JOB STATS", "SUBMIT JOB STATS");
+  checkTest("SUBMIT JOB INDEX STATS", "SUBMIT JOB INDEX STATS");
+  checkTest("SUBMIT JOB INDEX STATS idx1, idx2", "SUBMIT JOB INDEX STATS idx1,idx2");
   checkTest("SUBMIT JOB BALANCE LEADER", "SUBMIT JOB BALANCE LEADER");
   checkTest("SHOW JOBS", "SHOW JOBS");
   checkTest("SHOW JOB 111", "SHOW JOB 111");
@@ -5,6 +5,7 @@
 
 #include "storage/CommonUtils.h"
 
+#include "common/utils/IndexKeyUtils.h"
 #include "storage/exec/QueryUtils.h"
 
 DEFINE_bool(ttl_use_ms,
@@ -81,5 +82,22 @@ StatusOr<Value> CommonUtils::ttlValue(const meta::NebulaSchemaProvider* schema,
   return reader->getValueByName(std::move(ttlProp).second.second);
 }
 
+std::string CommonUtils::indexValue(const meta::NebulaSchemaProvider* schema,
+                                    RowReaderWrapper* reader,
+                                    const meta::cpp2::IndexItem* index) {
+  auto ttl = ttlValue(schema, reader);
+  const auto* params = index->get_index_params();
+  if (params == nullptr || !params->included_fields_ref().has_value()) {
+    return ttl.ok() ? IndexKeyUtils::indexVal(std::move(ttl).value()) : "";
+  }
+  List included;
+  for (const auto& name : *params->included_fields_ref()) {
+    auto value = QueryUtils::readValue(reader, name, schema);
+    included.emplace_back(value.ok() ? std::move(value).value() : Value::kNullValue);
+  }
+  return IndexKeyUtils::indexVal(ttl.ok() ? std::move(ttl).value() : Value::kNullValue,
+                                 std::move(included));
+}
+
 }  // namespace storage
 }  // namespace nebula
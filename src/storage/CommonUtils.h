@@ -275,6 +275,19 @@ class CommonUtils final {
 
   static StatusOr<Value> ttlValue(const meta::NebulaSchemaProvider* schema,
                                   RowReaderWrapper* reader);
+
+  /**
+   * @brief the value of index key, which contains the ttl property and the included properties
+   * of index, empty if there is neither of them
+   *
+   * @param schema **Latest** schema
+   * @param reader RowReader of current value
+   * @param index Index of the key
+   * @return Index value
+   */
+  static std::string indexValue(const meta::NebulaSchemaProvider* schema,
+                                RowReaderWrapper* reader,
+                                const meta::cpp2::IndexItem* index);
 };
 
 }  // namespace storage
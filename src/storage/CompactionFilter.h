@@ -163,7 +163,8 @@ class StorageCompactionFilter final : public kvstore::KVFilter {
     }
     auto tRet = indexMan_->getTagIndex(spaceId, indexId);
     if (tRet.ok()) {
-      if (!val.empty()) {
+      // The value of vector index is the HNSW graph instead of ttl
+      if (!val.empty() && !IndexKeyUtils::isVectorIndex(*tRet.value())) {
         auto id = tRet.value()->get_schema_id().get_tag_id();
         auto schema = schemaMan_->getTagSchema(spaceId, id);
         if (!schema) {
@@ -119,6 +119,11 @@ folly::Future<cpp2::GetNeighborsResponse> GraphStorageLocalServer::future_lookup
   LOCAL_RETURN_FUTURE(cpp2::GetNeighborsResponse, future_lookupAndTraverse);
 }
 
+folly::Future<cpp2::FulltextSearchResponse> GraphStorageLocalServer::future_fulltextSearch(
+    const cpp2::FulltextSearchRequest& request) {
+  LOCAL_RETURN_FUTURE(cpp2::FulltextSearchResponse, future_fulltextSearch);
+}
+
 folly::Future<cpp2::ScanResponse> GraphStorageLocalServer::future_scanVertex(
     const cpp2::ScanVertexRequest& request) {
   LOCAL_RETURN_FUTURE(cpp2::ScanResponse, future_scanVertex);
@@ -49,6 +49,8 @@ class GraphStorageLocalServer final : public boost::noncopyable, public nebula::
   folly::Future<cpp2::LookupIndexResp> future_lookupIndex(const cpp2::LookupIndexRequest& request);
   folly::Future<cpp2::GetNeighborsResponse> future_lookupAndTraverse(
       const cpp2::LookupAndTraverseRequest& request);
+  folly::Future<cpp2::FulltextSearchResponse> future_fulltextSearch(
+      const cpp2::FulltextSearchRequest& request);
   folly::Future<cpp2::ScanResponse> future_scanVertex(const cpp2::ScanVertexRequest& request);
   folly::Future<cpp2::ScanResponse> future_scanEdge(const cpp2::ScanEdgeRequest& request);
   folly::Future<cpp2::KVGetResponse> future_get(const cpp2::KVGetRequest& request);
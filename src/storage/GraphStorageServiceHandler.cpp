@@ -5,7 +5,9 @@
 
 #include "storage/GraphStorageServiceHandler.h"
 
+#include "common/memory/MemoryScope.h"
 #include "common/memory/MemoryTracker.h"
+#include "storage/index/FulltextSearchProcessor.h"
 #include "storage/index/LookupProcessor.h"
 #include "storage/kv/GetProcessor.h"
 #include "storage/kv/PutProcessor.h"
@@ -31,25 +33,38 @@
 //    Processors DO NOT NEED handle error in their logic.
 //  else (do some work in another thread)
 //    Processors need handle error in that thread by itself
-#define RETURN_FUTURE(processor)             \
-  auto f = processor->getFuture();           \
-  try {                                      \
-    processor->process(req);                 \
-  } catch (std::bad_alloc & e) {             \
-    LOG(ERROR) << processor << " bad_alloc"; \
-    processor->memoryExceeded();             \
-    processor->onError();                    \
-  } catch (std::exception & e) {             \
-    LOG(ERROR) << e.what();                  \
-    processor->onError();                    \
-  } catch (...) {                            \
-    processor->onError();                    \
-  }                                          \
+#define RETURN_FUTURE(processor)                                                \
+  auto f = processor->getFuture();                                              \
+  memory::MemoryScopeGuard scopeGuard(                                          \
+      requestsScope()->create("request", memory::MemoryScope::kNoLimit, true)); \
+  try {                                                                         \
+    processor->process(req);                                                    \
+  } catch (std::bad_alloc & e) {                                                \
+    LOG(ERROR) << processor << " bad_alloc";                                    \
+    processor->memoryExceeded();                                                \
+    processor->onError();                                                       \
+  } catch (std::exception & e) {                                                \
+    LOG(ERROR) << e.what();                                                     \
+    processor->onError();                                                       \
+  } catch (...) {                                                               \
+    processor->onError();                                                       \
+  }                                                                             \
   return f;
 
 namespace nebula {
 namespace storage {
 
+namespace {
+
+// The parent of the memory scopes of the requests, each of which could be chosen to fail when
+// the memory of the process is exhausted
+const std::shared_ptr<memory::MemoryScope>& requestsScope() {
+  static const auto scope = memory::MemoryScope::root()->child("requests");
+  return scope;
+}
+
+}  // namespace
+
 GraphStorageServiceHandler::GraphStorageServiceHandler(StorageEnv* env) : env_(env) {
   if (FLAGS_reader_handlers_type == "io") {
     auto tf = std::make_shared<folly::NamedThreadFactory>("reader-pool");
@@ -78,6 +93,7 @@ GraphStorageServiceHandler::GraphStorageServiceHandler(StorageEnv* env) : env_(e
   kGetDstBySrcCounters.init("get_dst_by_src");
   kGetPropCounters.init("get_prop");
   kLookupCounters.init("lookup");
+  kFulltextSearchCounters.init("fulltext_search");
   kScanVertexCounters.init("scan_vertex");
   kScanEdgeCounters.init("scan_edge");
   kPutCounters.init("kv_put");
@@ -161,6 +177,12 @@ folly::Future<cpp2::LookupIndexResp> GraphStorageServiceHandler::future_lookupIn
   RETURN_FUTURE(processor);
 }
 
+folly::Future<cpp2::FulltextSearchResponse> GraphStorageServiceHandler::future_fulltextSearch(
+    const cpp2::FulltextSearchRequest& req) {
+  auto* processor = FulltextSearchProcessor::instance(env_, &kFulltextSearchCounters);
+  RETURN_FUTURE(processor);
+}
+
 folly::Future<cpp2::ScanResponse> GraphStorageServiceHandler::future_scanVertex(
     const cpp2::ScanVertexRequest& req) {
   auto* processor = ScanVertexProcessor::instance(env_, &kScanVertexCounters, readerPool_.get());
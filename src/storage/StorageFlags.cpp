@@ -28,6 +28,17 @@ DEFINE_uint32(rebuild_index_part_rate_limit,
 
 DEFINE_uint32(rebuild_index_batch_size, 1024 * 128, "batch size for rebuild index, in bytes");
 
+DEFINE_bool(rebuild_index_by_ingest,
+            false,
+            "whether to rebuild index by sorting the index keys into a sst file and ingesting it. "
+            "Single replica only: the ingested file bypasses raft, so the partitions with other "
+            "replicas are still rebuilt through raft");
+
+DEFINE_uint64(rebuild_index_sort_buffer_size,
+              256UL * 1024 * 1024,
+              "max bytes of index keys sorted in memory for each partition when rebuilding index "
+              "by ingest");
+
 DEFINE_int32(reader_handlers, 32, "Total reader handlers");
 
 DEFINE_uint64(default_mvcc_ver,
@@ -48,3 +59,8 @@ DEFINE_bool(query_concurrently,
             "go are supported");
 
 DEFINE_bool(use_vertex_key, false, "whether allow insert or query the vertex key");
+
+DEFINE_int32(vector_index_ef_search,
+             64,
+             "size of the dynamic candidate list when searching a vector index, used if the "
+             "query does not specify one");
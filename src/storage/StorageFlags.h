@@ -22,6 +22,10 @@ DECLARE_uint32(rebuild_index_part_rate_limit);
 
 DECLARE_uint32(rebuild_index_batch_size);
 
+DECLARE_bool(rebuild_index_by_ingest);
+
+DECLARE_uint64(rebuild_index_sort_buffer_size);
+
 DECLARE_int32(reader_handlers);
 
 DECLARE_uint64(default_mvcc_ver);
@@ -36,4 +40,6 @@ DECLARE_bool(query_concurrently);
 
 DECLARE_bool(use_vertex_key);
 
+DECLARE_int32(vector_index_ef_search);
+
 #endif  // STORAGE_STORAGEFLAGS_H_
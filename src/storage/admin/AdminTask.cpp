@@ -8,6 +8,7 @@
 #include "storage/admin/CompactTask.h"
 #include "storage/admin/DownloadTask.h"
 #include "storage/admin/FlushTask.h"
+#include "storage/admin/IndexStatsTask.h"
 #include "storage/admin/IngestTask.h"
 #include "storage/admin/RebuildEdgeIndexTask.h"
 #include "storage/admin/RebuildFTIndexTask.h"
@@ -39,6 +40,9 @@ std::shared_ptr<AdminTask> AdminTaskFactory::createAdminTask(StorageEnv* env, Ta
     case meta::cpp2::JobType::STATS:
       ret = std::make_shared<StatsTask>(env, std::move(ctx));
       break;
+    case meta::cpp2::JobType::INDEX_STATS:
+      ret = std::make_shared<IndexStatsTask>(env, std::move(ctx));
+      break;
     case meta::cpp2::JobType::DOWNLOAD:
       ret = std::make_shared<DownloadTask>(env, std::move(ctx));
       break;
@@ -5,7 +5,11 @@
 
 #include "storage/admin/CompactTask.h"
 
+#include <thrift/lib/cpp/util/EnumUtils.h>
+
 #include "common/base/Logging.h"
+#include "common/utils/IndexKeyUtils.h"
+#include "storage/index/HnswIndex.h"
 
 namespace nebula {
 namespace storage {
@@ -36,8 +40,45 @@ ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> CompactTask::genSubT
 }
 
 nebula::cpp2::ErrorCode CompactTask::subTask(kvstore::KVEngine* engine) {
+  auto code = removeExpiredVectors(engine);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
   return engine->compact();
 }
 
+nebula::cpp2::ErrorCode CompactTask::removeExpiredVectors(kvstore::KVEngine* engine) {
+  auto space = *ctx_.parameters_.space_id_ref();
+  auto indexes = env_->indexMan_->getTagIndexes(space);
+  if (!indexes.ok()) {
+    // The space has no index
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  auto* store = dynamic_cast<kvstore::NebulaStore*>(env_->kvstore_);
+  for (const auto& index : indexes.value()) {
+    if (!IndexKeyUtils::isVectorIndex(*index)) {
+      continue;
+    }
+    auto vIdLen = env_->schemaMan_->getSpaceVidLen(space);
+    if (!vIdLen.ok()) {
+      return nebula::cpp2::ErrorCode::E_SPACE_NOT_FOUND;
+    }
+    // The followers are changed by the logs of leader
+    for (auto part : engine->allParts()) {
+      if (!store->isLeader(space, part)) {
+        continue;
+      }
+      auto code = HnswIndex::removeExpired(env_, space, part, vIdLen.value(), index);
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        LOG(ERROR) << "Remove expired vertices from vector index " << index->get_index_id()
+                   << " in part " << part << " failed: "
+                   << apache::thrift::util::enumNameSafe(code);
+        return code;
+      }
+    }
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
 }  // namespace storage
 }  // namespace nebula
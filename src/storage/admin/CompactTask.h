@@ -31,6 +31,13 @@ class CompactTask : public AdminTask {
   ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> genSubTasks() override;
 
   nebula::cpp2::ErrorCode subTask(nebula::kvstore::KVEngine* engine);
+
+ private:
+  /**
+   * @brief Remove the vertices expired by TTL from the vector indexes of the leader parts in
+   * engine, before their rows are dropped by compaction.
+   */
+  nebula::cpp2::ErrorCode removeExpiredVectors(nebula::kvstore::KVEngine* engine);
 };
 
 }  // namespace storage
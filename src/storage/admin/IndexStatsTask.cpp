@@ -0,0 +1,221 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "storage/admin/IndexStatsTask.h"
+
+#include <thrift/lib/cpp/util/EnumUtils.h>
+
+#include "common/algorithm/HyperLogLog.h"
+#include "common/algorithm/ReservoirSampling.h"
+#include "common/time/WallClock.h"
+#include "common/utils/IndexKeyUtils.h"
+#include "common/utils/IndexStatsUtils.h"
+
+DEFINE_uint32(index_stats_samples,
+              1024,
+              "The number of values sampled for each index column in a part, which are used to "
+              "build the histogram");
+
+DECLARE_int32(stats_sleep_interval_ms);
+
+namespace nebula {
+namespace storage {
+
+bool IndexStatsTask::check() {
+  return env_->kvstore_ != nullptr && env_->schemaMan_ != nullptr && env_->indexMan_ != nullptr;
+}
+
+nebula::cpp2::ErrorCode IndexStatsTask::getIndexes(GraphSpaceID space, IndexItems& items) {
+  if (!ctx_.parameters_.task_specific_paras_ref().has_value() ||
+      (*ctx_.parameters_.task_specific_paras_ref()).empty()) {
+    auto tagIndexes = env_->indexMan_->getTagIndexes(space);
+    if (!tagIndexes.ok()) {
+      return nebula::cpp2::ErrorCode::E_SPACE_NOT_FOUND;
+    }
+    auto edgeIndexes = env_->indexMan_->getEdgeIndexes(space);
+    if (!edgeIndexes.ok()) {
+      return nebula::cpp2::ErrorCode::E_SPACE_NOT_FOUND;
+    }
+    items = std::move(tagIndexes).value();
+    for (auto& item : edgeIndexes.value()) {
+      items.emplace_back(std::move(item));
+    }
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+  for (const auto& index : *ctx_.parameters_.task_specific_paras_ref()) {
+    auto indexId = folly::to<IndexID>(index);
+    auto indexRet = env_->indexMan_->getTagIndex(space, indexId);
+    if (!indexRet.ok()) {
+      indexRet = env_->indexMan_->getEdgeIndex(space, indexId);
+    }
+    if (!indexRet.ok()) {
+      LOG(INFO) << "Index not found: " << indexId;
+      return nebula::cpp2::ErrorCode::E_INDEX_NOT_FOUND;
+    }
+    items.emplace_back(std::move(indexRet).value());
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> IndexStatsTask::genSubTasks() {
+  spaceId_ = *ctx_.parameters_.space_id_ref();
+  auto parts = *ctx_.parameters_.parts_ref();
+  subTaskSize_ = parts.size();
+
+  auto ret = getIndexes(spaceId_, items_);
+  if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(INFO) << "Get indexes failed, spaceId: " << spaceId_;
+    return ret;
+  }
+  // The HNSW graph of vector index has no index key to be sampled
+  items_.erase(std::remove_if(items_.begin(),
+                              items_.end(),
+                              [](const auto& item) { return IndexKeyUtils::isVectorIndex(*item); }),
+               items_.end());
+
+  std::vector<AdminSubTask> tasks;
+  for (const auto& part : parts) {
+    TaskFunction task = std::bind(&IndexStatsTask::genSubTask, this, spaceId_, part, items_);
+    tasks.emplace_back(std::move(task));
+  }
+  return tasks;
+}
+
+nebula::cpp2::ErrorCode IndexStatsTask::genSubTask(GraphSpaceID space,
+                                                   PartitionID part,
+                                                   const IndexItems& items) {
+  if (UNLIKELY(canceled_)) {
+    LOG(INFO) << "Index stats task is canceled";
+    return nebula::cpp2::ErrorCode::E_USER_CANCEL;
+  }
+
+  auto vIdLenRet = env_->schemaMan_->getSpaceVidLen(space);
+  if (!vIdLenRet.ok()) {
+    LOG(INFO) << "Get space vid length failed";
+    return nebula::cpp2::ErrorCode::E_SPACE_NOT_FOUND;
+  }
+
+  LOG(INFO) << "Start index stats task of part " << part;
+  std::vector<meta::cpp2::IndexStats> result;
+  for (const auto& item : items) {
+    auto statsRet = statsIndex(space, part, vIdLenRet.value(), *item);
+    if (!statsRet.ok()) {
+      LOG(INFO) << "Index stats task failed: " << statsRet.status();
+      return canceled_ ? nebula::cpp2::ErrorCode::E_USER_CANCEL
+                       : nebula::cpp2::ErrorCode::E_INVALID_DATA;
+    }
+    result.emplace_back(std::move(statsRet).value());
+  }
+
+  statistics_.emplace(part, std::move(result));
+  LOG(INFO) << "Index stats task of part " << part << " finished";
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+StatusOr<meta::cpp2::IndexStats> IndexStatsTask::statsIndex(GraphSpaceID space,
+                                                             PartitionID part,
+                                                             size_t vIdLen,
+                                                             const meta::cpp2::IndexItem& item) {
+  auto indexId = item.get_index_id();
+  const auto& cols = item.get_fields();
+  bool isEdgeIndex = item.get_schema_id().getType() == nebula::cpp2::SchemaID::Type::edge_type;
+  bool hasNullableCol = std::any_of(cols.begin(), cols.end(), [](const auto& col) {
+    return col.nullable_ref().value_or(false);
+  });
+
+  // When the storage occurs leader change, continue to read data from the
+  // follower instead of reporting an error.
+  auto prefix = IndexKeyUtils::indexPrefix(part, indexId);
+  std::unique_ptr<kvstore::KVIterator> iter;
+  auto ret = env_->kvstore_->prefix(space, part, prefix, &iter, true);
+  if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return Status::Error("Scan index %d of part %d failed", indexId, part);
+  }
+
+  std::vector<algorithm::HyperLogLog> sketches(cols.size());
+  std::vector<algorithm::ReservoirSampling<Value>> samplers;
+  std::vector<int64_t> nullCounts(cols.size(), 0);
+  for (size_t i = 0; i < cols.size(); ++i) {
+    samplers.emplace_back(FLAGS_index_stats_samples);
+  }
+
+  int64_t rows = 0;
+  size_t countToSleep = 0;
+  while (iter && iter->valid()) {
+    if (UNLIKELY(canceled_)) {
+      return Status::Error("Index stats task is canceled");
+    }
+    auto key = iter->key();
+    for (size_t i = 0; i < cols.size(); ++i) {
+      auto value = IndexKeyUtils::getValueFromIndexKey(
+          vIdLen, key, cols[i].get_name(), cols, isEdgeIndex, hasNullableCol);
+      if (value.isNull()) {
+        // The geography column is stored as cell ids which could not be decoded to value
+        if (!value.isBadNull()) {
+          nullCounts[i]++;
+        }
+        continue;
+      }
+      sketches[i].add(folly::hash::twang_mix64(std::hash<Value>()(value)));
+      samplers[i].sampling(std::move(value));
+    }
+    rows++;
+    iter->next();
+    sleepIfScannedSomeRecord(++countToSleep);
+  }
+
+  meta::cpp2::IndexStats stats;
+  stats.index_id_ref() = indexId;
+  stats.rows_ref() = rows;
+  stats.update_time_ref() = time::WallClock::fastNowInSec();
+  for (size_t i = 0; i < cols.size(); ++i) {
+    meta::cpp2::IndexColumnStats column;
+    column.name_ref() = cols[i].get_name();
+    column.ndv_ref() = 0;
+    column.null_count_ref() = nullCounts[i];
+    column.sketch_ref() = sketches[i].registers();
+    column.samples_ref() = samplers[i].samples();
+    stats.columns_ref()->emplace_back(std::move(column));
+  }
+  return stats;
+}
+
+void IndexStatsTask::finish(nebula::cpp2::ErrorCode rc) {
+  FLOG_INFO("task(%d, %d) finished, rc=[%s]",
+            ctx_.jobId_,
+            ctx_.taskId_,
+            apache::thrift::util::enumNameSafe(rc).c_str());
+  nebula::meta::cpp2::StatsItem result;
+  result.status_ref() = nebula::meta::cpp2::JobStatus::FAILED;
+
+  if (rc == nebula::cpp2::ErrorCode::SUCCEEDED && statistics_.size() == subTaskSize_) {
+    // The samples are merged in meta again, keep enough of them to represent all parts
+    std::unordered_map<IndexID, meta::cpp2::IndexStats> indexStats;
+    for (auto& elem : statistics_) {
+      for (const auto& stats : elem.second) {
+        IndexStatsUtils::merge(indexStats[stats.get_index_id()], stats, FLAGS_index_stats_samples);
+      }
+    }
+    result.index_stats_ref() = std::move(indexStats);
+    result.status_ref() = nebula::meta::cpp2::JobStatus::FINISHED;
+    ctx_.onFinish_(rc, result);
+  } else if (rc != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    ctx_.onFinish_(rc, result);
+  } else {
+    LOG(WARNING) << "The number of subtasks is not equal to the number of parts";
+    ctx_.onFinish_(nebula::cpp2::ErrorCode::E_PART_NOT_FOUND, result);
+  }
+}
+
+void IndexStatsTask::sleepIfScannedSomeRecord(size_t& countToSleep) {
+  if (FLAGS_stats_sleep_interval_ms > 0 && countToSleep >= kRecordsToSleep) {
+    usleep(FLAGS_stats_sleep_interval_ms * 1000);
+    countToSleep = 0;
+  }
+}
+
+}  // namespace storage
+}  // namespace nebula
@@ -0,0 +1,77 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef STORAGE_ADMIN_INDEXSTATSTASK_H_
+#define STORAGE_ADMIN_INDEXSTATSTASK_H_
+
+#include "interface/gen-cpp2/meta_types.h"
+#include "kvstore/NebulaStore.h"
+#include "storage/admin/AdminTask.h"
+
+namespace nebula {
+namespace storage {
+
+using IndexItems = std::vector<std::shared_ptr<meta::cpp2::IndexItem>>;
+
+/**
+ * @brief Task class to collect the statistics of tag and edge indexes, including the number of
+ * distinct values, the null count and the sampled values of every index column.
+ *
+ */
+class IndexStatsTask : public AdminTask {
+ public:
+  using AdminTask::finish;
+  IndexStatsTask(StorageEnv* env, TaskContext&& ctx) : AdminTask(env, std::move(ctx)) {}
+
+  ~IndexStatsTask() {
+    LOG(INFO) << "Release Index Stats Task";
+  }
+
+  bool check() override;
+
+  /**
+   * @brief Generate sub tasks for IndexStatsTask, one sub task for each part.
+   *
+   * @return ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> Task vector or errorcode.
+   */
+  ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> genSubTasks() override;
+
+  /**
+   * @brief Merge the statistics of all parts and report them.
+   *
+   * @param rc Errorcode of task.
+   */
+  void finish(nebula::cpp2::ErrorCode rc) override;
+
+ protected:
+  nebula::cpp2::ErrorCode genSubTask(GraphSpaceID space, PartitionID part, const IndexItems& items);
+
+ private:
+  nebula::cpp2::ErrorCode getIndexes(GraphSpaceID space, IndexItems& items);
+
+  StatusOr<meta::cpp2::IndexStats> statsIndex(GraphSpaceID space,
+                                              PartitionID part,
+                                              size_t vIdLen,
+                                              const meta::cpp2::IndexItem& item);
+
+  void sleepIfScannedSomeRecord(size_t& countToSleep);
+
+ protected:
+  GraphSpaceID spaceId_;
+
+  IndexItems items_;
+
+  folly::ConcurrentHashMap<PartitionID, std::vector<meta::cpp2::IndexStats>> statistics_;
+
+  // The number of subtasks equals to the number of parts in request
+  size_t subTaskSize_{0};
+
+  static constexpr size_t kRecordsToSleep{1000};
+};
+
+}  // namespace storage
+}  // namespace nebula
+
+#endif  // STORAGE_ADMIN_INDEXSTATSTASK_H_
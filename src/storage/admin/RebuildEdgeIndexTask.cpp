@@ -126,14 +126,6 @@ nebula::cpp2::ErrorCode RebuildEdgeIndexTask::buildIndexGlobal(GraphSpaceID spac
       continue;
     }
 
-    std::string indexVal = "";
-    if (ttlProp.first) {
-      auto ttlValRet = CommonUtils::ttlValue(schema, reader.get());
-      if (ttlValRet.ok()) {
-        indexVal = IndexKeyUtils::indexVal(std::move(ttlValRet).value());
-      }
-    }
-
     for (const auto& item : items) {
       if (item->get_schema_id().get_edge_type() == edgeType) {
         auto valuesRet = IndexKeyUtils::collectIndexValues(reader.get(), item.get(), schema);
@@ -141,6 +133,7 @@ nebula::cpp2::ErrorCode RebuildEdgeIndexTask::buildIndexGlobal(GraphSpaceID spac
           LOG(INFO) << "Collect index value failed";
           continue;
         }
+        auto indexVal = CommonUtils::indexValue(schema, reader.get(), item.get());
         auto indexKeys = IndexKeyUtils::edgeIndexKeys(vidSize,
                                                       part,
                                                       item->get_index_id(),
@@ -33,7 +33,8 @@ ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> RebuildFTIndexTask::
         continue;
       }
       for (auto& l : lMap.second) {
-        if (l.first != meta::cpp2::ListenerType::ELASTICSEARCH) {
+        if (l.first != meta::cpp2::ListenerType::ELASTICSEARCH &&
+            l.first != meta::cpp2::ListenerType::LOCAL_FULLTEXT) {
           continue;
         }
         listener = l.second.get();
@@ -5,6 +5,7 @@
 
 #include "storage/admin/RebuildIndexTask.h"
 
+#include "common/fs/FileUtils.h"
 #include "common/utils/OperationKeyUtils.h"
 #include "kvstore/Common.h"
 #include "storage/StorageFlags.h"
@@ -81,6 +82,22 @@ ErrorOr<nebula::cpp2::ErrorCode, std::vector<AdminSubTask>> RebuildIndexTask::ge
     }
   }
 
+  if (FLAGS_rebuild_index_by_ingest) {
+    std::vector<PartitionID> replicated;
+    for (const auto& part : parts) {
+      if (!canIngest(space_, part)) {
+        replicated.emplace_back(part);
+      }
+    }
+    if (!replicated.empty()) {
+      LOG(WARNING) << folly::sformat(
+          "rebuild_index_by_ingest only works for single replica parts, parts {} of space {} are "
+          "rebuilt through raft",
+          folly::join(",", replicated),
+          space_);
+    }
+  }
+
   for (const auto& part : parts) {
     env_->rebuildIndexGuard_->insert_or_assign(std::make_tuple(space_, part), IndexState::STARTING);
     TaskFunction task = std::bind(&RebuildIndexTask::invoke, this, space_, part, items);
@@ -110,6 +127,24 @@ nebula::cpp2::ErrorCode RebuildIndexTask::invoke(GraphSpaceID space,
     SCOPE_EXIT {
       env_->rebuildIndexGuard_->assign(std::make_tuple(space, part), IndexState::FINISHED);
     };
+    if (FLAGS_rebuild_index_by_ingest) {
+      if (canIngest(space, part)) {
+        auto partRet = env_->kvstore_->part(space, part);
+        auto* engine = value(partRet)->engine();
+        // Clean up the files left by the last failed task
+        auto dir = folly::sformat("{}/rebuild_index/{}", engine->getDataRoot(), part);
+        fs::FileUtils::remove(dir.c_str(), true);
+        sorters_.insert_or_assign(
+            part,
+            std::make_shared<kvstore::SstFileSorter>(dir, FLAGS_rebuild_index_sort_buffer_size));
+      } else {
+        VLOG(1) << folly::sformat(
+            "Part has other replicas, rebuild index by raft, space={}, part={}", space, part);
+      }
+    }
+    SCOPE_EXIT {
+      sorters_.erase(part);
+    };
     LOG(INFO) << "Start building index";
     result = buildIndexGlobal(space, part, items, rateLimiter.get());
     if (result != nebula::cpp2::ErrorCode::SUCCEEDED) {
@@ -119,6 +154,14 @@ nebula::cpp2::ErrorCode RebuildIndexTask::invoke(GraphSpaceID space,
       LOG(INFO) << folly::sformat("Building index successful, space={}, part={}", space, part);
     }
 
+    if (sorters_.find(part) != sorters_.end()) {
+      result = ingestIndex(space, part);
+      if (result != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        LOG(INFO) << folly::sformat("Ingesting index failed, space={}, part={}", space, part);
+        return nebula::cpp2::ErrorCode::E_REBUILD_INDEX_FAILED;
+      }
+    }
+
     LOG(INFO) << folly::sformat("Processing operation logs, space={}, part={}", space, part);
     result = buildIndexOnOperations(space, part, rateLimiter.get());
     if (result != nebula::cpp2::ErrorCode::SUCCEEDED) {
@@ -131,6 +174,46 @@ nebula::cpp2::ErrorCode RebuildIndexTask::invoke(GraphSpaceID space,
   return result;
 }
 
+bool RebuildIndexTask::canIngest(GraphSpaceID space, PartitionID part) {
+  auto partRet = env_->kvstore_->part(space, part);
+  if (!ok(partRet)) {
+    return false;
+  }
+  return value(partRet)->peers().size() == 1;
+}
+
+nebula::cpp2::ErrorCode RebuildIndexTask::ingestIndex(GraphSpaceID space, PartitionID part) {
+  auto partRet = env_->kvstore_->part(space, part);
+  if (!ok(partRet)) {
+    return error(partRet);
+  }
+  auto* engine = value(partRet)->engine();
+  auto sorter = sorters_.find(part)->second;
+  auto dir = folly::sformat("{}/rebuild_index/{}", engine->getDataRoot(), part);
+  SCOPE_EXIT {
+    fs::FileUtils::remove(dir.c_str(), true);
+  };
+
+  LOG(INFO) << folly::sformat(
+      "Sorting {} index keys, space={}, part={}", sorter->size(), space, part);
+  auto fileRet = sorter->finish();
+  if (!ok(fileRet)) {
+    return error(fileRet);
+  }
+  auto file = value(fileRet);
+  if (file.empty()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  // The data written during building are recorded in the operation logs, which are replayed after
+  // ingestion and overwrite the ingested ones
+  auto code = engine->ingest({file});
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  LOG(INFO) << folly::sformat("Ingest index file {}, space={}, part={}", file, space, part);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
 nebula::cpp2::ErrorCode RebuildIndexTask::buildIndexOnOperations(
     GraphSpaceID space, PartitionID part, kvstore::RateLimiter* rateLimiter) {
   if (canceled_) {
@@ -239,6 +322,17 @@ nebula::cpp2::ErrorCode RebuildIndexTask::writeData(GraphSpaceID space,
                                                     std::vector<kvstore::KV> data,
                                                     size_t batchSize,
                                                     kvstore::RateLimiter* rateLimiter) {
+  auto sorterIter = sorters_.find(part);
+  if (sorterIter != sorters_.end()) {
+    // Written into local sst file, no need to be rate limited
+    for (auto& kv : data) {
+      auto code = sorterIter->second->add(std::move(kv.first), std::move(kv.second));
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        return code;
+      }
+    }
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
   folly::Baton<true, std::atomic> baton;
   auto result = nebula::cpp2::ErrorCode::SUCCEEDED;
   rateLimiter->consume(static_cast<double>(batchSize),                             // toConsume
@@ -6,10 +6,13 @@
 #ifndef STORAGE_ADMIN_REBUILDINDEXTASK_H_
 #define STORAGE_ADMIN_REBUILDINDEXTASK_H_
 
+#include <folly/concurrency/ConcurrentHashMap.h>
+
 #include "common/meta/IndexManager.h"
 #include "interface/gen-cpp2/storage_types.h"
 #include "kvstore/LogEncoder.h"
 #include "kvstore/RateLimiter.h"
+#include "kvstore/SstFileSorter.h"
 #include "storage/admin/AdminTask.h"
 
 namespace nebula {
@@ -73,9 +76,23 @@ class RebuildIndexTask : public AdminTask {
 
   nebula::cpp2::ErrorCode invoke(GraphSpaceID space, PartitionID part, const IndexItems& items);
 
+  /**
+   * @brief Whether the index of the part could be built by ingesting sst file. The ingested file
+   * bypasses raft, so it is only allowed when there is no other replica of the part.
+   */
+  bool canIngest(GraphSpaceID space, PartitionID part);
+
+  /**
+   * @brief Sort the index keys collected by buildIndexGlobal into a sst file and ingest it.
+   */
+  nebula::cpp2::ErrorCode ingestIndex(GraphSpaceID space, PartitionID part);
+
  protected:
   GraphSpaceID space_;
   bool changedSpaceGuard_{false};
+  // The parts whose index are built by ingest, index keys are written into the sorter instead of
+  // raft during buildIndexGlobal
+  folly::ConcurrentHashMap<PartitionID, std::shared_ptr<kvstore::SstFileSorter>> sorters_;
 };
 
 }  // namespace storage
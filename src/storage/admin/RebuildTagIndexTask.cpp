@@ -8,6 +8,7 @@
 #include "codec/RowReaderWrapper.h"
 #include "common/utils/IndexKeyUtils.h"
 #include "storage/StorageFlags.h"
+#include "storage/index/HnswIndex.h"
 
 namespace nebula {
 namespace storage {
@@ -61,8 +62,11 @@ nebula::cpp2::ErrorCode RebuildTagIndexTask::buildIndexGlobal(GraphSpaceID space
 
   std::vector<kvstore::KV> data;
   data.reserve(kReserveNum);
+  // The vector indexes are not built from index keys, they are written by atomic op
+  std::vector<std::pair<std::shared_ptr<meta::cpp2::IndexItem>, std::string>> vectorData;
   RowReaderWrapper reader;
   size_t batchSize = 0;
+  size_t vectorBatchSize = 0;
   while (iter && iter->valid()) {
     if (UNLIKELY(canceled_)) {
       LOG(INFO) << "Rebuild Tag Index is Canceled";
@@ -78,6 +82,16 @@ nebula::cpp2::ErrorCode RebuildTagIndexTask::buildIndexGlobal(GraphSpaceID space
       data.clear();
       batchSize = 0;
     }
+    if (vectorBatchSize >= FLAGS_rebuild_index_batch_size) {
+      auto result = writeVectorIndex(
+          space, part, vidSize, std::move(vectorData), vectorBatchSize, rateLimiter);
+      if (result != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        LOG(ERROR) << "Write Part " << part << " Vector Index Failed";
+        return result;
+      }
+      vectorData.clear();
+      vectorBatchSize = 0;
+    }
 
     auto key = iter->key();
     auto val = iter->val();
@@ -117,21 +131,19 @@ nebula::cpp2::ErrorCode RebuildTagIndexTask::buildIndexGlobal(GraphSpaceID space
       continue;
     }
 
-    std::string indexVal = "";
-    if (ttlProp.first) {
-      auto ttlValRet = CommonUtils::ttlValue(schema, reader.get());
-      if (ttlValRet.ok()) {
-        indexVal = IndexKeyUtils::indexVal(std::move(ttlValRet).value());
-      }
-    }
-
     for (const auto& item : items) {
       if (item->get_schema_id().get_tag_id() == tagID) {
+        if (IndexKeyUtils::isVectorIndex(*item)) {
+          vectorBatchSize += key.size() + val.size();
+          vectorData.emplace_back(item, key.str());
+          continue;
+        }
         auto valuesRet = IndexKeyUtils::collectIndexValues(reader.get(), item.get(), schema);
         if (!valuesRet.ok()) {
           LOG(INFO) << "Collect index value failed";
           continue;
         }
+        auto indexVal = CommonUtils::indexValue(schema, reader.get(), item.get());
         auto indexKeys = IndexKeyUtils::vertexIndexKeys(
             vidSize, part, item->get_index_id(), vertex.toString(), std::move(valuesRet).value());
         for (auto& indexKey : indexKeys) {
@@ -148,8 +160,71 @@ nebula::cpp2::ErrorCode RebuildTagIndexTask::buildIndexGlobal(GraphSpaceID space
     LOG(INFO) << "Write Part " << part << " Index Failed";
     return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
   }
+  result =
+      writeVectorIndex(space, part, vidSize, std::move(vectorData), vectorBatchSize, rateLimiter);
+  if (result != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    LOG(INFO) << "Write Part " << part << " Vector Index Failed";
+    return nebula::cpp2::ErrorCode::E_STORE_FAILURE;
+  }
   return nebula::cpp2::ErrorCode::SUCCEEDED;
 }
 
+nebula::cpp2::ErrorCode RebuildTagIndexTask::writeVectorIndex(
+    GraphSpaceID space,
+    PartitionID part,
+    size_t vIdLen,
+    std::vector<std::pair<std::shared_ptr<meta::cpp2::IndexItem>, std::string>> data,
+    size_t batchSize,
+    kvstore::RateLimiter* rateLimiter) {
+  if (data.empty()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  auto atomicOp = [this, space, part, vIdLen, data = std::move(data)]() {
+    kvstore::MergeableAtomicOpResult ret;
+    ret.code = nebula::cpp2::ErrorCode::E_RAFT_ATOMIC_OP_FAILED;
+    std::vector<VectorIndexChange> changes;
+    for (const auto& [item, key] : data) {
+      ret.readSet.emplace_back(key);
+      std::string val;
+      auto code = env_->kvstore_->get(space, part, key, &val);
+      if (code == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+        continue;
+      } else if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        ret.code = code;
+        return ret;
+      }
+      auto tagId = NebulaKeyUtils::getTagId(vIdLen, key);
+      auto reader = RowReaderWrapper::getTagPropReader(env_->schemaMan_, space, tagId, val);
+      auto vId = NebulaKeyUtils::getVertexId(vIdLen, key).str();
+      HnswIndex::collectChange(item, vId, nullptr, &reader, &changes);
+    }
+    auto batchHolder = std::make_unique<kvstore::BatchHolder>();
+    auto code =
+        HnswIndex::applyChanges(env_, space, part, vIdLen, changes, batchHolder.get(), &ret);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      ret.code = code;
+      return ret;
+    }
+    ret.batch = encodeBatchValue(batchHolder->getBatch());
+    ret.code = nebula::cpp2::ErrorCode::SUCCEEDED;
+    return ret;
+  };
+
+  folly::Baton<true, std::atomic> baton;
+  auto result = nebula::cpp2::ErrorCode::SUCCEEDED;
+  rateLimiter->consume(static_cast<double>(batchSize),                             // toConsume
+                       static_cast<double>(FLAGS_rebuild_index_part_rate_limit),   // rate
+                       static_cast<double>(FLAGS_rebuild_index_part_rate_limit));  // burstSize
+  env_->kvstore_->asyncAtomicOp(
+      space, part, std::move(atomicOp), [&result, &baton](nebula::cpp2::ErrorCode code) {
+        if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+          result = code;
+        }
+        baton.post();
+      });
+  baton.wait();
+  return result;
+}
+
 }  // namespace storage
 }  // namespace nebula
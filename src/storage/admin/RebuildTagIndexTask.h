@@ -52,6 +52,20 @@ class RebuildTagIndexTask : public RebuildIndexTask {
                                            PartitionID part,
                                            const IndexItems& items,
                                            kvstore::RateLimiter* rateLimiter) override;
+
+  /**
+   * @brief Insert the vectors of tag rows into the HNSW graph of vector indexes. The rows are read
+   * again in an atomic op, since they may have been modified after scanned.
+   *
+   * @param data Vector index and the key of tag row.
+   */
+  nebula::cpp2::ErrorCode writeVectorIndex(
+      GraphSpaceID space,
+      PartitionID part,
+      size_t vIdLen,
+      std::vector<std::pair<std::shared_ptr<meta::cpp2::IndexItem>, std::string>> data,
+      size_t batchSize,
+      kvstore::RateLimiter* rateLimiter);
 };
 
 }  // namespace storage
@@ -0,0 +1,151 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "storage/exec/IndexGeoKnnScanNode.h"
+
+#include <s2/s2earth.h>
+#include <s2/s2latlng.h>
+
+#include "common/geo/GeoFunction.h"
+#include "common/geo/GeoIndex.h"
+#include "common/utils/IndexKeyUtils.h"
+#include "storage/exec/IndexScanNode.h"
+
+namespace nebula {
+namespace storage {
+
+// The radius of the first ring, in meters
+static constexpr double kInitialRadius = 100.0;
+
+IndexGeoKnnScanNode::IndexGeoKnnScanNode(const IndexGeoKnnScanNode& node)
+    : IndexKnnScanNode(node), query_(node.query_), geoPos_(node.geoPos_) {}
+
+IndexGeoKnnScanNode::IndexGeoKnnScanNode(RuntimeContext* context,
+                                         IndexID indexId,
+                                         const cpp2::GeoKnnQuery& query,
+                                         Expression* filter,
+                                         ::nebula::kvstore::KVStore* kvstore)
+    : IndexKnnScanNode(context, "IndexGeoKnnScanNode", indexId, filter, kvstore), query_(query) {}
+
+::nebula::cpp2::ErrorCode IndexGeoKnnScanNode::init(InitContext& ctx) {
+  auto code = IndexKnnScanNode::init(ctx);
+  if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  const auto& fields = index_->get_fields();
+  if (IndexKeyUtils::isVectorIndex(*index_) || fields.size() != 1 ||
+      fields[0].get_type().get_type() != ::nebula::cpp2::PropertyType::GEOGRAPHY) {
+    return ::nebula::cpp2::ErrorCode::E_INVALID_OPERATION;
+  }
+  // The geography is read from the tag row to compute the exact distance
+  geoPos_ = addColumn(fields[0].get_name());
+  exprCtx_ = std::make_unique<IndexExprContext>(colPos_);
+  return ::nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode IndexGeoKnnScanNode::doExecute(PartitionID partId) {
+  partId_ = partId;
+  rows_.clear();
+  code_ = ::nebula::cpp2::ErrorCode::SUCCEEDED;
+  auto k = static_cast<size_t>(std::max(query_.get_k(), 0));
+  if (k == 0) {
+    code_ = ::nebula::cpp2::ErrorCode::E_INVALID_PARM;
+    return code_;
+  }
+
+  const auto& field = index_->get_fields().front();
+  const auto& type = field.get_type();
+  bool pointsOnly = type.geo_shape_ref().has_value() &&
+                    type.geo_shape_ref().value() == meta::cpp2::GeoShape::POINT;
+  geo::GeoIndex geoIndex(IndexKeyUtils::regionCoverParams(*index_), pointsOnly);
+  Geography point(Point(Coordinate(query_.get_longitude(), query_.get_latitude())));
+  auto center = S2LatLng::FromDegrees(query_.get_latitude(), query_.get_longitude()).ToPoint();
+  auto vIdLen = context_->vIdLen();
+
+  geo::RingScanState state;
+  Set<std::string> visited;
+  std::vector<std::pair<double, Row>> candidates;
+  const double maxRadius = S2Earth::RadiusMeters() * M_PI;
+  double radius = kInitialRadius;
+  while (true) {
+    auto ranges = geoIndex.ring(center, S2Earth::ToAngle(util::units::Meters(radius)), &state);
+    for (auto& range : ranges) {
+      auto hint = range.toIndexColumnHint();
+      hint.column_name_ref() = field.get_name();
+      auto path = Path::make(index_.get(), tag_.back().get(), {hint}, vIdLen);
+      path->resetPart(partId);
+      std::unique_ptr<kvstore::KVIterator> iter;
+      nebula::cpp2::ErrorCode code;
+      if (path->isRange()) {
+        auto rangePath = dynamic_cast<RangePath*>(path.get());
+        code = kvstore_->range(
+            spaceId_, partId, rangePath->getStartKey(), rangePath->getEndKey(), &iter);
+      } else {
+        auto prefixPath = dynamic_cast<PrefixPath*>(path.get());
+        code = kvstore_->prefix(spaceId_, partId, prefixPath->getPrefixKey(), &iter);
+      }
+      if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+        code_ = code;
+        return code_;
+      }
+      for (; iter && iter->valid(); iter->next()) {
+        if (path->qualified(iter->key()) == QualifiedStrategy::INCOMPATIBLE) {
+          continue;
+        }
+        // A geography covered by several cells is only read once
+        auto vId = IndexKeyUtils::getIndexVertexID(vIdLen, iter->key()).str();
+        if (!visited.emplace(vId).second) {
+          continue;
+        }
+        Row row;
+        auto ret = accept(vId, &row);
+        if (!nebula::ok(ret)) {
+          code_ = nebula::error(ret);
+          return code_;
+        }
+        const auto& geog = row.values[geoPos_];
+        if (!nebula::value(ret) || !geog.isGeography()) {
+          continue;
+        }
+        auto dist = geo::GeoFunction::distance(point, geog.getGeography());
+        candidates.emplace_back(dist, std::move(row));
+      }
+    }
+    // The candidates inside the cap are closer than any geography which has not been scanned
+    auto inside = std::count_if(candidates.begin(), candidates.end(), [radius](const auto& c) {
+      return c.first <= radius;
+    });
+    if (static_cast<size_t>(inside) >= k || radius >= maxRadius) {
+      break;
+    }
+    radius = std::min(radius * 2, maxRadius);
+  }
+
+  auto topK = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(),
+                    candidates.begin() + topK,
+                    candidates.end(),
+                    [](const auto& a, const auto& b) { return a.first < b.first; });
+  for (size_t i = 0; i < topK; i++) {
+    emit(std::move(candidates[i].second), candidates[i].first);
+  }
+  return code_;
+}
+
+std::unique_ptr<IndexNode> IndexGeoKnnScanNode::copy() {
+  return std::make_unique<IndexGeoKnnScanNode>(*this);
+}
+
+std::string IndexGeoKnnScanNode::identify() {
+  return fmt::format("{}(IndexID={}, k={}, point=({}, {}), filter=[{}])",
+                     name_,
+                     indexId_,
+                     query_.get_k(),
+                     query_.get_longitude(),
+                     query_.get_latitude(),
+                     filter_ == nullptr ? "" : filter_->toString());
+}
+
+}  // namespace storage
+}  // namespace nebula
@@ -0,0 +1,48 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#ifndef STORAGE_EXEC_INDEXGEOKNNSCANNODE_H
+#define STORAGE_EXEC_INDEXGEOKNNSCANNODE_H
+
+#include "storage/exec/IndexKnnScanNode.h"
+
+namespace nebula {
+namespace storage {
+
+/**
+ * IndexGeoKnnScanNode
+ *
+ * reference: IndexKnnScanNode
+ *
+ * `IndexGeoKnnScanNode` is the leaf node which searches the k nearest vertices to a point in a
+ * geography index. It scans the cells of rings around the point, and doubles the radius until at
+ * least k candidates are found inside the scanned cap, so the geographies outside the cap could
+ * not be closer than them. `_distance` is the distance to the point in meters.
+ *
+ * Member:
+ * `query_`          : the query point and k
+ * `geoPos_`         : position of the indexed geography column in the row
+ */
+class IndexGeoKnnScanNode final : public IndexKnnScanNode {
+ public:
+  IndexGeoKnnScanNode(const IndexGeoKnnScanNode& node);
+  IndexGeoKnnScanNode(RuntimeContext* context,
+                      IndexID indexId,
+                      const cpp2::GeoKnnQuery& query,
+                      Expression* filter,
+                      ::nebula::kvstore::KVStore* kvstore);
+  ::nebula::cpp2::ErrorCode init(InitContext& ctx) override;
+  std::unique_ptr<IndexNode> copy() override;
+  std::string identify() override;
+
+ private:
+  nebula::cpp2::ErrorCode doExecute(PartitionID partId) override;
+
+  cpp2::GeoKnnQuery query_;
+  size_t geoPos_{0};
+};
+
+}  // namespace storage
+}  // namespace nebula
+#endif
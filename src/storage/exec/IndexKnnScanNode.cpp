@@ -0,0 +1,174 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "storage/exec/IndexKnnScanNode.h"
+
+#include "codec/RowReaderWrapper.h"
+#include "common/utils/NebulaKeyUtils.h"
+#include "storage/exec/IndexSelectionNode.h"
+#include "storage/exec/QueryUtils.h"
+
+namespace nebula {
+namespace storage {
+
+IndexKnnScanNode::IndexKnnScanNode(const IndexKnnScanNode& node)
+    : IndexNode(node),
+      indexId_(node.indexId_),
+      index_(node.index_),
+      tag_(node.tag_),
+      ttlProps_(node.ttlProps_),
+      filter_(node.filter_ == nullptr ? nullptr : node.filter_->clone()),
+      kvstore_(node.kvstore_),
+      requiredColumns_(node.requiredColumns_),
+      columns_(node.columns_),
+      colPos_(node.colPos_) {
+  exprCtx_ = std::make_unique<IndexExprContext>(colPos_);
+}
+
+IndexKnnScanNode::IndexKnnScanNode(RuntimeContext* context,
+                                   const std::string& name,
+                                   IndexID indexId,
+                                   Expression* filter,
+                                   ::nebula::kvstore::KVStore* kvstore)
+    : IndexNode(context, name),
+      indexId_(indexId),
+      filter_(filter == nullptr ? nullptr : filter->clone()),
+      kvstore_(kvstore) {}
+
+::nebula::cpp2::ErrorCode IndexKnnScanNode::init(InitContext& ctx) {
+  auto env = context_->env();
+  auto indexVal = env->indexMan_->getTagIndex(spaceId_, indexId_);
+  if (!indexVal.ok()) {
+    return ::nebula::cpp2::ErrorCode::E_INDEX_NOT_FOUND;
+  }
+  index_ = indexVal.value();
+  auto allSchema = env->schemaMan_->getAllVerTagSchema(spaceId_);
+  auto tagId = index_->get_schema_id().get_tag_id();
+  if (!allSchema.ok() || !allSchema.value().count(tagId)) {
+    return ::nebula::cpp2::ErrorCode::E_TAG_NOT_FOUND;
+  }
+  tag_ = allSchema.value().at(tagId);
+  ttlProps_ = CommonUtils::ttlProps(tag_.back().get());
+
+  for (auto& col : ctx.requiredColumns) {
+    requiredColumns_.push_back(col);
+  }
+  ctx.returnColumns = requiredColumns_;
+  for (size_t i = 0; i < ctx.returnColumns.size(); i++) {
+    ctx.retColMap[ctx.returnColumns[i]] = i;
+  }
+  columns_ = requiredColumns_;
+  colPos_ = ctx.retColMap;
+  if (filter_ != nullptr) {
+    SelectionExprVisitor vis;
+    filter_->accept(&vis);
+    for (auto& col : vis.getRequiredColumns()) {
+      addColumn(col);
+    }
+  }
+  exprCtx_ = std::make_unique<IndexExprContext>(colPos_);
+  return ::nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+size_t IndexKnnScanNode::addColumn(const std::string& col) {
+  auto iter = colPos_.find(col);
+  if (iter != colPos_.end()) {
+    return iter->second;
+  }
+  colPos_[col] = columns_.size();
+  columns_.push_back(col);
+  return columns_.size() - 1;
+}
+
+IndexNode::Result IndexKnnScanNode::doNext() {
+  if (code_ != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return Result(code_);
+  }
+  if (rows_.empty()) {
+    return Result();
+  }
+  Row row = std::move(rows_.front());
+  rows_.pop_front();
+  return Result(std::move(row));
+}
+
+nebula::cpp2::ErrorCode IndexKnnScanNode::readRow(const std::string& vId, Row* row) {
+  auto key = NebulaKeyUtils::tagKey(context_->vIdLen(), partId_, vId, context_->tagId_);
+  std::string val;
+  auto code = kvstore_->get(spaceId_, partId_, key, &val);
+  if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  auto reader = RowReaderWrapper::getRowReader(tag_, val);
+  if (reader == nullptr) {
+    LOG(WARNING) << "Bad format row of vertex " << folly::hexlify(vId);
+    return ::nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+  }
+  if (ttlProps_.first &&
+      CommonUtils::checkDataExpiredForTTL(
+          tag_.back().get(), reader.get(), ttlProps_.second.second, ttlProps_.second.first)) {
+    return ::nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+  }
+  row->values.clear();
+  row->values.reserve(columns_.size());
+  for (auto& col : columns_) {
+    switch (QueryUtils::toReturnColType(col)) {
+      case QueryUtils::ReturnColType::kVid: {
+        if (context_->isIntId()) {
+          row->values.emplace_back(*reinterpret_cast<const int64_t*>(vId.data()));
+        } else {
+          row->values.emplace_back(vId.substr(0, vId.find_first_of('\0')));
+        }
+      } break;
+      case QueryUtils::ReturnColType::kTag: {
+        row->values.emplace_back(context_->tagId_);
+      } break;
+      case QueryUtils::ReturnColType::kOther: {
+        auto field = tag_.back()->field(col);
+        if (col == kDistance || field == nullptr) {
+          row->values.emplace_back(Value::kNullUnknownProp);
+        } else {
+          auto retVal = QueryUtils::readValue(reader.get(), col, field);
+          if (!retVal.ok()) {
+            return ::nebula::cpp2::ErrorCode::E_INVALID_DATA;
+          }
+          row->values.emplace_back(std::move(retVal).value());
+        }
+      } break;
+      default:
+        row->values.emplace_back(Value::kNullUnknownProp);
+    }
+  }
+  return ::nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, bool> IndexKnnScanNode::accept(const std::string& vId,
+                                                                 Row* row) {
+  auto code = readRow(vId, row);
+  if (code == ::nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    return false;
+  } else if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  if (filter_ != nullptr) {
+    exprCtx_->setRow(*row);
+    auto& result = filter_->eval(*exprCtx_);
+    if (result.type() != Value::Type::BOOL || !result.getBool()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void IndexKnnScanNode::emit(Row row, double distance) {
+  auto distPos = colPos_.find(kDistance);
+  if (distPos != colPos_.end()) {
+    row.values[distPos->second] = Value(distance);
+  }
+  row.values.resize(requiredColumns_.size());
+  rows_.emplace_back(std::move(row));
+}
+
+}  // namespace storage
+}  // namespace nebula
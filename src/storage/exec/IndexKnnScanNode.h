@@ -0,0 +1,72 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#ifndef STORAGE_EXEC_INDEXKNNSCANNODE_H
+#define STORAGE_EXEC_INDEXKNNSCANNODE_H
+
+#include "common/base/Base.h"
+#include "common/expression/Expression.h"
+#include "storage/exec/IndexExprContext.h"
+#include "storage/exec/IndexNode.h"
+
+namespace nebula {
+namespace storage {
+
+/**
+ * IndexKnnScanNode
+ *
+ * reference: IndexNode
+ *
+ * `IndexKnnScanNode` is the base of the leaf nodes which return the k nearest vertices of a tag
+ * index to a query. The derived node searches the candidates of current part in `doExecute`, and
+ * emits the top k rows ordered by distance ascending. Each candidate is read from its tag row, so
+ * the filter and ttl are evaluated before it is counted in the top k.
+ *
+ * Member:
+ * `filter_`         : filter on the tag properties, could be nullptr
+ * `requiredColumns_`: columns returned to parent node, `_distance` is the distance to the query
+ * `columns_`        : requiredColumns_ and the properties which are only used by filter or search
+ * `rows_`           : top k rows of current part, ordered by distance ascending
+ */
+class IndexKnnScanNode : public IndexNode {
+ public:
+  IndexKnnScanNode(const IndexKnnScanNode& node);
+  IndexKnnScanNode(RuntimeContext* context,
+                   const std::string& name,
+                   IndexID indexId,
+                   Expression* filter,
+                   ::nebula::kvstore::KVStore* kvstore);
+  ::nebula::cpp2::ErrorCode init(InitContext& ctx) override;
+
+ protected:
+  Result doNext() override;
+  // Add a column which is only used by the derived node, return its position in the row
+  size_t addColumn(const std::string& col);
+  // Read the tag row of the padded vid, E_KEY_NOT_FOUND if it does not exist or is expired
+  nebula::cpp2::ErrorCode readRow(const std::string& vId, Row* row);
+  // Read the tag row and evaluate the filter, false if the vertex should be skipped
+  ErrorOr<nebula::cpp2::ErrorCode, bool> accept(const std::string& vId, Row* row);
+  // Fill `_distance` of the row and append it to the result of current part
+  void emit(Row row, double distance);
+
+  using TagSchemas = std::vector<std::shared_ptr<const nebula::meta::NebulaSchemaProvider>>;
+  IndexID indexId_;
+  std::shared_ptr<meta::cpp2::IndexItem> index_;
+  TagSchemas tag_;
+  std::pair<bool, std::pair<int64_t, std::string>> ttlProps_;
+  Expression* filter_{nullptr};
+  ::nebula::kvstore::KVStore* kvstore_;
+  std::vector<std::string> requiredColumns_;
+  std::vector<std::string> columns_;
+  Map<std::string, size_t> colPos_;
+  std::unique_ptr<IndexExprContext> exprCtx_;
+
+  PartitionID partId_;
+  nebula::cpp2::ErrorCode code_{nebula::cpp2::ErrorCode::SUCCEEDED};
+  std::deque<Row> rows_;
+};
+
+}  // namespace storage
+}  // namespace nebula
+#endif
@@ -326,6 +326,7 @@ QualifiedStrategy::Result PrefixPath::qualified(const Map<std::string, Value>& r
 void PrefixPath::resetPart(PartitionID partId) {
   std::string p = IndexKeyUtils::indexPrefix(partId);
   prefix_ = prefix_.replace(0, p.size(), p);
+  endKey_ = endKey_.replace(0, p.size(), p);
 }
 
 void PrefixPath::buildKey() {
@@ -348,6 +349,8 @@ void PrefixPath::buildKey() {
     }
   }
   prefix_ = std::move(common);
+  // The length of index key is fixed, so it is greater than all keys with prefix_
+  endKey_ = prefix_ + std::string(totalKeyLength_ - prefix_.size() + 1, '\xFF');
 }
 
 // End of PrefixPath
@@ -359,18 +362,24 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
       indexId_(node.indexId_),
       index_(node.index_),
       columnHints_(node.columnHints_),
+      rangeHints_(node.rangeHints_),
+      skipScan_(node.skipScan_),
       kvstore_(node.kvstore_),
       indexNullable_(node.indexNullable_),
       requiredColumns_(node.requiredColumns_),
       requiredAndHintColumns_(node.requiredAndHintColumns_),
       ttlProps_(node.ttlProps_),
       needAccessBase_(node.needAccessBase_),
-      colPosMap_(node.colPosMap_) {
-  if (node.path_->isRange()) {
-    path_ = std::make_unique<RangePath>(*dynamic_cast<RangePath*>(node.path_.get()));
-  } else {
-    path_ = std::make_unique<PrefixPath>(*dynamic_cast<PrefixPath*>(node.path_.get()));
+      colPosMap_(node.colPosMap_),
+      includedColPos_(node.includedColPos_) {
+  for (auto& path : node.paths_) {
+    if (path->isRange()) {
+      paths_.emplace_back(std::make_unique<RangePath>(*dynamic_cast<RangePath*>(path.get())));
+    } else {
+      paths_.emplace_back(std::make_unique<PrefixPath>(*dynamic_cast<PrefixPath*>(path.get())));
+    }
   }
+  path_ = paths_.empty() ? nullptr : paths_.front().get();
 }
 
 ::nebula::cpp2::ErrorCode IndexScanNode::init(InitContext& ctx) {
@@ -381,6 +390,23 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
   for (auto& hint : columnHints_) {
     requiredAndHintColumns_.insert(hint.get_column_name());
   }
+  for (auto& hints : rangeHints_) {
+    for (auto& hint : hints) {
+      requiredAndHintColumns_.insert(hint.get_column_name());
+    }
+  }
+  if (skipScan_) {
+    // Only the leading field of fixed length could be decoded from index key exactly
+    const auto& fields = index_->get_fields();
+    if (fields.size() <= columnHints_.size()) {
+      return ::nebula::cpp2::ErrorCode::E_INVALID_PARM;
+    }
+    auto type = IndexKeyUtils::toValueType(fields.front().get_type().get_type());
+    if (type == Value::Type::STRING || type == Value::Type::GEOGRAPHY) {
+      return ::nebula::cpp2::ErrorCode::E_UNSUPPORTED;
+    }
+    requiredAndHintColumns_.insert(fields.front().get_name());
+  }
   for (auto& col : ctx.requiredColumns) {
     requiredColumns_.push_back(col);
   }
@@ -406,6 +432,16 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
     }
     tmp.erase(field.get_name());
   }
+  // The included props of a covering index are stored in index value
+  const auto* params = index_->get_index_params();
+  if (params != nullptr && params->included_fields_ref().has_value()) {
+    const auto& included = *params->included_fields_ref();
+    for (size_t i = 0; i < included.size(); i++) {
+      if (tmp.erase(included[i]) > 0 && colPosMap_.count(included[i])) {
+        includedColPos_.emplace_back(i, colPosMap_[included[i]]);
+      }
+    }
+  }
   tmp.erase(kVid);
   tmp.erase(kTag);
   tmp.erase(kRank);
@@ -413,7 +449,20 @@ IndexScanNode::IndexScanNode(const IndexScanNode& node)
   tmp.erase(kDst);
   tmp.erase(kType);
   needAccessBase_ = !tmp.empty();
-  path_ = Path::make(index_.get(), getSchema().back().get(), columnHints_, context_->vIdLen());
+  // The paths of skip scan are built by the leading values during iteration
+  if (!skipScan_ && rangeHints_.empty()) {
+    paths_.emplace_back(
+        Path::make(index_.get(), getSchema().back().get(), columnHints_, context_->vIdLen()));
+  } else if (!skipScan_) {
+    for (auto& hints : rangeHints_) {
+      paths_.emplace_back(
+          Path::make(index_.get(), getSchema().back().get(), hints, context_->vIdLen()));
+    }
+    std::sort(paths_.begin(), paths_.end(), [](const auto& a, const auto& b) {
+      return a->getStartKey() < b->getStartKey();
+    });
+  }
+  path_ = paths_.empty() ? nullptr : paths_.front().get();
   return ::nebula::cpp2::ErrorCode::SUCCEEDED;
 }
 
@@ -425,19 +474,23 @@ nebula::cpp2::ErrorCode IndexScanNode::doExecute(PartitionID partId) {
 
 IndexNode::Result IndexScanNode::doNext() {
   for (; iter_ && iter_->valid(); iter_->next()) {
+    if (!locate()) {
+      break;
+    }
     if (!checkTTL()) {
       continue;
     }
-    auto q = path_->qualified(iter_->key());
+    auto q = qualified(iter_->key());
     if (q == QualifiedStrategy::INCOMPATIBLE) {
       continue;
     }
     bool compatible = q == QualifiedStrategy::COMPATIBLE;
     if (compatible && !needAccessBase_) {
-      auto key = iter_->key().toString();
-      iter_->next();
-      Row row = decodeFromIndex(key);
-      return Result(std::move(row));
+      Row row = decodeFromIndex(iter_->key());
+      if (decodeIncludedFromIndex(iter_->val(), row.values)) {
+        iter_->next();
+        return Result(std::move(row));
+      }
     }
     std::pair<std::string, std::string> kv;
     auto ret = getBaseData(iter_->key(), kv);
@@ -454,7 +507,7 @@ IndexNode::Result IndexScanNode::doNext() {
     }
     Map<std::string, Value> rowData = decodeFromBase(kv.first, kv.second);
     if (!compatible) {
-      q = path_->qualified(rowData);
+      q = qualified(rowData);
       CHECK(q != QualifiedStrategy::UNCERTAIN);
       if (q == QualifiedStrategy::INCOMPATIBLE) {
         continue;
@@ -485,18 +538,134 @@ bool IndexScanNode::checkTTL() {
 }
 
 nebula::cpp2::ErrorCode IndexScanNode::resetIter(PartitionID partId) {
-  path_->resetPart(partId);
   nebula::cpp2::ErrorCode ret = nebula::cpp2::ErrorCode::SUCCEEDED;
-  if (path_->isRange()) {
-    auto rangePath = dynamic_cast<RangePath*>(path_.get());
+  if (skipScan_) {
+    paths_.clear();
+    path_ = nullptr;
+    auto prefix = IndexKeyUtils::indexPrefix(partId, index_->get_index_id());
+    return kvstore_->prefix(spaceId_, partId, prefix, &iter_);
+  }
+  for (auto& path : paths_) {
+    path->resetPart(partId);
+  }
+  pathIdx_ = 0;
+  path_ = paths_.front().get();
+  if (paths_.size() > 1) {
+    // All the ranges are visited by one iterator, see `locate`
+    auto last = std::max_element(paths_.begin(), paths_.end(), [](const auto& a, const auto& b) {
+      return a->getEndKey() < b->getEndKey();
+    });
+    ret = kvstore_->range(spaceId_, partId, path_->getStartKey(), (*last)->getEndKey(), &iter_);
+  } else if (path_->isRange()) {
+    auto rangePath = dynamic_cast<RangePath*>(path_);
     kvstore_->range(spaceId_, partId, rangePath->getStartKey(), rangePath->getEndKey(), &iter_);
   } else {
-    auto prefixPath = dynamic_cast<PrefixPath*>(path_.get());
+    auto prefixPath = dynamic_cast<PrefixPath*>(path_);
     ret = kvstore_->prefix(spaceId_, partId, prefixPath->getPrefixKey(), &iter_);
   }
   return ret;
 }
 
+bool IndexScanNode::locate() {
+  if (skipScan_) {
+    return locateSkipScan();
+  }
+  // The iterator of a single path only returns the keys in its range
+  if (paths_.size() == 1) {
+    return true;
+  }
+  while (iter_->valid()) {
+    auto key = iter_->key();
+    while (pathIdx_ < paths_.size() && key >= folly::StringPiece(paths_[pathIdx_]->getEndKey())) {
+      pathIdx_++;
+    }
+    if (pathIdx_ == paths_.size()) {
+      return false;
+    }
+    path_ = paths_[pathIdx_].get();
+    if (key >= folly::StringPiece(path_->getStartKey())) {
+      return true;
+    }
+    iter_->seek(path_->getStartKey());
+  }
+  return false;
+}
+
+bool IndexScanNode::locateSkipScan() {
+  const auto& leading = index_->get_fields().front();
+  auto type = IndexKeyUtils::toValueType(leading.get_type().get_type());
+  auto leadingLen =
+      IndexKeyUtils::encodeNullValue(type, leading.get_type().get_type_length()).size();
+  size_t suffixLen = index_->get_schema_id().tag_id_ref().has_value()
+                         ? context_->vIdLen()
+                         : context_->vIdLen() * 2 + sizeof(EdgeRanking);
+  while (iter_->valid()) {
+    auto key = iter_->key();
+    if (path_ == nullptr || key >= folly::StringPiece(path_->getEndKey())) {
+      // Build the path of the leading value of current key
+      std::vector<Value> values(1);
+      decodePropFromIndex(
+          key.subpiece(0, key.size() - suffixLen), {{leading.get_name(), 0}}, values);
+      std::vector<cpp2::IndexColumnHint> hints;
+      hints.reserve(columnHints_.size() + 1);
+      auto& hint = hints.emplace_back();
+      hint.column_name_ref() = leading.get_name();
+      hint.scan_type_ref() = cpp2::ScanType::PREFIX;
+      hint.begin_value_ref() = std::move(values[0]);
+      hints.insert(hints.end(), columnHints_.begin(), columnHints_.end());
+      paths_.clear();
+      paths_.emplace_back(
+          Path::make(index_.get(), getSchema().back().get(), hints, context_->vIdLen()));
+      path_ = paths_.back().get();
+      path_->resetPart(partId_);
+      if (key >= folly::StringPiece(path_->getEndKey())) {
+        // No more key of the leading value is in range, seek to the next leading value
+        auto next = key.subpiece(0, sizeof(PartitionID) + sizeof(IndexID) + leadingLen).str();
+        next.append(key.size(), '\xFF');
+        iter_->seek(next);
+        continue;
+      }
+    }
+    if (key >= folly::StringPiece(path_->getStartKey())) {
+      return true;
+    }
+    iter_->seek(path_->getStartKey());
+  }
+  return false;
+}
+
+template <typename T>
+QualifiedStrategy::Result IndexScanNode::qualified(const T& data) {
+  auto ret = path_->qualified(data);
+  // The ranges may overlap, e.g. the truncated strings, so the key is qualified if any path
+  // containing it qualifies it
+  auto key = iter_->key();
+  for (size_t i = pathIdx_ + 1; i < paths_.size() && ret != QualifiedStrategy::COMPATIBLE; i++) {
+    auto* path = paths_[i].get();
+    if (key < folly::StringPiece(path->getStartKey())) {
+      break;
+    }
+    if (key < folly::StringPiece(path->getEndKey())) {
+      ret = std::max(ret, path->qualified(data));
+    }
+  }
+  return ret;
+}
+
+bool IndexScanNode::decodeIncludedFromIndex(folly::StringPiece value, std::vector<Value>& values) {
+  if (includedColPos_.empty()) {
+    return true;
+  }
+  auto included = IndexKeyUtils::parseIndexIncluded(value);
+  for (auto& [includedPos, colPos] : includedColPos_) {
+    if (includedPos >= included.size()) {
+      return false;
+    }
+    values[colPos] = std::move(included[includedPos]);
+  }
+  return true;
+}
+
 void IndexScanNode::decodePropFromIndex(folly::StringPiece key,
                                         const Map<std::string, size_t>& colPosMap,
                                         std::vector<Value>& values) {
@@ -559,7 +728,19 @@ void IndexScanNode::decodePropFromIndex(folly::StringPiece key,
 }
 
 std::string IndexScanNode::identify() {
-  return fmt::format("{}(IndexID={}, Path=({}))", name_, indexId_, path_->toString());
+  if (skipScan_) {
+    std::vector<std::string> columns;
+    for (auto& hint : columnHints_) {
+      columns.emplace_back(hint.get_column_name());
+    }
+    return fmt::format(
+        "{}(IndexID={}, SkipScan=({}))", name_, indexId_, folly::join(", ", columns));
+  }
+  std::vector<std::string> paths;
+  for (auto& path : paths_) {
+    paths.emplace_back(fmt::format("({})", path->toString()));
+  }
+  return fmt::format("{}(IndexID={}, Path={})", name_, indexId_, folly::join(" ", paths));
 }
 
 // End of IndexScan
@@ -70,6 +70,27 @@ class IndexScanNode : public IndexNode {
   ::nebula::cpp2::ErrorCode init(InitContext& ctx) override;
   std::string identify() override;
 
+  /**
+   * @brief scan several ranges of the index instead of `columnHints`
+   *
+   * Each element is the column hints of a range. All ranges are visited in key order by one
+   * iterator, which seeks to the start of next range rather than being recreated.
+   */
+  void setRangeHints(const std::vector<std::vector<cpp2::IndexColumnHint>>& rangeHints) {
+    rangeHints_ = rangeHints;
+  }
+
+  /**
+   * @brief skip the leading field of index, `columnHints` begin from the second field
+   *
+   * For each distinct value of the leading field, a path is built by the value and `columnHints`,
+   * and the iterator seeks to its start. It is only efficient when the leading field has few
+   * distinct values.
+   */
+  void setSkipScan(bool skipScan) {
+    skipScan_ = skipScan;
+  }
+
  protected:
   nebula::cpp2::ErrorCode doExecute(PartitionID partId) final;
   Result doNext() final;
@@ -98,6 +119,15 @@ class IndexScanNode : public IndexNode {
    */
   virtual Row decodeFromIndex(folly::StringPiece key) = 0;
 
+  /**
+   * @brief decode the included props of a covering index from index value
+   *
+   * @param value index value
+   * @param values row decoded from index key
+   * @return false if the index value does not contain the included props
+   */
+  bool decodeIncludedFromIndex(folly::StringPiece value, std::vector<Value>& values);
+
   /**
    * @brief get the base data key-value according to index key
    *
@@ -135,6 +165,25 @@ class IndexScanNode : public IndexNode {
    * @see Path
    */
   nebula::cpp2::ErrorCode resetIter(PartitionID partId);
+
+  /**
+   * @brief move iterator to the first key not less than current one which is in the range of a
+   * path, and make the path current
+   *
+   * @return false if there is no more key in any path
+   */
+  bool locate();
+
+  /**
+   * @brief `locate` of skip scan, the path of the leading value of key is built if necessary
+   */
+  bool locateSkipScan();
+
+  /**
+   * @brief qualify current key or its base data by all the paths whose range contains the key
+   */
+  template <typename T>
+  QualifiedStrategy::Result qualified(const T& data);
   PartitionID partId_;
   /**
    * @brief index_ in this Node to access
@@ -146,9 +195,20 @@ class IndexScanNode : public IndexNode {
   std::shared_ptr<nebula::meta::cpp2::IndexItem> index_;
   const std::vector<cpp2::IndexColumnHint>& columnHints_;
   /**
+   * @brief column hints of each range, scan `columnHints_` if empty
+   */
+  std::vector<std::vector<cpp2::IndexColumnHint>> rangeHints_;
+  bool skipScan_{false};
+  /**
+   * @brief paths of all ranges ordered by start key, the path of current leading value if skip scan
    * @see Path
    */
-  std::unique_ptr<Path> path_;
+  std::vector<std::unique_ptr<Path>> paths_;
+  /**
+   * @brief current path and its position in `paths_`
+   */
+  Path* path_{nullptr};
+  size_t pathIdx_{0};
   /**
    * @brief current kvstore iterator.It while be reset `doExecute` and iterated during `doNext`
    */
@@ -173,6 +233,10 @@ class IndexScanNode : public IndexNode {
   bool needAccessBase_{false};
   bool fatalOnBaseNotFound_{false};
   Map<std::string, size_t> colPosMap_;
+  /**
+   * @brief pairs of position in the included props of index and position in the returned row
+   */
+  std::vector<std::pair<size_t, size_t>> includedColPos_;
 };
 class QualifiedStrategy {
  public:
@@ -401,6 +465,12 @@ class Path {
    */
   virtual void resetPart(PartitionID partId) = 0;
 
+  /**
+   * @brief all index keys of the path are in [getStartKey(), getEndKey())
+   */
+  virtual const std::string& getStartKey() = 0;
+  virtual const std::string& getEndKey() = 0;
+
   /**
    * @brief Seralize Path to string
    *
@@ -507,11 +577,23 @@ class PrefixPath : public Path {
     return prefix_;
   }
 
+  const std::string& getStartKey() override {
+    return prefix_;
+  }
+
+  const std::string& getEndKey() override {
+    return endKey_;
+  }
+
  private:
   /**
    * @brief the bytes who is used to query in kvstore
    */
   std::string prefix_;
+  /**
+   * @brief the key greater than all keys with prefix_
+   */
+  std::string endKey_;
 
   /**
    * @brief build prefix_
@@ -543,11 +625,11 @@ class RangePath : public Path {
     return includeEnd_;
   }
 
-  inline const std::string& getStartKey() {
+  inline const std::string& getStartKey() override {
     return startKey_;
   }
 
-  inline const std::string& getEndKey() {
+  inline const std::string& getEndKey() override {
     return endKey_;
   }
 
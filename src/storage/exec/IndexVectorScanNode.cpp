@@ -0,0 +1,100 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#include "storage/exec/IndexVectorScanNode.h"
+
+#include "common/utils/IndexKeyUtils.h"
+#include "storage/StorageFlags.h"
+#include "storage/index/HnswIndex.h"
+
+namespace nebula {
+namespace storage {
+
+IndexVectorScanNode::IndexVectorScanNode(const IndexVectorScanNode& node)
+    : IndexKnnScanNode(node), query_(node.query_) {}
+
+IndexVectorScanNode::IndexVectorScanNode(RuntimeContext* context,
+                                         IndexID indexId,
+                                         const cpp2::VectorQuery& query,
+                                         Expression* filter,
+                                         ::nebula::kvstore::KVStore* kvstore)
+    : IndexKnnScanNode(context, "IndexVectorScanNode", indexId, filter, kvstore), query_(query) {}
+
+::nebula::cpp2::ErrorCode IndexVectorScanNode::init(InitContext& ctx) {
+  auto code = IndexKnnScanNode::init(ctx);
+  if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  if (!IndexKeyUtils::isVectorIndex(*index_)) {
+    return ::nebula::cpp2::ErrorCode::E_INVALID_OPERATION;
+  }
+  return ::nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode IndexVectorScanNode::doExecute(PartitionID partId) {
+  partId_ = partId;
+  rows_.clear();
+  code_ = ::nebula::cpp2::ErrorCode::SUCCEEDED;
+  auto k = query_.get_k();
+  auto ef = query_.ef_ref().value_or(FLAGS_vector_index_ef_search);
+  if (k <= 0 || ef <= 0) {
+    code_ = ::nebula::cpp2::ErrorCode::E_INVALID_PARM;
+    return code_;
+  }
+
+  // The rows of candidates which have been read by filter
+  Map<std::string, Row> cache;
+  std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)> filter;
+  if (filter_ != nullptr || ttlProps_.first) {
+    filter = [this, &cache](const std::string& vId) -> ErrorOr<nebula::cpp2::ErrorCode, bool> {
+      Row row;
+      auto ret = accept(vId, &row);
+      if (nebula::ok(ret) && nebula::value(ret)) {
+        cache.emplace(vId, std::move(row));
+      }
+      return ret;
+    };
+  }
+
+  HnswIndex hnsw(kvstore_, spaceId_, partId, context_->vIdLen(), *index_);
+  std::vector<float> vec(query_.get_vector().begin(), query_.get_vector().end());
+  auto ret = hnsw.search(std::move(vec), k, ef, filter);
+  if (!nebula::ok(ret)) {
+    code_ = nebula::error(ret);
+    return code_;
+  }
+  for (auto& [vId, dist] : nebula::value(ret)) {
+    Row row;
+    auto iter = cache.find(vId);
+    if (iter != cache.end()) {
+      row = std::move(iter->second);
+    } else {
+      auto code = readRow(vId, &row);
+      if (code == ::nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+        continue;
+      } else if (code != ::nebula::cpp2::ErrorCode::SUCCEEDED) {
+        code_ = code;
+        return code_;
+      }
+    }
+    emit(std::move(row), hnsw.userDistance(dist));
+  }
+  return code_;
+}
+
+std::unique_ptr<IndexNode> IndexVectorScanNode::copy() {
+  return std::make_unique<IndexVectorScanNode>(*this);
+}
+
+std::string IndexVectorScanNode::identify() {
+  return fmt::format("{}(IndexID={}, k={}, dim={}, filter=[{}])",
+                     name_,
+                     indexId_,
+                     query_.get_k(),
+                     query_.get_vector().size(),
+                     filter_ == nullptr ? "" : filter_->toString());
+}
+
+}  // namespace storage
+}  // namespace nebula
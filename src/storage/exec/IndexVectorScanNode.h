@@ -0,0 +1,45 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+#ifndef STORAGE_EXEC_INDEXVECTORSCANNODE_H
+#define STORAGE_EXEC_INDEXVECTORSCANNODE_H
+
+#include "storage/exec/IndexKnnScanNode.h"
+
+namespace nebula {
+namespace storage {
+
+/**
+ * IndexVectorScanNode
+ *
+ * reference: IndexKnnScanNode
+ *
+ * `IndexVectorScanNode` is the leaf node which searches the approximate k nearest neighbors of the
+ * query vector in the HNSW graph of a vector index. The filter is evaluated on the tag row of each
+ * candidate during the search, so the top k are chosen among the vertices which pass the filter.
+ *
+ * Member:
+ * `query_`          : the query vector, k and ef
+ */
+class IndexVectorScanNode final : public IndexKnnScanNode {
+ public:
+  IndexVectorScanNode(const IndexVectorScanNode& node);
+  IndexVectorScanNode(RuntimeContext* context,
+                      IndexID indexId,
+                      const cpp2::VectorQuery& query,
+                      Expression* filter,
+                      ::nebula::kvstore::KVStore* kvstore);
+  ::nebula::cpp2::ErrorCode init(InitContext& ctx) override;
+  std::unique_ptr<IndexNode> copy() override;
+  std::string identify() override;
+
+ private:
+  nebula::cpp2::ErrorCode doExecute(PartitionID partId) override;
+
+  cpp2::VectorQuery query_;
+};
+
+}  // namespace storage
+}  // namespace nebula
+#endif
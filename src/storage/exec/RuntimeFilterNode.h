@@ -0,0 +1,106 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef STORAGE_EXEC_RUNTIMEFILTERNODE_H_
+#define STORAGE_EXEC_RUNTIMEFILTERNODE_H_
+
+#include "common/algorithm/BloomFilter.h"
+#include "common/base/Base.h"
+#include "common/utils/NebulaKeyUtils.h"
+#include "interface/gen-cpp2/storage_types.h"
+#include "storage/exec/RelNode.h"
+
+namespace nebula {
+namespace storage {
+
+/*
+RuntimeDstFilter is decoded from the runtime filter in request, which is built by graph from the
+join keys of the other side of a join. The vid is tested by its raw bytes, which are the 8 bytes
+of int64 for int vid, or the string without padding for string vid.
+*/
+class RuntimeDstFilter final {
+ public:
+  nebula::cpp2::ErrorCode init(const cpp2::RuntimeFilter& filter, bool isIntId) {
+    if (filter.keys_ref().has_value()) {
+      for (const auto& key : *filter.keys_ref()) {
+        // The keys of other types never match any vid
+        if (isIntId && key.isInt()) {
+          auto vid = key.getInt();
+          keys_.emplace(reinterpret_cast<const char*>(&vid), sizeof(int64_t));
+        } else if (!isIntId && key.isStr()) {
+          keys_.emplace(key.getStr());
+        }
+      }
+      return nebula::cpp2::ErrorCode::SUCCEEDED;
+    }
+    if (!filter.bloom_ref().has_value() || !filter.num_hashes_ref().has_value()) {
+      return nebula::cpp2::ErrorCode::E_INVALID_FILTER;
+    }
+    auto ret = algorithm::BloomFilter::fromBits(*filter.bloom_ref(), *filter.num_hashes_ref());
+    if (!ret.ok()) {
+      return nebula::cpp2::ErrorCode::E_INVALID_FILTER;
+    }
+    bloom_ = std::make_unique<algorithm::BloomFilter>(std::move(ret).value());
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+  bool mayContain(folly::StringPiece vid) const {
+    if (bloom_ != nullptr) {
+      return bloom_->mayContain(vid);
+    }
+    return keys_.find(vid.str()) != keys_.end();
+  }
+
+ private:
+  std::unordered_set<std::string> keys_;
+  std::unique_ptr<algorithm::BloomFilter> bloom_;
+};
+
+/*
+RuntimeFilterNode skips the edges whose dst could not pass the runtime filter. It is placed right
+after the HashJoinNode of GetNeighbors, so the edges dropped are neither evaluated by FilterNode
+nor serialized into the response.
+*/
+template <typename T>
+class RuntimeFilterNode : public IterateNode<T> {
+ public:
+  using RelNode<T>::doExecute;
+
+  RuntimeFilterNode(RuntimeContext* context,
+                    IterateNode<T>* upstream,
+                    const RuntimeDstFilter* filter)
+      : IterateNode<T>(upstream), context_(context), filter_(filter) {
+    IterateNode<T>::name_ = "RuntimeFilterNode";
+  }
+
+  nebula::cpp2::ErrorCode doExecute(PartitionID partId, const T& vId) override {
+    auto ret = RelNode<T>::doExecute(partId, vId);
+    if (ret != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return ret;
+    }
+    if (this->valid() && !check()) {
+      this->next();
+    }
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+ private:
+  bool check() override {
+    auto dst = NebulaKeyUtils::getDstId(context_->vIdLen(), this->key());
+    if (!context_->isIntId()) {
+      dst = dst.subpiece(0, dst.find('\0'));
+    }
+    return filter_->mayContain(dst);
+  }
+
+ private:
+  RuntimeContext* context_;
+  const RuntimeDstFilter* filter_;
+};
+
+}  // namespace storage
+}  // namespace nebula
+
+#endif  // STORAGE_EXEC_RUNTIMEFILTERNODE_H_
@@ -14,6 +14,7 @@
 #include "storage/context/StorageExpressionContext.h"
 #include "storage/exec/FilterNode.h"
 #include "storage/exec/TagNode.h"
+#include "storage/index/HnswIndex.h"
 
 namespace nebula {
 namespace storage {
@@ -278,8 +279,22 @@ class UpdateTagNode : public UpdateNode<VertexID> {
       ret = code;
       baton.post();
     };
-    context_->env()->kvstore_->asyncAppendBatch(
-        context_->spaceId(), partId, std::move(batch).value(), callback);
+    if (!vectorChanges_.empty()) {
+      // The HNSW graph is read when updating the vector, so it has to be an atomic op
+      auto atomicOp = [this, partId, batch = std::move(batch).value()]() {
+        return HnswIndex::atomicOp(context_->env(),
+                                   context_->spaceId(),
+                                   partId,
+                                   context_->vIdLen(),
+                                   batch,
+                                   vectorChanges_);
+      };
+      context_->env()->kvstore_->asyncAtomicOp(
+          context_->spaceId(), partId, std::move(atomicOp), callback);
+    } else {
+      context_->env()->kvstore_->asyncAppendBatch(
+          context_->spaceId(), partId, std::move(batch).value(), callback);
+    }
     baton.wait();
     return ret;
   }
@@ -427,10 +442,20 @@ class UpdateTagNode : public UpdateNode<VertexID> {
     // when there is no origin data, there is no the old index.
     // when TTL exists, there is no index.
     // when insert_ is true, not old index, val_ is empty.
+    vectorChanges_.clear();
     if (!indexes_.empty()) {
       RowReaderWrapper nReader;
       for (auto& index : indexes_) {
         if (tagId_ == index->get_schema_id().get_tag_id()) {
+          if (IndexKeyUtils::isVectorIndex(*index)) {
+            if (!nReader) {
+              nReader = RowReaderWrapper::getTagPropReader(
+                  context_->env()->schemaMan_, context_->spaceId(), tagId_, nVal);
+            }
+            HnswIndex::collectChange(
+                index, vId, val_.empty() ? nullptr : reader_, &nReader, &vectorChanges_);
+            continue;
+          }
           // step 1, delete old version index if exists.
           if (!val_.empty()) {
             if (!reader_) {
@@ -467,8 +492,7 @@ class UpdateTagNode : public UpdateNode<VertexID> {
           }
           auto nis = indexKeys(partId, vId, nReader.get(), index);
           if (!nis.empty()) {
-            auto v = CommonUtils::ttlValue(schema_, nReader.get());
-            auto niv = v.ok() ? IndexKeyUtils::indexVal(std::move(v).value()) : "";
+            auto niv = CommonUtils::indexValue(schema_, nReader.get(), index.get());
             auto indexState = context_->env()->getIndexState(context_->spaceId(), partId);
             if (context_->env()->checkRebuilding(indexState)) {
               for (auto& ni : nis) {
@@ -514,6 +538,7 @@ class UpdateTagNode : public UpdateNode<VertexID> {
   TagContext* tagContext_;
   TagID tagId_;
   std::string tagName_;
+  std::vector<VectorIndexChange> vectorChanges_;
 };
 
 /**
@@ -819,8 +844,7 @@ class UpdateEdgeNode : public UpdateNode<cpp2::EdgeKey> {
           }
           auto niks = indexKeys(partId, nReader.get(), edgeKey, index);
           if (!niks.empty()) {
-            auto v = CommonUtils::ttlValue(schema_, nReader.get());
-            auto niv = v.ok() ? IndexKeyUtils::indexVal(std::move(v).value()) : "";
+            auto niv = CommonUtils::indexValue(schema_, nReader.get(), index.get());
             auto indexState = context_->env()->getIndexState(context_->spaceId(), partId);
             if (context_->env()->checkRebuilding(indexState)) {
               for (auto& nik : niks) {
@@ -0,0 +1,123 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "storage/index/FulltextSearchProcessor.h"
+
+#include "kvstore/NebulaStore.h"
+#include "kvstore/listener/fulltext/LocalFTListener.h"
+
+namespace nebula {
+namespace storage {
+
+ProcessorCounters kFulltextSearchCounters;
+
+namespace {
+
+// The query is a parameter of request, the other failures are of reading the index
+nebula::cpp2::ErrorCode toErrorCode(const Status& status) {
+  return status.isSyntaxError() ? nebula::cpp2::ErrorCode::E_INVALID_PARM
+                                : nebula::cpp2::ErrorCode::E_EXECUTION_ERROR;
+}
+
+kvstore::LocalFTIndex::Stats fromThrift(const cpp2::FulltextStats& stats) {
+  kvstore::LocalFTIndex::Stats result;
+  for (const auto& kv : stats.get_doc_count()) {
+    auto& field = result.fields[kv.first];
+    field.first = kv.second;
+    auto found = stats.get_total_length().find(kv.first);
+    field.second = found == stats.get_total_length().end() ? 0 : found->second;
+  }
+  result.terms.insert(stats.get_doc_freq().begin(), stats.get_doc_freq().end());
+  return result;
+}
+
+cpp2::FulltextStats toThrift(const kvstore::LocalFTIndex::Stats& stats) {
+  cpp2::FulltextStats result;
+  for (const auto& kv : stats.fields) {
+    result.doc_count_ref()->emplace(kv.first, kv.second.first);
+    result.total_length_ref()->emplace(kv.first, kv.second.second);
+  }
+  result.doc_freq_ref()->insert(stats.terms.begin(), stats.terms.end());
+  return result;
+}
+
+}  // namespace
+
+void FulltextSearchProcessor::process(const cpp2::FulltextSearchRequest& req) {
+  spaceId_ = req.get_space_id();
+  auto limit = req.get_limit();
+  std::optional<kvstore::LocalFTIndex::Stats> global;
+  if (req.stats_ref().has_value()) {
+    global = fromThrift(*req.stats_ref());
+  }
+  std::vector<plugin::ESQueryResult::Item> items;
+  kvstore::LocalFTIndex::Stats stats;
+  auto* store = dynamic_cast<kvstore::NebulaStore*>(env_->kvstore_);
+  for (auto partId : req.get_parts()) {
+    if (store == nullptr) {
+      pushResultCode(nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND, partId);
+      continue;
+    }
+    auto ret = store->listener(spaceId_, partId, meta::cpp2::ListenerType::LOCAL_FULLTEXT);
+    if (!nebula::ok(ret)) {
+      pushResultCode(nebula::error(ret), partId);
+      continue;
+    }
+    auto* listener = dynamic_cast<kvstore::LocalFTListener*>(nebula::value(ret).get());
+    if (listener == nullptr) {
+      pushResultCode(nebula::cpp2::ErrorCode::E_LISTENER_NOT_FOUND, partId);
+      continue;
+    }
+    if (req.get_stats_only()) {
+      auto partStats = listener->collectStats(req.get_index(), req.get_query());
+      if (!partStats.ok()) {
+        LOG(ERROR) << "Collect statistics of fulltext index " << req.get_index() << " of part "
+                   << partId << " failed: " << partStats.status();
+        pushResultCode(toErrorCode(partStats.status()), partId);
+        continue;
+      }
+      stats.merge(partStats.value());
+      continue;
+    }
+    auto result = listener->search(
+        req.get_index(), req.get_query(), limit, global.has_value() ? &global.value() : nullptr);
+    if (!result.ok()) {
+      LOG(ERROR) << "Search fulltext index " << req.get_index() << " of part " << partId
+                 << " failed: " << result.status();
+      pushResultCode(toErrorCode(result.status()), partId);
+      continue;
+    }
+    auto& partItems = result.value().items;
+    items.insert(items.end(),
+                 std::make_move_iterator(partItems.begin()),
+                 std::make_move_iterator(partItems.end()));
+  }
+  if (req.get_stats_only()) {
+    resp_.stats_ref() = toThrift(stats);
+    onFinished();
+    return;
+  }
+
+  // Each part returns its top n, keep the top n of all parts
+  std::stable_sort(items.begin(), items.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.score > rhs.score;
+  });
+  if (limit >= 0 && items.size() > static_cast<size_t>(limit)) {
+    items.resize(limit);
+  }
+  nebula::DataSet ds({"vid", "src", "dst", "rank", "score"});
+  for (auto& item : items) {
+    ds.rows.emplace_back(Row({std::move(item.vid),
+                              std::move(item.src),
+                              std::move(item.dst),
+                              item.rank,
+                              item.score}));
+  }
+  resp_.data_ref() = std::move(ds);
+  onFinished();
+}
+
+}  // namespace storage
+}  // namespace nebula
@@ -0,0 +1,37 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef STORAGE_INDEX_FULLTEXTSEARCHPROCESSOR_H_
+#define STORAGE_INDEX_FULLTEXTSEARCHPROCESSOR_H_
+
+#include "common/base/Base.h"
+#include "storage/BaseProcessor.h"
+
+namespace nebula {
+namespace storage {
+
+extern ProcessorCounters kFulltextSearchCounters;
+
+/**
+ * @brief Search the fulltext index of local fulltext listeners, it runs in the listener host.
+ */
+class FulltextSearchProcessor : public BaseProcessor<cpp2::FulltextSearchResponse> {
+ public:
+  static FulltextSearchProcessor* instance(
+      StorageEnv* env, const ProcessorCounters* counters = &kFulltextSearchCounters) {
+    return new FulltextSearchProcessor(env, counters);
+  }
+
+  void process(const cpp2::FulltextSearchRequest& req);
+
+ protected:
+  FulltextSearchProcessor(StorageEnv* env, const ProcessorCounters* counters)
+      : BaseProcessor<cpp2::FulltextSearchResponse>(env, counters) {}
+};
+
+}  // namespace storage
+}  // namespace nebula
+
+#endif  // STORAGE_INDEX_FULLTEXTSEARCHPROCESSOR_H_
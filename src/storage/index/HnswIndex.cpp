@@ -0,0 +1,929 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include "storage/index/HnswIndex.h"
+
+#include <folly/synchronization/Baton.h>
+
+#include <queue>
+
+#include "common/algorithm/VectorDistance.h"
+#include "common/utils/IndexKeyUtils.h"
+#include "common/utils/NebulaKeyUtils.h"
+
+namespace nebula {
+namespace storage {
+
+using algorithm::VectorDistance;
+
+namespace {
+constexpr int32_t kDefaultHnswM = 16;
+constexpr int32_t kDefaultHnswEfConstruction = 200;
+constexpr int32_t kMaxHnswLevel = 16;
+// Max number of expired vertices removed in one atomic op
+constexpr size_t kRemoveExpiredBatch = 256;
+}  // namespace
+
+HnswIndex::HnswIndex(kvstore::KVStore* kvstore,
+                     GraphSpaceID spaceId,
+                     PartitionID partId,
+                     size_t vIdLen,
+                     const meta::cpp2::IndexItem& index)
+    : kvstore_(kvstore),
+      spaceId_(spaceId),
+      partId_(partId),
+      vIdLen_(vIdLen),
+      indexId_(index.get_index_id()) {
+  const auto& params = *index.index_params_ref();
+  metric_ = *params.vector_metric_ref();
+  m_ = params.hnsw_m_ref().value_or(kDefaultHnswM);
+  efConstruction_ = params.hnsw_ef_construction_ref().value_or(kDefaultHnswEfConstruction);
+}
+
+nebula::cpp2::ErrorCode HnswIndex::insert(const std::string& vId, std::vector<float> vec) {
+  if (!prepare(&vec)) {
+    return remove(vId);
+  }
+  auto id = pad(vId);
+  auto oldRet = getNode(id);
+  if (!nebula::ok(oldRet)) {
+    return nebula::error(oldRet);
+  }
+  auto old = nebula::value(oldRet);
+  if (old != nullptr) {
+    if (old->vec == vec) {
+      return nebula::cpp2::ErrorCode::SUCCEEDED;
+    }
+    auto code = remove(id);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
+
+  auto entryRet = getEntry();
+  if (!nebula::ok(entryRet)) {
+    return nebula::error(entryRet);
+  }
+  auto entry = nebula::value(entryRet);
+  auto node = std::make_shared<Node>();
+  node->level = randomLevel();
+  node->vec = std::move(vec);
+  node->neighbors.resize(node->level + 1);
+  if (entry.empty()) {
+    putNode(id, node);
+    setEntry(id);
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+
+  auto entryNodeRet = getNode(entry);
+  if (!nebula::ok(entryNodeRet)) {
+    return nebula::error(entryNodeRet);
+  }
+  auto entryNode = nebula::value(entryNodeRet);
+  if (entryNode->vec.size() != node->vec.size()) {
+    LOG(WARNING) << "Dimension of vector is " << node->vec.size() << ", but the index "
+                 << indexId_ << " expects " << entryNode->vec.size();
+    return nebula::cpp2::ErrorCode::E_INVALID_FIELD_VALUE;
+  }
+  std::vector<Candidate> entries{{distance(node->vec, entryNode->vec), entry}};
+  // Greedy search on the upper levels
+  for (auto level = entryNode->level; level > node->level; --level) {
+    auto ret = searchLayer(node->vec, std::move(entries), 1, level, nullptr, nullptr);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    entries = std::move(nebula::value(ret));
+  }
+
+  putNode(id, node);
+  for (auto level = std::min(node->level, entryNode->level); level >= 0; --level) {
+    auto ret =
+        searchLayer(node->vec, std::move(entries), efConstruction_, level, nullptr, nullptr);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    entries = std::move(nebula::value(ret));
+    auto selected = selectNeighbors(entries, m_);
+    if (!nebula::ok(selected)) {
+      return nebula::error(selected);
+    }
+    node->neighbors[level] = std::move(nebula::value(selected));
+    for (const auto& neighbor : node->neighbors[level]) {
+      auto code = connect(neighbor, id, level);
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        return code;
+      }
+    }
+  }
+  if (node->level > entryNode->level) {
+    setEntry(id);
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode HnswIndex::remove(const std::string& vId) {
+  auto id = pad(vId);
+  auto nodeRet = getNode(id);
+  if (!nebula::ok(nodeRet)) {
+    return nebula::error(nodeRet);
+  }
+  auto node = nebula::value(nodeRet);
+  if (node == nullptr) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  removeNode(id);
+
+  // Reselect the neighbors of the nodes linked to the removed one, the neighbors of the removed
+  // one are the candidates too, so the graph keeps connected
+  for (auto level = 0; level <= node->level; ++level) {
+    for (const auto& neighbor : node->neighbors[level]) {
+      auto ret = getNode(neighbor);
+      if (!nebula::ok(ret)) {
+        return nebula::error(ret);
+      }
+      auto neighborNode = nebula::value(ret);
+      if (neighborNode == nullptr || neighborNode->level < level) {
+        continue;
+      }
+      const auto& links = neighborNode->neighbors[level];
+      if (std::find(links.begin(), links.end(), id) == links.end()) {
+        continue;
+      }
+      std::vector<std::string> candidates(links);
+      candidates.insert(
+          candidates.end(), node->neighbors[level].begin(), node->neighbors[level].end());
+      auto code = reselect(neighbor, level, candidates);
+      if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        return code;
+      }
+    }
+  }
+
+  auto entryRet = loadEntry();
+  if (!nebula::ok(entryRet)) {
+    return nebula::error(entryRet);
+  }
+  if (nebula::value(entryRet) != id) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  // Replace the entry point with the neighbor on the highest level
+  std::string next;
+  int32_t nextLevel = -1;
+  for (auto level = node->level; level >= 0 && next.empty(); --level) {
+    for (const auto& neighbor : node->neighbors[level]) {
+      auto ret = getNode(neighbor);
+      if (!nebula::ok(ret)) {
+        return nebula::error(ret);
+      }
+      auto neighborNode = nebula::value(ret);
+      if (neighborNode != nullptr && neighborNode->level > nextLevel) {
+        next = neighbor;
+        nextLevel = neighborNode->level;
+      }
+    }
+  }
+  if (next.empty()) {
+    auto anyRet = anyNode();
+    if (!nebula::ok(anyRet)) {
+      return nebula::error(anyRet);
+    }
+    next = std::move(nebula::value(anyRet));
+  }
+  setEntry(std::move(next));
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::vector<std::pair<std::string, float>>> HnswIndex::search(
+    std::vector<float> query,
+    size_t k,
+    size_t ef,
+    const std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)>& filter) {
+  std::vector<std::pair<std::string, float>> result;
+  if (!prepare(&query)) {
+    return nebula::cpp2::ErrorCode::E_INVALID_PARM;
+  }
+  auto entryRet = getEntry();
+  if (!nebula::ok(entryRet)) {
+    return nebula::error(entryRet);
+  }
+  auto entry = nebula::value(entryRet);
+  if (entry.empty() || k == 0) {
+    return result;
+  }
+  auto entryNodeRet = getNode(entry);
+  if (!nebula::ok(entryNodeRet)) {
+    return nebula::error(entryNodeRet);
+  }
+  auto entryNode = nebula::value(entryNodeRet);
+  if (entryNode->vec.size() != query.size()) {
+    LOG(WARNING) << "Dimension of query vector is " << query.size() << ", but the index "
+                 << indexId_ << " expects " << entryNode->vec.size();
+    return nebula::cpp2::ErrorCode::E_INVALID_PARM;
+  }
+  std::vector<Candidate> entries{{distance(query, entryNode->vec), entry}};
+  for (auto level = entryNode->level; level > 0; --level) {
+    auto ret = searchLayer(query, std::move(entries), 1, level, nullptr, nullptr);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    entries = std::move(nebula::value(ret));
+  }
+
+  // The filter is evaluated once for each vertex, since the search may run several times
+  std::unordered_map<std::string, bool> passed;
+  std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)> cachedFilter;
+  if (filter != nullptr) {
+    cachedFilter = [&filter, &passed](
+                       const std::string& vId) -> ErrorOr<nebula::cpp2::ErrorCode, bool> {
+      auto iter = passed.find(vId);
+      if (iter != passed.end()) {
+        return iter->second;
+      }
+      auto ret = filter(vId);
+      if (nebula::ok(ret)) {
+        passed.emplace(vId, nebula::value(ret));
+      }
+      return ret;
+    };
+  }
+  // The layer is searched as usual, the vertices filtered out are still used to navigate but
+  // not returned. If less than k vertices pass the filter, search again with a doubled ef until
+  // k are found or all the reachable vertices are visited.
+  std::vector<Candidate> candidates;
+  for (auto efSearch = std::max(ef, k);; efSearch *= 2) {
+    bool exhausted = false;
+    auto ret = searchLayer(query, entries, efSearch, 0, cachedFilter, &exhausted);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    candidates = std::move(nebula::value(ret));
+    if (filter == nullptr || candidates.size() >= k || exhausted) {
+      break;
+    }
+  }
+  for (size_t i = 0; i < candidates.size() && i < k; ++i) {
+    result.emplace_back(std::move(candidates[i].second), candidates[i].first);
+  }
+  return result;
+}
+
+void HnswIndex::flush(kvstore::BatchHolder* batch, std::list<std::string>* writeSet) {
+  for (const auto& id : dirtyNodes_) {
+    auto key = nodeKey(id);
+    writeSet->emplace_back(key);
+    const auto& node = nodes_[id];
+    if (node != nullptr) {
+      batch->put(std::move(key), encodeNode(*node));
+    } else {
+      batch->remove(std::move(key));
+    }
+  }
+  dirtyNodes_.clear();
+  if (entryDirty_) {
+    auto key = IndexKeyUtils::vectorEntryKey(partId_, indexId_);
+    writeSet->emplace_back(key);
+    if (entry_->empty()) {
+      batch->remove(std::move(key));
+    } else {
+      batch->put(std::move(key), std::string(*entry_));
+    }
+    entryDirty_ = false;
+  }
+}
+
+float HnswIndex::userDistance(float distance) const {
+  if (metric_ == meta::cpp2::VectorMetric::L2) {
+    return std::sqrt(distance);
+  }
+  return distance;
+}
+
+// static
+std::optional<std::vector<float>> HnswIndex::toVector(const Value& value) {
+  if (!value.isList() || value.getList().empty()) {
+    return std::nullopt;
+  }
+  const auto& values = value.getList().values;
+  std::vector<float> vec;
+  vec.reserve(values.size());
+  for (const auto& v : values) {
+    if (v.isFloat()) {
+      vec.emplace_back(static_cast<float>(v.getFloat()));
+    } else if (v.isInt()) {
+      vec.emplace_back(static_cast<float>(v.getInt()));
+    } else {
+      return std::nullopt;
+    }
+  }
+  return vec;
+}
+
+// static
+void HnswIndex::collectChange(std::shared_ptr<meta::cpp2::IndexItem> index,
+                              const std::string& vId,
+                              RowReaderWrapper* oldReader,
+                              RowReaderWrapper* newReader,
+                              std::vector<VectorIndexChange>* changes) {
+  const auto& fields = index->get_fields();
+  if (fields.empty()) {
+    return;
+  }
+  const auto& name = fields.front().get_name();
+  std::optional<std::vector<float>> oldVec;
+  std::optional<std::vector<float>> newVec;
+  if (oldReader != nullptr && *oldReader != nullptr) {
+    oldVec = toVector(oldReader->getValueByName(name));
+  }
+  if (newReader != nullptr && *newReader != nullptr) {
+    newVec = toVector(newReader->getValueByName(name));
+  }
+  if (oldVec == newVec) {
+    return;
+  }
+  changes->emplace_back(VectorIndexChange{std::move(index), vId, std::move(newVec)});
+}
+
+// static
+nebula::cpp2::ErrorCode HnswIndex::applyChanges(StorageEnv* env,
+                                                GraphSpaceID spaceId,
+                                                PartitionID partId,
+                                                size_t vIdLen,
+                                                const std::vector<VectorIndexChange>& changes,
+                                                kvstore::BatchHolder* batch,
+                                                kvstore::MergeableAtomicOpResult* result) {
+  if (changes.empty()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  // The graph is modified in place even if the index is building, since the changes are
+  // idempotent and serialized by atomic op
+  if (env->checkIndexLocked(env->getIndexState(spaceId, partId))) {
+    LOG(ERROR) << "The index has been locked: " << changes.front().index->get_index_name();
+    return nebula::cpp2::ErrorCode::E_DATA_CONFLICT_ERROR;
+  }
+  std::map<IndexID, std::unique_ptr<HnswIndex>> indexes;
+  for (const auto& change : changes) {
+    auto& index = indexes[change.index->get_index_id()];
+    if (index == nullptr) {
+      index = std::make_unique<HnswIndex>(env->kvstore_, spaceId, partId, vIdLen, *change.index);
+    }
+    auto code = change.vector.has_value() ? index->insert(change.vId, *change.vector)
+                                          : index->remove(change.vId);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
+  for (auto& [indexId, index] : indexes) {
+    index->flush(batch, &result->writeSet);
+    const auto& readKeys = index->readKeys();
+    result->readSet.insert(result->readSet.end(), readKeys.begin(), readKeys.end());
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+// static
+nebula::cpp2::ErrorCode HnswIndex::removeExpired(StorageEnv* env,
+                                                 GraphSpaceID spaceId,
+                                                 PartitionID partId,
+                                                 size_t vIdLen,
+                                                 std::shared_ptr<meta::cpp2::IndexItem> index) {
+  auto tagId = index->get_schema_id().get_tag_id();
+  auto schema = env->schemaMan_->getTagSchema(spaceId, tagId);
+  if (schema == nullptr) {
+    return nebula::cpp2::ErrorCode::E_TAG_NOT_FOUND;
+  }
+  auto ttl = CommonUtils::ttlProps(schema.get());
+  auto expired = [&](const std::string& vId,
+                     std::vector<std::string>* readSet) -> ErrorOr<nebula::cpp2::ErrorCode, bool> {
+    auto key = NebulaKeyUtils::tagKey(vIdLen, partId, vId, tagId);
+    std::string val;
+    auto code = env->kvstore_->get(spaceId, partId, key, &val);
+    if (readSet != nullptr) {
+      readSet->emplace_back(std::move(key));
+    }
+    if (code == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+      return true;
+    } else if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+    if (!ttl.first) {
+      return false;
+    }
+    auto reader = RowReaderWrapper::getTagPropReader(env->schemaMan_, spaceId, tagId, val);
+    return reader != nullptr &&
+           CommonUtils::checkDataExpiredForTTL(
+               schema.get(), reader.get(), ttl.second.second, ttl.second.first);
+  };
+
+  std::vector<std::string> vIds;
+  auto prefix = IndexKeyUtils::vectorNodePrefix(partId, index->get_index_id());
+  std::unique_ptr<kvstore::KVIterator> iter;
+  auto code = env->kvstore_->prefix(spaceId, partId, prefix, &iter);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  for (; iter->valid(); iter->next()) {
+    auto vId = iter->key().subpiece(prefix.size()).str();
+    auto ret = expired(vId, nullptr);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    if (nebula::value(ret)) {
+      vIds.emplace_back(std::move(vId));
+    }
+  }
+
+  // The rows are checked again in atomic op, since they may have been inserted again
+  for (size_t start = 0; start < vIds.size(); start += kRemoveExpiredBatch) {
+    auto end = std::min(vIds.size(), start + kRemoveExpiredBatch);
+    auto op = [&, start, end]() {
+      kvstore::MergeableAtomicOpResult ret;
+      ret.code = nebula::cpp2::ErrorCode::E_RAFT_ATOMIC_OP_FAILED;
+      std::vector<VectorIndexChange> changes;
+      for (auto i = start; i < end; ++i) {
+        auto isExpired = expired(vIds[i], &ret.readSet);
+        if (!nebula::ok(isExpired)) {
+          ret.code = nebula::error(isExpired);
+          return ret;
+        }
+        if (nebula::value(isExpired)) {
+          changes.emplace_back(VectorIndexChange{index, vIds[i], std::nullopt});
+        }
+      }
+      auto batchHolder = std::make_unique<kvstore::BatchHolder>();
+      auto applyCode =
+          applyChanges(env, spaceId, partId, vIdLen, changes, batchHolder.get(), &ret);
+      if (applyCode != nebula::cpp2::ErrorCode::SUCCEEDED) {
+        ret.code = applyCode;
+        return ret;
+      }
+      ret.batch = kvstore::encodeBatchValue(batchHolder->getBatch());
+      ret.code = nebula::cpp2::ErrorCode::SUCCEEDED;
+      return ret;
+    };
+    folly::Baton<true, std::atomic> baton;
+    auto result = nebula::cpp2::ErrorCode::SUCCEEDED;
+    env->kvstore_->asyncAtomicOp(
+        spaceId, partId, std::move(op), [&result, &baton](nebula::cpp2::ErrorCode opCode) {
+          result = opCode;
+          baton.post();
+        });
+    baton.wait();
+    if (result != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return result;
+    }
+  }
+  if (!vIds.empty()) {
+    LOG(INFO) << "Removed " << vIds.size() << " expired vertices from vector index "
+              << index->get_index_id() << " in part " << partId;
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+// static
+kvstore::MergeableAtomicOpResult HnswIndex::atomicOp(
+    StorageEnv* env,
+    GraphSpaceID spaceId,
+    PartitionID partId,
+    size_t vIdLen,
+    const std::string& batch,
+    const std::vector<VectorIndexChange>& changes) {
+  kvstore::MergeableAtomicOpResult ret;
+  ret.code = nebula::cpp2::ErrorCode::E_RAFT_ATOMIC_OP_FAILED;
+  auto batchHolder = std::make_unique<kvstore::BatchHolder>();
+  if (!batch.empty()) {
+    for (const auto& [type, kv] : kvstore::decodeBatchValue(batch)) {
+      switch (type) {
+        case kvstore::BatchLogType::OP_BATCH_PUT:
+          ret.writeSet.emplace_back(kv.first.str());
+          batchHolder->put(kv.first.str(), kv.second.str());
+          break;
+        case kvstore::BatchLogType::OP_BATCH_REMOVE:
+          ret.writeSet.emplace_back(kv.first.str());
+          batchHolder->remove(kv.first.str());
+          break;
+        case kvstore::BatchLogType::OP_BATCH_REMOVE_RANGE:
+          batchHolder->rangeRemove(kv.first.str(), kv.second.str());
+          break;
+      }
+    }
+  }
+  auto code = applyChanges(env, spaceId, partId, vIdLen, changes, batchHolder.get(), &ret);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    ret.code = code;
+    return ret;
+  }
+  ret.batch = kvstore::encodeBatchValue(batchHolder->getBatch());
+  ret.code = nebula::cpp2::ErrorCode::SUCCEEDED;
+  return ret;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, HnswIndex::NodePtr> HnswIndex::getNode(const std::string& vId) {
+  auto iter = nodes_.find(vId);
+  if (iter != nodes_.end()) {
+    return iter->second;
+  }
+  auto key = nodeKey(vId);
+  readKeys_.emplace(key);
+  std::string val;
+  auto code = kvstore_->get(spaceId_, partId_, key, &val);
+  if (code == nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    nodes_.emplace(vId, nullptr);
+    return NodePtr();
+  } else if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  auto node = decodeNode(val);
+  if (node == nullptr) {
+    LOG(WARNING) << "Invalid node of vector index " << indexId_ << " in part " << partId_;
+  }
+  nodes_.emplace(vId, node);
+  return node;
+}
+
+void HnswIndex::putNode(const std::string& vId, NodePtr node) {
+  nodes_[vId] = std::move(node);
+  dirtyNodes_.emplace(vId);
+}
+
+void HnswIndex::removeNode(const std::string& vId) {
+  nodes_[vId] = nullptr;
+  dirtyNodes_.emplace(vId);
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::string> HnswIndex::loadEntry() {
+  if (entry_.has_value()) {
+    return *entry_;
+  }
+  auto key = IndexKeyUtils::vectorEntryKey(partId_, indexId_);
+  readKeys_.emplace(key);
+  std::string val;
+  auto code = kvstore_->get(spaceId_, partId_, key, &val);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED &&
+      code != nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND) {
+    return code;
+  }
+  entry_ = std::move(val);
+  return *entry_;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::string> HnswIndex::getEntry() {
+  auto entryRet = loadEntry();
+  if (!nebula::ok(entryRet)) {
+    return entryRet;
+  }
+  auto entry = std::move(nebula::value(entryRet));
+  if (entry.empty()) {
+    return entry;
+  }
+  auto nodeRet = getNode(entry);
+  if (!nebula::ok(nodeRet)) {
+    return nebula::error(nodeRet);
+  }
+  if (nebula::value(nodeRet) != nullptr) {
+    return entry;
+  }
+  // The entry point is lost, which should not happen, pick another one
+  LOG(WARNING) << "Entry point of vector index " << indexId_ << " in part " << partId_
+               << " does not exist";
+  auto anyRet = anyNode();
+  if (!nebula::ok(anyRet)) {
+    return anyRet;
+  }
+  setEntry(nebula::value(anyRet));
+  return *entry_;
+}
+
+void HnswIndex::setEntry(std::string vId) {
+  entry_ = std::move(vId);
+  entryDirty_ = true;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::string> HnswIndex::anyNode() {
+  for (const auto& id : dirtyNodes_) {
+    if (nodes_[id] != nullptr) {
+      return id;
+    }
+  }
+  auto prefix = IndexKeyUtils::vectorNodePrefix(partId_, indexId_);
+  std::unique_ptr<kvstore::KVIterator> iter;
+  auto code = kvstore_->prefix(spaceId_, partId_, prefix, &iter);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    return code;
+  }
+  for (; iter->valid(); iter->next()) {
+    auto id = iter->key().subpiece(prefix.size()).str();
+    auto nodeRet = getNode(id);
+    if (!nebula::ok(nodeRet)) {
+      return nebula::error(nodeRet);
+    }
+    if (nebula::value(nodeRet) != nullptr) {
+      return id;
+    }
+  }
+  return std::string();
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::vector<HnswIndex::Candidate>> HnswIndex::searchLayer(
+    const std::vector<float>& query,
+    std::vector<Candidate> entries,
+    size_t ef,
+    int32_t level,
+    const std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)>& filter,
+    bool* exhausted) {
+  std::unordered_set<std::string> visited;
+  // The nearest candidate on the top
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+  // The farthest visited one on the top, which bounds the search whether it passes the filter or
+  // not, otherwise a selective filter never fills the results and the whole graph is walked
+  std::priority_queue<Candidate> nearest;
+  // The farthest result on the top, which passes the filter
+  std::priority_queue<Candidate> results;
+  // Whether any node is skipped since it is farther than the bound
+  bool pruned = false;
+  auto visit = [&](const Candidate& candidate) -> nebula::cpp2::ErrorCode {
+    nearest.emplace(candidate);
+    if (nearest.size() > ef) {
+      nearest.pop();
+    }
+    if (filter != nullptr) {
+      auto ret = filter(candidate.second);
+      if (!nebula::ok(ret)) {
+        return nebula::error(ret);
+      }
+      if (!nebula::value(ret)) {
+        return nebula::cpp2::ErrorCode::SUCCEEDED;
+      }
+    }
+    results.emplace(candidate);
+    if (results.size() > ef) {
+      results.pop();
+    }
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  };
+
+  for (auto& entry : entries) {
+    if (!visited.emplace(entry.second).second) {
+      continue;
+    }
+    auto code = visit(entry);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+    candidates.emplace(std::move(entry));
+  }
+  while (!candidates.empty()) {
+    auto candidate = candidates.top();
+    if (nearest.size() >= ef && candidate.first > nearest.top().first) {
+      break;
+    }
+    candidates.pop();
+    auto nodeRet = getNode(candidate.second);
+    if (!nebula::ok(nodeRet)) {
+      return nebula::error(nodeRet);
+    }
+    auto node = nebula::value(nodeRet);
+    if (node == nullptr || node->level < level) {
+      continue;
+    }
+    for (const auto& neighbor : node->neighbors[level]) {
+      if (!visited.emplace(neighbor).second) {
+        continue;
+      }
+      auto neighborRet = getNode(neighbor);
+      if (!nebula::ok(neighborRet)) {
+        return nebula::error(neighborRet);
+      }
+      // The link is dangling if the neighbor has been removed
+      auto neighborNode = nebula::value(neighborRet);
+      if (neighborNode == nullptr || neighborNode->vec.size() != query.size()) {
+        continue;
+      }
+      auto dist = distance(query, neighborNode->vec);
+      if (nearest.size() < ef || dist < nearest.top().first) {
+        Candidate next{dist, neighbor};
+        auto code = visit(next);
+        if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+          return code;
+        }
+        candidates.emplace(std::move(next));
+      } else {
+        pruned = true;
+      }
+    }
+  }
+  if (exhausted != nullptr) {
+    *exhausted = candidates.empty() && !pruned;
+  }
+
+  std::vector<Candidate> ret(results.size());
+  for (auto i = ret.size(); i > 0; --i) {
+    ret[i - 1] = results.top();
+    results.pop();
+  }
+  return ret;
+}
+
+ErrorOr<nebula::cpp2::ErrorCode, std::vector<std::string>> HnswIndex::selectNeighbors(
+    const std::vector<Candidate>& candidates, size_t m) {
+  std::vector<std::string> selected;
+  if (candidates.size() <= m) {
+    for (const auto& candidate : candidates) {
+      selected.emplace_back(candidate.second);
+    }
+    return selected;
+  }
+  // A candidate is skipped if it is closer to a selected one than to the base, which keeps the
+  // links spread in different directions
+  std::vector<NodePtr> selectedNodes;
+  std::vector<std::string> pruned;
+  for (const auto& [dist, id] : candidates) {
+    if (selected.size() >= m) {
+      break;
+    }
+    auto ret = getNode(id);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    auto node = nebula::value(ret);
+    if (node == nullptr) {
+      continue;
+    }
+    bool good = true;
+    for (const auto& selectedNode : selectedNodes) {
+      if (distance(node->vec, selectedNode->vec) < dist) {
+        good = false;
+        break;
+      }
+    }
+    if (good) {
+      selected.emplace_back(id);
+      selectedNodes.emplace_back(std::move(node));
+    } else {
+      pruned.emplace_back(id);
+    }
+  }
+  // Keep the pruned ones if there is room, the graph is more robust to removals
+  for (size_t i = 0; i < pruned.size() && selected.size() < m; ++i) {
+    selected.emplace_back(std::move(pruned[i]));
+  }
+  return selected;
+}
+
+nebula::cpp2::ErrorCode HnswIndex::connect(const std::string& vId,
+                                           const std::string& neighbor,
+                                           int32_t level) {
+  auto ret = getNode(vId);
+  if (!nebula::ok(ret)) {
+    return nebula::error(ret);
+  }
+  auto node = nebula::value(ret);
+  if (node == nullptr || node->level < level) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  auto& links = node->neighbors[level];
+  if (std::find(links.begin(), links.end(), neighbor) != links.end()) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  links.emplace_back(neighbor);
+  dirtyNodes_.emplace(vId);
+  if (links.size() > maxNeighbors(level)) {
+    return reselect(vId, level, std::vector<std::string>(links));
+  }
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+nebula::cpp2::ErrorCode HnswIndex::reselect(const std::string& vId,
+                                            int32_t level,
+                                            const std::vector<std::string>& candidates) {
+  auto nodeRet = getNode(vId);
+  if (!nebula::ok(nodeRet)) {
+    return nebula::error(nodeRet);
+  }
+  auto node = nebula::value(nodeRet);
+  if (node == nullptr || node->level < level) {
+    return nebula::cpp2::ErrorCode::SUCCEEDED;
+  }
+  std::vector<Candidate> sorted;
+  std::unordered_set<std::string> seen;
+  for (const auto& candidate : candidates) {
+    if (candidate == vId || !seen.emplace(candidate).second) {
+      continue;
+    }
+    auto ret = getNode(candidate);
+    if (!nebula::ok(ret)) {
+      return nebula::error(ret);
+    }
+    auto candidateNode = nebula::value(ret);
+    if (candidateNode == nullptr || candidateNode->level < level ||
+        candidateNode->vec.size() != node->vec.size()) {
+      continue;
+    }
+    sorted.emplace_back(distance(node->vec, candidateNode->vec), candidate);
+  }
+  std::sort(sorted.begin(), sorted.end());
+  auto selected = selectNeighbors(sorted, maxNeighbors(level));
+  if (!nebula::ok(selected)) {
+    return nebula::error(selected);
+  }
+  node->neighbors[level] = std::move(nebula::value(selected));
+  dirtyNodes_.emplace(vId);
+  return nebula::cpp2::ErrorCode::SUCCEEDED;
+}
+
+float HnswIndex::distance(const std::vector<float>& lhs, const std::vector<float>& rhs) const {
+  if (metric_ == meta::cpp2::VectorMetric::L2) {
+    return VectorDistance::l2Sqr(lhs.data(), rhs.data(), lhs.size());
+  }
+  // The vectors are normalized
+  return 1.0f - VectorDistance::dot(lhs.data(), rhs.data(), lhs.size());
+}
+
+bool HnswIndex::prepare(std::vector<float>* vec) const {
+  if (vec->empty()) {
+    return false;
+  }
+  for (auto v : *vec) {
+    if (!std::isfinite(v)) {
+      return false;
+    }
+  }
+  if (metric_ == meta::cpp2::VectorMetric::COSINE) {
+    return VectorDistance::normalize(vec->data(), vec->size());
+  }
+  return true;
+}
+
+int32_t HnswIndex::randomLevel() const {
+  // The level is exponentially distributed with mL = 1 / ln(M)
+  auto rand = std::max(folly::Random::randDouble01(), std::numeric_limits<double>::min());
+  auto level = static_cast<int32_t>(-std::log(rand) / std::log(static_cast<double>(m_)));
+  return std::min(level, kMaxHnswLevel);
+}
+
+std::string HnswIndex::pad(const std::string& vId) const {
+  if (vId.size() >= vIdLen_) {
+    return vId;
+  }
+  std::string padded(vId);
+  padded.append(vIdLen_ - vId.size(), '\0');
+  return padded;
+}
+
+std::string HnswIndex::nodeKey(const std::string& vId) const {
+  return IndexKeyUtils::vectorNodeKey(vIdLen_, partId_, indexId_, vId);
+}
+
+// static
+std::string HnswIndex::encodeNode(const Node& node) {
+  std::string val;
+  int32_t dim = node.vec.size();
+  val.append(reinterpret_cast<const char*>(&node.level), sizeof(int32_t))
+      .append(reinterpret_cast<const char*>(&dim), sizeof(int32_t))
+      .append(reinterpret_cast<const char*>(node.vec.data()), sizeof(float) * dim);
+  for (const auto& links : node.neighbors) {
+    int32_t count = links.size();
+    val.append(reinterpret_cast<const char*>(&count), sizeof(int32_t));
+    for (const auto& link : links) {
+      val.append(link);
+    }
+  }
+  return val;
+}
+
+HnswIndex::NodePtr HnswIndex::decodeNode(folly::StringPiece val) const {
+  auto readInt = [&val](int32_t* v) {
+    if (val.size() < sizeof(int32_t)) {
+      return false;
+    }
+    memcpy(v, val.data(), sizeof(int32_t));
+    val.advance(sizeof(int32_t));
+    return true;
+  };
+  auto node = std::make_shared<Node>();
+  int32_t dim = 0;
+  if (!readInt(&node->level) || !readInt(&dim) || node->level < 0 || dim < 0 ||
+      val.size() < sizeof(float) * dim) {
+    return nullptr;
+  }
+  node->vec.resize(dim);
+  memcpy(node->vec.data(), val.data(), sizeof(float) * dim);
+  val.advance(sizeof(float) * dim);
+  node->neighbors.resize(node->level + 1);
+  for (auto& links : node->neighbors) {
+    int32_t count = 0;
+    if (!readInt(&count) || count < 0 || val.size() < vIdLen_ * count) {
+      return nullptr;
+    }
+    links.reserve(count);
+    for (int32_t i = 0; i < count; ++i) {
+      links.emplace_back(val.subpiece(0, vIdLen_).str());
+      val.advance(vIdLen_);
+    }
+  }
+  return node;
+}
+
+}  // namespace storage
+}  // namespace nebula
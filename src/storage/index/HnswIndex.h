@@ -0,0 +1,225 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#ifndef STORAGE_INDEX_HNSWINDEX_H_
+#define STORAGE_INDEX_HNSWINDEX_H_
+
+#include "common/base/Base.h"
+#include "common/base/ErrorOr.h"
+#include "interface/gen-cpp2/meta_types.h"
+#include "kvstore/LogEncoder.h"
+#include "storage/CommonUtils.h"
+
+namespace nebula {
+namespace storage {
+
+/**
+ * @brief Changes of the vector indexes caused by a mutation, an empty vector means the vertex
+ * should be removed from the index.
+ */
+struct VectorIndexChange {
+  std::shared_ptr<meta::cpp2::IndexItem> index;
+  std::string vId;
+  std::optional<std::vector<float>> vector;
+};
+
+/**
+ * @brief HNSW graph of a vector index in one part, which is stored in the key space of the index,
+ * see IndexKeyUtils::vectorNodeKey. The value of a node:
+ *
+ * level(int32) dim(int32) vector(float * dim) {count(int32) neighbors(vid * count)} * (level + 1)
+ *
+ * The reads are cached and the writes are buffered in memory, until they are flushed into a
+ * batch. The keys which are read are recorded, so the writes could run as an atomic op. It is
+ * not thread-safe.
+ */
+class HnswIndex final {
+ public:
+  HnswIndex(kvstore::KVStore* kvstore,
+            GraphSpaceID spaceId,
+            PartitionID partId,
+            size_t vIdLen,
+            const meta::cpp2::IndexItem& index);
+
+  /**
+   * @brief Insert the vector of vertex, the old one is replaced if it is different
+   */
+  nebula::cpp2::ErrorCode insert(const std::string& vId, std::vector<float> vec);
+
+  /**
+   * @brief Remove the vertex from index, and repair the links of its neighbors
+   */
+  nebula::cpp2::ErrorCode remove(const std::string& vId);
+
+  /**
+   * @brief Search the approximate k nearest neighbors
+   *
+   * @param ef Size of the dynamic candidate list, which is at least k
+   * @param filter Only the vertices which pass the filter are returned, but all of them are used
+   * to navigate the graph
+   * @return Padded vid and distance of each neighbor, ordered by distance ascending
+   */
+  ErrorOr<nebula::cpp2::ErrorCode, std::vector<std::pair<std::string, float>>> search(
+      std::vector<float> query,
+      size_t k,
+      size_t ef,
+      const std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)>& filter =
+          nullptr);
+
+  /**
+   * @brief Write the buffered changes into batch
+   */
+  void flush(kvstore::BatchHolder* batch, std::list<std::string>* writeSet);
+
+  const std::unordered_set<std::string>& readKeys() const {
+    return readKeys_;
+  }
+
+  /**
+   * @brief Distance returned to user, the euclidean distance for l2, and 1 - cosine similarity
+   * for cosine
+   */
+  float userDistance(float distance) const;
+
+  /**
+   * @brief Convert a list of numbers to vector, return nullopt if it is not a valid vector
+   */
+  static std::optional<std::vector<float>> toVector(const Value& value);
+
+  /**
+   * @brief Collect the change of a vector index if the vector of vertex is modified, the reader
+   * is nullptr if the vertex does not exist
+   */
+  static void collectChange(std::shared_ptr<meta::cpp2::IndexItem> index,
+                            const std::string& vId,
+                            RowReaderWrapper* oldReader,
+                            RowReaderWrapper* newReader,
+                            std::vector<VectorIndexChange>* changes);
+
+  /**
+   * @brief Apply the changes into batch, the read and written keys are added into result
+   */
+  static nebula::cpp2::ErrorCode applyChanges(StorageEnv* env,
+                                              GraphSpaceID spaceId,
+                                              PartitionID partId,
+                                              size_t vIdLen,
+                                              const std::vector<VectorIndexChange>& changes,
+                                              kvstore::BatchHolder* batch,
+                                              kvstore::MergeableAtomicOpResult* result);
+
+  /**
+   * @brief Remove the vertices whose tag rows have expired by TTL or don't exist any more. The rows
+   * expired are dropped by compaction, which doesn't change the graph. It runs in atomic ops, so
+   * it should be called in the leader of part.
+   */
+  static nebula::cpp2::ErrorCode removeExpired(StorageEnv* env,
+                                               GraphSpaceID spaceId,
+                                               PartitionID partId,
+                                               size_t vIdLen,
+                                               std::shared_ptr<meta::cpp2::IndexItem> index);
+
+  /**
+   * @brief Build the result of an atomic op, which writes an encoded batch together with the
+   * changes of vector indexes. It could be executed more than once.
+   */
+  static kvstore::MergeableAtomicOpResult atomicOp(StorageEnv* env,
+                                                   GraphSpaceID spaceId,
+                                                   PartitionID partId,
+                                                   size_t vIdLen,
+                                                   const std::string& batch,
+                                                   const std::vector<VectorIndexChange>& changes);
+
+ private:
+  struct Node {
+    int32_t level;
+    std::vector<float> vec;
+    // Neighbors of each level
+    std::vector<std::vector<std::string>> neighbors;
+  };
+  using NodePtr = std::shared_ptr<Node>;
+  // Distance and padded vid
+  using Candidate = std::pair<float, std::string>;
+
+  // nullptr if the node does not exist
+  ErrorOr<nebula::cpp2::ErrorCode, NodePtr> getNode(const std::string& vId);
+
+  void putNode(const std::string& vId, NodePtr node);
+
+  void removeNode(const std::string& vId);
+
+  // The entry point which is stored, empty if there is none
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> loadEntry();
+
+  // The entry point which exists in graph, empty if the graph is empty
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> getEntry();
+
+  void setEntry(std::string vId);
+
+  // Any node in the graph, empty if there is none
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> anyNode();
+
+  ErrorOr<nebula::cpp2::ErrorCode, std::vector<Candidate>> searchLayer(
+      const std::vector<float>& query,
+      std::vector<Candidate> entries,
+      size_t ef,
+      int32_t level,
+      const std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)>& filter,
+      // Set to true if all the reachable nodes are visited
+      bool* exhausted);
+
+  // Select at most m neighbors from candidates which are ordered by distance ascending
+  ErrorOr<nebula::cpp2::ErrorCode, std::vector<std::string>> selectNeighbors(
+      const std::vector<Candidate>& candidates, size_t m);
+
+  // Add the link from vId to neighbor, shrink the neighbors of it if too many
+  nebula::cpp2::ErrorCode connect(const std::string& vId,
+                                  const std::string& neighbor,
+                                  int32_t level);
+
+  nebula::cpp2::ErrorCode reselect(const std::string& vId,
+                                   int32_t level,
+                                   const std::vector<std::string>& candidates);
+
+  float distance(const std::vector<float>& lhs, const std::vector<float>& rhs) const;
+
+  // Normalize the vector if metric is cosine, return false if the vector is invalid
+  bool prepare(std::vector<float>* vec) const;
+
+  int32_t randomLevel() const;
+
+  size_t maxNeighbors(int32_t level) const {
+    return level == 0 ? m_ * 2 : m_;
+  }
+
+  std::string pad(const std::string& vId) const;
+
+  std::string nodeKey(const std::string& vId) const;
+
+  static std::string encodeNode(const Node& node);
+
+  NodePtr decodeNode(folly::StringPiece val) const;
+
+ private:
+  kvstore::KVStore* kvstore_{nullptr};
+  GraphSpaceID spaceId_;
+  PartitionID partId_;
+  size_t vIdLen_;
+  IndexID indexId_;
+  meta::cpp2::VectorMetric metric_;
+  size_t m_;
+  size_t efConstruction_;
+
+  // Cached nodes, nullptr if the node does not exist
+  std::unordered_map<std::string, NodePtr> nodes_;
+  std::unordered_set<std::string> dirtyNodes_;
+  std::optional<std::string> entry_;
+  bool entryDirty_{false};
+  std::unordered_set<std::string> readKeys_;
+};
+
+}  // namespace storage
+}  // namespace nebula
+
+#endif  // STORAGE_INDEX_HNSWINDEX_H_
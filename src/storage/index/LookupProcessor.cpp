@@ -8,6 +8,7 @@
 #include <thrift/lib/cpp2/protocol/Serializer.h>
 
 #include "common/memory/MemoryTracker.h"
+#include "common/utils/IndexKeyUtils.h"
 #include "folly/Likely.h"
 #include "interface/gen-cpp2/common_types.tcc"
 #include "interface/gen-cpp2/meta_types.tcc"
@@ -15,11 +16,13 @@
 #include "storage/exec/IndexAggregateNode.h"
 #include "storage/exec/IndexDedupNode.h"
 #include "storage/exec/IndexEdgeScanNode.h"
+#include "storage/exec/IndexGeoKnnScanNode.h"
 #include "storage/exec/IndexLimitNode.h"
 #include "storage/exec/IndexNode.h"
 #include "storage/exec/IndexProjectionNode.h"
 #include "storage/exec/IndexSelectionNode.h"
 #include "storage/exec/IndexTopNNode.h"
+#include "storage/exec/IndexVectorScanNode.h"
 #include "storage/exec/IndexVertexScanNode.h"
 
 namespace nebula {
@@ -196,6 +199,31 @@ ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::bu
     if (!idx.ok()) {
       return nebula::cpp2::ErrorCode::E_INDEX_NOT_FOUND;
     }
+    bool isVectorIndex = IndexKeyUtils::isVectorIndex(*idx.value());
+    if (isVectorIndex || ctx.geo_knn_query_ref().has_value()) {
+      if (isVectorIndex && !ctx.vector_query_ref().has_value()) {
+        return nebula::cpp2::ErrorCode::E_INVALID_OPERATION;
+      }
+      // The filter is evaluated during the search, so that k results pass it
+      Expression* filter = nullptr;
+      if (ctx.filter_ref().is_set() && !ctx.get_filter().empty()) {
+        filter = Expression::decode(context_->objPool(), *ctx.filter_ref());
+      }
+      if (isVectorIndex) {
+        node = std::make_unique<IndexVectorScanNode>(context_.get(),
+                                                     ctx.get_index_id(),
+                                                     *ctx.vector_query_ref(),
+                                                     filter,
+                                                     context_->env()->kvstore_);
+      } else {
+        node = std::make_unique<IndexGeoKnnScanNode>(context_.get(),
+                                                     ctx.get_index_id(),
+                                                     *ctx.geo_knn_query_ref(),
+                                                     filter,
+                                                     context_->env()->kvstore_);
+      }
+      return node;
+    }
     auto cols = idx.value()->get_fields();
     bool hasNullableCol =
         std::any_of(cols.begin(), cols.end(), [](const meta::cpp2::ColumnDef& col) {
@@ -207,6 +235,11 @@ ErrorOr<nebula::cpp2::ErrorCode, std::unique_ptr<IndexNode>> LookupProcessor::bu
                                                  context_->env()->kvstore_,
                                                  hasNullableCol);
   }
+  auto* scanNode = static_cast<IndexScanNode*>(node.get());
+  if (ctx.range_hints_ref().has_value() && !ctx.range_hints_ref()->empty()) {
+    scanNode->setRangeHints(*ctx.range_hints_ref());
+  }
+  scanNode->setSkipScan(ctx.get_skip_scan());
   if (ctx.filter_ref().is_set() && !ctx.get_filter().empty()) {
     auto expr = Expression::decode(context_->objPool(), *ctx.filter_ref());
     auto filterNode = std::make_unique<IndexSelectionNode>(context_.get(), expr);
@@ -14,6 +14,7 @@
 #include "common/utils/NebulaKeyUtils.h"
 #include "common/utils/OperationKeyUtils.h"
 #include "storage/StorageFlags.h"
+#include "storage/index/HnswIndex.h"
 #include "storage/stats/StorageStats.h"
 
 namespace nebula {
@@ -232,6 +233,7 @@ kvstore::MergeableAtomicOpResult AddVerticesProcessor::addVerticesWithIndex(
   ret.code = nebula::cpp2::ErrorCode::E_RAFT_ATOMIC_OP_FAILED;
   IndexCountWrapper wrapper(env_);
   auto batchHolder = std::make_unique<kvstore::BatchHolder>();
+  std::vector<VectorIndexChange> vectorChanges;
   for (auto& vertice : vertices) {
     batchHolder->put(std::string(vertice), "");
   }
@@ -268,6 +270,11 @@ kvstore::MergeableAtomicOpResult AddVerticesProcessor::addVerticesWithIndex(
     }
     for (const auto& index : indexes_) {
       if (tagId == index->get_schema_id().get_tag_id()) {
+        // The vector indexes are updated together after all vertices are handled
+        if (IndexKeyUtils::isVectorIndex(*index)) {
+          HnswIndex::collectChange(index, vId.str(), &oldReader, &newReader, &vectorChanges);
+          continue;
+        }
         // step 1, Delete old version index if exists.
         if (oldReader != nullptr) {
           auto oldIndexKeys = indexKeys(partId, vId.str(), oldReader.get(), index, schema);
@@ -298,9 +305,8 @@ kvstore::MergeableAtomicOpResult AddVerticesProcessor::addVerticesWithIndex(
         if (newReader != nullptr) {
           auto newIndexKeys = indexKeys(partId, vId.str(), newReader.get(), index, schema);
           if (!newIndexKeys.empty()) {
-            // check if index has ttl field, write it to index value if exists
-            auto field = CommonUtils::ttlValue(schema, newReader.get());
-            auto indexVal = field.ok() ? IndexKeyUtils::indexVal(std::move(field).value()) : "";
+            // write the ttl field and included fields of index to index value if exists
+            auto indexVal = CommonUtils::indexValue(schema, newReader.get(), index.get());
             auto indexState = env_->getIndexState(spaceId_, partId);
             if (env_->checkRebuilding(indexState)) {
               for (auto& idxKey : newIndexKeys) {
@@ -326,6 +332,12 @@ kvstore::MergeableAtomicOpResult AddVerticesProcessor::addVerticesWithIndex(
     ret.writeSet.emplace_back(key);
     batchHolder->put(std::string(key), std::string(value));
   }
+  auto code = HnswIndex::applyChanges(
+      env_, spaceId_, partId, spaceVidLen_, vectorChanges, batchHolder.get(), &ret);
+  if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+    ret.code = code;
+    return ret;
+  }
   ret.batch = encodeBatchValue(batchHolder->getBatch());
   ret.code = nebula::cpp2::ErrorCode::SUCCEEDED;
   return ret;
@@ -69,7 +69,8 @@ void DeleteTagsProcessor::process(const cpp2::DeleteTagsRequest& req) {
       IndexCountWrapper wrapper(env_);
       auto partId = part.first;
       std::vector<VMLI> lockedKeys;
-      auto batch = deleteTags(partId, part.second, lockedKeys);
+      std::vector<VectorIndexChange> vectorChanges;
+      auto batch = deleteTags(partId, part.second, lockedKeys, &vectorChanges);
       if (!nebula::ok(batch)) {
         env_->verticesML_->unlockBatch(lockedKeys);
         handleAsync(spaceId_, partId, nebula::error(batch));
@@ -78,6 +79,25 @@ void DeleteTagsProcessor::process(const cpp2::DeleteTagsRequest& req) {
       // keys has been locked in deleteTags
       nebula::MemoryLockGuard<VMLI> lg(
           env_->verticesML_.get(), std::move(lockedKeys), false, false);
+      if (!vectorChanges.empty()) {
+        auto atomicOp = [partId,
+                         batch = std::move(nebula::value(batch)),
+                         changes = std::move(vectorChanges),
+                         this]() {
+          return HnswIndex::atomicOp(env_, spaceId_, partId, spaceVidLen_, batch, changes);
+        };
+        env_->kvstore_->asyncAtomicOp(
+            spaceId_,
+            partId,
+            std::move(atomicOp),
+            [l = std::move(lg), icw = std::move(wrapper), partId, this](
+                nebula::cpp2::ErrorCode code) {
+              UNUSED(l);
+              UNUSED(icw);
+              handleAsync(spaceId_, partId, code);
+            });
+        continue;
+      }
       env_->kvstore_->asyncAppendBatch(spaceId_,
                                        partId,
                                        std::move(nebula::value(batch)),
@@ -92,7 +112,10 @@ void DeleteTagsProcessor::process(const cpp2::DeleteTagsRequest& req) {
 }
 
 ErrorOr<nebula::cpp2::ErrorCode, std::string> DeleteTagsProcessor::deleteTags(
-    PartitionID partId, const std::vector<cpp2::DelTags>& delTags, std::vector<VMLI>& lockedKeys) {
+    PartitionID partId,
+    const std::vector<cpp2::DelTags>& delTags,
+    std::vector<VMLI>& lockedKeys,
+    std::vector<VectorIndexChange>* vectorChanges) {
   std::unique_ptr<kvstore::BatchHolder> batchHolder = std::make_unique<kvstore::BatchHolder>();
   for (const auto& entry : delTags) {
     const auto& vId = entry.get_id().getStr();
@@ -123,6 +146,10 @@ ErrorOr<nebula::cpp2::ErrorCode, std::string> DeleteTagsProcessor::deleteTags(
       }
       for (auto& index : indexes_) {
         if (index->get_schema_id().get_tag_id() == tagId) {
+          if (IndexKeyUtils::isVectorIndex(*index)) {
+            HnswIndex::collectChange(index, vId, &reader, nullptr, vectorChanges);
+            continue;
+          }
           auto indexId = index->get_index_id();
 
           auto valuesRet = IndexKeyUtils::collectIndexValues(reader.get(), index.get());
@@ -10,6 +10,7 @@
 #include "kvstore/LogEncoder.h"
 #include "storage/BaseProcessor.h"
 #include "storage/CommonUtils.h"
+#include "storage/index/HnswIndex.h"
 
 namespace nebula {
 namespace storage {
@@ -30,7 +31,10 @@ class DeleteTagsProcessor : public BaseProcessor<cpp2::ExecResponse> {
       : BaseProcessor<cpp2::ExecResponse>(env, counters) {}
 
   ErrorOr<nebula::cpp2::ErrorCode, std::string> deleteTags(
-      PartitionID partId, const std::vector<cpp2::DelTags>& delTags, std::vector<VMLI>& lockKeys);
+      PartitionID partId,
+      const std::vector<cpp2::DelTags>& delTags,
+      std::vector<VMLI>& lockKeys,
+      std::vector<VectorIndexChange>* vectorChanges);
 
  private:
   GraphSpaceID spaceId_;
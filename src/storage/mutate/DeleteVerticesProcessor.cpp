@@ -88,7 +88,8 @@ void DeleteVerticesProcessor::process(const cpp2::DeleteVerticesRequest& req) {
       IndexCountWrapper wrapper(env_);
       auto partId = pv.first;
       std::vector<VMLI> dummyLock;
-      auto batch = deleteVertices(partId, std::move(pv).second, dummyLock);
+      std::vector<VectorIndexChange> vectorChanges;
+      auto batch = deleteVertices(partId, std::move(pv).second, dummyLock, &vectorChanges);
       if (!nebula::ok(batch)) {
         env_->verticesML_->unlockBatch(dummyLock);
         handleAsync(spaceId_, partId, nebula::error(batch));
@@ -96,6 +97,26 @@ void DeleteVerticesProcessor::process(const cpp2::DeleteVerticesRequest& req) {
       }
       DCHECK(!nebula::value(batch).empty());
       nebula::MemoryLockGuard<VMLI> lg(env_->verticesML_.get(), std::move(dummyLock), false, false);
+      if (!vectorChanges.empty()) {
+        // The HNSW graph is read when removing the vertices, so it has to be an atomic op
+        auto atomicOp = [partId,
+                         batch = std::move(nebula::value(batch)),
+                         changes = std::move(vectorChanges),
+                         this]() {
+          return HnswIndex::atomicOp(env_, spaceId_, partId, spaceVidLen_, batch, changes);
+        };
+        env_->kvstore_->asyncAtomicOp(
+            spaceId_,
+            partId,
+            std::move(atomicOp),
+            [l = std::move(lg), icw = std::move(wrapper), partId, this](
+                nebula::cpp2::ErrorCode code) {
+              UNUSED(l);
+              UNUSED(icw);
+              handleAsync(spaceId_, partId, code);
+            });
+        continue;
+      }
       env_->kvstore_->asyncAppendBatch(spaceId_,
                                        partId,
                                        std::move(nebula::value(batch)),
@@ -110,7 +131,10 @@ void DeleteVerticesProcessor::process(const cpp2::DeleteVerticesRequest& req) {
 }
 
 ErrorOr<nebula::cpp2::ErrorCode, std::string> DeleteVerticesProcessor::deleteVertices(
-    PartitionID partId, const std::vector<Value>& vertices, std::vector<VMLI>& target) {
+    PartitionID partId,
+    const std::vector<Value>& vertices,
+    std::vector<VMLI>& target,
+    std::vector<VectorIndexChange>* vectorChanges) {
   target.reserve(vertices.size());
   std::unique_ptr<kvstore::BatchHolder> batchHolder = std::make_unique<kvstore::BatchHolder>();
   for (auto& vertex : vertices) {
@@ -154,6 +178,10 @@ ErrorOr<nebula::cpp2::ErrorCode, std::string> DeleteVerticesProcessor::deleteVer
               return nebula::cpp2::ErrorCode::E_INVALID_DATA;
             }
           }
+          if (IndexKeyUtils::isVectorIndex(*index)) {
+            HnswIndex::collectChange(index, vertex.getStr(), &reader, nullptr, vectorChanges);
+            continue;
+          }
           auto valuesRet =
               IndexKeyUtils::collectIndexValues(reader.get(), index.get(), schema.get());
           if (!valuesRet.ok()) {
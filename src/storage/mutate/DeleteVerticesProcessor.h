@@ -10,6 +10,7 @@
 #include "kvstore/LogEncoder.h"
 #include "storage/BaseProcessor.h"
 #include "storage/CommonUtils.h"
+#include "storage/index/HnswIndex.h"
 
 namespace nebula {
 namespace storage {
@@ -29,9 +30,11 @@ class DeleteVerticesProcessor : public BaseProcessor<cpp2::ExecResponse> {
   DeleteVerticesProcessor(StorageEnv* env, const ProcessorCounters* counters)
       : BaseProcessor<cpp2::ExecResponse>(env, counters) {}
 
-  ErrorOr<nebula::cpp2::ErrorCode, std::string> deleteVertices(PartitionID partId,
-                                                               const std::vector<Value>& vertices,
-                                                               std::vector<VMLI>& target);
+  ErrorOr<nebula::cpp2::ErrorCode, std::string> deleteVertices(
+      PartitionID partId,
+      const std::vector<Value>& vertices,
+      std::vector<VMLI>& target,
+      std::vector<VectorIndexChange>* vectorChanges);
 
  private:
   GraphSpaceID spaceId_;
@@ -267,6 +267,13 @@ StoragePlan<VertexID> GetNeighborsProcessor::buildPlan(RuntimeContext* context,
     join = hashJoin.get();
     upstream = hashJoin.get();
     plan.addNode(std::move(hashJoin));
+    if (dstFilter_ != nullptr) {
+      auto runtimeFilter =
+          std::make_unique<RuntimeFilterNode<VertexID>>(context, upstream, dstFilter_.get());
+      runtimeFilter->addDependency(upstream);
+      upstream = runtimeFilter.get();
+      plan.addNode(std::move(runtimeFilter));
+    }
   } else {
     context->filterInvalidResultOut = true;
     auto groupNode = std::make_unique<MultiTagNode>(context, tags, expCtx);
@@ -349,6 +356,14 @@ nebula::cpp2::ErrorCode GetNeighborsProcessor::checkAndBuildContexts(
   if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
     return code;
   }
+  const auto& traverseSpec = req.get_traverse_spec();
+  if (traverseSpec.dst_filter_ref().has_value()) {
+    dstFilter_ = std::make_unique<RuntimeDstFilter>();
+    code = dstFilter_->init(*traverseSpec.dst_filter_ref(), this->isIntId_);
+    if (code != nebula::cpp2::ErrorCode::SUCCEEDED) {
+      return code;
+    }
+  }
   return nebula::cpp2::ErrorCode::SUCCEEDED;
 }
 
@@ -9,6 +9,7 @@
 #include <gtest/gtest_prod.h>
 
 #include "common/base/Base.h"
+#include "storage/exec/RuntimeFilterNode.h"
 #include "storage/exec/StoragePlan.h"
 #include "storage/query/QueryBaseProcessor.h"
 
@@ -86,6 +87,8 @@ class GetNeighborsProcessor
   std::vector<RuntimeContext> contexts_;
   std::vector<StorageExpressionContext> expCtxs_;
   std::vector<nebula::DataSet> results_;
+  // The filter of edges' dst shipped from graph, shared by all parts
+  std::unique_ptr<RuntimeDstFilter> dstFilter_;
 };
 
 }  // namespace storage
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/algorithm/BloomFilter.h"
 #include "common/base/Base.h"
 #include "common/fs/TempDir.h"
 #include "storage/query/GetNeighborsProcessor.h"
@@ -1212,6 +1213,80 @@ TEST(GetNeighborsTest, FailedTest) {
   }
 }
 
+TEST(GetNeighborsTest, RuntimeFilterTest) {
+  fs::TempDir rootPath("/tmp/GetNeighborsTest.XXXXXX");
+  mock::MockCluster cluster;
+  cluster.initStorageKV(rootPath.path());
+  auto* env = cluster.storageEnv_.get();
+  auto totalParts = cluster.getTotalParts();
+  ASSERT_EQ(true, QueryTestUtils::mockVertexData(env, totalParts));
+  ASSERT_EQ(true, QueryTestUtils::mockEdgeData(env, totalParts));
+  auto threadPool = std::make_shared<folly::IOThreadPoolExecutor>(4);
+
+  TagID team = 2;
+  EdgeType serve = 101;
+  std::vector<VertexID> vertices = {"Spurs"};
+  std::vector<EdgeType> over = {-serve};
+  std::vector<std::pair<TagID, std::vector<std::string>>> tags;
+  std::vector<std::pair<EdgeType, std::vector<std::string>>> edges;
+  tags.emplace_back(team, std::vector<std::string>{"name"});
+  edges.emplace_back(-serve, std::vector<std::string>{"playerName", "startYear", "teamCareer"});
+
+  auto getNeighbors = [&](cpp2::RuntimeFilter filter) {
+    auto req = QueryTestUtils::buildRequest(totalParts, vertices, over, tags, edges);
+    (*req.traverse_spec_ref()).dst_filter_ref() = std::move(filter);
+    auto* processor = GetNeighborsProcessor::instance(env, nullptr, threadPool.get());
+    auto fut = processor->getFuture();
+    processor->process(req);
+    return std::move(fut).get();
+  };
+
+  size_t exactEdges = 0;
+  {
+    LOG(INFO) << "ExactKeys";
+    cpp2::RuntimeFilter filter;
+    filter.keys_ref() = std::vector<Value>{"Tim Duncan", "Tony Parker", "Not Exists"};
+    auto resp = getNeighbors(std::move(filter));
+    ASSERT_EQ(0, (*resp.result_ref()).failed_parts.size());
+    ASSERT_EQ(1, (*resp.vertices_ref()).rows.size());
+    // vId, stat, team, -serve, expr
+    const auto& row = (*resp.vertices_ref()).rows[0];
+    ASSERT_EQ(5, row.values.size());
+    ASSERT_TRUE(row.values[3].isList());
+    for (const auto& edge : row.values[3].getList().values) {
+      const auto& name = edge.getList().values[0].getStr();
+      EXPECT_TRUE(name == "Tim Duncan" || name == "Tony Parker") << name;
+    }
+    exactEdges = row.values[3].getList().values.size();
+    ASSERT_GE(exactEdges, 2);
+  }
+  {
+    LOG(INFO) << "BloomFilter";
+    algorithm::BloomFilter bloom(2);
+    bloom.add("Tim Duncan");
+    bloom.add("Tony Parker");
+    cpp2::RuntimeFilter filter;
+    filter.bloom_ref() = bloom.bits();
+    filter.num_hashes_ref() = bloom.numHashes();
+    auto resp = getNeighbors(std::move(filter));
+    ASSERT_EQ(0, (*resp.result_ref()).failed_parts.size());
+    ASSERT_EQ(1, (*resp.vertices_ref()).rows.size());
+    const auto& row = (*resp.vertices_ref()).rows[0];
+    ASSERT_TRUE(row.values[3].isList());
+    // No false negative
+    ASSERT_GE(row.values[3].getList().values.size(), exactEdges);
+  }
+  {
+    LOG(INFO) << "InvalidBloomFilter";
+    cpp2::RuntimeFilter filter;
+    filter.bloom_ref() = "";
+    auto resp = getNeighbors(std::move(filter));
+    ASSERT_EQ(1, (*resp.result_ref()).failed_parts.size());
+    ASSERT_EQ(nebula::cpp2::ErrorCode::E_INVALID_FILTER,
+              (*resp.result_ref()).failed_parts.front().code);
+  }
+}
+
 TEST(GetNeighborsTest, ReturnAllPropertyTest) {
   fs::TempDir rootPath("/tmp/GetNeighborsTest.XXXXXX");
   mock::MockCluster cluster;
@@ -0,0 +1,351 @@
+/* Copyright (c) 2023 vesoft inc. All rights reserved.
+ *
+ * This source code is licensed under Apache 2.0 License.
+ */
+
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "common/base/Base.h"
+#include "common/fs/TempDir.h"
+#include "common/utils/IndexKeyUtils.h"
+#include "mock/AdHocIndexManager.h"
+#include "mock/AdHocSchemaManager.h"
+#include "mock/MockCluster.h"
+#include "storage/index/HnswIndex.h"
+#include "storage/index/LookupProcessor.h"
+#include "storage/mutate/AddVerticesProcessor.h"
+#include "storage/mutate/DeleteVerticesProcessor.h"
+
+namespace nebula {
+namespace storage {
+
+constexpr GraphSpaceID kSpace = 1;
+constexpr PartitionID kPart = 1;
+constexpr size_t kDim = 8;
+
+using Filter = std::function<ErrorOr<nebula::cpp2::ErrorCode, bool>(const std::string&)>;
+
+class HnswIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    rootPath_ = std::make_unique<fs::TempDir>("/tmp/HnswIndexTest.XXXXXX");
+    cluster_.initStorageKV(rootPath_->path());
+    env_ = cluster_.storageEnv_.get();
+    vIdLen_ = env_->schemaMan_->getSpaceVidLen(kSpace).value();
+  }
+
+  // A tag with a vector and a timestamp, and the l2 vector index on it
+  void createTag(TagID tagId, IndexID indexId, int64_t ttlDuration = 0) {
+    auto* sm = reinterpret_cast<mock::AdHocSchemaManager*>(env_->schemaMan_);
+    auto schema = std::make_shared<meta::NebulaSchemaProvider>(0);
+    schema->addField("vec", nebula::cpp2::PropertyType::LIST_FLOAT, 0, true);
+    schema->addField("ts", nebula::cpp2::PropertyType::INT64);
+    if (ttlDuration > 0) {
+      meta::cpp2::SchemaProp prop;
+      prop.ttl_col_ref() = "ts";
+      prop.ttl_duration_ref() = ttlDuration;
+      schema->setProp(prop);
+    }
+    sm->addTagSchema(kSpace, tagId, std::move(schema));
+
+    auto* im = reinterpret_cast<mock::AdHocIndexManager*>(env_->indexMan_);
+    meta::cpp2::ColumnDef col;
+    col.name = "vec";
+    col.type.type_ref() = nebula::cpp2::PropertyType::LIST_FLOAT;
+    im->addTagIndex(kSpace, tagId, indexId, {col});
+    index_ = im->getTagIndex(kSpace, indexId).value();
+    meta::cpp2::IndexParams params;
+    params.vector_metric_ref() = meta::cpp2::VectorMetric::L2;
+    index_->index_params_ref() = std::move(params);
+    tagId_ = tagId;
+  }
+
+  std::vector<float> randomVector() {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> vec(kDim);
+    for (auto& v : vec) {
+      v = dist(gen_);
+    }
+    return vec;
+  }
+
+  void addVertices(const std::map<std::string, std::vector<float>>& vertices, int64_t ts) {
+    cpp2::AddVerticesRequest req;
+    req.space_id_ref() = kSpace;
+    for (const auto& [vId, vec] : vertices) {
+      List list;
+      for (auto v : vec) {
+        list.values.emplace_back(static_cast<double>(v));
+      }
+      cpp2::NewTag newTag;
+      newTag.tag_id_ref() = tagId_;
+      newTag.props_ref() = {Value(std::move(list)), Value(ts)};
+      cpp2::NewVertex newVertex;
+      newVertex.id_ref() = vId;
+      newVertex.tags_ref() = {std::move(newTag)};
+      (*req.parts_ref())[kPart].emplace_back(std::move(newVertex));
+    }
+    auto* processor = AddVerticesProcessor::instance(env_, nullptr);
+    auto fut = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(fut).get();
+    EXPECT_EQ(0, resp.result.failed_parts.size());
+  }
+
+  void deleteVertices(const std::vector<std::string>& vIds) {
+    cpp2::DeleteVerticesRequest req;
+    req.space_id_ref() = kSpace;
+    for (const auto& vId : vIds) {
+      (*req.parts_ref())[kPart].emplace_back(vId);
+    }
+    auto* processor = DeleteVerticesProcessor::instance(env_, nullptr);
+    auto fut = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(fut).get();
+    EXPECT_EQ(0, resp.result.failed_parts.size());
+  }
+
+  // A new instance reads the graph flushed into kvstore
+  std::vector<std::string> search(const std::vector<float>& query,
+                                  size_t k,
+                                  size_t ef,
+                                  const Filter& filter = nullptr) {
+    HnswIndex hnsw(env_->kvstore_, kSpace, kPart, vIdLen_, *index_);
+    auto ret = hnsw.search(query, k, ef, filter);
+    EXPECT_TRUE(nebula::ok(ret));
+    std::vector<std::string> vIds;
+    if (nebula::ok(ret)) {
+      for (const auto& result : nebula::value(ret)) {
+        vIds.emplace_back(trim(result.first));
+      }
+    }
+    return vIds;
+  }
+
+  static std::vector<std::string> bruteForce(const std::map<std::string, std::vector<float>>& all,
+                                             const std::vector<float>& query,
+                                             size_t k) {
+    std::vector<std::pair<float, std::string>> dists;
+    for (const auto& [vId, vec] : all) {
+      float dist = 0;
+      for (size_t i = 0; i < kDim; ++i) {
+        dist += (vec[i] - query[i]) * (vec[i] - query[i]);
+      }
+      dists.emplace_back(dist, vId);
+    }
+    std::sort(dists.begin(), dists.end());
+    std::vector<std::string> vIds;
+    for (size_t i = 0; i < dists.size() && i < k; ++i) {
+      vIds.emplace_back(dists[i].second);
+    }
+    return vIds;
+  }
+
+  static double recall(const std::vector<std::string>& expected,
+                       const std::vector<std::string>& actual) {
+    std::unordered_set<std::string> set(actual.begin(), actual.end());
+    size_t hit = 0;
+    for (const auto& vId : expected) {
+      hit += set.count(vId);
+    }
+    return expected.empty() ? 1.0 : static_cast<double>(hit) / expected.size();
+  }
+
+  size_t nodeCount() {
+    auto prefix = IndexKeyUtils::vectorNodePrefix(kPart, index_->get_index_id());
+    std::unique_ptr<kvstore::KVIterator> iter;
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+              env_->kvstore_->prefix(kSpace, kPart, prefix, &iter));
+    size_t count = 0;
+    for (; iter->valid(); iter->next()) {
+      ++count;
+    }
+    return count;
+  }
+
+  static std::string trim(const std::string& vId) {
+    return vId.substr(0, vId.find('\0'));
+  }
+
+  std::mt19937 gen_{42};
+  std::unique_ptr<fs::TempDir> rootPath_;
+  mock::MockCluster cluster_;
+  StorageEnv* env_{nullptr};
+  size_t vIdLen_{0};
+  TagID tagId_{0};
+  std::shared_ptr<meta::cpp2::IndexItem> index_;
+};
+
+TEST_F(HnswIndexTest, InsertSearchRemove) {
+  createTag(3001, 3002);
+  std::map<std::string, std::vector<float>> all;
+  // Each batch is written by a new instance, which reads the graph written before
+  for (int32_t batch = 0; batch < 3; ++batch) {
+    std::map<std::string, std::vector<float>> vertices;
+    for (int32_t i = 0; i < 100; ++i) {
+      vertices.emplace(folly::sformat("v{}", batch * 100 + i), randomVector());
+    }
+    addVertices(vertices, 0);
+    all.insert(vertices.begin(), vertices.end());
+  }
+  EXPECT_EQ(all.size(), nodeCount());
+
+  double total = 0;
+  for (int32_t i = 0; i < 20; ++i) {
+    auto query = randomVector();
+    total += recall(bruteForce(all, query, 10), search(query, 10, 64));
+  }
+  EXPECT_GE(total / 20, 0.9);
+
+  // The removed ones are not returned, and the rest are still reachable
+  std::vector<std::string> removed;
+  for (auto iter = all.begin(); iter != all.end();) {
+    if (removed.size() < 100 && std::stoi(iter->first.substr(1)) % 3 == 0) {
+      removed.emplace_back(iter->first);
+      iter = all.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  deleteVertices(removed);
+  EXPECT_EQ(all.size(), nodeCount());
+  total = 0;
+  for (int32_t i = 0; i < 20; ++i) {
+    auto query = randomVector();
+    auto result = search(query, 10, 64);
+    for (const auto& vId : result) {
+      EXPECT_EQ(1UL, all.count(vId)) << vId;
+    }
+    total += recall(bruteForce(all, query, 10), result);
+  }
+  EXPECT_GE(total / 20, 0.9);
+
+  // The dimension must be the same as the indexed ones
+  HnswIndex hnsw(env_->kvstore_, kSpace, kPart, vIdLen_, *index_);
+  EXPECT_FALSE(nebula::ok(hnsw.search(std::vector<float>(kDim + 1, 0.0f), 10, 64)));
+}
+
+TEST_F(HnswIndexTest, Filter) {
+  createTag(3011, 3012);
+  std::map<std::string, std::vector<float>> all;
+  for (int32_t i = 0; i < 300; ++i) {
+    all.emplace(folly::sformat("v{}", i), randomVector());
+  }
+  addVertices(all, 0);
+
+  // Only 1 of 30 passes the filter, the search goes on until k of them are found
+  std::map<std::string, std::vector<float>> passed;
+  for (const auto& [vId, vec] : all) {
+    if (std::stoi(vId.substr(1)) % 30 == 0) {
+      passed.emplace(vId, vec);
+    }
+  }
+  size_t evaluated = 0;
+  Filter filter = [&passed, &evaluated](
+                      const std::string& vId) -> ErrorOr<nebula::cpp2::ErrorCode, bool> {
+    ++evaluated;
+    return passed.count(trim(vId)) > 0;
+  };
+  double total = 0;
+  for (int32_t i = 0; i < 20; ++i) {
+    auto query = randomVector();
+    auto result = search(query, 5, 10, filter);
+    ASSERT_EQ(5UL, result.size());
+    for (const auto& vId : result) {
+      EXPECT_EQ(1UL, passed.count(vId)) << vId;
+    }
+    total += recall(bruteForce(passed, query, 5), result);
+  }
+  EXPECT_GE(total / 20, 0.8);
+  // Each vertex is evaluated at most once in a search
+  EXPECT_LE(evaluated, all.size() * 20);
+
+  // No one passes, all the reachable vertices are visited
+  Filter none = [](const std::string&) -> ErrorOr<nebula::cpp2::ErrorCode, bool> {
+    return false;
+  };
+  EXPECT_TRUE(search(randomVector(), 5, 10, none).empty());
+  // The error of filter is returned
+  HnswIndex hnsw(env_->kvstore_, kSpace, kPart, vIdLen_, *index_);
+  Filter error = [](const std::string&) -> ErrorOr<nebula::cpp2::ErrorCode, bool> {
+    return nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND;
+  };
+  auto ret = hnsw.search(randomVector(), 5, 10, error);
+  ASSERT_FALSE(nebula::ok(ret));
+  EXPECT_EQ(nebula::cpp2::ErrorCode::E_KEY_NOT_FOUND, nebula::error(ret));
+}
+
+TEST_F(HnswIndexTest, RemoveExpired) {
+  createTag(3021, 3022, 60);
+  std::map<std::string, std::vector<float>> alive;
+  std::map<std::string, std::vector<float>> expired;
+  for (int32_t i = 0; i < 20; ++i) {
+    auto& vertices = i % 2 == 0 ? expired : alive;
+    vertices.emplace(folly::sformat("v{}", i), randomVector());
+  }
+  addVertices(alive, std::time(nullptr));
+  addVertices(expired, std::time(nullptr) - 3600);
+  EXPECT_EQ(20UL, nodeCount());
+
+  // The expired ones are skipped by the index scan, though they're still in the graph
+  auto lookup = [this](size_t k) {
+    cpp2::LookupIndexRequest req;
+    req.space_id_ref() = kSpace;
+    req.parts_ref() = {kPart};
+    req.return_columns_ref() = {kVid, kDistance};
+    cpp2::VectorQuery query;
+    auto vec = randomVector();
+    query.vector_ref() = std::vector<double>(vec.begin(), vec.end());
+    query.k_ref() = k;
+    cpp2::IndexQueryContext context;
+    context.index_id_ref() = index_->get_index_id();
+    context.filter_ref() = "";
+    context.vector_query_ref() = std::move(query);
+    cpp2::IndexSpec indices;
+    nebula::cpp2::SchemaID schemaId;
+    schemaId.tag_id_ref() = tagId_;
+    indices.schema_id_ref() = schemaId;
+    indices.contexts_ref() = {std::move(context)};
+    req.indices_ref() = std::move(indices);
+    auto threadPool = std::make_shared<folly::IOThreadPoolExecutor>(1);
+    auto* processor = LookupProcessor::instance(env_, nullptr, threadPool.get());
+    auto fut = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(fut).get();
+    EXPECT_EQ(0, resp.result.failed_parts.size());
+    std::set<std::string> vIds;
+    for (const auto& row : resp.get_data()->rows) {
+      vIds.emplace(trim(row[0].getStr()));
+    }
+    return vIds;
+  };
+  std::set<std::string> aliveIds;
+  for (const auto& kv : alive) {
+    aliveIds.emplace(kv.first);
+  }
+  EXPECT_EQ(aliveIds, lookup(20));
+
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            HnswIndex::removeExpired(env_, kSpace, kPart, vIdLen_, index_));
+  EXPECT_EQ(alive.size(), nodeCount());
+  auto result = search(randomVector(), 20, 20);
+  EXPECT_EQ(aliveIds, std::set<std::string>(result.begin(), result.end()));
+  EXPECT_EQ(aliveIds, lookup(20));
+  // Nothing changes if called again
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED,
+            HnswIndex::removeExpired(env_, kSpace, kPart, vIdLen_, index_));
+  EXPECT_EQ(alive.size(), nodeCount());
+}
+
+}  // namespace storage
+}  // namespace nebula
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  folly::init(&argc, &argv, true);
+  google::SetStderrLogging(google::INFO);
+  return RUN_ALL_TESTS();
+}
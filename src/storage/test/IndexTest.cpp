@@ -173,15 +173,14 @@ class IndexScanTest : public ::testing::Test {
       auto value = writer.moveEncodedStr();
       CHECK(ret[0].insert({key, value}).second);
       RowReaderWrapper reader(schema.get(), folly::StringPiece(value), schemaVer);
-      auto ttlProperty = CommonUtils::ttlValue(schema.get(), reader.get());
-      auto ttlValue = ttlProperty.ok() ? IndexKeyUtils::indexVal(ttlProperty.value()) : "";
       for (size_t j = 0; j < indices.size(); j++) {
         auto& index = indices[j];
+        auto indexVal = CommonUtils::indexValue(schema.get(), &reader, index.get());
         auto indexValue = IndexKeyUtils::collectIndexValues(&reader, index.get()).value();
         auto indexKeys = IndexKeyUtils::vertexIndexKeys(
             8, 0, index->get_index_id(), std::to_string(i), std::move(indexValue));
         for (auto& indexKey : indexKeys) {
-          CHECK(ret[j + 1].insert({indexKey, ttlValue}).second);
+          CHECK(ret[j + 1].insert({indexKey, indexVal}).second);
         }
       }
     }
@@ -575,6 +574,172 @@ TEST_F(IndexScanTest, Vertex) {
   }  // End of Case 2
 }
 
+TEST_F(IndexScanTest, CoveringVertex) {
+  auto rows = R"(
+    int | int
+    1   | 2
+    1   | 3
+  )"_row;
+  auto schema = R"(
+    a   | int | | false
+    b   | int | | false
+  )"_schema;
+  auto indices = R"(
+    TAG(t,1)
+    (i1,2):a
+  )"_index(schema);
+  // b is stored in index value
+  meta::cpp2::IndexParams params;
+  params.included_fields_ref() = {"b"};
+  indices[0]->index_params_ref() = std::move(params);
+  bool hasNullableCol = schema->hasNullableCol();
+  auto kv = encodeTag(rows, 1, schema, indices);
+  auto kvstore = std::make_unique<MockKVStore>();
+  // Only put index key-values into kvstore
+  for (auto& item : kv[1]) {
+    kvstore->put(item.first, item.second);
+  }
+  std::vector<ColumnHint> columnHints{
+      makeColumnHint("a", Value(1))  // a=1
+  };
+  IndexID indexId = 0;
+  auto context = makeContext(1, 0);
+  auto scanNode = std::make_unique<IndexVertexScanNode>(
+      context.get(), indexId, columnHints, kvstore.get(), hasNullableCol);
+  IndexScanTestHelper helper;
+  helper.setIndex(scanNode.get(), indices[0]);
+  helper.setTag(scanNode.get(), schema);
+  InitContext initCtx;
+  initCtx.requiredColumns = {kVid, "a", "b"};
+  scanNode->init(initCtx);
+  scanNode->execute(0);
+
+  std::vector<Row> result;
+  while (true) {
+    auto res = scanNode->next();
+    ASSERT(res.success());
+    if (!res.hasData()) {
+      break;
+    }
+    result.emplace_back(std::move(res).row());
+  }
+  auto expect = R"(
+    string | int | int
+    0      | 1   | 2
+    1      | 1   | 3
+  )"_row;
+  std::vector<std::string> colOrder = {kVid, "a", "b"};
+  ASSERT_EQ(result.size(), expect.size());
+  for (size_t i = 0; i < result.size(); i++) {
+    ASSERT_EQ(result[i].size(), expect[i].size());
+    for (size_t j = 0; j < expect[i].size(); j++) {
+      ASSERT_EQ(expect[i][j], result[i][initCtx.retColMap[colOrder[j]]]);
+    }
+  }
+}
+
+TEST_F(IndexScanTest, MultiRangeAndSkipScan) {
+  auto rows = R"(
+    int | int
+    1   | 1
+    1   | 5
+    2   | 1
+    2   | 5
+    3   | 5
+    4   | 2
+  )"_row;
+  auto schema = R"(
+    a   | int | | false
+    b   | int | | false
+  )"_schema;
+  auto indices = R"(
+    TAG(t,1)
+    (i1,2):a,b
+  )"_index(schema);
+  auto kv = encodeTag(rows, 1, schema, indices);
+  auto kvstore = std::make_unique<MockKVStore>();
+  for (auto& item : kv[1]) {
+    kvstore->put(item.first, item.second);
+  }
+  auto scan = [&](const std::vector<std::vector<ColumnHint>>& rangeHints,
+                  const std::vector<ColumnHint>& columnHints,
+                  bool skipScan) {
+    auto context = makeContext(1, 0);
+    auto scanNode = std::make_unique<IndexVertexScanNode>(
+        context.get(), 0, columnHints, kvstore.get(), schema->hasNullableCol());
+    IndexScanTestHelper helper;
+    helper.setIndex(scanNode.get(), indices[0]);
+    helper.setTag(scanNode.get(), schema);
+    scanNode->setRangeHints(rangeHints);
+    scanNode->setSkipScan(skipScan);
+    InitContext initCtx;
+    initCtx.requiredColumns = {kVid};
+    EXPECT_EQ(::nebula::cpp2::ErrorCode::SUCCEEDED, scanNode->init(initCtx));
+    scanNode->execute(0);
+    std::vector<Row> result;
+    while (true) {
+      auto res = scanNode->next();
+      EXPECT_TRUE(res.success());
+      if (!res.success() || !res.hasData()) {
+        break;
+      }
+      result.emplace_back(std::move(res).row());
+    }
+    return result;
+  };
+  // a in [1, 4, 3]
+  {
+    auto expect = R"(
+      string
+      0
+      1
+      4
+      5
+    )"_row;
+    auto result = scan({{makeColumnHint("a", Value(1))},
+                        {makeColumnHint("a", Value(4))},
+                        {makeColumnHint("a", Value(3))}},
+                       {},
+                       false);
+    EXPECT_EQ(expect, result);
+  }
+  // The overlapped ranges: 1 <= a < 3 or a == 2 and b == 5
+  {
+    auto expect = R"(
+      string
+      0
+      1
+      2
+      3
+    )"_row;
+    auto result = scan({{makeColumnHint<true, false>("a", Value(1), Value(3))},
+                        {makeColumnHint("a", Value(2)), makeColumnHint("b", Value(5))}},
+                       {},
+                       false);
+    EXPECT_EQ(expect, result);
+  }
+  // b == 5, skip a
+  {
+    auto expect = R"(
+      string
+      1
+      3
+      4
+    )"_row;
+    auto result = scan({}, {makeColumnHint("b", Value(5))}, true);
+    EXPECT_EQ(expect, result);
+  }
+  // b >= 2 and b < 5, skip a
+  {
+    auto expect = R"(
+      string
+      5
+    )"_row;
+    auto result = scan({}, {makeColumnHint<true, false>("b", Value(2), Value(5))}, true);
+    EXPECT_EQ(expect, result);
+  }
+}
+
 TEST_F(IndexScanTest, Edge) {
   auto rows = R"(
     int | int | int
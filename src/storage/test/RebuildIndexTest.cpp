@@ -6,9 +6,11 @@
 #include <gtest/gtest.h>
 
 #include "common/base/Base.h"
+#include "common/fs/FileUtils.h"
 #include "common/fs/TempDir.h"
 #include "mock/MockCluster.h"
 #include "mock/MockData.h"
+#include "storage/StorageFlags.h"
 #include "storage/admin/AdminTaskManager.h"
 #include "storage/admin/RebuildEdgeIndexTask.h"
 #include "storage/admin/RebuildTagIndexTask.h"
@@ -406,6 +408,79 @@ TEST_F(RebuildIndexTest, RebuildTagIndex) {
   }
 }
 
+TEST_F(RebuildIndexTest, RebuildTagIndexByIngest) {
+  gflags::FlagSaver saver;
+  FLAGS_rebuild_index_by_ingest = true;
+  // Add Vertices
+  {
+    auto* processor = AddVerticesProcessor::instance(RebuildIndexTest::env_, nullptr);
+    cpp2::AddVerticesRequest req = mock::MockData::mockAddVerticesReq();
+    auto fut = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(fut).get();
+    EXPECT_EQ(0, resp.result.failed_parts.size());
+  }
+  // The part with another replica is rebuilt through raft, the others are ingested
+  auto partRet = RebuildIndexTest::env_->kvstore_->part(1, 6);
+  ASSERT_TRUE(nebula::ok(partRet));
+  nebula::value(partRet)->addLearner(HostAddr("127.0.0.1", 1), true);
+  ASSERT_EQ(2, nebula::value(partRet)->peers().size());
+
+  cpp2::TaskPara parameter;
+  parameter.space_id_ref() = 1;
+  std::vector<PartitionID> parts = {1, 2, 3, 4, 5, 6};
+  parameter.parts_ref() = parts;
+  parameter.task_specific_paras_ref() = {"4", "5"};
+
+  cpp2::AddTaskRequest request;
+  request.job_type_ref() = meta::cpp2::JobType::REBUILD_TAG_INDEX;
+  request.job_id_ref() = ++gJobId;
+  request.task_id_ref() = 13;
+  request.para_ref() = std::move(parameter);
+
+  auto callback = [](nebula::cpp2::ErrorCode, nebula::meta::cpp2::StatsItem&) {};
+  TaskContext context(request, callback);
+
+  auto task = std::make_shared<RebuildTagIndexTask>(RebuildIndexTest::env_, std::move(context));
+  manager_->addAsyncTask(task);
+
+  // Wait for the task finished
+  do {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  } while (!manager_->isFinished(context.jobId_, context.taskId_));
+
+  // Every vertex has an entry of both indexes in its part
+  LOG(INFO) << "Check rebuild tag index by ingest...";
+  for (auto& key : mock::MockData::mockPlayerIndexKeys()) {
+    std::string value;
+    auto code = RebuildIndexTest::env_->kvstore_->get(1, key.first, key.second, &value);
+    EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, code);
+  }
+  for (auto part : parts) {
+    auto count = [part](const std::string& prefix) {
+      std::unique_ptr<kvstore::KVIterator> iter;
+      auto ret = RebuildIndexTest::env_->kvstore_->prefix(1, part, prefix, &iter);
+      EXPECT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, ret);
+      int num = 0;
+      for (; iter && iter->valid(); iter->next()) {
+        num++;
+      }
+      return num;
+    };
+    auto dataNum = count(NebulaKeyUtils::tagPrefix(part));
+    EXPECT_LT(0, dataNum);
+    EXPECT_EQ(2 * dataNum, count(IndexKeyUtils::indexPrefix(part))) << "part " << part;
+
+    // The sorted files are removed after ingested
+    auto engine = nebula::value(RebuildIndexTest::env_->kvstore_->part(1, part))->engine();
+    auto dir = folly::sformat("{}/rebuild_index/{}", engine->getDataRoot(), part);
+    EXPECT_FALSE(fs::FileUtils::exist(dir));
+  }
+
+  RebuildIndexTest::env_->rebuildIndexGuard_->clear();
+  sleep(1);
+}
+
 TEST_F(RebuildIndexTest, RebuildEdgeIndexWithDelete) {
   auto writer = std::make_unique<thread::GenericWorker>();
   EXPECT_TRUE(writer->start());
@@ -3,14 +3,17 @@
  * This source code is licensed under Apache 2.0 License.
  */
 
+#include <folly/synchronization/Baton.h>
 #include <gtest/gtest.h>
 
 #include "common/base/Base.h"
 #include "common/fs/TempDir.h"
+#include "common/utils/IndexStatsUtils.h"
 #include "interface/gen-cpp2/meta_types.h"
 #include "mock/MockCluster.h"
 #include "mock/MockData.h"
 #include "storage/admin/AdminTaskManager.h"
+#include "storage/admin/IndexStatsTask.h"
 #include "storage/admin/StatsTask.h"
 #include "storage/mutate/AddEdgesProcessor.h"
 #include "storage/mutate/AddVerticesProcessor.h"
@@ -390,6 +393,72 @@ TEST_F(StatsTaskTest, StatsTagAndEdgeData) {
   }
 }
 
+TEST_F(StatsTaskTest, IndexStats) {
+  {
+    auto* processor = AddVerticesProcessor::instance(StatsTaskTest::env_, nullptr);
+    cpp2::AddVerticesRequest req = mock::MockData::mockAddVerticesReq();
+    auto fut = processor->getFuture();
+    processor->process(req);
+    auto resp = std::move(fut).get();
+    EXPECT_EQ(0, resp.result.failed_parts.size());
+  }
+
+  cpp2::TaskPara parameter;
+  parameter.space_id_ref() = 1;
+  parameter.parts_ref() = {1, 2, 3, 4, 5, 6};
+  // The index of player on name, age and playing
+  parameter.task_specific_paras_ref() = {"1"};
+
+  cpp2::AddTaskRequest request;
+  request.job_type_ref() = meta::cpp2::JobType::INDEX_STATS;
+  request.job_id_ref() = ++gJobId;
+  request.task_id_ref() = 15;
+  request.para_ref() = std::move(parameter);
+
+  folly::Baton<true, std::atomic> baton;
+  nebula::cpp2::ErrorCode code = nebula::cpp2::ErrorCode::E_UNKNOWN;
+  nebula::meta::cpp2::StatsItem statsItem;
+  auto callback = [&](nebula::cpp2::ErrorCode ret, nebula::meta::cpp2::StatsItem& result) {
+    code = ret;
+    statsItem = std::move(result);
+    baton.post();
+  };
+  TaskContext context(request, callback);
+  auto task = std::make_shared<IndexStatsTask>(StatsTaskTest::env_, std::move(context));
+  manager_->addAsyncTask(task);
+  ASSERT_TRUE(baton.try_wait_for(std::chrono::seconds(50)));
+
+  ASSERT_EQ(nebula::cpp2::ErrorCode::SUCCEEDED, code);
+  ASSERT_EQ(nebula::meta::cpp2::JobStatus::FINISHED, statsItem.get_status());
+  ASSERT_TRUE(statsItem.index_stats_ref().has_value());
+  ASSERT_EQ(1, statsItem.index_stats_ref()->size());
+  auto stats = statsItem.index_stats_ref()->at(1);
+  EXPECT_EQ(1, stats.get_index_id());
+  // The number of players
+  EXPECT_EQ(51, stats.get_rows());
+  ASSERT_EQ(3, stats.get_columns().size());
+  for (const auto& column : stats.get_columns()) {
+    EXPECT_EQ(0, column.get_null_count());
+    // Merged from all parts, but not finalized in storage
+    ASSERT_TRUE(column.sketch_ref().has_value());
+    ASSERT_TRUE(column.samples_ref().has_value());
+    EXPECT_EQ(51, column.samples_ref()->size());
+  }
+
+  IndexStatsUtils::finalize(stats, 8);
+  const auto& name = stats.get_columns()[0];
+  EXPECT_EQ("name", name.get_name());
+  EXPECT_LE(45, name.get_ndv());
+  EXPECT_GE(51, name.get_ndv());
+  const auto& age = stats.get_columns()[1];
+  EXPECT_EQ("age", age.get_name());
+  ASSERT_EQ(8, age.get_histogram().size());
+  EXPECT_TRUE(std::is_sorted(age.get_histogram().begin(), age.get_histogram().end()));
+  const auto& playing = stats.get_columns()[2];
+  EXPECT_EQ(2, playing.get_ndv());
+  EXPECT_FALSE(playing.sketch_ref().has_value());
+}
+
 }  // namespace storage
 }  // namespace nebula
 
@@ -0,0 +1,91 @@
+# Copyright (c) 2023 vesoft inc. All rights reserved.
+#
+# This source code is licensed under Apache 2.0 License.
+Feature: Match cyclic patterns by multiway join
+
+  Background:
+    Given a nebulacluster with 1 graphd and 1 metad and 1 storaged and 0 listener:
+      """
+      graphd:enable_multiway_join=true
+      """
+
+  @distonly
+  Scenario: cyclic patterns with and without statistics
+    Given create a space with following options:
+      | partition_num  | 1                |
+      | replica_factor | 1                |
+      | vid_type       | FIXED_STRING(20) |
+    And having executed:
+      """
+      CREATE TAG person(name string);
+      CREATE EDGE like(likeness int);
+      CREATE TAG INDEX person_index ON person();
+      """
+    And wait 6 seconds
+    And having executed:
+      """
+      INSERT VERTEX person(name) VALUES "1":("1"), "2":("2"), "3":("3"), "4":("4"), "5":("5"), "6":("6");
+      INSERT EDGE like(likeness) VALUES "1"->"2":(1), "2"->"3":(2), "3"->"1":(3), "3"->"4":(4), "4"->"1":(5), "5"->"6":(6), "6"->"5":(7);
+      """
+    When executing query:
+      """
+      MATCH (a:person)-[e1:like]->(b:person)-[e2:like]->(a) RETURN id(a) AS a, id(b) AS b
+      """
+    Then the result should be, in any order:
+      | a   | b   |
+      | "5" | "6" |
+      | "6" | "5" |
+    When executing query:
+      """
+      MATCH (a:person)-[e1:like]->(b:person)-[e2:like]->(c:person)-[e3:like]->(a) RETURN id(a) AS a, id(b) AS b, id(c) AS c
+      """
+    Then the result should be, in any order:
+      | a   | b   | c   |
+      | "1" | "2" | "3" |
+      | "2" | "3" | "1" |
+      | "3" | "1" | "2" |
+    When executing query:
+      """
+      MATCH (a:person)-[e1:like]->(b:person), (b)-[e2:like]->(c:person)-[e3:like]->(d:person)-[e4:like]->(a) RETURN id(a) AS a, id(b) AS b, id(c) AS c, id(d) AS d
+      """
+    Then the result should be, in any order:
+      | a   | b   | c   | d   |
+      | "1" | "2" | "3" | "4" |
+      | "2" | "3" | "4" | "1" |
+      | "3" | "4" | "1" | "2" |
+      | "4" | "1" | "2" | "3" |
+    # The plan is chosen by the estimated rows once the statistics exist, the results are the same
+    When submit a job:
+      """
+      SUBMIT JOB STATS;
+      """
+    Then wait the job to finish
+    And wait 6 seconds
+    When executing query:
+      """
+      MATCH (a:person)-[e1:like]->(b:person)-[e2:like]->(a) RETURN id(a) AS a, id(b) AS b
+      """
+    Then the result should be, in any order:
+      | a   | b   |
+      | "5" | "6" |
+      | "6" | "5" |
+    When executing query:
+      """
+      MATCH (a:person)-[e1:like]->(b:person)-[e2:like]->(c:person)-[e3:like]->(a) RETURN id(a) AS a, id(b) AS b, id(c) AS c
+      """
+    Then the result should be, in any order:
+      | a   | b   | c   |
+      | "1" | "2" | "3" |
+      | "2" | "3" | "1" |
+      | "3" | "1" | "2" |
+    When executing query:
+      """
+      MATCH (a:person)-[e1:like]->(b:person), (b)-[e2:like]->(c:person)-[e3:like]->(d:person)-[e4:like]->(a) RETURN id(a) AS a, id(b) AS b, id(c) AS c, id(d) AS d
+      """
+    Then the result should be, in any order:
+      | a   | b   | c   | d   |
+      | "1" | "2" | "3" | "4" |
+      | "2" | "3" | "4" | "1" |
+      | "3" | "4" | "1" | "2" |
+      | "4" | "1" | "2" | "3" |
+    And drop the used space
@@ -0,0 +1,79 @@
+# Copyright (c) 2023 vesoft inc. All rights reserved.
+#
+# This source code is licensed under Apache 2.0 License.
+Feature: Eliminate common sub-plans
+
+  Background:
+    Given a graph with space named "nba"
+
+  Scenario: the branches filter the shared result differently
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like WHERE like.likeness >= 90 YIELD dst(edge) AS id
+      MINUS
+      GO FROM "Tony Parker" OVER like WHERE like.likeness > 90 YIELD dst(edge) AS id
+      """
+    Then the result should be, in any order:
+      | id                  |
+      | "LaMarcus Aldridge" |
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like WHERE like.likeness > 90 YIELD dst(edge) AS id
+      UNION ALL
+      GO FROM "Tony Parker" OVER like WHERE like.likeness <= 90 YIELD dst(edge) AS id
+      """
+    Then the result should be, in any order:
+      | id                  |
+      | "Tim Duncan"        |
+      | "Manu Ginobili"     |
+      | "LaMarcus Aldridge" |
+
+  Scenario: the branches dedup or keep the shared result
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like YIELD DISTINCT like.likeness AS l
+      UNION ALL
+      GO FROM "Tony Parker" OVER like YIELD like.likeness AS l
+      """
+    Then the result should be, in any order:
+      | l  |
+      | 95 |
+      | 90 |
+      | 95 |
+      | 95 |
+      | 90 |
+
+  Scenario: both inputs of a set operation are the shared result
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like YIELD dst(edge) AS id
+      MINUS
+      GO FROM "Tony Parker" OVER like YIELD dst(edge) AS id
+      """
+    Then the result should be, in any order:
+      | id |
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like YIELD dst(edge) AS id
+      INTERSECT
+      GO FROM "Tony Parker" OVER like YIELD dst(edge) AS id
+      """
+    Then the result should be, in any order:
+      | id                  |
+      | "Tim Duncan"        |
+      | "Manu Ginobili"     |
+      | "LaMarcus Aldridge" |
+    When executing query:
+      """
+      GO FROM "Tony Parker" OVER like YIELD dst(edge) AS id
+      UNION ALL
+      GO FROM "Tony Parker" OVER like YIELD dst(edge) AS id
+      """
+    Then the result should be, in any order:
+      | id                  |
+      | "Tim Duncan"        |
+      | "Manu Ginobili"     |
+      | "LaMarcus Aldridge" |
+      | "Tim Duncan"        |
+      | "Manu Ginobili"     |
+      | "LaMarcus Aldridge" |